@@ -43,6 +43,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <iostream>
 #include <limits>
 #include <sstream>
+#include <utility>
 #include <vector>
 
 
@@ -77,8 +78,9 @@ DEFINE_string(solvers, "cg",
               "A comma-separated list of solvers to run. "
               "Supported values are: bicgstab, bicg, cb_gmres_keep, "
               "cb_gmres_reduce1, cb_gmres_reduce2, cb_gmres_integer, "
-              "cb_gmres_ireduce1, cb_gmres_ireduce2, cg, cgs, fcg, gmres, idr, "
-              "lower_trs, upper_trs, symm_direct, overhead");
+              "cb_gmres_ireduce1, cb_gmres_ireduce2, cg, cgs, chebyshev, fcg, "
+              "gmres, idr, pipe_bicgstab, pipe_cg, lower_trs, upper_trs, "
+              "symm_direct, overhead");
 
 DEFINE_uint32(
     nrhs, 1,
@@ -87,6 +89,16 @@ DEFINE_uint32(
 DEFINE_uint32(gmres_restart, 100,
               "What maximum dimension of the Krylov space to use in GMRES");
 
+DEFINE_uint32(gmres_s_step, 1,
+              "How many Krylov vectors GMRES generates and orthogonalizes "
+              "as one block, 1 disables the s-step variant");
+
+DEFINE_string(gmres_ortho, "default",
+              "The orthogonalization used in GMRES and CB-GMRES. "
+              "Supported values are: default, mgs, cgs, cgs2, "
+              "cgs_conditional, dcgs2. CB-GMRES only supports the cgs "
+              "variants");
+
 DEFINE_uint32(idr_subspace_dim, 2,
               "What dimension of the subspace to use in IDR");
 
@@ -116,6 +128,14 @@ DEFINE_string(
 DEFINE_bool(overhead, false,
             "If set, uses dummy data to benchmark Ginkgo overhead");
 
+DEFINE_bool(
+    memory_model, false,
+    "If set, reports the number of bytes each solver iteration moves "
+    "according to the solver's memory movement model (vector values plus the "
+    "measured storage of the system matrix, preconditioner storage is not "
+    "included), the bandwidth this amounts to in the timed run, and the "
+    "bandwidth of a plain vector copy on the executor for comparison.");
+
 
 // input validation
 [[noreturn]] void print_config_error_and_exit()
@@ -246,6 +266,29 @@ std::unique_ptr<gko::LinOpFactory> add_criteria_precond_finalize(
 }
 
 
+gko::solver::gmres::ortho_method get_gmres_ortho(
+    gko::solver::gmres::ortho_method default_ortho)
+{
+    using gko::solver::gmres::ortho_method;
+    if (FLAGS_gmres_ortho == "default") {
+        return default_ortho;
+    } else if (FLAGS_gmres_ortho == "mgs") {
+        return ortho_method::mgs;
+    } else if (FLAGS_gmres_ortho == "cgs") {
+        return ortho_method::cgs;
+    } else if (FLAGS_gmres_ortho == "cgs2") {
+        return ortho_method::cgs2;
+    } else if (FLAGS_gmres_ortho == "cgs_conditional") {
+        return ortho_method::cgs_conditional;
+    } else if (FLAGS_gmres_ortho == "dcgs2") {
+        return ortho_method::dcgs2;
+    }
+    throw std::range_error(
+        std::string("GMRES does not have an orthogonalization <") +
+        FLAGS_gmres_ortho + ">!");
+}
+
+
 std::unique_ptr<gko::LinOpFactory> generate_solver(
     const std::shared_ptr<const gko::Executor>& exec,
     std::shared_ptr<const gko::LinOpFactory> precond,
@@ -276,7 +319,9 @@ std::unique_ptr<gko::LinOpFactory> generate_solver(
         return add_criteria_precond_finalize(
             gko::solver::CbGmres<etype>::build()
                 .with_krylov_dim(FLAGS_gmres_restart)
-                .with_storage_precision(s_prec),
+                .with_storage_precision(s_prec)
+                .with_orthogonalization(get_gmres_ortho(
+                    gko::solver::gmres::ortho_method::cgs_conditional)),
             exec, precond, max_iters);
     } else if (description == "bicgstab") {
         return add_criteria_precond_finalize<gko::solver::Bicgstab<etype>>(
@@ -290,9 +335,18 @@ std::unique_ptr<gko::LinOpFactory> generate_solver(
     } else if (description == "cgs") {
         return add_criteria_precond_finalize<gko::solver::Cgs<etype>>(
             exec, precond, max_iters);
+    } else if (description == "chebyshev") {
+        return add_criteria_precond_finalize<gko::solver::Chebyshev<etype>>(
+            exec, precond, max_iters);
     } else if (description == "fcg") {
         return add_criteria_precond_finalize<gko::solver::Fcg<etype>>(
             exec, precond, max_iters);
+    } else if (description == "pipe_bicgstab") {
+        return add_criteria_precond_finalize<gko::solver::PipeBicgstab<etype>>(
+            exec, precond, max_iters);
+    } else if (description == "pipe_cg") {
+        return add_criteria_precond_finalize<gko::solver::PipeCg<etype>>(
+            exec, precond, max_iters);
     } else if (description == "idr") {
         return add_criteria_precond_finalize(
             gko::solver::Idr<etype>::build()
@@ -301,8 +355,11 @@ std::unique_ptr<gko::LinOpFactory> generate_solver(
             exec, precond, max_iters);
     } else if (description == "gmres") {
         return add_criteria_precond_finalize(
-            gko::solver::Gmres<etype>::build().with_krylov_dim(
-                FLAGS_gmres_restart),
+            gko::solver::Gmres<etype>::build()
+                .with_krylov_dim(FLAGS_gmres_restart)
+                .with_s_step(FLAGS_gmres_s_step)
+                .with_orthogonalization(
+                    get_gmres_ortho(gko::solver::gmres::ortho_method::mgs)),
             exec, precond, max_iters);
     } else if (description == "lower_trs") {
         return gko::solver::LowerTrs<etype>::build()
@@ -374,6 +431,89 @@ void write_precond_info(const gko::LinOp* precond,
 }
 
 
+/**
+ * Returns the number of vector values and the number of passes over the
+ * system matrix one iteration of the given solver needs, following the memory
+ * movement summaries in the solver implementations. Returns {0, 0} for solvers
+ * without such a model.
+ */
+std::pair<double, double> get_memory_model(
+    const std::string& solver_name, const std::string& precond_name,
+    std::shared_ptr<const gko::Executor> exec, const gko::LinOp* system_matrix)
+{
+    if (solver_name == "cg") {
+        // the host executors fuse the vector updates with the reductions
+        const bool fused =
+            exec == exec->get_master() && precond_name == "none" &&
+            dynamic_cast<const gko::matrix::Csr<etype, itype>*>(system_matrix);
+        return {fused ? 11.0 : 18.0, 1.0};
+    } else if (solver_name == "chebyshev") {
+        return {11.0, 1.0};
+    } else if (solver_name == "fcg") {
+        return {21.0, 1.0};
+    } else if (solver_name == "pipe_cg") {
+        return {27.0, 1.0};
+    } else if (solver_name == "bicgstab") {
+        return {31.0, 2.0};
+    } else if (solver_name == "pipe_bicgstab") {
+        return {54.0, 2.0};
+    } else if (solver_name == "bicg" || solver_name == "cgs") {
+        return {28.0, 2.0};
+    } else if (solver_name == "gmres") {
+        const double d = FLAGS_gmres_restart;
+        return {5.0 / 2.0 * d + 21.0 / 2.0 + 14.0 / d, 1.0 + 1.0 / d};
+    } else if (solver_name == "idr") {
+        const double s = FLAGS_idr_subspace_dim;
+        return {11.0 / 2.0 * s * s + 31.0 / 2.0 * s + 18.0, s + 1.0};
+    }
+    return {0.0, 0.0};
+}
+
+
+/**
+ * Measures the storage of the matrix in bytes by cloning it with an
+ * allocation logger attached.
+ */
+gko::size_type get_storage(std::shared_ptr<const gko::Executor> exec,
+                           const gko::LinOp* system_matrix)
+{
+    rapidjson::Document tmp;
+    tmp.SetObject();
+    auto storage_logger = std::make_shared<StorageLogger>();
+    exec->add_logger(storage_logger);
+    {
+        auto matrix_clone = system_matrix->clone(exec);
+    }
+    exec->remove_logger(gko::lend(storage_logger));
+    storage_logger->write_data(tmp, tmp.GetAllocator());
+    return tmp["storage"].GetUint64();
+}
+
+
+/**
+ * Measures the bandwidth of copying the vector x on its executor in bytes per
+ * the time unit of the timer.
+ */
+double get_copy_bandwidth(const vec<etype>* x)
+{
+    auto exec = x->get_executor();
+    auto src = clone(x);
+    auto dst = clone(x);
+    auto timer = get_timer(exec, FLAGS_gpu_timer);
+    IterationControl ic(timer);
+    for (auto _ : ic.warmup_run()) {
+        dst->copy_from(lend(src));
+        exec->synchronize();
+    }
+    for (auto _ : ic.run()) {
+        dst->copy_from(lend(src));
+    }
+    const auto bytes = 2.0 * sizeof(etype) * x->get_size()[0] *
+                       x->get_size()[1];
+    return bytes / ic.compute_average_time();
+}
+
+
 void solve_system(const std::string& solver_name,
                   const std::string& precond_name,
                   const char* precond_solver_name,
@@ -532,6 +672,29 @@ void solve_system(const std::string& solver_name,
                           apply_timer->compute_average_time(), allocator);
         add_or_set_member(solver_json, "repetitions",
                           apply_timer->get_num_repetitions(), allocator);
+        if (FLAGS_memory_model && !FLAGS_overhead &&
+            solver_json["apply"].HasMember("iterations") &&
+            solver_json["apply"]["iterations"].GetInt() > 0) {
+            const auto model = get_memory_model(
+                solver_name, precond_name, exec, lend(system_matrix));
+            if (model.first > 0.0) {
+                const auto num_values = static_cast<double>(
+                    b->get_size()[0] * b->get_size()[1]);
+                const auto bytes_per_iteration =
+                    model.first * num_values * sizeof(etype) +
+                    model.second * get_storage(exec, lend(system_matrix));
+                const auto time_per_iteration =
+                    apply_timer->compute_average_time() /
+                    solver_json["apply"]["iterations"].GetInt();
+                add_or_set_member(solver_json["apply"], "bytes_per_iteration",
+                                  bytes_per_iteration, allocator);
+                add_or_set_member(solver_json["apply"], "bandwidth",
+                                  bytes_per_iteration / time_per_iteration,
+                                  allocator);
+                add_or_set_member(solver_json["apply"], "copy_bandwidth",
+                                  get_copy_bandwidth(b), allocator);
+            }
+        }
 
         // compute and write benchmark data
         add_or_set_member(solver_json, "completed", true, allocator);
@@ -53,7 +53,9 @@ namespace formats {
 
 
 std::string available_format =
-    "coo, csr, ell, ell-mixed, sellp, hybrid, hybrid0, hybrid25, hybrid33, "
+    "coo, csr, csr-mixed, delta-csr, symmetric-csr, ell, ell-mixed, sellp, "
+    "sellp-mixed, sellp-sigma, hybrid, hybrid0, "
+    "hybrid25, hybrid33, "
     "hybrid40, "
     "hybrid60, hybrid80, hybridlimit0, hybridlimit25, hybridlimit33, "
     "hybridminstorage"
@@ -82,11 +84,21 @@ std::string format_description =
     "csri: Ginkgo's CSR implementation with inbalance strategy.\n"
     "csrm: Ginkgo's CSR implementation with merge_path strategy.\n"
     "csrs: Ginkgo's CSR implementation with sparselib strategy.\n"
+    "csr-mixed: Ginkgo's CSR implementation storing the values in the next\n"
+    "           lower precision.\n"
+    "delta-csr: CSR with column indices stored as 16-bit deltas to the\n"
+    "           previous column of the row.\n"
+    "symmetric-csr: CSR storing only the upper triangle of a symmetric or\n"
+    "               Hermitian matrix, the lower triangle is ignored.\n"
     "ell: Ellpack format according to Bell and Garland: Efficient Sparse\n"
     "     Matrix-Vector Multiplication on CUDA.\n"
     "ell-mixed: Mixed Precision Ellpack format according to Bell and Garland:\n"
     "           Efficient Sparse Matrix-Vector Multiplication on CUDA.\n"
     "sellp: Sliced Ellpack uses a default block size of 32.\n"
+    "sellp-mixed: Sliced Ellpack storing the values in the next lower\n"
+    "             precision.\n"
+    "sellp-sigma: SELL-C-sigma, Sliced Ellpack with rows sorted by length\n"
+    "             within windows of 8 slices.\n"
     "hybrid: Hybrid uses ELL and COO to represent the matrix.\n"
     "hybrid0, hybrid25, hybrid33, hybrid40, hybrid60, hybrid80:\n"
     "    Use 0%, 25%, ... quantiles of the row length distribution\n"
@@ -158,6 +170,7 @@ namespace formats {
 // some shortcuts
 using hybrid = gko::matrix::Hybrid<etype, itype>;
 using csr = gko::matrix::Csr<etype, itype>;
+using sellp = gko::matrix::Sellp<etype, itype>;
 
 /**
  * Creates a Ginkgo matrix from the intermediate data representation format
@@ -181,6 +194,35 @@ std::unique_ptr<MatrixType> read_matrix_from_data(
 }
 
 
+/**
+ * Creates a Ginkgo matrix storing its values in reduced precision from the
+ * intermediate data representation format gko::matrix_data.
+ *
+ * @param exec  the executor where the matrix will be put
+ * @param data  the data represented in the intermediate representation format
+ *
+ * @tparam MatrixType  the Ginkgo matrix type (such as
+ *                     `gko::matrix::Csr<gko::next_precision<etype>>`)
+ *
+ * @return a `unique_pointer` to the created matrix
+ */
+template <typename MatrixType>
+std::unique_ptr<MatrixType> read_mixed_matrix_from_data(
+    std::shared_ptr<const gko::Executor> exec,
+    const gko::matrix_data<etype, itype>& data)
+{
+    gko::matrix_data<typename MatrixType::value_type, itype> conv_data;
+    conv_data.size = data.size;
+    conv_data.nonzeros.reserve(data.nonzeros.size());
+    for (const auto& entry : data.nonzeros) {
+        conv_data.nonzeros.emplace_back(
+            entry.row, entry.column,
+            static_cast<typename MatrixType::value_type>(entry.value));
+    }
+    return read_matrix_from_data<MatrixType>(std::move(exec), conv_data);
+}
+
+
 /**
  * Creates a Ginkgo sparselib matrix from the intermediate data representation
  * format gko::matrix_data.
@@ -288,6 +330,12 @@ const std::map<std::string, std::function<std::unique_ptr<gko::LinOp>(
         {"csrm", READ_MATRIX(csr, std::make_shared<csr::merge_path>())},
         {"csrc", READ_MATRIX(csr, std::make_shared<csr::classical>())},
         {"csrs", READ_MATRIX(csr, std::make_shared<csr::sparselib>())},
+        {"csr-mixed",
+         read_mixed_matrix_from_data<
+             gko::matrix::Csr<gko::next_precision<etype>, itype>>},
+        {"delta-csr", read_matrix_from_data<gko::matrix::DeltaCsr<etype, itype>>},
+        {"symmetric-csr",
+         read_matrix_from_data<gko::matrix::SymmetricCsr<etype, itype>>},
         {"coo", read_matrix_from_data<gko::matrix::Coo<etype, itype>>},
         {"ell", [](std::shared_ptr<const gko::Executor> exec,
             const gko::matrix_data<etype, itype> &data) {
@@ -366,7 +414,14 @@ const std::map<std::string, std::function<std::unique_ptr<gko::LinOp>(
         {"hybridminstorage",
          READ_MATRIX(hybrid,
                      std::make_shared<hybrid::minimal_storage_limit>())},
-        {"sellp", read_matrix_from_data<gko::matrix::Sellp<etype, itype>>}
+        {"sellp", read_matrix_from_data<sellp>},
+        {"sellp-mixed",
+         read_mixed_matrix_from_data<
+             gko::matrix::Sellp<gko::next_precision<etype>, itype>>},
+        {"sellp-sigma",
+         READ_MATRIX(sellp, gko::dim<2>{}, gko::matrix::default_slice_size,
+                     gko::matrix::default_stride_factor,
+                     8 * gko::matrix::default_slice_size, 0)}
 };
 // clang-format on
 
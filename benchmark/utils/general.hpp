@@ -69,6 +69,14 @@ DEFINE_string(executor, "reference",
 
 DEFINE_uint32(device_id, 0, "ID of the device where to run the code");
 
+DEFINE_bool(first_touch, false,
+            "If set, the omp executor places new memory on the NUMA nodes of "
+            "the threads processing it, by first-touching it in parallel");
+
+DEFINE_bool(bind_threads, false,
+            "If set, the OpenMP threads are bound to the cores of the "
+            "machine, one thread per core");
+
 DEFINE_bool(overwrite, false,
             "If true, overwrites existing results with new ones");
 
@@ -289,11 +297,26 @@ void backup_results(rapidjson::Document& results)
 }
 
 
+// returns the allocator for the omp executor, as set by the first_touch
+// flag, and binds the OpenMP threads if requested
+std::shared_ptr<gko::CpuAllocatorBase> create_cpu_allocator()
+{
+    if (FLAGS_bind_threads) {
+        gko::machine_topology::get_instance()->bind_omp_threads_to_cores();
+    }
+    if (FLAGS_first_touch) {
+        return std::make_shared<gko::FirstTouchCpuAllocator>();
+    }
+    return std::make_shared<gko::CpuAllocator>();
+}
+
+
 // executor mapping
 const std::map<std::string, std::function<std::shared_ptr<gko::Executor>(bool)>>
     executor_factory{
         {"reference", [](bool) { return gko::ReferenceExecutor::create(); }},
-        {"omp", [](bool) { return gko::OmpExecutor::create(); }},
+        {"omp",
+         [](bool) { return gko::OmpExecutor::create(create_cpu_allocator()); }},
         {"cuda",
          [](bool) {
              return gko::CudaExecutor::create(FLAGS_device_id,
@@ -195,6 +195,9 @@ if(PAPI_sde_FOUND)
     ginkgo_print_variable(${detailed_log} "PAPI_INCLUDE_DIR")
     ginkgo_print_flags(${detailed_log} "PAPI_LIBRARY")
 endif()
+ginkgo_print_variable(${minimal_log} "GINKGO_BUILD_BLAS")
+ginkgo_print_variable(${detailed_log} "GINKGO_BUILD_BLAS")
+ginkgo_print_variable(${detailed_log} "BLAS_LIBRARIES")
 ginkgo_print_variable(${minimal_log} "GINKGO_BUILD_HWLOC")
 ginkgo_print_variable(${detailed_log} "GINKGO_BUILD_HWLOC")
 ginkgo_print_variable(${detailed_log} "HWLOC_VERSION")
@@ -0,0 +1,114 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2022, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include "core/matrix/batch_dense_kernels.hpp"
+
+
+#include <ginkgo/core/base/math.hpp>
+
+
+#include "common/unified/base/kernel_launch.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace GKO_DEVICE_NAMESPACE {
+/**
+ * @brief The BatchDense matrix format namespace.
+ *
+ * @ingroup batch_dense
+ */
+namespace batch_dense {
+
+
+template <typename ValueType>
+void simple_apply(std::shared_ptr<const DefaultExecutor> exec,
+                  const matrix::BatchDense<ValueType>* a,
+                  const matrix::Dense<ValueType>* b,
+                  matrix::Dense<ValueType>* c)
+{
+    // each row of c belongs to the batch item row / num_rows
+    run_kernel(
+        exec,
+        [] GKO_KERNEL(auto row, auto col, auto num_rows, auto num_cols,
+                      auto values, auto b, auto c) {
+            const auto item = row / num_rows;
+            // the item rows are stored consecutively without padding
+            const auto row_values = values + row * num_cols;
+            auto sum = zero(c(row, col));
+            for (int64 i = 0; i < num_cols; i++) {
+                sum += row_values[i] * b(item * num_cols + i, col);
+            }
+            c(row, col) = sum;
+        },
+        c->get_size(), static_cast<int64>(a->get_common_size()[0]),
+        static_cast<int64>(a->get_common_size()[1]), a->get_const_values(), b,
+        c);
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(
+    GKO_DECLARE_BATCH_DENSE_SIMPLE_APPLY_KERNEL);
+
+
+template <typename ValueType>
+void apply(std::shared_ptr<const DefaultExecutor> exec,
+           const matrix::Dense<ValueType>* alpha,
+           const matrix::BatchDense<ValueType>* a,
+           const matrix::Dense<ValueType>* b,
+           const matrix::Dense<ValueType>* beta, matrix::Dense<ValueType>* c)
+{
+    run_kernel(
+        exec,
+        [] GKO_KERNEL(auto row, auto col, auto alpha, auto num_rows,
+                      auto num_cols, auto values, auto b, auto beta, auto c) {
+            const auto item = row / num_rows;
+            const auto row_values = values + row * num_cols;
+            auto sum = zero(c(row, col));
+            for (int64 i = 0; i < num_cols; i++) {
+                sum += row_values[i] * b(item * num_cols + i, col);
+            }
+            c(row, col) = alpha[0] * sum + beta[0] * c(row, col);
+        },
+        c->get_size(), alpha->get_const_values(),
+        static_cast<int64>(a->get_common_size()[0]),
+        static_cast<int64>(a->get_common_size()[1]), a->get_const_values(), b,
+        beta->get_const_values(), c);
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_BATCH_DENSE_APPLY_KERNEL);
+
+
+}  // namespace batch_dense
+}  // namespace GKO_DEVICE_NAMESPACE
+}  // namespace kernels
+}  // namespace gko
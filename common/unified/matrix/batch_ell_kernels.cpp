@@ -0,0 +1,131 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2022, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include "core/matrix/batch_ell_kernels.hpp"
+
+
+#include <ginkgo/core/base/math.hpp>
+
+
+#include "common/unified/base/kernel_launch.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace GKO_DEVICE_NAMESPACE {
+/**
+ * @brief The BatchEll matrix format namespace.
+ *
+ * @ingroup batch_ell
+ */
+namespace batch_ell {
+
+
+template <typename ValueType>
+void spmv(std::shared_ptr<const DefaultExecutor> exec,
+          const matrix::BatchEll<ValueType, int32>* a,
+          const matrix::Dense<ValueType>* b, matrix::Dense<ValueType>* c)
+{
+    // each row of c belongs to the batch item row / num_rows
+    run_kernel(
+        exec,
+        [] GKO_KERNEL(auto row, auto col, auto num_rows, auto num_cols,
+                      auto num_stored_elements_per_row, auto values,
+                      auto col_idxs, auto b, auto c) {
+            const auto item = row / num_rows;
+            const auto item_row = row % num_rows;
+            const auto item_values =
+                values + item * num_rows * num_stored_elements_per_row;
+            auto sum = zero(c(row, col));
+            for (int64 i = 0; i < num_stored_elements_per_row; i++) {
+                const auto idx = item_row + i * num_rows;
+                const auto item_col = col_idxs[idx];
+                if (item_col != invalid_index<int32>()) {
+                    sum += item_values[idx] *
+                           b(item * num_cols + item_col, col);
+                }
+            }
+            c(row, col) = sum;
+        },
+        c->get_size(), static_cast<int64>(a->get_common_size()[0]),
+        static_cast<int64>(a->get_common_size()[1]),
+        static_cast<int64>(a->get_num_stored_elements_per_row()),
+        a->get_const_values(), a->get_const_col_idxs(), b, c);
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_BATCH_ELL_SPMV_KERNEL);
+
+
+template <typename ValueType>
+void advanced_spmv(std::shared_ptr<const DefaultExecutor> exec,
+                   const matrix::Dense<ValueType>* alpha,
+                   const matrix::BatchEll<ValueType, int32>* a,
+                   const matrix::Dense<ValueType>* b,
+                   const matrix::Dense<ValueType>* beta,
+                   matrix::Dense<ValueType>* c)
+{
+    run_kernel(
+        exec,
+        [] GKO_KERNEL(auto row, auto col, auto alpha, auto num_rows,
+                      auto num_cols, auto num_stored_elements_per_row,
+                      auto values, auto col_idxs, auto b, auto beta, auto c) {
+            const auto item = row / num_rows;
+            const auto item_row = row % num_rows;
+            const auto item_values =
+                values + item * num_rows * num_stored_elements_per_row;
+            auto sum = zero(c(row, col));
+            for (int64 i = 0; i < num_stored_elements_per_row; i++) {
+                const auto idx = item_row + i * num_rows;
+                const auto item_col = col_idxs[idx];
+                if (item_col != invalid_index<int32>()) {
+                    sum += item_values[idx] *
+                           b(item * num_cols + item_col, col);
+                }
+            }
+            c(row, col) = alpha[0] * sum + beta[0] * c(row, col);
+        },
+        c->get_size(), alpha->get_const_values(),
+        static_cast<int64>(a->get_common_size()[0]),
+        static_cast<int64>(a->get_common_size()[1]),
+        static_cast<int64>(a->get_num_stored_elements_per_row()),
+        a->get_const_values(), a->get_const_col_idxs(), b,
+        beta->get_const_values(), c);
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_BATCH_ELL_ADVANCED_SPMV_KERNEL);
+
+
+}  // namespace batch_ell
+}  // namespace GKO_DEVICE_NAMESPACE
+}  // namespace kernels
+}  // namespace gko
@@ -133,6 +133,58 @@ void inv_scale(std::shared_ptr<const DefaultExecutor> exec,
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_CSR_INV_SCALE_KERNEL);
 
 
+template <typename ValueType, typename IndexType>
+void spgemm_numeric(std::shared_ptr<const DefaultExecutor> exec,
+                    const matrix::Csr<ValueType, IndexType>* a,
+                    const matrix::Csr<ValueType, IndexType>* b,
+                    matrix::Csr<ValueType, IndexType>* c)
+{
+    run_kernel(
+        exec,
+        [] GKO_KERNEL(auto row, auto a_row_ptrs, auto a_cols, auto a_vals,
+                      auto b_row_ptrs, auto b_cols, auto b_vals,
+                      auto c_row_ptrs, auto c_cols, auto c_vals) {
+            const auto c_begin = c_row_ptrs[row];
+            const auto c_end = c_row_ptrs[row + 1];
+            for (auto c_nz = c_begin; c_nz < c_end; c_nz++) {
+                c_vals[c_nz] = zero(c_vals[c_nz]);
+            }
+            for (auto a_nz = a_row_ptrs[row]; a_nz < a_row_ptrs[row + 1];
+                 a_nz++) {
+                const auto a_val = a_vals[a_nz];
+                const auto b_row = a_cols[a_nz];
+                // the columns of B are sorted, so the search range for the
+                // next output column starts after the previous one
+                auto lo = c_begin;
+                for (auto b_nz = b_row_ptrs[b_row];
+                     b_nz < b_row_ptrs[b_row + 1]; b_nz++) {
+                    const auto col = b_cols[b_nz];
+                    auto hi = c_end;
+                    while (lo < hi) {
+                        const auto mid = lo + (hi - lo) / 2;
+                        if (c_cols[mid] < col) {
+                            lo = mid + 1;
+                        } else {
+                            hi = mid;
+                        }
+                    }
+                    // entries outside of the output pattern are dropped
+                    if (lo < c_end && c_cols[lo] == col) {
+                        c_vals[lo] += a_val * b_vals[b_nz];
+                    }
+                }
+            }
+        },
+        c->get_size()[0], a->get_const_row_ptrs(), a->get_const_col_idxs(),
+        a->get_const_values(), b->get_const_row_ptrs(), b->get_const_col_idxs(),
+        b->get_const_values(), c->get_const_row_ptrs(), c->get_const_col_idxs(),
+        c->get_values());
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_CSR_SPGEMM_NUMERIC_KERNEL);
+
+
 template <typename ValueType, typename IndexType>
 void convert_to_sellp(std::shared_ptr<const DefaultExecutor> exec,
                       const matrix::Csr<ValueType, IndexType>* matrix,
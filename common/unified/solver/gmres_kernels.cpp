@@ -38,6 +38,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 
 #include "common/unified/base/kernel_launch.hpp"
+#include "common/unified/base/kernel_launch_reduction.hpp"
 
 
 namespace gko {
@@ -124,6 +125,76 @@ void multi_axpy(std::shared_ptr<const DefaultExecutor> exec,
 GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_GMRES_MULTI_AXPY_KERNEL);
 
 
+template <typename ValueType>
+void multi_dot(std::shared_ptr<const DefaultExecutor> exec,
+               const matrix::Dense<ValueType>* krylov_bases,
+               const matrix::Dense<ValueType>* block,
+               matrix::Dense<ValueType>* result, array<char>& tmp)
+{
+    // the reduction writes one entry per dot product, so result needs to be
+    // stored contiguously, i.e. with stride equal to its number of columns
+    const auto num_rhs = static_cast<int64>(block->get_size()[1]);
+    const auto block_size = static_cast<int64>(result->get_size()[1]) / num_rhs;
+    const auto num_rows = static_cast<int64>(block->get_size()[0]) / block_size;
+    run_kernel_col_reduction_cached(
+        exec,
+        [] GKO_KERNEL(auto row, auto col, auto bases, auto block, auto num_rows,
+                      auto block_size, auto num_rhs) {
+            const auto i = col / (block_size * num_rhs);
+            const auto k = col % (block_size * num_rhs) / num_rhs;
+            const auto rhs = col % num_rhs;
+            return conj(bases(i * num_rows + row, rhs)) *
+                   block(k * num_rows + row, rhs);
+        },
+        GKO_KERNEL_REDUCE_SUM(ValueType), result->get_values(),
+        dim<2>{static_cast<size_type>(num_rows),
+               result->get_size()[0] * result->get_size()[1]},
+        tmp, krylov_bases, block, num_rows, block_size, num_rhs);
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_GMRES_MULTI_DOT_KERNEL);
+
+
+template <typename ValueType>
+void multi_update(std::shared_ptr<const DefaultExecutor> exec,
+                  const matrix::Dense<ValueType>* krylov_bases,
+                  const matrix::Dense<ValueType>* coeffs,
+                  const matrix::Dense<ValueType>* triangular,
+                  matrix::Dense<ValueType>* block)
+{
+    const auto num_rhs = static_cast<int64>(block->get_size()[1]);
+    const auto num_bases = static_cast<int64>(coeffs->get_size()[0]);
+    const auto block_size = static_cast<int64>(triangular->get_size()[0]);
+    const auto num_rows = static_cast<int64>(block->get_size()[0]) / block_size;
+    run_kernel(
+        exec,
+        [] GKO_KERNEL(auto row, auto rhs, auto bases, auto coeffs,
+                      auto triangular, auto block, auto num_rows,
+                      auto num_bases, auto block_size, auto num_rhs) {
+            // triangular is upper triangular, so going backwards allows
+            // updating the block in-place
+            for (auto k = block_size - 1; k >= 0; k--) {
+                auto value = zero(block(row, rhs));
+                for (decltype(k) l = 0; l <= k; l++) {
+                    value += block(l * num_rows + row, rhs) *
+                             triangular(l, k * num_rhs + rhs);
+                }
+                for (decltype(k) i = 0; i < num_bases; i++) {
+                    value -= bases(i * num_rows + row, rhs) *
+                             coeffs(i, k * num_rhs + rhs);
+                }
+                block(k * num_rows + row, rhs) = value;
+            }
+        },
+        dim<2>{static_cast<size_type>(num_rows),
+               static_cast<size_type>(num_rhs)},
+        krylov_bases, coeffs, triangular, block, num_rows, num_bases,
+        block_size, num_rhs);
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_GMRES_MULTI_UPDATE_KERNEL);
+
+
 }  // namespace gmres
 }  // namespace GKO_DEVICE_NAMESPACE
 }  // namespace kernels
@@ -0,0 +1,246 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2022, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include "core/solver/pipe_bicgstab_kernels.hpp"
+
+
+#include <ginkgo/core/base/math.hpp>
+
+
+#include "common/unified/base/kernel_launch_solver.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace GKO_DEVICE_NAMESPACE {
+/**
+ * @brief The pipelined BICGSTAB solver namespace.
+ *
+ * @ingroup pipe_bicgstab
+ */
+namespace pipe_bicgstab {
+
+
+template <typename ValueType>
+void initialize(std::shared_ptr<const DefaultExecutor> exec,
+                const matrix::Dense<ValueType>* b, matrix::Dense<ValueType>* r,
+                matrix::Dense<ValueType>* p, matrix::Dense<ValueType>* s,
+                matrix::Dense<ValueType>* ps, matrix::Dense<ValueType>* z,
+                matrix::Dense<ValueType>* pz, matrix::Dense<ValueType>* v,
+                matrix::Dense<ValueType>* prev_rho,
+                matrix::Dense<ValueType>* alpha,
+                matrix::Dense<ValueType>* beta,
+                matrix::Dense<ValueType>* omega,
+                array<stopping_status>* stop_status)
+{
+    if (b->get_size()) {
+        run_kernel_solver(
+            exec,
+            [] GKO_KERNEL(auto row, auto col, auto b, auto r, auto p, auto s,
+                          auto ps, auto z, auto pz, auto v, auto prev_rho,
+                          auto alpha, auto beta, auto omega, auto stop) {
+                if (row == 0) {
+                    prev_rho[col] = beta[col] = zero(prev_rho[col]);
+                    alpha[col] = omega[col] = one(alpha[col]);
+                    stop[col].reset();
+                }
+                r(row, col) = b(row, col);
+                p(row, col) = s(row, col) = ps(row, col) = z(row, col) =
+                    pz(row, col) = v(row, col) = zero(p(row, col));
+            },
+            b->get_size(), b->get_stride(), b, default_stride(r),
+            default_stride(p), default_stride(s), default_stride(ps),
+            default_stride(z), default_stride(pz), default_stride(v),
+            row_vector(prev_rho), row_vector(alpha), row_vector(beta),
+            row_vector(omega), *stop_status);
+    } else {
+        run_kernel(
+            exec,
+            [] GKO_KERNEL(auto col, auto prev_rho, auto alpha, auto beta,
+                          auto omega, auto stop) {
+                prev_rho[col] = beta[col] = zero(prev_rho[col]);
+                alpha[col] = omega[col] = one(alpha[col]);
+                stop[col].reset();
+            },
+            b->get_size()[1], row_vector(prev_rho), row_vector(alpha),
+            row_vector(beta), row_vector(omega), *stop_status);
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(
+    GKO_DECLARE_PIPE_BICGSTAB_INITIALIZE_KERNEL);
+
+
+template <typename ValueType>
+void step_1(std::shared_ptr<const DefaultExecutor> exec,
+            const matrix::Dense<ValueType>* r,
+            const matrix::Dense<ValueType>* pr,
+            const matrix::Dense<ValueType>* w,
+            const matrix::Dense<ValueType>* pw,
+            const matrix::Dense<ValueType>* t, matrix::Dense<ValueType>* p,
+            matrix::Dense<ValueType>* s, matrix::Dense<ValueType>* ps,
+            matrix::Dense<ValueType>* z, const matrix::Dense<ValueType>* pz,
+            const matrix::Dense<ValueType>* v, matrix::Dense<ValueType>* q,
+            matrix::Dense<ValueType>* pq, matrix::Dense<ValueType>* y,
+            const matrix::Dense<ValueType>* alpha,
+            const matrix::Dense<ValueType>* beta,
+            const matrix::Dense<ValueType>* omega,
+            const array<stopping_status>* stop_status)
+{
+    run_kernel_solver(
+        exec,
+        [] GKO_KERNEL(auto row, auto col, auto r, auto pr, auto w, auto pw,
+                      auto t, auto p, auto s, auto ps, auto z, auto pz, auto v,
+                      auto q, auto pq, auto y, auto alpha, auto beta,
+                      auto omega, auto stop) {
+            if (!stop[col].has_stopped()) {
+                const auto tmp_p =
+                    pr(row, col) +
+                    beta[col] * (p(row, col) - omega[col] * ps(row, col));
+                const auto tmp_s =
+                    w(row, col) +
+                    beta[col] * (s(row, col) - omega[col] * z(row, col));
+                const auto tmp_ps =
+                    pw(row, col) +
+                    beta[col] * (ps(row, col) - omega[col] * pz(row, col));
+                const auto tmp_z =
+                    t(row, col) +
+                    beta[col] * (z(row, col) - omega[col] * v(row, col));
+                p(row, col) = tmp_p;
+                s(row, col) = tmp_s;
+                ps(row, col) = tmp_ps;
+                z(row, col) = tmp_z;
+                q(row, col) = r(row, col) - alpha[col] * tmp_s;
+                pq(row, col) = pr(row, col) - alpha[col] * tmp_ps;
+                y(row, col) = w(row, col) - alpha[col] * tmp_z;
+            }
+        },
+        r->get_size(), r->get_stride(), default_stride(r), default_stride(pr),
+        default_stride(w), default_stride(pw), default_stride(t),
+        default_stride(p), default_stride(s), default_stride(ps),
+        default_stride(z), default_stride(pz), default_stride(v),
+        default_stride(q), default_stride(pq), default_stride(y),
+        row_vector(alpha), row_vector(beta), row_vector(omega), *stop_status);
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_PIPE_BICGSTAB_STEP_1_KERNEL);
+
+
+template <typename ValueType>
+void step_2(std::shared_ptr<const DefaultExecutor> exec,
+            matrix::Dense<ValueType>* x, matrix::Dense<ValueType>* r,
+            matrix::Dense<ValueType>* pr, matrix::Dense<ValueType>* w,
+            const matrix::Dense<ValueType>* pw,
+            const matrix::Dense<ValueType>* t,
+            const matrix::Dense<ValueType>* p,
+            const matrix::Dense<ValueType>* q,
+            const matrix::Dense<ValueType>* pq,
+            const matrix::Dense<ValueType>* y,
+            const matrix::Dense<ValueType>* pz,
+            const matrix::Dense<ValueType>* v,
+            const matrix::Dense<ValueType>* qy,
+            const matrix::Dense<ValueType>* yy,
+            const matrix::Dense<ValueType>* alpha,
+            matrix::Dense<ValueType>* omega,
+            const array<stopping_status>* stop_status)
+{
+    run_kernel_solver(
+        exec,
+        [] GKO_KERNEL(auto row, auto col, auto x, auto r, auto pr, auto w,
+                      auto pw, auto t, auto p, auto q, auto pq, auto y,
+                      auto pz, auto v, auto qy, auto yy, auto alpha,
+                      auto omega, auto stop) {
+            if (!stop[col].has_stopped()) {
+                auto tmp = safe_divide(qy[col], yy[col]);
+                if (row == 0) {
+                    omega[col] = tmp;
+                }
+                x(row, col) += alpha[col] * p(row, col) + tmp * pq(row, col);
+                r(row, col) = q(row, col) - tmp * y(row, col);
+                pr(row, col) =
+                    pq(row, col) -
+                    tmp * (pw(row, col) - alpha[col] * pz(row, col));
+                w(row, col) =
+                    y(row, col) -
+                    tmp * (t(row, col) - alpha[col] * v(row, col));
+            }
+        },
+        x->get_size(), r->get_stride(), x, default_stride(r),
+        default_stride(pr), default_stride(w), default_stride(pw),
+        default_stride(t), default_stride(p), default_stride(q),
+        default_stride(pq), default_stride(y), default_stride(pz),
+        default_stride(v), row_vector(qy), row_vector(yy), row_vector(alpha),
+        row_vector(omega), *stop_status);
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_PIPE_BICGSTAB_STEP_2_KERNEL);
+
+
+template <typename ValueType>
+void step_3(std::shared_ptr<const DefaultExecutor> exec,
+            const matrix::Dense<ValueType>* rho,
+            const matrix::Dense<ValueType>* rw,
+            const matrix::Dense<ValueType>* rs,
+            const matrix::Dense<ValueType>* rz,
+            matrix::Dense<ValueType>* prev_rho, matrix::Dense<ValueType>* alpha,
+            matrix::Dense<ValueType>* beta,
+            const matrix::Dense<ValueType>* omega,
+            const array<stopping_status>* stop_status)
+{
+    run_kernel(
+        exec,
+        [] GKO_KERNEL(auto col, auto rho, auto rw, auto rs, auto rz,
+                      auto prev_rho, auto alpha, auto beta, auto omega,
+                      auto stop) {
+            if (!stop[col].has_stopped()) {
+                auto tmp_beta = safe_divide(rho[col], prev_rho[col]) *
+                                safe_divide(alpha[col], omega[col]);
+                beta[col] = tmp_beta;
+                alpha[col] = safe_divide(
+                    rho[col], rw[col] + tmp_beta * (rs[col] -
+                                                    omega[col] * rz[col]));
+                prev_rho[col] = rho[col];
+            }
+        },
+        rho->get_size()[1], row_vector(rho), row_vector(rw), row_vector(rs),
+        row_vector(rz), row_vector(prev_rho), row_vector(alpha),
+        row_vector(beta), row_vector(omega), *stop_status);
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_PIPE_BICGSTAB_STEP_3_KERNEL);
+
+
+}  // namespace pipe_bicgstab
+}  // namespace GKO_DEVICE_NAMESPACE
+}  // namespace kernels
+}  // namespace gko
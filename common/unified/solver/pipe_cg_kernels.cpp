@@ -0,0 +1,174 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2022, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include "core/solver/pipe_cg_kernels.hpp"
+
+
+#include <ginkgo/core/base/math.hpp>
+
+
+#include "common/unified/base/kernel_launch_solver.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace GKO_DEVICE_NAMESPACE {
+/**
+ * @brief The pipelined CG solver namespace.
+ *
+ * @ingroup pipe_cg
+ */
+namespace pipe_cg {
+
+
+template <typename ValueType>
+void initialize(std::shared_ptr<const DefaultExecutor> exec,
+                const matrix::Dense<ValueType>* b, matrix::Dense<ValueType>* r,
+                matrix::Dense<ValueType>* p, matrix::Dense<ValueType>* q,
+                matrix::Dense<ValueType>* s, matrix::Dense<ValueType>* z,
+                matrix::Dense<ValueType>* prev_rho,
+                matrix::Dense<ValueType>* alpha,
+                matrix::Dense<ValueType>* beta,
+                array<stopping_status>* stop_status)
+{
+    if (b->get_size()) {
+        run_kernel_solver(
+            exec,
+            [] GKO_KERNEL(auto row, auto col, auto b, auto r, auto p, auto q,
+                          auto s, auto z, auto prev_rho, auto alpha, auto beta,
+                          auto stop) {
+                if (row == 0) {
+                    prev_rho[col] = beta[col] = zero(prev_rho[col]);
+                    alpha[col] = one(alpha[col]);
+                    stop[col].reset();
+                }
+                r(row, col) = b(row, col);
+                p(row, col) = q(row, col) = s(row, col) = z(row, col) =
+                    zero(p(row, col));
+            },
+            b->get_size(), b->get_stride(), b, default_stride(r),
+            default_stride(p), default_stride(q), default_stride(s),
+            default_stride(z), row_vector(prev_rho), row_vector(alpha),
+            row_vector(beta), *stop_status);
+    } else {
+        run_kernel(
+            exec,
+            [] GKO_KERNEL(auto col, auto prev_rho, auto alpha, auto beta,
+                          auto stop) {
+                prev_rho[col] = beta[col] = zero(prev_rho[col]);
+                alpha[col] = one(alpha[col]);
+                stop[col].reset();
+            },
+            b->get_size()[1], row_vector(prev_rho), row_vector(alpha),
+            row_vector(beta), *stop_status);
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_PIPE_CG_INITIALIZE_KERNEL);
+
+
+template <typename ValueType>
+void step_1(std::shared_ptr<const DefaultExecutor> exec,
+            const matrix::Dense<ValueType>* rho,
+            const matrix::Dense<ValueType>* delta,
+            matrix::Dense<ValueType>* prev_rho, matrix::Dense<ValueType>* alpha,
+            matrix::Dense<ValueType>* beta,
+            const array<stopping_status>* stop_status)
+{
+    run_kernel(
+        exec,
+        [] GKO_KERNEL(auto col, auto rho, auto delta, auto prev_rho,
+                      auto alpha, auto beta, auto stop) {
+            if (!stop[col].has_stopped()) {
+                auto tmp_beta = safe_divide(rho[col], prev_rho[col]);
+                auto denom = delta[col];
+                if (is_nonzero(tmp_beta)) {
+                    denom -= tmp_beta * safe_divide(rho[col], alpha[col]);
+                }
+                beta[col] = tmp_beta;
+                alpha[col] = safe_divide(rho[col], denom);
+                prev_rho[col] = rho[col];
+            }
+        },
+        rho->get_size()[1], row_vector(rho), row_vector(delta),
+        row_vector(prev_rho), row_vector(alpha), row_vector(beta),
+        *stop_status);
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_PIPE_CG_STEP_1_KERNEL);
+
+
+template <typename ValueType>
+void step_2(std::shared_ptr<const DefaultExecutor> exec,
+            matrix::Dense<ValueType>* x, matrix::Dense<ValueType>* r,
+            matrix::Dense<ValueType>* u, matrix::Dense<ValueType>* w,
+            const matrix::Dense<ValueType>* m,
+            const matrix::Dense<ValueType>* n, matrix::Dense<ValueType>* p,
+            matrix::Dense<ValueType>* q, matrix::Dense<ValueType>* s,
+            matrix::Dense<ValueType>* z, const matrix::Dense<ValueType>* alpha,
+            const matrix::Dense<ValueType>* beta,
+            const array<stopping_status>* stop_status)
+{
+    run_kernel_solver(
+        exec,
+        [] GKO_KERNEL(auto row, auto col, auto x, auto r, auto u, auto w,
+                      auto m, auto n, auto p, auto q, auto s, auto z,
+                      auto alpha, auto beta, auto stop) {
+            if (!stop[col].has_stopped()) {
+                const auto tmp_z = n(row, col) + beta[col] * z(row, col);
+                const auto tmp_q = m(row, col) + beta[col] * q(row, col);
+                const auto tmp_s = w(row, col) + beta[col] * s(row, col);
+                const auto tmp_p = u(row, col) + beta[col] * p(row, col);
+                z(row, col) = tmp_z;
+                q(row, col) = tmp_q;
+                s(row, col) = tmp_s;
+                p(row, col) = tmp_p;
+                x(row, col) += alpha[col] * tmp_p;
+                r(row, col) -= alpha[col] * tmp_s;
+                u(row, col) -= alpha[col] * tmp_q;
+                w(row, col) -= alpha[col] * tmp_z;
+            }
+        },
+        x->get_size(), r->get_stride(), x, default_stride(r), default_stride(u),
+        default_stride(w), default_stride(m), default_stride(n),
+        default_stride(p), default_stride(q), default_stride(s),
+        default_stride(z), row_vector(alpha), row_vector(beta), *stop_status);
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_PIPE_CG_STEP_2_KERNEL);
+
+
+}  // namespace pipe_cg
+}  // namespace GKO_DEVICE_NAMESPACE
+}  // namespace kernels
+}  // namespace gko
@@ -57,6 +57,16 @@ using compiled_kernels = syn::value_list<int, 2, 3, 4, 7>;
 #endif
 
 
+/**
+ * A compile-time list of block sizes for which the host executors (Reference
+ * and OpenMP) provide dedicated fixed-block kernels. It contains all
+ * compiled_kernels and additional block sizes that are cheap to instantiate
+ * only on the host.
+ */
+using host_kernels =
+    syn::concatenate<compiled_kernels, syn::value_list<int, 5, 6, 8>>;
+
+
 }  // namespace fixedblock
 }  // namespace gko
 
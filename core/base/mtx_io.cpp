@@ -35,20 +35,53 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <algorithm>
 #include <cctype>
+#include <cstdlib>
 #include <cstring>
+#include <exception>
+#include <fstream>
+#include <iterator>
 #include <limits>
 #include <map>
+#include <numeric>
 #include <regex>
 #include <string>
+#include <thread>
+#include <tuple>
 #include <type_traits>
+#include <vector>
+
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 
 #include <ginkgo/core/base/exception_helpers.hpp>
 #include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/temporary_clone.hpp>
 #include <ginkgo/core/base/utils.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/csr_stream_builder.hpp>
+
+
+#include "core/base/device_matrix_data_kernels.hpp"
 
 
 namespace gko {
+namespace components {
+namespace {
+
+
+GKO_REGISTER_OPERATION(aos_to_soa, components::aos_to_soa);
+
+
+}  // anonymous namespace
+}  // namespace components
+
+
 namespace {
 
 
@@ -65,6 +98,297 @@ namespace {
     }
 
 
+/**
+ * Runs `fn(thread_id)` for all thread ids in [0, num_threads) on separate
+ * threads, the first one on the calling thread. If any of the calls throws,
+ * the exception of the call with the lowest thread id is rethrown after all
+ * threads have finished.
+ */
+template <typename Function>
+void run_threads(size_type num_threads, Function fn)
+{
+    std::vector<std::exception_ptr> errors(num_threads);
+    const auto guarded_fn = [&](size_type tid) {
+        try {
+            fn(tid);
+        } catch (...) {
+            errors[tid] = std::current_exception();
+        }
+    };
+    std::vector<std::thread> threads;
+    threads.reserve(num_threads);
+    try {
+        for (size_type tid = 1; tid < num_threads; tid++) {
+            threads.emplace_back(guarded_fn, tid);
+        }
+    } catch (...) {
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        throw;
+    }
+    guarded_fn(0);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (const auto& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+
+/**
+ * Returns the number of threads to use for the parallel parser, given the
+ * number of threads requested by the user and the amount of text to parse.
+ * If no number of threads was requested (0), the hardware threads are used,
+ * but only as many as are worthwhile for the amount of text.
+ */
+size_type get_num_parser_threads(size_type requested, size_type num_bytes)
+{
+    if (requested > 0) {
+        return requested;
+    }
+    // smaller chunks are not worth the thread creation
+    constexpr size_type min_chunk_size = 1 << 20;
+    const auto max_threads = std::max<size_type>(num_bytes / min_chunk_size, 1);
+    return std::min<size_type>(
+        std::max<size_type>(std::thread::hardware_concurrency(), 1),
+        max_threads);
+}
+
+
+bool is_blank(char c)
+{
+    return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+
+bool is_digit(char c) { return c >= '0' && c <= '9'; }
+
+
+/**
+ * Splits the text [begin, end) into num_chunks chunks of roughly the same
+ * size, which only contain complete lines.
+ *
+ * @return the num_chunks + 1 boundaries of the chunks.
+ */
+std::vector<const char*> split_lines(const char* begin, const char* end,
+                                     size_type num_chunks)
+{
+    std::vector<const char*> bounds(num_chunks + 1, end);
+    bounds[0] = begin;
+    const auto chunk_size = (end - begin) / num_chunks;
+    for (size_type chunk = 1; chunk < num_chunks; chunk++) {
+        const auto pos = std::max(bounds[chunk - 1], begin + chunk * chunk_size);
+        const auto line_end = std::find(pos, end, '\n');
+        bounds[chunk] = line_end == end ? end : line_end + 1;
+    }
+    return bounds;
+}
+
+
+/**
+ * Calls `fn(line_begin, line_end)` for every line in [begin, end) that is not
+ * blank. `line_end` points to the end of the line, excluding the line break.
+ */
+template <typename Function>
+void for_each_line(const char* begin, const char* end, Function fn)
+{
+    while (begin < end) {
+        const auto line_end = std::find(begin, end, '\n');
+        if (std::find_if_not(begin, line_end, is_blank) != line_end) {
+            fn(begin, line_end);
+        }
+        begin = line_end + 1;
+    }
+}
+
+
+/**
+ * Parses a positive decimal integer at `pos`, skipping preceding blanks, and
+ * advances `pos` behind it.
+ *
+ * @return true if the next token is an integer fitting into IndexType.
+ */
+template <typename IndexType>
+bool parse_index(const char*& pos, const char* end, IndexType& result)
+{
+    // more digits could overflow the accumulation
+    constexpr int max_digits = 18;
+    pos = std::find_if_not(pos, end, is_blank);
+    if (pos != end && *pos == '+') {
+        ++pos;
+    }
+    const auto begin = pos;
+    uint64 value{};
+    for (; pos != end && is_digit(*pos) && pos - begin < max_digits; ++pos) {
+        value = value * 10 + (*pos - '0');
+    }
+    if (pos == begin || (pos != end && !is_blank(*pos)) ||
+        value > static_cast<uint64>(std::numeric_limits<IndexType>::max())) {
+        return false;
+    }
+    result = static_cast<IndexType>(value);
+    return true;
+}
+
+
+/**
+ * Parses a decimal floating point number at `pos`, skipping preceding blanks,
+ * and advances `pos` behind it. Numbers with at most 19 significant digits and
+ * small exponents are converted directly, which is exact as long as the
+ * mantissa and power of ten are exactly representable. All other numbers are
+ * converted by std::strtod.
+ *
+ * @return true if the next token is a floating point number.
+ */
+bool parse_double(const char*& pos, const char* end, double& result)
+{
+    constexpr double powers_of_ten[] = {
+        1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+    constexpr int max_power = 22;
+    constexpr int max_digits = 19;
+    constexpr uint64 max_exact_mantissa = uint64{1} << 53;
+    pos = std::find_if_not(pos, end, is_blank);
+    const auto token_begin = pos;
+    const auto token_end = std::find_if(pos, end, [](char c) {
+        return is_blank(c) || c == '\n';
+    });
+    if (token_begin == token_end) {
+        return false;
+    }
+    auto it = token_begin;
+    const bool negative = *it == '-';
+    if (*it == '-' || *it == '+') {
+        ++it;
+    }
+    uint64 mantissa{};
+    int num_digits{};
+    int exponent{};
+    bool has_digits = false;
+    for (; it != token_end && is_digit(*it); ++it, has_digits = true) {
+        mantissa = mantissa * 10 + (*it - '0');
+        num_digits += mantissa > 0;
+    }
+    if (it != token_end && *it == '.') {
+        for (++it; it != token_end && is_digit(*it); ++it, has_digits = true) {
+            mantissa = mantissa * 10 + (*it - '0');
+            num_digits += mantissa > 0;
+            exponent--;
+        }
+    }
+    if (has_digits && it != token_end && (*it == 'e' || *it == 'E')) {
+        ++it;
+        const bool negative_exponent = it != token_end && *it == '-';
+        if (it != token_end && (*it == '-' || *it == '+')) {
+            ++it;
+        }
+        int explicit_exponent{};
+        const auto exponent_begin = it;
+        // longer exponents are handled by strtod
+        for (; it != token_end && is_digit(*it) && it - exponent_begin < 4;
+             ++it) {
+            explicit_exponent = explicit_exponent * 10 + (*it - '0');
+        }
+        if (it == exponent_begin) {
+            return false;
+        }
+        exponent += negative_exponent ? -explicit_exponent : explicit_exponent;
+    }
+    if (has_digits && it == token_end && num_digits <= max_digits &&
+        mantissa <= max_exact_mantissa && exponent >= -max_power &&
+        exponent <= max_power) {
+        auto value = static_cast<double>(mantissa);
+        value = exponent < 0 ? value / powers_of_ten[-exponent]
+                             : value * powers_of_ten[exponent];
+        result = negative ? -value : value;
+        pos = token_end;
+        return true;
+    }
+    // the slow path needs a null-terminated copy of the token
+    const std::string token{token_begin, token_end};
+    char* parsed_end{};
+    result = std::strtod(token.c_str(), &parsed_end);
+    pos = token_end;
+    return parsed_end == token.c_str() + token.size();
+}
+
+
+/**
+ * Returns the end of the matrix market header in [begin, end), i.e. the
+ * beginning of the first line after the dimensions line. It follows the same
+ * rules as mtx_io::read_header.
+ */
+const char* find_header_end(const char* begin, const char* end)
+{
+    const auto next_line = [end](const char* pos) {
+        const auto line_end = std::find(pos, end, '\n');
+        return line_end == end ? end : line_end + 1;
+    };
+    auto pos = begin;
+    // the description line is the first non-empty line
+    while (pos != end && *pos == '\n') {
+        pos = next_line(pos);
+    }
+    pos = next_line(pos);
+    // the dimensions line is the first line after it not starting with %
+    while (pos != end && *pos == '%') {
+        pos = next_line(pos);
+    }
+    return next_line(pos);
+}
+
+
+/**
+ * Sorts the entries in row-major order, using num_threads threads.
+ */
+template <typename ValueType, typename IndexType>
+void ensure_row_major_order(matrix_data<ValueType, IndexType>& data,
+                            size_type num_threads)
+{
+    using nonzero_type = matrix_data_entry<ValueType, IndexType>;
+    const auto less = [](const nonzero_type& x, const nonzero_type& y) {
+        return std::tie(x.row, x.column) < std::tie(y.row, y.column);
+    };
+    auto& nonzeros = data.nonzeros;
+    const auto size = nonzeros.size();
+    num_threads = std::max<size_type>(std::min(num_threads, size), 1);
+    std::vector<size_type> bounds(num_threads + 1);
+    for (size_type i = 0; i <= num_threads; i++) {
+        bounds[i] = size * i / num_threads;
+    }
+    std::vector<char> sorted(num_threads);
+    run_threads(num_threads, [&](size_type tid) {
+        // include the first element of the next chunk
+        const auto chunk_end = std::min(bounds[tid + 1] + 1, size);
+        sorted[tid] = std::is_sorted(nonzeros.begin() + bounds[tid],
+                                     nonzeros.begin() + chunk_end, less);
+    });
+    if (std::all_of(sorted.begin(), sorted.end(), [](char s) { return s; })) {
+        return;
+    }
+    run_threads(num_threads, [&](size_type tid) {
+        std::sort(nonzeros.begin() + bounds[tid],
+                  nonzeros.begin() + bounds[tid + 1], less);
+    });
+    // merge pairs of sorted chunks until only one is left
+    for (size_type width = 1; width < num_threads; width *= 2) {
+        const auto num_merges = (num_threads + 2 * width - 1) / (2 * width);
+        run_threads(num_merges, [&](size_type merge) {
+            const auto first = merge * 2 * width;
+            const auto middle = std::min(first + width, num_threads);
+            const auto last = std::min(first + 2 * width, num_threads);
+            std::inplace_merge(nonzeros.begin() + bounds[first],
+                               nonzeros.begin() + bounds[middle],
+                               nonzeros.begin() + bounds[last], less);
+        });
+    }
+}
+
+
 /**
  * The mtx_io class provides the functionality of reading and writing matrix
  * market format files.
@@ -102,6 +426,31 @@ public:
         return data;
     }
 
+    /**
+     * Reads a matrix from a text in memory, using multiple threads.
+     *
+     * @param begin  the beginning of the text.
+     * @param end  the end of the text.
+     * @param num_threads  the number of threads to use, 0 for automatic.
+     *
+     * @return the matrix data.
+     */
+    matrix_data<ValueType, IndexType> read(const char* begin, const char* end,
+                                           size_type num_threads) const
+    {
+        const auto content_begin = find_header_end(begin, end);
+        std::istringstream header_stream(std::string(begin, content_begin));
+        auto parsed_header = this->read_header(header_stream);
+        std::istringstream dimensions_stream(parsed_header.dimensions_line);
+        num_threads = get_num_parser_threads(
+            num_threads, static_cast<size_type>(end - content_begin));
+        auto data = parsed_header.layout->read_data(
+            dimensions_stream, content_begin, end, parsed_header.entry,
+            parsed_header.modifier, num_threads);
+        ensure_row_major_order(data, num_threads);
+        return data;
+    }
+
     /**
      * Writes a matrix to a stream.
      *
@@ -127,6 +476,8 @@ private:
      */
     struct entry_format {
         virtual ValueType read_entry(std::istream& is) const = 0;
+        virtual ValueType parse_entry(const char*& pos,
+                                      const char* end) const = 0;
         virtual void write_entry(std::ostream& os,
                                  const ValueType& value) const = 0;
     };
@@ -154,6 +505,22 @@ private:
             return static_cast<ValueType>(result);
         }
 
+        /**
+         * parses entry from a line of text
+         *
+         * @param  pos the position in the line, advanced behind the entry
+         * @param  end the end of the line
+         *
+         * @return the matrix entry.
+         */
+        ValueType parse_entry(const char*& pos, const char* end) const override
+        {
+            double result{};
+            GKO_CHECK_MATCH(parse_double(pos, end, result),
+                            "error while reading matrix entry");
+            return static_cast<ValueType>(result);
+        }
+
         /**
          * writes entry to the output stream
          *
@@ -201,6 +568,19 @@ private:
             return read_entry_impl<ValueType>(is);
         }
 
+        /**
+         * parses entry from a line of text
+         *
+         * @param  pos the position in the line, advanced behind the entry
+         * @param  end the end of the line
+         *
+         * @return the matrix entry.
+         */
+        ValueType parse_entry(const char*& pos, const char* end) const override
+        {
+            return parse_entry_impl<ValueType>(pos, end);
+        }
+
         /**
          * writes entry to the output stream
          *
@@ -236,6 +616,27 @@ private:
                 "trying to read a complex matrix into a real storage type");
         }
 
+        template <typename T>
+        static std::enable_if_t<is_complex_s<T>::value, T> parse_entry_impl(
+            const char*& pos, const char* end)
+        {
+            using real_type = remove_complex<T>;
+            double real{};
+            double imag{};
+            GKO_CHECK_MATCH(
+                (parse_double(pos, end, real) && parse_double(pos, end, imag)),
+                "error while reading matrix entry");
+            return {static_cast<real_type>(real), static_cast<real_type>(imag)};
+        }
+
+        template <typename T>
+        static std::enable_if_t<!is_complex_s<T>::value, T> parse_entry_impl(
+            const char*&, const char*)
+        {
+            throw GKO_STREAM_ERROR(
+                "trying to read a complex matrix into a real storage type");
+        }
+
     } complex_format{};
 
     /**
@@ -254,6 +655,19 @@ private:
             return one<ValueType>();
         }
 
+        /**
+         * parses entry from a line of text
+         *
+         * @param  dummy position in the line
+         * @param  dummy end of the line
+         *
+         * @return the matrix entry(one).
+         */
+        ValueType parse_entry(const char*&, const char*) const override
+        {
+            return one<ValueType>();
+        }
+
         /**
          * writes entry to the output stream
          *
@@ -483,6 +897,22 @@ private:
             std::istream& header, std::istream& content,
             const entry_format* entry_reader,
             const storage_modifier* modifier) const = 0;
+        /**
+         * Read the matrix data from a text in memory, using multiple threads
+         *
+         * @param header  The header in the matrix file
+         * @param begin  The beginning of the content in the matrix file
+         * @param end  The end of the content in the matrix file
+         * @param entry_reader  The entry format in the matrix file
+         * @param modifier  The storage modifier for the matrix file
+         * @param num_threads  The number of threads to use
+         *
+         * @return the matrix data
+         */
+        virtual matrix_data<ValueType, IndexType> read_data(
+            std::istream& header, const char* begin, const char* end,
+            const entry_format* entry_reader, const storage_modifier* modifier,
+            size_type num_threads) const = 0;
         /**
          * Write the matrix data
          *
@@ -546,6 +976,46 @@ private:
             return data;
         }
 
+        /**
+         * Read the matrix data from a text in memory, using multiple threads
+         *
+         * @param header  The header in the matrix file
+         * @param begin  The beginning of the content in the matrix file
+         * @param end  The end of the content in the matrix file
+         * @param entry_reader  The entry format in the matrix file
+         * @param modifier  The storage modifier for the matrix file
+         * @param num_threads  The number of threads to use
+         *
+         * @return the matrix data
+         */
+        matrix_data<ValueType, IndexType> read_data(
+            std::istream& header, const char* begin, const char* end,
+            const entry_format* entry_reader, const storage_modifier* modifier,
+            size_type num_threads) const override
+        {
+            size_type num_rows{};
+            size_type num_cols{};
+            size_type num_nonzeros{};
+            GKO_CHECK_STREAM(
+                header >> num_rows >> num_cols >> num_nonzeros,
+                "error when determining matrix size, expected: rows cols nnz");
+            return parse_lines(
+                dim<2>{num_rows, num_cols}, begin, end, num_nonzeros, modifier,
+                num_threads,
+                [&](size_type i, const char* pos, const char* line_end,
+                    matrix_data<ValueType, IndexType>& data) {
+                    IndexType row{};
+                    IndexType col{};
+                    GKO_CHECK_MATCH(
+                        (parse_index(pos, line_end, row) &&
+                         parse_index(pos, line_end, col)),
+                        "error when reading coordinates of matrix entry " +
+                            std::to_string(i));
+                    auto entry = entry_reader->parse_entry(pos, line_end);
+                    modifier->insert_entry(row - 1, col - 1, entry, data);
+                });
+        }
+
         /**
          * Write the matrix data
          *
@@ -615,6 +1085,52 @@ private:
             return data;
         }
 
+        /**
+         * Read the matrix data from a text in memory, using multiple threads
+         *
+         * @param header  The header in the matrix file
+         * @param begin  The beginning of the content in the matrix file
+         * @param end  The end of the content in the matrix file
+         * @param entry_reader  The entry format in the matrix file
+         * @param modifier  The storage modifier for the matrix file
+         * @param num_threads  The number of threads to use
+         *
+         * @return the matrix data
+         */
+        matrix_data<ValueType, IndexType> read_data(
+            std::istream& header, const char* begin, const char* end,
+            const entry_format* entry_reader, const storage_modifier* modifier,
+            size_type num_threads) const override
+        {
+            size_type num_rows{};
+            size_type num_cols{};
+            GKO_CHECK_STREAM(
+                header >> num_rows >> num_cols,
+                "error when determining matrix size, expected: rows cols nnz");
+            // the index of the first stored entry of each column
+            std::vector<size_type> col_begins(num_cols + 1);
+            for (size_type col = 0; col < num_cols; ++col) {
+                const auto row_start = modifier->get_row_start(col);
+                col_begins[col + 1] =
+                    col_begins[col] +
+                    (num_rows > row_start ? num_rows - row_start : 0);
+            }
+            return parse_lines(
+                dim<2>{num_rows, num_cols}, begin, end, col_begins.back(),
+                modifier, num_threads,
+                [&](size_type i, const char* pos, const char* line_end,
+                    matrix_data<ValueType, IndexType>& data) {
+                    const auto col = static_cast<size_type>(
+                        std::upper_bound(col_begins.begin(), col_begins.end(),
+                                         i) -
+                        col_begins.begin() - 1);
+                    const auto row =
+                        modifier->get_row_start(col) + i - col_begins[col];
+                    auto entry = entry_reader->parse_entry(pos, line_end);
+                    modifier->insert_entry(row, col, entry, data);
+                });
+        }
+
         /**
          * Write the matrix data
          *
@@ -655,6 +1171,66 @@ private:
     } array_layout{};
 
 
+    /**
+     * Parses the first num_lines non-blank lines of the text [begin, end) in
+     * parallel. The text is split into one chunk per thread, and each thread
+     * calls `parse_line(line_index, line_begin, line_end, data)` for the lines
+     * in its chunk, with a separate data object. The data objects are
+     * concatenated in the end.
+     *
+     * @return the matrix data
+     */
+    template <typename LineParser>
+    static matrix_data<ValueType, IndexType> parse_lines(
+        dim<2> size, const char* begin, const char* end, size_type num_lines,
+        const storage_modifier* modifier, size_type num_threads,
+        LineParser parse_line)
+    {
+        const auto bounds = split_lines(begin, end, num_threads);
+        std::vector<size_type> line_begins(num_threads + 1);
+        run_threads(num_threads, [&](size_type tid) {
+            size_type num_chunk_lines{};
+            for_each_line(bounds[tid], bounds[tid + 1],
+                          [&](const char*, const char*) { num_chunk_lines++; });
+            line_begins[tid + 1] = num_chunk_lines;
+        });
+        std::partial_sum(line_begins.begin(), line_begins.end(),
+                         line_begins.begin());
+        std::vector<matrix_data<ValueType, IndexType>> chunk_data(num_threads);
+        run_threads(num_threads, [&](size_type tid) {
+            auto& data = chunk_data[tid];
+            auto line = line_begins[tid];
+            const auto chunk_end = std::min(line_begins[tid + 1], num_lines);
+            data.nonzeros.reserve(modifier->get_reservation_size(
+                size[0], size[1], chunk_end > line ? chunk_end - line : 0));
+            for_each_line(bounds[tid], bounds[tid + 1],
+                          [&](const char* line_begin, const char* line_end) {
+                              if (line < num_lines) {
+                                  parse_line(line, line_begin, line_end, data);
+                              }
+                              line++;
+                          });
+        });
+        // lines missing at the end of the text are parsed as empty lines
+        for (auto line = line_begins.back(); line < num_lines; ++line) {
+            parse_line(line, end, end, chunk_data.back());
+        }
+        std::vector<size_type> nonzero_begins(num_threads + 1);
+        for (size_type tid = 0; tid < num_threads; ++tid) {
+            nonzero_begins[tid + 1] =
+                nonzero_begins[tid] + chunk_data[tid].nonzeros.size();
+        }
+        matrix_data<ValueType, IndexType> data(size);
+        data.nonzeros.resize(nonzero_begins.back());
+        run_threads(num_threads, [&](size_type tid) {
+            std::copy(chunk_data[tid].nonzeros.begin(),
+                      chunk_data[tid].nonzeros.end(),
+                      data.nonzeros.begin() + nonzero_begins[tid]);
+            chunk_data[tid].nonzeros = {};
+        });
+        return data;
+    }
+
     /**
      * the constructors establishes the mapping between specification strings to
      * classes representing algorithms
@@ -765,14 +1341,14 @@ matrix_data<ValueType, IndexType> read_raw(std::istream& is)
 
 
 /**
- * Returns the magic number at the beginning of the binary format header for the
- * given type parameters.
+ * Returns the two highest bytes of the binary format magic numbers, which
+ * encode the given type parameters.
  *
  * @tparam ValueType  the value type to be used for the binary storage
  * @tparam IndexType  the index type to be used for the binary storage
  */
 template <typename ValueType, typename IndexType>
-static constexpr uint64 binary_format_magic()
+static constexpr uint64 binary_format_type_bits()
 {
     constexpr auto is_int = std::is_same<IndexType, int32>::value;
     constexpr auto is_long = std::is_same<IndexType, int64>::value;
@@ -790,7 +1366,23 @@ static constexpr uint64 binary_format_magic()
     constexpr auto value_bit =
         is_double ? 'D' : (is_float ? 'S' : (is_complex_double ? 'Z' : 'C'));
     constexpr uint64 shift = 256;
-    constexpr uint64 type_bits = index_bit * shift + value_bit;
+    return index_bit * shift + value_bit;
+}
+
+
+/**
+ * Returns the magic number at the beginning of the binary format header for the
+ * given type parameters.
+ *
+ * @tparam ValueType  the value type to be used for the binary storage
+ * @tparam IndexType  the index type to be used for the binary storage
+ */
+template <typename ValueType, typename IndexType>
+static constexpr uint64 binary_format_magic()
+{
+    constexpr uint64 shift = 256;
+    constexpr uint64 type_bits =
+        binary_format_type_bits<ValueType, IndexType>();
     return 'G' +
            shift *
                ('I' +
@@ -802,6 +1394,30 @@ static constexpr uint64 binary_format_magic()
 }
 
 
+/**
+ * Returns the magic number at the beginning of the binary CSR format header for
+ * the given type parameters.
+ *
+ * @tparam ValueType  the value type to be used for the binary storage
+ * @tparam IndexType  the index type to be used for the binary storage
+ */
+template <typename ValueType, typename IndexType>
+static constexpr uint64 binary_csr_format_magic()
+{
+    constexpr uint64 shift = 256;
+    constexpr uint64 type_bits =
+        binary_format_type_bits<ValueType, IndexType>();
+    return 'G' +
+           shift *
+               ('K' +
+                shift *
+                    ('O' +
+                     shift *
+                         ('C' +
+                          shift * ('S' + shift * ('R' + shift * type_bits)))));
+}
+
+
 namespace {
 
 
@@ -870,6 +1486,62 @@ matrix_data<ValueType, IndexType> read_binary_convert(std::istream& is,
 }
 
 
+template <typename FileValueType, typename FileIndexType, typename ValueType,
+          typename IndexType>
+std::unique_ptr<matrix::Csr<ValueType, IndexType>>
+read_binary_streaming_convert(
+    std::istream& is, std::shared_ptr<const Executor> exec, uint64 num_rows,
+    uint64 num_cols, uint64 num_entries, size_type batch_size)
+{
+    if (num_rows > std::numeric_limits<IndexType>::max() ||
+        num_cols > std::numeric_limits<IndexType>::max() ||
+        num_entries > std::numeric_limits<IndexType>::max()) {
+        throw GKO_STREAM_ERROR(
+            "cannot read into this format, its index type would overflow");
+    }
+    if (is_complex<FileValueType>() && !is_complex<ValueType>()) {
+        throw GKO_STREAM_ERROR(
+            "cannot read into this format, would assign complex to real");
+    }
+    constexpr auto entry_binary_size =
+        sizeof(FileValueType) + 2 * sizeof(FileIndexType);
+    batch_size =
+        std::max<size_type>(std::min<size_type>(batch_size, num_entries), 1);
+    matrix::CsrStreamBuilder<ValueType, IndexType> builder{
+        exec, dim<2>{num_rows, num_cols}, num_entries};
+    std::vector<char> buffer(batch_size * entry_binary_size);
+    std::vector<matrix_data_entry<ValueType, IndexType>> batch(batch_size);
+    for (size_type batch_begin = 0; batch_begin < num_entries;
+         batch_begin += batch_size) {
+        const auto batch_end =
+            std::min<size_type>(batch_begin + batch_size, num_entries);
+        const auto num_batch_entries = batch_end - batch_begin;
+        GKO_CHECK_STREAM(
+            is.read(buffer.data(), num_batch_entries * entry_binary_size),
+            "failed reading entries " + std::to_string(batch_begin) + " to " +
+                std::to_string(batch_end - 1));
+        for (size_type i = 0; i < num_batch_entries; i++) {
+            const auto block = buffer.data() + i * entry_binary_size;
+            FileValueType value{};
+            FileIndexType row{};
+            FileIndexType column{};
+            std::memcpy(&row, block, sizeof(FileIndexType));
+            std::memcpy(&column, block + sizeof(FileIndexType),
+                        sizeof(FileIndexType));
+            std::memcpy(&value, block + 2 * sizeof(FileIndexType),
+                        sizeof(FileValueType));
+            batch[i].value = static_cast<ValueType>(
+                select_helper<is_complex<ValueType>()>::get(value,
+                                                            real(value)));
+            batch[i].row = row;
+            batch[i].column = column;
+        }
+        builder.append(batch.data(), num_batch_entries);
+    }
+    return builder.finalize();
+}
+
+
 }  // namespace
 
 
@@ -912,6 +1584,333 @@ matrix_data<ValueType, IndexType> read_binary_raw(std::istream& is)
 }
 
 
+namespace {
+
+
+/**
+ * Provides the contents of a file in memory. Where the operating system
+ * supports it, the file is mapped into memory, so its pages are only loaded
+ * when they are first accessed. Otherwise, the whole file is read into memory.
+ * Modifications of the contents are never written back to the file.
+ */
+class mapped_file {
+public:
+    explicit mapped_file(const std::string& filename)
+        : data_{nullptr}, size_{}
+    {
+#ifdef _WIN32
+        std::ifstream stream{filename, std::ios::binary | std::ios::ate};
+        GKO_CHECK_STREAM(stream, "failed opening file " + filename);
+        size_ = static_cast<size_type>(stream.tellg());
+        buffer_.resize(size_);
+        stream.seekg(0);
+        GKO_CHECK_STREAM(stream.read(buffer_.data(), size_),
+                         "failed reading file " + filename);
+        data_ = buffer_.data();
+#else
+        const auto fd = open(filename.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw GKO_STREAM_ERROR("failed opening file " + filename);
+        }
+        struct stat file_stat {};
+        if (fstat(fd, &file_stat) != 0) {
+            close(fd);
+            throw GKO_STREAM_ERROR("failed querying the size of file " +
+                                   filename);
+        }
+        size_ = static_cast<size_type>(file_stat.st_size);
+        if (size_ > 0) {
+            // private mapping: writes create a private copy of the page
+            const auto ptr = mmap(nullptr, size_, PROT_READ | PROT_WRITE,
+                                  MAP_PRIVATE, fd, 0);
+            if (ptr == MAP_FAILED) {
+                close(fd);
+                throw GKO_STREAM_ERROR("failed mapping file " + filename);
+            }
+            data_ = static_cast<char*>(ptr);
+        }
+        // the mapping stays valid after closing the file
+        close(fd);
+#endif
+    }
+
+    ~mapped_file()
+    {
+#ifndef _WIN32
+        if (data_) {
+            munmap(data_, size_);
+        }
+#endif
+    }
+
+    mapped_file(const mapped_file&) = delete;
+
+    mapped_file& operator=(const mapped_file&) = delete;
+
+    char* get_data() const { return data_; }
+
+    size_type get_size() const { return size_; }
+
+private:
+    char* data_;
+    size_type size_;
+#ifdef _WIN32
+    std::vector<char> buffer_;
+#endif
+};
+
+
+/**
+ * The header of the binary formats.
+ */
+struct binary_header {
+    uint64 magic;
+    uint64 num_rows;
+    uint64 num_cols;
+    uint64 num_entries;
+};
+
+
+binary_header read_binary_header(const mapped_file& file)
+{
+    static_assert(sizeof(binary_header) == 32, "c++ is broken");
+    if (file.get_size() < sizeof(binary_header)) {
+        throw GKO_STREAM_ERROR("failed reading header");
+    }
+    binary_header header{};
+    std::memcpy(&header, file.get_data(), sizeof(binary_header));
+    return header;
+}
+
+
+template <typename FileValueType, typename FileIndexType, typename ValueType,
+          typename IndexType>
+device_matrix_data<ValueType, IndexType> read_binary_mapped_convert(
+    std::shared_ptr<const Executor> exec, const mapped_file& file,
+    const binary_header& header)
+{
+    if (header.num_rows > std::numeric_limits<IndexType>::max() ||
+        header.num_cols > std::numeric_limits<IndexType>::max()) {
+        throw GKO_STREAM_ERROR(
+            "cannot read into this format, its index type would overflow");
+    }
+    if (is_complex<FileValueType>() && !is_complex<ValueType>()) {
+        throw GKO_STREAM_ERROR(
+            "cannot read into this format, would assign complex to real");
+    }
+    using entry_type = matrix_data_entry<ValueType, IndexType>;
+    constexpr auto entry_binary_size =
+        sizeof(FileValueType) + 2 * sizeof(FileIndexType);
+    const auto num_entries = static_cast<size_type>(header.num_entries);
+    if (header.num_entries >
+        (file.get_size() - sizeof(binary_header)) / entry_binary_size) {
+        throw GKO_STREAM_ERROR(
+            "file is too short for the number of entries in its header");
+    }
+    const auto host_exec = exec->get_master();
+    const auto file_entries = file.get_data() + sizeof(binary_header);
+    array<entry_type> entries{host_exec};
+    bool sorted = true;
+    if (std::is_same<FileValueType, ValueType>::value &&
+        std::is_same<FileIndexType, IndexType>::value &&
+        sizeof(entry_type) == entry_binary_size &&
+        reinterpret_cast<uintptr>(file_entries) % alignof(entry_type) == 0) {
+        // the entries are stored exactly like matrix_data_entry
+        entries = make_array_view(host_exec, num_entries,
+                                  reinterpret_cast<entry_type*>(file_entries));
+        const auto data = entries.get_const_data();
+        for (size_type i = 1; i < num_entries && sorted; i++) {
+            sorted = std::tie(data[i - 1].row, data[i - 1].column) <=
+                     std::tie(data[i].row, data[i].column);
+        }
+    } else {
+        entries.resize_and_reset(num_entries);
+        const auto data = entries.get_data();
+        for (size_type i = 0; i < num_entries; i++) {
+            const auto block = file_entries + i * entry_binary_size;
+            FileValueType value{};
+            FileIndexType row{};
+            FileIndexType column{};
+            std::memcpy(&row, block, sizeof(FileIndexType));
+            std::memcpy(&column, block + sizeof(FileIndexType),
+                        sizeof(FileIndexType));
+            std::memcpy(&value, block + 2 * sizeof(FileIndexType),
+                        sizeof(FileValueType));
+            data[i].value = static_cast<ValueType>(
+                select_helper<is_complex<ValueType>()>::get(value,
+                                                            real(value)));
+            data[i].row = row;
+            data[i].column = column;
+            sorted = sorted &&
+                     (i == 0 || std::tie(data[i - 1].row, data[i - 1].column) <=
+                                    std::tie(data[i].row, data[i].column));
+        }
+    }
+    device_matrix_data<ValueType, IndexType> result{
+        exec, dim<2>{header.num_rows, header.num_cols}, num_entries};
+    exec->run(components::make_aos_to_soa(
+        *make_temporary_clone(exec, &entries), result));
+    if (!sorted) {
+        result.sort_row_major();
+    }
+    return result;
+}
+
+
+/**
+ * Returns the offset of the next array in the binary CSR format, given the end
+ * of the previous one.
+ */
+constexpr size_type binary_csr_align(size_type offset)
+{
+    constexpr size_type alignment = 64;
+    return (offset + alignment - 1) / alignment * alignment;
+}
+
+
+}  // namespace
+
+
+template <typename ValueType, typename IndexType>
+device_matrix_data<ValueType, IndexType> read_binary_mapped_raw(
+    std::shared_ptr<const Executor> exec, const std::string& filename)
+{
+    const mapped_file file{filename};
+    const auto header = read_binary_header(file);
+#define DECLARE_OVERLOAD(_vtype, _itype)                                    \
+    else if (header.magic == binary_format_magic<_vtype, _itype>())         \
+    {                                                                       \
+        return read_binary_mapped_convert<_vtype, _itype, ValueType,        \
+                                          IndexType>(exec, file, header);   \
+    }
+    if (false) {
+    }
+    DECLARE_OVERLOAD(double, int32)
+    DECLARE_OVERLOAD(float, int32)
+    DECLARE_OVERLOAD(std::complex<double>, int32)
+    DECLARE_OVERLOAD(std::complex<float>, int32)
+    DECLARE_OVERLOAD(double, int64)
+    DECLARE_OVERLOAD(float, int64)
+    DECLARE_OVERLOAD(std::complex<double>, int64)
+    DECLARE_OVERLOAD(std::complex<float>, int64)
+#undef DECLARE_OVERLOAD
+    else
+    {
+        throw GKO_STREAM_ERROR("invalid header magic number '" +
+                               std::string(file.get_data(), 8) + "'");
+    }
+}
+
+
+template <typename ValueType, typename IndexType>
+std::unique_ptr<matrix::Csr<ValueType, IndexType>> read_binary_csr(
+    std::shared_ptr<const Executor> exec, const std::string& filename)
+{
+    const auto file = std::make_shared<mapped_file>(filename);
+    const auto header = read_binary_header(*file);
+    if (header.magic != binary_csr_format_magic<ValueType, IndexType>()) {
+        throw GKO_STREAM_ERROR("invalid header magic number '" +
+                               std::string(file->get_data(), 8) + "'");
+    }
+    const auto num_rows = static_cast<size_type>(header.num_rows);
+    const auto num_entries = static_cast<size_type>(header.num_entries);
+    const auto row_ptrs_offset = binary_csr_align(sizeof(binary_header));
+    const auto col_idxs_offset =
+        binary_csr_align(row_ptrs_offset + (num_rows + 1) * sizeof(IndexType));
+    const auto values_offset =
+        binary_csr_align(col_idxs_offset + num_entries * sizeof(IndexType));
+    if (file->get_size() < values_offset + num_entries * sizeof(ValueType)) {
+        throw GKO_STREAM_ERROR("file is too short for the matrix in its header");
+    }
+    const auto host_exec = exec->get_master();
+    // the arrays keep the mapping alive instead of freeing their data
+    const auto adopt = [&](auto ptr, size_type size) {
+        using value_type = std::remove_pointer_t<decltype(ptr)>;
+        return array<value_type>{host_exec, size, ptr,
+                                 [file](value_type*) {}};
+    };
+    auto row_ptrs = adopt(
+        reinterpret_cast<IndexType*>(file->get_data() + row_ptrs_offset),
+        num_rows + 1);
+    auto col_idxs = adopt(
+        reinterpret_cast<IndexType*>(file->get_data() + col_idxs_offset),
+        num_entries);
+    auto values = adopt(
+        reinterpret_cast<ValueType*>(file->get_data() + values_offset),
+        num_entries);
+    if (row_ptrs.get_const_data()[0] != 0 ||
+        static_cast<size_type>(row_ptrs.get_const_data()[num_rows]) !=
+            num_entries) {
+        throw GKO_STREAM_ERROR("invalid row pointers");
+    }
+    return matrix::Csr<ValueType, IndexType>::create(
+        exec, dim<2>{header.num_rows, header.num_cols}, std::move(values),
+        std::move(col_idxs), std::move(row_ptrs));
+}
+
+
+template <typename ValueType, typename IndexType>
+matrix_data<ValueType, IndexType> read_raw_parallel(std::istream& is,
+                                                    size_type num_threads)
+{
+    const std::string content{std::istreambuf_iterator<char>{is},
+                              std::istreambuf_iterator<char>{}};
+    return mtx_io<ValueType, IndexType>::get().read(
+        content.data(), content.data() + content.size(), num_threads);
+}
+
+
+template <typename ValueType, typename IndexType>
+matrix_data<ValueType, IndexType> read_raw_parallel(const std::string& filename,
+                                                    size_type num_threads)
+{
+    const mapped_file file{filename};
+    return mtx_io<ValueType, IndexType>::get().read(
+        file.get_data(), file.get_data() + file.get_size(), num_threads);
+}
+
+
+template <typename ValueType, typename IndexType>
+std::unique_ptr<matrix::Csr<ValueType, IndexType>> read_binary_streaming(
+    std::istream& is, std::shared_ptr<const Executor> exec,
+    size_type batch_size)
+{
+    std::array<char, 32> header{};
+    GKO_CHECK_STREAM(is.read(header.data(), 32), "failed reading header");
+    uint64 magic{};
+    uint64 num_rows{};
+    uint64 num_cols{};
+    uint64 num_entries{};
+    std::memcpy(&magic, &header[0], 8);
+    std::memcpy(&num_rows, &header[8], 8);
+    std::memcpy(&num_cols, &header[16], 8);
+    std::memcpy(&num_entries, &header[24], 8);
+#define DECLARE_OVERLOAD(_vtype, _itype)                                      \
+    else if (magic == binary_format_magic<_vtype, _itype>())                  \
+    {                                                                         \
+        return read_binary_streaming_convert<_vtype, _itype, ValueType,       \
+                                             IndexType>(                      \
+            is, exec, num_rows, num_cols, num_entries, batch_size);           \
+    }
+    if (false) {
+    }
+    DECLARE_OVERLOAD(double, int32)
+    DECLARE_OVERLOAD(float, int32)
+    DECLARE_OVERLOAD(std::complex<double>, int32)
+    DECLARE_OVERLOAD(std::complex<float>, int32)
+    DECLARE_OVERLOAD(double, int64)
+    DECLARE_OVERLOAD(float, int64)
+    DECLARE_OVERLOAD(std::complex<double>, int64)
+    DECLARE_OVERLOAD(std::complex<float>, int64)
+#undef DECLARE_OVERLOAD
+    else
+    {
+        throw GKO_STREAM_ERROR("invalid header magic number '" +
+                               std::string(header.data(), 8) + "'");
+    }
+}
+
+
 template <typename ValueType, typename IndexType>
 matrix_data<ValueType, IndexType> read_generic_raw(std::istream& is)
 {
@@ -955,6 +1954,38 @@ void write_binary_raw(std::ostream& os,
 }
 
 
+template <typename ValueType, typename IndexType>
+void write_binary_csr(std::ostream& os,
+                      const matrix::Csr<ValueType, IndexType>* matrix)
+{
+    const auto host_matrix =
+        make_temporary_clone(matrix->get_executor()->get_master(), matrix);
+    const binary_header header{binary_csr_format_magic<ValueType, IndexType>(),
+                               host_matrix->get_size()[0],
+                               host_matrix->get_size()[1],
+                               host_matrix->get_num_stored_elements()};
+    const auto row_ptrs_bytes = (header.num_rows + 1) * sizeof(IndexType);
+    const auto col_idxs_bytes = header.num_entries * sizeof(IndexType);
+    const auto values_bytes = header.num_entries * sizeof(ValueType);
+    const std::array<char, 64> padding{};
+    size_type offset{};
+    const auto write_section = [&](const void* data, size_type num_bytes) {
+        const auto padding_bytes = binary_csr_align(offset) - offset;
+        GKO_CHECK_STREAM(os.write(padding.data(), padding_bytes),
+                         "failed writing padding");
+        GKO_CHECK_STREAM(
+            os.write(static_cast<const char*>(data), num_bytes),
+            "failed writing data");
+        offset += padding_bytes + num_bytes;
+    };
+    write_section(&header, sizeof(header));
+    write_section(host_matrix->get_const_row_ptrs(), row_ptrs_bytes);
+    write_section(host_matrix->get_const_col_idxs(), col_idxs_bytes);
+    write_section(host_matrix->get_const_values(), values_bytes);
+    os.flush();
+}
+
+
 /**
  * Writes raw data to the stream.
  *
@@ -988,11 +2019,40 @@ void write_raw(std::ostream& os, const matrix_data<ValueType, IndexType>& data,
                           const matrix_data<ValueType, IndexType>& data)
 #define GKO_DECLARE_READ_GENERIC_RAW(ValueType, IndexType) \
     matrix_data<ValueType, IndexType> read_generic_raw(std::istream& is)
+#define GKO_DECLARE_READ_RAW_PARALLEL(ValueType, IndexType)          \
+    matrix_data<ValueType, IndexType> read_raw_parallel(std::istream& is, \
+                                                        size_type num_threads)
+#define GKO_DECLARE_READ_RAW_PARALLEL_FILE(ValueType, IndexType) \
+    matrix_data<ValueType, IndexType> read_raw_parallel(          \
+        const std::string& filename, size_type num_threads)
+#define GKO_DECLARE_READ_BINARY_MAPPED_RAW(ValueType, IndexType) \
+    device_matrix_data<ValueType, IndexType> read_binary_mapped_raw(  \
+        std::shared_ptr<const Executor> exec, const std::string& filename)
+#define GKO_DECLARE_READ_BINARY_STREAMING(ValueType, IndexType)     \
+    std::unique_ptr<matrix::Csr<ValueType, IndexType>>                  \
+    read_binary_streaming(std::istream& is,                             \
+                          std::shared_ptr<const Executor> exec,         \
+                          size_type batch_size)
+#define GKO_DECLARE_READ_BINARY_CSR(ValueType, IndexType)              \
+    std::unique_ptr<matrix::Csr<ValueType, IndexType>> read_binary_csr( \
+        std::shared_ptr<const Executor> exec, const std::string& filename)
+#define GKO_DECLARE_WRITE_BINARY_CSR(ValueType, IndexType) \
+    void write_binary_csr(std::ostream& os,                \
+                          const matrix::Csr<ValueType, IndexType>* matrix)
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_READ_RAW);
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_READ_RAW_PARALLEL);
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_READ_RAW_PARALLEL_FILE);
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_WRITE_RAW);
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_READ_BINARY_RAW);
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_WRITE_BINARY_RAW);
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_READ_GENERIC_RAW);
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_READ_BINARY_MAPPED_RAW);
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_READ_BINARY_CSR);
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_READ_BINARY_STREAMING);
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_WRITE_BINARY_CSR);
 
 
 }  // namespace gko
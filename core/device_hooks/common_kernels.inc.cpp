@@ -55,8 +55,12 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "core/factorization/par_ict_kernels.hpp"
 #include "core/factorization/par_ilu_kernels.hpp"
 #include "core/factorization/par_ilut_kernels.hpp"
+#include "core/matrix/batch_csr_kernels.hpp"
+#include "core/matrix/batch_dense_kernels.hpp"
+#include "core/matrix/batch_ell_kernels.hpp"
 #include "core/matrix/coo_kernels.hpp"
 #include "core/matrix/csr_kernels.hpp"
+#include "core/matrix/delta_csr_kernels.hpp"
 #include "core/matrix/dense_kernels.hpp"
 #include "core/matrix/diagonal_kernels.hpp"
 #include "core/matrix/ell_kernels.hpp"
@@ -65,15 +69,22 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "core/matrix/hybrid_kernels.hpp"
 #include "core/matrix/sellp_kernels.hpp"
 #include "core/matrix/sparsity_csr_kernels.hpp"
+#include "core/matrix/symmetric_csr_kernels.hpp"
 #include "core/multigrid/pgm_kernels.hpp"
 #include "core/preconditioner/isai_kernels.hpp"
 #include "core/preconditioner/jacobi_kernels.hpp"
+#include "core/reorder/amd_kernels.hpp"
+#include "core/reorder/nested_dissection_kernels.hpp"
 #include "core/reorder/rcm_kernels.hpp"
+#include "core/solver/batch_bicgstab_kernels.hpp"
+#include "core/solver/batch_cg_kernels.hpp"
+#include "core/solver/batch_gmres_kernels.hpp"
 #include "core/solver/bicg_kernels.hpp"
 #include "core/solver/bicgstab_kernels.hpp"
 #include "core/solver/cb_gmres_kernels.hpp"
 #include "core/solver/cg_kernels.hpp"
 #include "core/solver/cgs_kernels.hpp"
+#include "core/solver/chebyshev_kernels.hpp"
 #include "core/solver/common_gmres_kernels.hpp"
 #include "core/solver/fcg_kernels.hpp"
 #include "core/solver/gmres_kernels.hpp"
@@ -81,6 +92,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "core/solver/ir_kernels.hpp"
 #include "core/solver/lower_trs_kernels.hpp"
 #include "core/solver/multigrid_kernels.hpp"
+#include "core/solver/pipe_bicgstab_kernels.hpp"
+#include "core/solver/pipe_cg_kernels.hpp"
 #include "core/solver/upper_trs_kernels.hpp"
 #include "core/stop/criterion_kernels.hpp"
 #include "core/stop/residual_norm_kernels.hpp"
@@ -169,6 +182,11 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
     _macro(SourceType, TargetType) GKO_NOT_COMPILED(GKO_HOOK_MODULE); \
     GKO_INSTANTIATE_FOR_EACH_VALUE_CONVERSION_OR_COPY(_macro)
 
+#define GKO_STUB_BATCH_MATRIX_TYPE(_macro)                                \
+    template <typename ValueType, typename BatchMatrixType>               \
+    _macro(ValueType, BatchMatrixType) GKO_NOT_COMPILED(GKO_HOOK_MODULE); \
+    GKO_INSTANTIATE_FOR_EACH_BATCH_MATRIX_TYPE(_macro)
+
 #define GKO_STUB_CB_GMRES(_macro)                                              \
     template <typename ValueType, typename ValueTypeKrylovBases>               \
     _macro(ValueType, ValueTypeKrylovBases) GKO_NOT_COMPILED(GKO_HOOK_MODULE); \
@@ -271,6 +289,36 @@ GKO_STUB_VALUE_AND_LOCAL_GLOBAL_INDEX_TYPE(GKO_DECLARE_BUILD_LOCAL_NONLOCAL);
 }  // namespace distributed_matrix
 
 
+namespace batch_csr {
+
+
+GKO_STUB_VALUE_TYPE(GKO_DECLARE_BATCH_CSR_SPMV_KERNEL);
+GKO_STUB_VALUE_TYPE(GKO_DECLARE_BATCH_CSR_ADVANCED_SPMV_KERNEL);
+
+
+}  // namespace batch_csr
+
+
+namespace batch_dense {
+
+
+GKO_STUB_VALUE_TYPE(GKO_DECLARE_BATCH_DENSE_SIMPLE_APPLY_KERNEL);
+GKO_STUB_VALUE_TYPE(GKO_DECLARE_BATCH_DENSE_APPLY_KERNEL);
+
+
+}  // namespace batch_dense
+
+
+namespace batch_ell {
+
+
+GKO_STUB_VALUE_TYPE(GKO_DECLARE_BATCH_ELL_SPMV_KERNEL);
+GKO_STUB_VALUE_TYPE(GKO_DECLARE_BATCH_ELL_ADVANCED_SPMV_KERNEL);
+
+
+}  // namespace batch_ell
+
+
 namespace dense {
 
 
@@ -351,11 +399,40 @@ namespace cg {
 GKO_STUB_VALUE_TYPE(GKO_DECLARE_CG_INITIALIZE_KERNEL);
 GKO_STUB_VALUE_TYPE(GKO_DECLARE_CG_STEP_1_KERNEL);
 GKO_STUB_VALUE_TYPE(GKO_DECLARE_CG_STEP_2_KERNEL);
+GKO_STUB_VALUE_TYPE(GKO_DECLARE_CG_STEP_2_NORM_KERNEL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_CG_SPMV_CONJ_DOT_KERNEL);
 
 
 }  // namespace cg
 
 
+namespace batch_cg {
+
+
+GKO_STUB_BATCH_MATRIX_TYPE(GKO_DECLARE_BATCH_CG_APPLY_KERNEL);
+
+
+}  // namespace batch_cg
+
+
+namespace batch_bicgstab {
+
+
+GKO_STUB_BATCH_MATRIX_TYPE(GKO_DECLARE_BATCH_BICGSTAB_APPLY_KERNEL);
+
+
+}  // namespace batch_bicgstab
+
+
+namespace batch_gmres {
+
+
+GKO_STUB_BATCH_MATRIX_TYPE(GKO_DECLARE_BATCH_GMRES_APPLY_KERNEL);
+
+
+}  // namespace batch_gmres
+
+
 namespace bicg {
 
 
@@ -413,6 +490,29 @@ GKO_STUB_VALUE_TYPE(GKO_DECLARE_BICGSTAB_FINALIZE_KERNEL);
 }  // namespace bicgstab
 
 
+namespace pipe_cg {
+
+
+GKO_STUB_VALUE_TYPE(GKO_DECLARE_PIPE_CG_INITIALIZE_KERNEL);
+GKO_STUB_VALUE_TYPE(GKO_DECLARE_PIPE_CG_STEP_1_KERNEL);
+GKO_STUB_VALUE_TYPE(GKO_DECLARE_PIPE_CG_STEP_2_KERNEL);
+
+
+}  // namespace pipe_cg
+
+
+namespace pipe_bicgstab {
+
+
+GKO_STUB_VALUE_TYPE(GKO_DECLARE_PIPE_BICGSTAB_INITIALIZE_KERNEL);
+GKO_STUB_VALUE_TYPE(GKO_DECLARE_PIPE_BICGSTAB_STEP_1_KERNEL);
+GKO_STUB_VALUE_TYPE(GKO_DECLARE_PIPE_BICGSTAB_STEP_2_KERNEL);
+GKO_STUB_VALUE_TYPE(GKO_DECLARE_PIPE_BICGSTAB_STEP_3_KERNEL);
+
+
+}  // namespace pipe_bicgstab
+
+
 namespace idr {
 
 
@@ -438,6 +538,16 @@ GKO_STUB_VALUE_TYPE(GKO_DECLARE_CGS_STEP_3_KERNEL);
 }  // namespace cgs
 
 
+namespace chebyshev {
+
+
+GKO_STUB_VALUE_TYPE(GKO_DECLARE_CHEBYSHEV_INIT_UPDATE_KERNEL);
+GKO_STUB_VALUE_TYPE(GKO_DECLARE_CHEBYSHEV_UPDATE_KERNEL);
+
+
+}  // namespace chebyshev
+
+
 namespace common_gmres {
 
 
@@ -454,6 +564,8 @@ namespace gmres {
 
 GKO_STUB_VALUE_TYPE(GKO_DECLARE_GMRES_RESTART_KERNEL);
 GKO_STUB_VALUE_TYPE(GKO_DECLARE_GMRES_MULTI_AXPY_KERNEL);
+GKO_STUB_VALUE_TYPE(GKO_DECLARE_GMRES_MULTI_DOT_KERNEL);
+GKO_STUB_VALUE_TYPE(GKO_DECLARE_GMRES_MULTI_UPDATE_KERNEL);
 
 
 }  // namespace gmres
@@ -516,8 +628,12 @@ namespace csr {
 
 GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_CSR_SPMV_KERNEL);
 GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_CSR_ADVANCED_SPMV_KERNEL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_CSR_MIXED_SPMV_KERNEL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_CSR_ADVANCED_MIXED_SPMV_KERNEL);
 GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_CSR_SPGEMM_KERNEL);
 GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_CSR_ADVANCED_SPGEMM_KERNEL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_CSR_SPGEMM_NUMERIC_KERNEL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_CSR_SPGEMM_SYMBOLIC_KERNEL);
 GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_CSR_SPGEAM_KERNEL);
 GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_CSR_FILL_IN_DENSE_KERNEL);
 GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_CSR_CONVERT_TO_ELL_KERNEL);
@@ -559,6 +675,19 @@ GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_CSR_INV_SCALE_KERNEL);
 }  // namespace csr
 
 
+namespace delta_csr {
+
+
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_DELTA_CSR_SPMV_KERNEL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_DELTA_CSR_ADVANCED_SPMV_KERNEL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_DELTA_CSR_COUNT_ESCAPES_KERNEL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_DELTA_CSR_CONVERT_FROM_CSR_KERNEL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_DELTA_CSR_CONVERT_TO_CSR_KERNEL);
+
+
+}  // namespace delta_csr
+
+
 namespace fbcsr {
 
 
@@ -649,6 +778,8 @@ GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_SELLP_SPMV_KERNEL);
 GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_SELLP_FILL_IN_MATRIX_DATA_KERNEL);
 GKO_STUB_INDEX_TYPE(GKO_DECLARE_SELLP_COMPUTE_SLICE_SETS_KERNEL);
 GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_SELLP_ADVANCED_SPMV_KERNEL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_SELLP_MIXED_SPMV_KERNEL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_SELLP_ADVANCED_MIXED_SPMV_KERNEL);
 GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_SELLP_FILL_IN_DENSE_KERNEL);
 GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_SELLP_CONVERT_TO_CSR_KERNEL);
 GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_SELLP_COUNT_NONZEROS_PER_ROW_KERNEL);
@@ -658,6 +789,21 @@ GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_SELLP_EXTRACT_DIAGONAL_KERNEL);
 }  // namespace sellp
 
 
+namespace symmetric_csr {
+
+
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_SYMMETRIC_CSR_SPMV_KERNEL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_SYMMETRIC_CSR_ADVANCED_SPMV_KERNEL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_SYMMETRIC_CSR_COUNT_UPPER_NNZ_KERNEL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SYMMETRIC_CSR_CONVERT_FROM_CSR_KERNEL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_SYMMETRIC_CSR_COUNT_CSR_NNZ_KERNEL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_SYMMETRIC_CSR_CONVERT_TO_CSR_KERNEL);
+
+
+}  // namespace symmetric_csr
+
+
 namespace jacobi {
 
 
@@ -787,6 +933,26 @@ GKO_STUB_VALUE_AND_INDEX_TYPE(
 
 
 }  // namespace par_ilut_factorization
+
+
+namespace amd {
+
+
+GKO_STUB_INDEX_TYPE(GKO_DECLARE_AMD_GET_PERMUTATION_KERNEL);
+
+
+}  // namespace amd
+
+
+namespace nested_dissection {
+
+
+GKO_STUB_INDEX_TYPE(GKO_DECLARE_NESTED_DISSECTION_GET_PERMUTATION_KERNEL);
+
+
+}  // namespace nested_dissection
+
+
 namespace rcm {
 
 
@@ -812,6 +978,7 @@ GKO_STUB_NON_COMPLEX_VALUE_AND_INDEX_TYPE(
 GKO_STUB_NON_COMPLEX_VALUE_AND_INDEX_TYPE(GKO_DECLARE_PGM_ASSIGN_TO_EXIST_AGG);
 GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_PGM_SORT_ROW_MAJOR);
 GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_PGM_COMPUTE_COARSE_COO);
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_PGM_COMPUTE_COARSE_CSR);
 
 
 }  // namespace pgm
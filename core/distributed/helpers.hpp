@@ -34,6 +34,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define GKO_CORE_DISTRIBUTED_HELPERS_HPP_
 
 
+#include <functional>
 #include <memory>
 
 
@@ -102,6 +103,95 @@ const matrix::Dense<ValueType>* get_local(
 #endif
 
 
+/**
+ * Handle of a sum of local reduction results over all processes, which may
+ * still be in progress. The result may only be accessed after wait() returned.
+ */
+class global_reduction {
+public:
+    global_reduction() = default;
+
+#if GINKGO_BUILD_MPI
+    global_reduction(experimental::mpi::request req,
+                     std::function<void()> finish)
+        : has_req_{true}, req_{std::move(req)}, finish_{std::move(finish)}
+    {}
+#endif
+
+    /** Blocks until the reduction result is available. */
+    void wait()
+    {
+#if GINKGO_BUILD_MPI
+        if (has_req_) {
+            req_.wait();
+            has_req_ = false;
+        }
+#endif
+        if (finish_) {
+            finish_();
+            finish_ = nullptr;
+        }
+    }
+
+private:
+#if GINKGO_BUILD_MPI
+    bool has_req_{};
+    experimental::mpi::request req_;
+#endif
+    std::function<void()> finish_;
+};
+
+
+/**
+ * Starts summing the local reduction results stored in `result` over all
+ * processes owning parts of `vec`. For non-distributed vectors, the local
+ * results are already final.
+ *
+ * @param vec  the vector that the local results were computed from
+ * @param result  the contiguously stored local results, which are replaced by
+ *                the global results once the returned handle has been waited on
+ */
+template <typename ValueType, typename ResultType>
+global_reduction start_global_sum(const matrix::Dense<ValueType>* vec,
+                                  matrix::Dense<ResultType>* result)
+{
+    return {};
+}
+
+
+#if GINKGO_BUILD_MPI
+
+
+template <typename ValueType, typename ResultType>
+global_reduction start_global_sum(
+    const experimental::distributed::Vector<ValueType>* vec,
+    matrix::Dense<ResultType>* result)
+{
+    GKO_ASSERT(result->get_stride() == result->get_size()[1]);
+    auto exec = result->get_executor();
+    const auto comm = vec->get_communicator();
+    const auto count = static_cast<int>(result->get_num_stored_elements());
+    exec->synchronize();
+    auto use_host_buffer =
+        exec->get_master() != exec && !experimental::mpi::is_gpu_aware();
+    if (use_host_buffer) {
+        std::shared_ptr<matrix::Dense<ResultType>> host_result =
+            gko::clone(exec->get_master(), result);
+        auto req = comm.i_all_reduce(exec->get_master(),
+                                     host_result->get_values(), count, MPI_SUM);
+        auto finish = [host_result, result] {
+            result->copy_from(host_result.get());
+        };
+        return {std::move(req), std::move(finish)};
+    }
+    return {comm.i_all_reduce(exec, result->get_values(), count, MPI_SUM),
+            nullptr};
+}
+
+
+#endif
+
+
 template <typename Arg>
 bool is_distributed(Arg* linop)
 {
@@ -38,6 +38,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ginkgo/core/base/types.hpp>
 
 
+#include "core/base/utils.hpp"
 #include "core/components/fill_array_kernels.hpp"
 #include "core/factorization/lu_kernels.hpp"
 #include "core/factorization/symbolic.hpp"
@@ -82,69 +83,106 @@ Lu<ValueType, IndexType>::generate(
 
 
 template <typename ValueType, typename IndexType>
-std::unique_ptr<LinOp> Lu<ValueType, IndexType>::generate_impl(
+std::shared_ptr<const typename Lu<ValueType, IndexType>::symbolic_type>
+Lu<ValueType, IndexType>::generate_symbolic(
     std::shared_ptr<const LinOp> system_matrix) const
 {
     GKO_ASSERT_IS_SQUARE_MATRIX(system_matrix);
     const auto exec = this->get_executor();
-    // TODO deal with non Csr matrices
-    const auto mtx = as<matrix_type>(system_matrix);
+    // convert and/or sort the matrix if necessary
+    const auto mtx = convert_to_with_sorting<matrix_type>(
+        exec, system_matrix, parameters_.skip_sorting);
     const auto num_rows = mtx->get_size()[0];
-    std::unique_ptr<matrix_type> factors;
+    std::shared_ptr<symbolic_type> symbolic{new symbolic_type{exec}};
     if (!parameters_.symbolic_factorization) {
         if (parameters_.symmetric_sparsity) {
-            factors = gko::factorization::symbolic_cholesky(mtx.get());
+            auto pattern = sparsity_pattern_type::create(exec);
+            pattern->copy_from(
+                gko::factorization::symbolic_cholesky(mtx.get()).get());
+            symbolic->pattern_ = std::move(pattern);
         } else {
             GKO_NOT_SUPPORTED(mtx);
         }
     } else {
-        const auto& symbolic = parameters_.symbolic_factorization;
-        const auto factor_nnz = symbolic->get_num_nonzeros();
-        factors = matrix_type::create(exec, mtx->get_size(), factor_nnz);
-        const auto symbolic_exec = symbolic->get_executor();
-        exec->copy_from(symbolic_exec.get(), factor_nnz,
-                        symbolic->get_const_col_idxs(),
-                        factors->get_col_idxs());
-        exec->copy_from(symbolic_exec.get(), num_rows + 1,
-                        symbolic->get_const_row_ptrs(),
-                        factors->get_row_ptrs());
-        // update srow to be safe
-        factors->set_strategy(factors->get_strategy());
+        GKO_ASSERT_EQUAL_DIMENSIONS(parameters_.symbolic_factorization, mtx);
+        symbolic->pattern_ = parameters_.symbolic_factorization;
     }
     // setup lookup structure on factors
-    array<IndexType> storage_offsets{exec, num_rows + 1};
-    array<int64> row_descs{exec, num_rows};
-    array<IndexType> diag_idxs{exec, num_rows};
+    const auto pattern = make_temporary_clone(exec, symbolic->pattern_.get());
+    symbolic->storage_offsets_.resize_and_reset(num_rows + 1);
+    symbolic->row_descs_.resize_and_reset(num_rows);
     const auto allowed_sparsity = gko::matrix::csr::sparsity_type::bitmap |
                                   gko::matrix::csr::sparsity_type::full |
                                   gko::matrix::csr::sparsity_type::hash;
     exec->run(make_build_lookup_offsets(
-        factors->get_const_row_ptrs(), factors->get_const_col_idxs(), num_rows,
-        allowed_sparsity, storage_offsets.get_data()));
-    const auto storage_size = static_cast<size_type>(
-        exec->copy_val_to_host(storage_offsets.get_const_data() + num_rows));
-    array<int32> storage{exec, storage_size};
+        pattern->get_const_row_ptrs(), pattern->get_const_col_idxs(), num_rows,
+        allowed_sparsity, symbolic->storage_offsets_.get_data()));
+    const auto storage_size =
+        static_cast<size_type>(exec->copy_val_to_host(
+            symbolic->storage_offsets_.get_const_data() + num_rows));
+    symbolic->storage_.resize_and_reset(storage_size);
     exec->run(make_build_lookup(
-        factors->get_const_row_ptrs(), factors->get_const_col_idxs(), num_rows,
-        allowed_sparsity, storage_offsets.get_const_data(),
-        row_descs.get_data(), storage.get_data()));
+        pattern->get_const_row_ptrs(), pattern->get_const_col_idxs(), num_rows,
+        allowed_sparsity, symbolic->storage_offsets_.get_const_data(),
+        symbolic->row_descs_.get_data(), symbolic->storage_.get_data()));
+    return symbolic;
+}
+
+
+template <typename ValueType, typename IndexType>
+std::unique_ptr<Factorization<ValueType, IndexType>>
+Lu<ValueType, IndexType>::generate_numeric(
+    const symbolic_type* symbolic,
+    std::shared_ptr<const LinOp> system_matrix) const
+{
+    GKO_ASSERT_EQUAL_DIMENSIONS(symbolic->pattern_, system_matrix);
+    const auto exec = this->get_executor();
+    // convert and/or sort the matrix if necessary
+    const auto mtx = convert_to_with_sorting<matrix_type>(
+        exec, system_matrix, parameters_.skip_sorting);
+    const auto num_rows = mtx->get_size()[0];
+    const auto& pattern = symbolic->pattern_;
+    const auto factor_nnz = pattern->get_num_nonzeros();
+    auto factors = matrix_type::create(exec, mtx->get_size(), factor_nnz);
+    const auto pattern_exec = pattern->get_executor();
+    exec->copy_from(pattern_exec.get(), factor_nnz,
+                    pattern->get_const_col_idxs(), factors->get_col_idxs());
+    exec->copy_from(pattern_exec.get(), num_rows + 1,
+                    pattern->get_const_row_ptrs(), factors->get_row_ptrs());
+    // update srow to be safe
+    factors->set_strategy(factors->get_strategy());
+    const auto storage_offsets =
+        make_temporary_clone(exec, &symbolic->storage_offsets_);
+    const auto row_descs = make_temporary_clone(exec, &symbolic->row_descs_);
+    const auto storage = make_temporary_clone(exec, &symbolic->storage_);
+    array<IndexType> diag_idxs{exec, num_rows};
     // initialize factors
     exec->run(make_fill_array(factors->get_values(),
                               factors->get_num_stored_elements(),
                               zero<ValueType>()));
-    exec->run(make_initialize(
-        mtx.get(), storage_offsets.get_const_data(), row_descs.get_const_data(),
-        storage.get_const_data(), diag_idxs.get_data(), factors.get()));
+    exec->run(make_initialize(mtx.get(), storage_offsets->get_const_data(),
+                              row_descs->get_const_data(),
+                              storage->get_const_data(), diag_idxs.get_data(),
+                              factors.get()));
     // run numerical factorization
     array<int> tmp{exec};
-    exec->run(make_factorize(storage_offsets.get_const_data(),
-                             row_descs.get_const_data(),
-                             storage.get_const_data(),
-                             diag_idxs.get_const_data(), factors.get(), tmp));
+    exec->run(make_factorize(
+        storage_offsets->get_const_data(), row_descs->get_const_data(),
+        storage->get_const_data(), diag_idxs.get_const_data(), factors.get(),
+        tmp));
     return factorization_type::create_from_combined_lu(std::move(factors));
 }
 
 
+template <typename ValueType, typename IndexType>
+std::unique_ptr<LinOp> Lu<ValueType, IndexType>::generate_impl(
+    std::shared_ptr<const LinOp> system_matrix) const
+{
+    const auto symbolic = this->generate_symbolic(system_matrix);
+    return this->generate_numeric(symbolic.get(), system_matrix);
+}
+
+
 #define GKO_DECLARE_LU(ValueType, IndexType) class Lu<ValueType, IndexType>
 
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_LU);
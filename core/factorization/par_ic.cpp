@@ -147,6 +147,61 @@ std::unique_ptr<Composition<ValueType>> ParIc<ValueType, IndexType>::generate(
 }
 
 
+template <typename ValueType, typename IndexType>
+std::unique_ptr<ParIc<ValueType, IndexType>>
+ParIc<ValueType, IndexType>::refactorize(
+    std::shared_ptr<const LinOp> system_matrix) const
+{
+    using CsrMatrix = matrix::Csr<ValueType, IndexType>;
+    using CooMatrix = matrix::Coo<ValueType, IndexType>;
+
+    GKO_ASSERT_EQUAL_DIMENSIONS(this, system_matrix);
+
+    const auto exec = this->get_executor();
+
+    auto csr_system_matrix = CsrMatrix::create(exec);
+    as<ConvertibleTo<CsrMatrix>>(system_matrix.get())
+        ->convert_to(csr_system_matrix.get());
+    if (!parameters_.skip_sorting) {
+        csr_system_matrix->sort_by_column_index();
+    }
+    exec->run(par_ic_factorization::make_add_diagonal_elements(
+        csr_system_matrix.get(), true));
+
+    // start the sweeps from the current factor
+    std::shared_ptr<matrix_type> l_factor = this->get_l_factor()->clone();
+    const auto matrix_size = l_factor->get_size();
+    const auto l_nnz = l_factor->get_num_stored_elements();
+
+    // the lower triangle of the system matrix has the sparsity pattern of L
+    auto a_lower = l_factor->clone();
+    exec->run(par_ic_factorization::make_initialize_l(csr_system_matrix.get(),
+                                                      a_lower.get(), false));
+    auto a_lower_coo = CooMatrix::create(
+        exec, matrix_size, make_array_view(exec, l_nnz, a_lower->get_values()),
+        make_array_view(exec, l_nnz, a_lower->get_col_idxs()),
+        array<IndexType>{exec, l_nnz});
+    exec->run(par_ic_factorization::make_convert_ptrs_to_idxs(
+        a_lower->get_const_row_ptrs(), matrix_size[0],
+        a_lower_coo->get_row_idxs()));
+
+    exec->run(par_ic_factorization::make_compute_factor(
+        parameters_.iterations, a_lower_coo.get(), l_factor.get()));
+
+    std::unique_ptr<ParIc> result{new ParIc{*this}};
+    if (parameters_.both_factors) {
+        auto lh_factor = l_factor->conj_transpose();
+        Composition<ValueType>::create(std::move(l_factor),
+                                       std::move(lh_factor))
+            ->move_to(result.get());
+    } else {
+        Composition<ValueType>::create(std::move(l_factor))
+            ->move_to(result.get());
+    }
+    return result;
+}
+
+
 #define GKO_DECLARE_PAR_IC(ValueType, IndexType) \
     class ParIc<ValueType, IndexType>
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_PAR_IC);
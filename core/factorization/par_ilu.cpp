@@ -164,6 +164,48 @@ ParIlu<ValueType, IndexType>::generate_l_u(
 }
 
 
+template <typename ValueType, typename IndexType>
+std::unique_ptr<ParIlu<ValueType, IndexType>>
+ParIlu<ValueType, IndexType>::refactorize(
+    std::shared_ptr<const LinOp> system_matrix) const
+{
+    using CsrMatrix = matrix::Csr<ValueType, IndexType>;
+    using CooMatrix = matrix::Coo<ValueType, IndexType>;
+
+    GKO_ASSERT_EQUAL_DIMENSIONS(this, system_matrix);
+
+    const auto exec = this->get_executor();
+
+    auto csr_system_matrix = CsrMatrix::create(exec);
+    as<ConvertibleTo<CsrMatrix>>(system_matrix.get())
+        ->convert_to(csr_system_matrix.get());
+    if (!parameters_.skip_sorting) {
+        csr_system_matrix->sort_by_column_index();
+    }
+    exec->run(par_ilu_factorization::make_add_diagonal_elements(
+        csr_system_matrix.get(), true));
+    auto coo_system_matrix = CooMatrix::create(exec);
+    csr_system_matrix->move_to(coo_system_matrix.get());
+
+    // start the sweeps from the current factors
+    std::shared_ptr<l_matrix_type> l_factor = this->get_l_factor()->clone();
+    std::shared_ptr<u_matrix_type> u_factor = this->get_u_factor()->clone();
+    auto u_factor_transpose = as<u_matrix_type>(u_factor->transpose());
+
+    exec->run(par_ilu_factorization::make_compute_l_u_factors(
+        parameters_.iterations, coo_system_matrix.get(), l_factor.get(),
+        u_factor_transpose.get()));
+
+    exec->run(par_ilu_factorization::make_csr_transpose(
+        u_factor_transpose.get(), u_factor.get()));
+
+    std::unique_ptr<ParIlu> result{new ParIlu{*this}};
+    Composition<ValueType>::create(std::move(l_factor), std::move(u_factor))
+        ->move_to(result.get());
+    return result;
+}
+
+
 #define GKO_DECLARE_PAR_ILU(ValueType, IndexType) \
     class ParIlu<ValueType, IndexType>
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_PAR_ILU);
@@ -253,6 +253,56 @@ ParIlut<ValueType, IndexType>::generate_l_u(
 }
 
 
+template <typename ValueType, typename IndexType>
+std::unique_ptr<ParIlut<ValueType, IndexType>>
+ParIlut<ValueType, IndexType>::refactorize(
+    std::shared_ptr<const LinOp> system_matrix) const
+{
+    using CsrMatrix = matrix::Csr<ValueType, IndexType>;
+    using CooMatrix = matrix::Coo<ValueType, IndexType>;
+
+    GKO_ASSERT_EQUAL_DIMENSIONS(this, system_matrix);
+
+    const auto exec = this->get_executor();
+
+    auto csr_system_matrix = convert_to_with_sorting<CsrMatrix>(
+        exec, system_matrix, parameters_.skip_sorting);
+
+    // keep the sparsity pattern of the current factors
+    std::shared_ptr<CsrMatrix> l = this->get_l_factor()->clone();
+    std::shared_ptr<CsrMatrix> u = this->get_u_factor()->clone();
+    const auto mtx_size = l->get_size();
+    const auto l_nnz = l->get_num_stored_elements();
+    const auto u_nnz = u->get_num_stored_elements();
+    auto u_csc = CsrMatrix::create(exec, mtx_size, u_nnz);
+    exec->run(make_csr_transpose(u.get(), u_csc.get()));
+    // COO representations of L and U aliasing their values
+    auto l_coo = CooMatrix::create(
+        exec, mtx_size, make_array_view(exec, l_nnz, l->get_values()),
+        make_array_view(exec, l_nnz, l->get_col_idxs()),
+        array<IndexType>{exec, l_nnz});
+    auto u_coo = CooMatrix::create(
+        exec, mtx_size, make_array_view(exec, u_nnz, u->get_values()),
+        make_array_view(exec, u_nnz, u->get_col_idxs()),
+        array<IndexType>{exec, u_nnz});
+    exec->run(make_convert_ptrs_to_idxs(
+        l->get_const_row_ptrs(), mtx_size[0], l_coo->get_row_idxs()));
+    exec->run(make_convert_ptrs_to_idxs(
+        u->get_const_row_ptrs(), mtx_size[0], u_coo->get_row_idxs()));
+
+    for (size_type it = 0; it < parameters_.iterations; ++it) {
+        exec->run(make_compute_l_u_factors(csr_system_matrix.get(), l.get(),
+                                           l_coo.get(), u.get(), u_coo.get(),
+                                           u_csc.get()));
+    }
+
+    std::unique_ptr<ParIlut> result{new ParIlut{*this}};
+    Composition<ValueType>::create(std::move(l), std::move(u))
+        ->move_to(result.get());
+    return result;
+}
+
+
 template <typename ValueType, typename IndexType>
 void ParIlutState<ValueType, IndexType>::iterate()
 {
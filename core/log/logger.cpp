@@ -76,6 +76,8 @@ constexpr Logger::mask_type Logger::criterion_check_completed_mask;
 
 constexpr Logger::mask_type Logger::iteration_complete_mask;
 
+constexpr Logger::mask_type Logger::batch_solver_completed_mask;
+
 
 }  // namespace log
 }  // namespace gko
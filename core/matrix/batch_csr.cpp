@@ -0,0 +1,191 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2022, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include <ginkgo/core/matrix/batch_csr.hpp>
+
+
+#include <algorithm>
+#include <numeric>
+
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/precision_dispatch.hpp>
+#include <ginkgo/core/base/temporary_clone.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+
+#include "core/matrix/batch_csr_kernels.hpp"
+
+
+namespace gko {
+namespace matrix {
+namespace batch_csr {
+namespace {
+
+
+GKO_REGISTER_OPERATION(spmv, batch_csr::spmv);
+GKO_REGISTER_OPERATION(advanced_spmv, batch_csr::advanced_spmv);
+
+
+}  // anonymous namespace
+}  // namespace batch_csr
+
+
+template <typename ValueType, typename IndexType>
+std::unique_ptr<typename BatchCsr<ValueType, IndexType>::unbatch_type>
+BatchCsr<ValueType, IndexType>::create_view_for_item(size_type item)
+{
+    GKO_ENSURE_IN_BOUNDS(item, num_batch_items_);
+    auto exec = this->get_executor();
+    const auto nnz = this->get_num_stored_elements_per_item();
+    return unbatch_type::create(
+        exec, common_size_,
+        make_array_view(exec, nnz, this->get_values_for_item(item)),
+        make_array_view(exec, nnz, this->get_col_idxs()),
+        make_array_view(exec, common_size_[0] + 1, this->get_row_ptrs()));
+}
+
+
+template <typename ValueType, typename IndexType>
+std::unique_ptr<const typename BatchCsr<ValueType, IndexType>::unbatch_type>
+BatchCsr<ValueType, IndexType>::create_const_view_for_item(
+    size_type item) const
+{
+    GKO_ENSURE_IN_BOUNDS(item, num_batch_items_);
+    auto exec = this->get_executor();
+    const auto nnz = this->get_num_stored_elements_per_item();
+    return unbatch_type::create_const(
+        exec, common_size_,
+        make_const_array_view(exec, nnz, this->get_const_values_for_item(item)),
+        make_const_array_view(exec, nnz, this->get_const_col_idxs()),
+        make_const_array_view(exec, common_size_[0] + 1,
+                              this->get_const_row_ptrs()));
+}
+
+
+template <typename ValueType, typename IndexType>
+void BatchCsr<ValueType, IndexType>::read(const std::vector<mat_data>& data)
+{
+    auto host_exec = this->get_executor()->get_master();
+    const auto num_batch_items = data.size();
+    const auto common_size = num_batch_items > 0 ? data[0].size : dim<2>{};
+    auto pattern = num_batch_items > 0 ? data[0] : mat_data{};
+    pattern.ensure_row_major_order();
+    const auto nnz = pattern.nonzeros.size();
+    array<index_type> row_ptrs{host_exec, common_size[0] + 1};
+    array<index_type> col_idxs{host_exec, nnz};
+    array<value_type> values{host_exec, num_batch_items * nnz};
+    std::fill_n(row_ptrs.get_data(), row_ptrs.get_num_elems(), 0);
+    for (size_type nz = 0; nz < nnz; nz++) {
+        row_ptrs.get_data()[pattern.nonzeros[nz].row + 1]++;
+        col_idxs.get_data()[nz] = pattern.nonzeros[nz].column;
+    }
+    std::partial_sum(row_ptrs.get_const_data(),
+                     row_ptrs.get_const_data() + row_ptrs.get_num_elems(),
+                     row_ptrs.get_data());
+    for (size_type item = 0; item < num_batch_items; item++) {
+        auto item_data = data[item];
+        item_data.ensure_row_major_order();
+        GKO_ASSERT_EQUAL_DIMENSIONS(common_size, item_data.size);
+        GKO_ASSERT_EQ(nnz, item_data.nonzeros.size());
+        for (size_type nz = 0; nz < nnz; nz++) {
+            const auto& entry = item_data.nonzeros[nz];
+            GKO_ASSERT_EQ(pattern.nonzeros[nz].row, entry.row);
+            GKO_ASSERT_EQ(pattern.nonzeros[nz].column, entry.column);
+            values.get_data()[item * nnz + nz] = entry.value;
+        }
+    }
+    num_batch_items_ = num_batch_items;
+    common_size_ = common_size;
+    this->set_size(dim<2>{num_batch_items} * common_size);
+    values_ = values;
+    col_idxs_ = col_idxs;
+    row_ptrs_ = row_ptrs;
+}
+
+
+template <typename ValueType, typename IndexType>
+void BatchCsr<ValueType, IndexType>::write(std::vector<mat_data>& data) const
+{
+    auto tmp = make_temporary_clone(this->get_executor()->get_master(), this);
+    const auto row_ptrs = tmp->get_const_row_ptrs();
+    const auto col_idxs = tmp->get_const_col_idxs();
+    data.assign(num_batch_items_, mat_data{common_size_});
+    for (size_type item = 0; item < num_batch_items_; item++) {
+        const auto values = tmp->get_const_values_for_item(item);
+        for (size_type row = 0; row < common_size_[0]; row++) {
+            for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+                data[item].nonzeros.emplace_back(row, col_idxs[nz],
+                                                 values[nz]);
+            }
+        }
+    }
+}
+
+
+template <typename ValueType, typename IndexType>
+void BatchCsr<ValueType, IndexType>::apply_impl(const LinOp* b,
+                                                LinOp* x) const
+{
+    precision_dispatch_real_complex<ValueType>(
+        [this](auto dense_b, auto dense_x) {
+            this->get_executor()->run(
+                batch_csr::make_spmv(this, dense_b, dense_x));
+        },
+        b, x);
+}
+
+
+template <typename ValueType, typename IndexType>
+void BatchCsr<ValueType, IndexType>::apply_impl(const LinOp* alpha,
+                                                const LinOp* b,
+                                                const LinOp* beta,
+                                                LinOp* x) const
+{
+    precision_dispatch_real_complex<ValueType>(
+        [this](auto dense_alpha, auto dense_b, auto dense_beta, auto dense_x) {
+            this->get_executor()->run(batch_csr::make_advanced_spmv(
+                dense_alpha, this, dense_b, dense_beta, dense_x));
+        },
+        alpha, b, beta, x);
+}
+
+
+#define GKO_DECLARE_BATCH_CSR_MATRIX(ValueType) class BatchCsr<ValueType, int32>
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_BATCH_CSR_MATRIX);
+
+
+}  // namespace matrix
+}  // namespace gko
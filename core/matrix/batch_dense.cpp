@@ -0,0 +1,202 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2022, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include <ginkgo/core/matrix/batch_dense.hpp>
+
+
+#include <algorithm>
+
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/precision_dispatch.hpp>
+#include <ginkgo/core/base/temporary_clone.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+
+#include "core/matrix/batch_dense_kernels.hpp"
+
+
+namespace gko {
+namespace matrix {
+namespace batch_dense {
+namespace {
+
+
+GKO_REGISTER_OPERATION(simple_apply, batch_dense::simple_apply);
+GKO_REGISTER_OPERATION(apply, batch_dense::apply);
+
+
+template <typename ValueType, typename IndexType>
+array<ValueType> read_values(
+    std::shared_ptr<const Executor> host_exec,
+    const std::vector<matrix_data<ValueType, IndexType>>& data)
+{
+    const auto common_size = data.empty() ? dim<2>{} : data[0].size;
+    const auto num_elems = common_size[0] * common_size[1];
+    array<ValueType> values{host_exec, data.size() * num_elems};
+    std::fill_n(values.get_data(), values.get_num_elems(), zero<ValueType>());
+    for (size_type item = 0; item < data.size(); item++) {
+        GKO_ASSERT_EQUAL_DIMENSIONS(common_size, data[item].size);
+        for (const auto& entry : data[item].nonzeros) {
+            values.get_data()[item * num_elems + entry.row * common_size[1] +
+                              entry.column] += entry.value;
+        }
+    }
+    return values;
+}
+
+
+template <typename ValueType, typename IndexType>
+void write_values(const BatchDense<ValueType>* source,
+                  std::vector<matrix_data<ValueType, IndexType>>& data)
+{
+    const auto common_size = source->get_common_size();
+    data.assign(source->get_num_batch_items(),
+                matrix_data<ValueType, IndexType>{common_size});
+    for (size_type item = 0; item < data.size(); item++) {
+        for (size_type row = 0; row < common_size[0]; row++) {
+            for (size_type col = 0; col < common_size[1]; col++) {
+                if (is_nonzero(source->at(item, row, col))) {
+                    data[item].nonzeros.emplace_back(
+                        row, col, source->at(item, row, col));
+                }
+            }
+        }
+    }
+}
+
+
+}  // anonymous namespace
+}  // namespace batch_dense
+
+
+template <typename ValueType>
+std::unique_ptr<typename BatchDense<ValueType>::unbatch_type>
+BatchDense<ValueType>::create_view_for_item(size_type item)
+{
+    GKO_ENSURE_IN_BOUNDS(item, num_batch_items_);
+    auto exec = this->get_executor();
+    return unbatch_type::create(
+        exec, common_size_,
+        make_array_view(exec, this->get_num_stored_elements_per_item(),
+                        this->get_values_for_item(item)),
+        common_size_[1]);
+}
+
+
+template <typename ValueType>
+std::unique_ptr<const typename BatchDense<ValueType>::unbatch_type>
+BatchDense<ValueType>::create_const_view_for_item(size_type item) const
+{
+    GKO_ENSURE_IN_BOUNDS(item, num_batch_items_);
+    auto exec = this->get_executor();
+    return unbatch_type::create_const(
+        exec, common_size_,
+        make_const_array_view(exec, this->get_num_stored_elements_per_item(),
+                              this->get_const_values_for_item(item)),
+        common_size_[1]);
+}
+
+
+template <typename ValueType>
+void BatchDense<ValueType>::read(const std::vector<mat_data>& data)
+{
+    auto values =
+        batch_dense::read_values(this->get_executor()->get_master(), data);
+    num_batch_items_ = data.size();
+    common_size_ = data.empty() ? dim<2>{} : data[0].size;
+    this->set_size(dim<2>{num_batch_items_} * common_size_);
+    values_ = values;
+}
+
+
+template <typename ValueType>
+void BatchDense<ValueType>::read(const std::vector<mat_data32>& data)
+{
+    auto values =
+        batch_dense::read_values(this->get_executor()->get_master(), data);
+    num_batch_items_ = data.size();
+    common_size_ = data.empty() ? dim<2>{} : data[0].size;
+    this->set_size(dim<2>{num_batch_items_} * common_size_);
+    values_ = values;
+}
+
+
+template <typename ValueType>
+void BatchDense<ValueType>::write(std::vector<mat_data>& data) const
+{
+    auto tmp = make_temporary_clone(this->get_executor()->get_master(), this);
+    batch_dense::write_values(tmp.get(), data);
+}
+
+
+template <typename ValueType>
+void BatchDense<ValueType>::write(std::vector<mat_data32>& data) const
+{
+    auto tmp = make_temporary_clone(this->get_executor()->get_master(), this);
+    batch_dense::write_values(tmp.get(), data);
+}
+
+
+template <typename ValueType>
+void BatchDense<ValueType>::apply_impl(const LinOp* b, LinOp* x) const
+{
+    precision_dispatch_real_complex<ValueType>(
+        [this](auto dense_b, auto dense_x) {
+            this->get_executor()->run(
+                batch_dense::make_simple_apply(this, dense_b, dense_x));
+        },
+        b, x);
+}
+
+
+template <typename ValueType>
+void BatchDense<ValueType>::apply_impl(const LinOp* alpha, const LinOp* b,
+                                       const LinOp* beta, LinOp* x) const
+{
+    precision_dispatch_real_complex<ValueType>(
+        [this](auto dense_alpha, auto dense_b, auto dense_beta, auto dense_x) {
+            this->get_executor()->run(batch_dense::make_apply(
+                dense_alpha, this, dense_b, dense_beta, dense_x));
+        },
+        alpha, b, beta, x);
+}
+
+
+#define GKO_DECLARE_BATCH_DENSE_MATRIX(ValueType) class BatchDense<ValueType>
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_BATCH_DENSE_MATRIX);
+
+
+}  // namespace matrix
+}  // namespace gko
@@ -0,0 +1,202 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2022, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include <ginkgo/core/matrix/batch_ell.hpp>
+
+
+#include <algorithm>
+#include <vector>
+
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/precision_dispatch.hpp>
+#include <ginkgo/core/base/temporary_clone.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/matrix/ell.hpp>
+
+
+#include "core/matrix/batch_ell_kernels.hpp"
+
+
+namespace gko {
+namespace matrix {
+namespace batch_ell {
+namespace {
+
+
+GKO_REGISTER_OPERATION(spmv, batch_ell::spmv);
+GKO_REGISTER_OPERATION(advanced_spmv, batch_ell::advanced_spmv);
+
+
+}  // anonymous namespace
+}  // namespace batch_ell
+
+
+template <typename ValueType, typename IndexType>
+std::unique_ptr<typename BatchEll<ValueType, IndexType>::unbatch_type>
+BatchEll<ValueType, IndexType>::create_view_for_item(size_type item)
+{
+    GKO_ENSURE_IN_BOUNDS(item, num_batch_items_);
+    auto exec = this->get_executor();
+    const auto num_elems = this->get_num_stored_elements_per_item();
+    return unbatch_type::create(
+        exec, common_size_,
+        make_array_view(exec, num_elems, this->get_values_for_item(item)),
+        make_array_view(exec, num_elems, this->get_col_idxs()),
+        num_stored_elements_per_row_, common_size_[0]);
+}
+
+
+template <typename ValueType, typename IndexType>
+std::unique_ptr<const typename BatchEll<ValueType, IndexType>::unbatch_type>
+BatchEll<ValueType, IndexType>::create_const_view_for_item(
+    size_type item) const
+{
+    GKO_ENSURE_IN_BOUNDS(item, num_batch_items_);
+    auto exec = this->get_executor();
+    const auto num_elems = this->get_num_stored_elements_per_item();
+    return unbatch_type::create_const(
+        exec, common_size_,
+        make_const_array_view(exec, num_elems,
+                              this->get_const_values_for_item(item)),
+        make_const_array_view(exec, num_elems, this->get_const_col_idxs()),
+        num_stored_elements_per_row_, common_size_[0]);
+}
+
+
+template <typename ValueType, typename IndexType>
+void BatchEll<ValueType, IndexType>::read(const std::vector<mat_data>& data)
+{
+    auto host_exec = this->get_executor()->get_master();
+    const auto num_batch_items = data.size();
+    const auto common_size = num_batch_items > 0 ? data[0].size : dim<2>{};
+    const auto num_rows = common_size[0];
+    auto pattern = num_batch_items > 0 ? data[0] : mat_data{};
+    pattern.ensure_row_major_order();
+    const auto nnz = pattern.nonzeros.size();
+    // the position of each nonzero in the column-major ELL storage
+    std::vector<size_type> row_nnz(num_rows);
+    std::vector<size_type> positions(nnz);
+    for (size_type nz = 0; nz < nnz; nz++) {
+        const auto row = pattern.nonzeros[nz].row;
+        positions[nz] = row + row_nnz[row] * num_rows;
+        row_nnz[row]++;
+    }
+    const auto max_row_nnz =
+        num_rows > 0 ? *std::max_element(row_nnz.begin(), row_nnz.end()) : 0;
+    const auto num_elems = num_rows * max_row_nnz;
+    array<index_type> col_idxs{host_exec, num_elems};
+    array<value_type> values{host_exec, num_batch_items * num_elems};
+    std::fill_n(col_idxs.get_data(), num_elems, invalid_index<IndexType>());
+    std::fill_n(values.get_data(), values.get_num_elems(), zero<ValueType>());
+    for (size_type nz = 0; nz < nnz; nz++) {
+        col_idxs.get_data()[positions[nz]] = pattern.nonzeros[nz].column;
+    }
+    for (size_type item = 0; item < num_batch_items; item++) {
+        auto item_data = data[item];
+        item_data.ensure_row_major_order();
+        GKO_ASSERT_EQUAL_DIMENSIONS(common_size, item_data.size);
+        GKO_ASSERT_EQ(nnz, item_data.nonzeros.size());
+        for (size_type nz = 0; nz < nnz; nz++) {
+            const auto& entry = item_data.nonzeros[nz];
+            GKO_ASSERT_EQ(pattern.nonzeros[nz].row, entry.row);
+            GKO_ASSERT_EQ(pattern.nonzeros[nz].column, entry.column);
+            values.get_data()[item * num_elems + positions[nz]] = entry.value;
+        }
+    }
+    num_batch_items_ = num_batch_items;
+    common_size_ = common_size;
+    num_stored_elements_per_row_ = max_row_nnz;
+    this->set_size(dim<2>{num_batch_items} * common_size);
+    values_ = values;
+    col_idxs_ = col_idxs;
+}
+
+
+template <typename ValueType, typename IndexType>
+void BatchEll<ValueType, IndexType>::write(std::vector<mat_data>& data) const
+{
+    auto tmp = make_temporary_clone(this->get_executor()->get_master(), this);
+    const auto num_rows = common_size_[0];
+    const auto col_idxs = tmp->get_const_col_idxs();
+    data.assign(num_batch_items_, mat_data{common_size_});
+    for (size_type item = 0; item < num_batch_items_; item++) {
+        const auto values = tmp->get_const_values_for_item(item);
+        for (size_type row = 0; row < num_rows; row++) {
+            for (size_type i = 0; i < num_stored_elements_per_row_; i++) {
+                const auto idx = row + i * num_rows;
+                if (col_idxs[idx] != invalid_index<IndexType>()) {
+                    data[item].nonzeros.emplace_back(row, col_idxs[idx],
+                                                     values[idx]);
+                }
+            }
+        }
+    }
+}
+
+
+template <typename ValueType, typename IndexType>
+void BatchEll<ValueType, IndexType>::apply_impl(const LinOp* b,
+                                                LinOp* x) const
+{
+    precision_dispatch_real_complex<ValueType>(
+        [this](auto dense_b, auto dense_x) {
+            this->get_executor()->run(
+                batch_ell::make_spmv(this, dense_b, dense_x));
+        },
+        b, x);
+}
+
+
+template <typename ValueType, typename IndexType>
+void BatchEll<ValueType, IndexType>::apply_impl(const LinOp* alpha,
+                                                const LinOp* b,
+                                                const LinOp* beta,
+                                                LinOp* x) const
+{
+    precision_dispatch_real_complex<ValueType>(
+        [this](auto dense_alpha, auto dense_b, auto dense_beta, auto dense_x) {
+            this->get_executor()->run(batch_ell::make_advanced_spmv(
+                dense_alpha, this, dense_b, dense_beta, dense_x));
+        },
+        alpha, b, beta, x);
+}
+
+
+#define GKO_DECLARE_BATCH_ELL_MATRIX(ValueType) class BatchEll<ValueType, int32>
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_BATCH_ELL_MATRIX);
+
+
+}  // namespace matrix
+}  // namespace gko
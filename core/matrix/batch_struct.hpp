@@ -0,0 +1,258 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2022, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#ifndef GKO_CORE_MATRIX_BATCH_STRUCT_HPP_
+#define GKO_CORE_MATRIX_BATCH_STRUCT_HPP_
+
+
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/matrix/batch_csr.hpp>
+#include <ginkgo/core/matrix/batch_dense.hpp>
+#include <ginkgo/core/matrix/batch_ell.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/stop/residual_norm.hpp>
+
+
+namespace gko {
+namespace kernels {
+/**
+ * @brief Host kernels shared by the Reference and OpenMP executors.
+ *
+ * They operate on a single batch item and are meant to be called from the
+ * loop over the batch items of the executor kernels.
+ */
+namespace host {
+
+
+/**
+ * Non-owning view of a single batch item of a BatchCsr matrix.
+ */
+template <typename ValueType>
+struct batch_csr_item {
+    const ValueType* values;
+    const int32* col_idxs;
+    const int32* row_ptrs;
+    size_type num_rows;
+    size_type num_cols;
+};
+
+
+/**
+ * Non-owning view of a single batch item of a BatchEll matrix. The entries are
+ * stored column-major with a stride of `num_rows`.
+ */
+template <typename ValueType>
+struct batch_ell_item {
+    const ValueType* values;
+    const int32* col_idxs;
+    size_type num_stored_elements_per_row;
+    size_type num_rows;
+    size_type num_cols;
+};
+
+
+/**
+ * Non-owning view of a single batch item of a BatchDense matrix, stored
+ * row-major without padding.
+ */
+template <typename ValueType>
+struct batch_dense_item {
+    const ValueType* values;
+    size_type num_rows;
+    size_type num_cols;
+};
+
+
+template <typename ValueType>
+inline batch_csr_item<ValueType> extract_batch_item(
+    const matrix::BatchCsr<ValueType, int32>* mat, size_type item)
+{
+    return {mat->get_const_values_for_item(item), mat->get_const_col_idxs(),
+            mat->get_const_row_ptrs(), mat->get_common_size()[0],
+            mat->get_common_size()[1]};
+}
+
+
+template <typename ValueType>
+inline batch_ell_item<ValueType> extract_batch_item(
+    const matrix::BatchEll<ValueType, int32>* mat, size_type item)
+{
+    return {mat->get_const_values_for_item(item), mat->get_const_col_idxs(),
+            mat->get_num_stored_elements_per_row(), mat->get_common_size()[0],
+            mat->get_common_size()[1]};
+}
+
+
+template <typename ValueType>
+inline batch_dense_item<ValueType> extract_batch_item(
+    const matrix::BatchDense<ValueType>* mat, size_type item)
+{
+    return {mat->get_const_values_for_item(item), mat->get_common_size()[0],
+            mat->get_common_size()[1]};
+}
+
+
+/**
+ * Computes c = A * b for a single batch item. `b` and `c` are contiguous.
+ */
+template <typename ValueType>
+inline void simple_apply(const batch_csr_item<ValueType>& a,
+                         const ValueType* b, ValueType* c)
+{
+    for (size_type row = 0; row < a.num_rows; row++) {
+        auto sum = zero<ValueType>();
+        for (auto nz = a.row_ptrs[row]; nz < a.row_ptrs[row + 1]; nz++) {
+            sum += a.values[nz] * b[a.col_idxs[nz]];
+        }
+        c[row] = sum;
+    }
+}
+
+
+template <typename ValueType>
+inline void simple_apply(const batch_ell_item<ValueType>& a,
+                         const ValueType* b, ValueType* c)
+{
+    for (size_type row = 0; row < a.num_rows; row++) {
+        c[row] = zero<ValueType>();
+    }
+    for (size_type i = 0; i < a.num_stored_elements_per_row; i++) {
+        const auto offset = i * a.num_rows;
+        for (size_type row = 0; row < a.num_rows; row++) {
+            const auto col = a.col_idxs[offset + row];
+            if (col != invalid_index<int32>()) {
+                c[row] += a.values[offset + row] * b[col];
+            }
+        }
+    }
+}
+
+
+template <typename ValueType>
+inline void simple_apply(const batch_dense_item<ValueType>& a,
+                         const ValueType* b, ValueType* c)
+{
+    for (size_type row = 0; row < a.num_rows; row++) {
+        auto sum = zero<ValueType>();
+        for (size_type col = 0; col < a.num_cols; col++) {
+            sum += a.values[row * a.num_cols + col] * b[col];
+        }
+        c[row] = sum;
+    }
+}
+
+
+/**
+ * Copies column `col` of the rows of batch item `item` in `vec` into the
+ * contiguous vector `out`.
+ */
+template <typename ValueType>
+inline void load_item_vector(const matrix::Dense<ValueType>* vec,
+                             size_type item, size_type col, size_type num_rows,
+                             ValueType* out)
+{
+    for (size_type row = 0; row < num_rows; row++) {
+        out[row] = vec->at(item * num_rows + row, col);
+    }
+}
+
+
+/**
+ * Copies the contiguous vector `in` into column `col` of the rows of batch item
+ * `item` in `vec`.
+ */
+template <typename ValueType>
+inline void store_item_vector(const ValueType* in, size_type item,
+                              size_type col, size_type num_rows,
+                              matrix::Dense<ValueType>* vec)
+{
+    for (size_type row = 0; row < num_rows; row++) {
+        vec->at(item * num_rows + row, col) = in[row];
+    }
+}
+
+
+/**
+ * Computes the dot product conj(x)^T * y of two contiguous vectors.
+ */
+template <typename ValueType>
+inline ValueType dot(size_type size, const ValueType* x, const ValueType* y)
+{
+    auto result = zero<ValueType>();
+    for (size_type i = 0; i < size; i++) {
+        result += conj(x[i]) * y[i];
+    }
+    return result;
+}
+
+
+/**
+ * Computes the Euclidean norm of a contiguous vector.
+ */
+template <typename ValueType>
+inline remove_complex<ValueType> norm2(size_type size, const ValueType* x)
+{
+    auto result = zero<remove_complex<ValueType>>();
+    for (size_type i = 0; i < size; i++) {
+        result += squared_norm(x[i]);
+    }
+    return sqrt(result);
+}
+
+
+/**
+ * Returns the residual norm below which a batch system counts as converged.
+ */
+template <typename RealType>
+inline RealType convergence_threshold(stop::mode tolerance_type,
+                                      RealType tolerance, RealType rhs_norm,
+                                      RealType initial_residual_norm)
+{
+    switch (tolerance_type) {
+    case stop::mode::absolute:
+        return tolerance;
+    case stop::mode::initial_resnorm:
+        return tolerance * initial_residual_norm;
+    default:
+        return tolerance * rhs_norm;
+    }
+}
+
+
+}  // namespace host
+}  // namespace kernels
+}  // namespace gko
+
+
+#endif  // GKO_CORE_MATRIX_BATCH_STRUCT_HPP_
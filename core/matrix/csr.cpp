@@ -41,12 +41,14 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ginkgo/core/base/precision_dispatch.hpp>
 #include <ginkgo/core/base/utils.hpp>
 #include <ginkgo/core/matrix/coo.hpp>
+#include <ginkgo/core/matrix/delta_csr.hpp>
 #include <ginkgo/core/matrix/dense.hpp>
 #include <ginkgo/core/matrix/ell.hpp>
 #include <ginkgo/core/matrix/fbcsr.hpp>
 #include <ginkgo/core/matrix/identity.hpp>
 #include <ginkgo/core/matrix/sellp.hpp>
 #include <ginkgo/core/matrix/sparsity_csr.hpp>
+#include <ginkgo/core/matrix/symmetric_csr.hpp>
 
 
 #include "core/base/device_matrix_data_kernels.hpp"
@@ -55,9 +57,13 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "core/components/format_conversion_kernels.hpp"
 #include "core/components/prefix_sum_kernels.hpp"
 #include "core/matrix/csr_kernels.hpp"
+#include "core/matrix/delta_csr_kernels.hpp"
 #include "core/matrix/ell_kernels.hpp"
 #include "core/matrix/hybrid_kernels.hpp"
+#include "core/matrix/mixed_precision_spmv.hpp"
 #include "core/matrix/sellp_kernels.hpp"
+#include "core/matrix/sellp_sorting.hpp"
+#include "core/matrix/symmetric_csr_kernels.hpp"
 
 
 namespace gko {
@@ -68,6 +74,8 @@ namespace {
 
 GKO_REGISTER_OPERATION(spmv, csr::spmv);
 GKO_REGISTER_OPERATION(advanced_spmv, csr::advanced_spmv);
+GKO_REGISTER_OPERATION(mixed_spmv, csr::mixed_spmv);
+GKO_REGISTER_OPERATION(advanced_mixed_spmv, csr::advanced_mixed_spmv);
 GKO_REGISTER_OPERATION(spgemm, csr::spgemm);
 GKO_REGISTER_OPERATION(advanced_spgemm, csr::advanced_spgemm);
 GKO_REGISTER_OPERATION(spgeam, csr::spgeam);
@@ -79,6 +87,12 @@ GKO_REGISTER_OPERATION(convert_to_sellp, csr::convert_to_sellp);
 GKO_REGISTER_OPERATION(compute_max_row_nnz, ell::compute_max_row_nnz);
 GKO_REGISTER_OPERATION(convert_to_ell, csr::convert_to_ell);
 GKO_REGISTER_OPERATION(convert_to_fbcsr, csr::convert_to_fbcsr);
+GKO_REGISTER_OPERATION(count_delta_escapes, delta_csr::count_escapes);
+GKO_REGISTER_OPERATION(convert_to_delta_csr, delta_csr::convert_from_csr);
+GKO_REGISTER_OPERATION(count_upper_nonzeros,
+                       symmetric_csr::count_upper_nonzeros);
+GKO_REGISTER_OPERATION(convert_to_symmetric_csr,
+                       symmetric_csr::convert_from_csr);
 GKO_REGISTER_OPERATION(compute_hybrid_coo_row_ptrs,
                        hybrid::compute_coo_row_ptrs);
 GKO_REGISTER_OPERATION(convert_to_hybrid, csr::convert_to_hybrid);
@@ -189,6 +203,13 @@ void Csr<ValueType, IndexType>::apply_impl(const LinOp* b, LinOp* x) const
         // if b is a CSR matrix, we compute a SpGeMM
         auto x_csr = as<TCsr>(x);
         this->get_executor()->run(csr::make_spgemm(this, b_csr, x_csr));
+    } else if (use_mixed_precision_spmv<ValueType>(
+                   this->get_executor().get(), b, x)) {
+        // apply the stored values directly to the vectors in the other
+        // precision instead of converting the vectors
+        using MixedDense = Dense<next_precision<ValueType>>;
+        this->get_executor()->run(csr::make_mixed_spmv(
+            this, as<MixedDense>(b), as<MixedDense>(x)));
     } else {
         precision_dispatch_real_complex<ValueType>(
             [this](auto dense_b, auto dense_x) {
@@ -221,6 +242,14 @@ void Csr<ValueType, IndexType>::apply_impl(const LinOp* alpha, const LinOp* b,
         this->get_executor()->run(
             csr::make_spgeam(as<Dense<ValueType>>(alpha), this,
                              as<Dense<ValueType>>(beta), lend(x_copy), x_csr));
+    } else if (use_mixed_precision_spmv<ValueType>(
+                   this->get_executor().get(), b, x)) {
+        using mixed_type = next_precision<ValueType>;
+        auto dense_alpha = make_temporary_conversion<mixed_type>(alpha);
+        auto dense_beta = make_temporary_conversion<mixed_type>(beta);
+        this->get_executor()->run(csr::make_advanced_mixed_spmv(
+            dense_alpha.get(), this, as<Dense<mixed_type>>(b),
+            dense_beta.get(), as<Dense<mixed_type>>(x)));
     } else {
         precision_dispatch_real_complex<ValueType>(
             [this](auto dense_alpha, auto dense_b, auto dense_beta,
@@ -275,6 +304,43 @@ void Csr<ValueType, IndexType>::move_to(Coo<ValueType, IndexType>* result)
 }
 
 
+template <typename ValueType, typename IndexType>
+void Csr<ValueType, IndexType>::convert_to(
+    DeltaCsr<ValueType, IndexType>* result) const
+{
+    auto exec = this->get_executor();
+    const auto num_rows = this->get_size()[0];
+    // the column deltas are only non-negative for sorted rows
+    std::unique_ptr<Csr> sorted;
+    auto source = this;
+    if (!this->is_sorted_by_column_index()) {
+        sorted = gko::clone(this);
+        sorted->sort_by_column_index();
+        source = sorted.get();
+    }
+    auto tmp = make_temporary_clone(exec, result);
+    tmp->escape_ptrs_.resize_and_reset(num_rows + 1);
+    exec->run(csr::make_count_delta_escapes(source, tmp->get_escape_ptrs()));
+    exec->run(csr::make_prefix_sum(tmp->get_escape_ptrs(), num_rows + 1));
+    const auto num_escapes =
+        exec->copy_val_to_host(tmp->get_const_escape_ptrs() + num_rows);
+    tmp->values_ = source->values_;
+    tmp->row_ptrs_ = source->row_ptrs_;
+    tmp->col_deltas_.resize_and_reset(source->get_num_stored_elements());
+    tmp->col_bases_.resize_and_reset(num_rows);
+    tmp->escape_col_idxs_.resize_and_reset(num_escapes);
+    tmp->set_size(this->get_size());
+    exec->run(csr::make_convert_to_delta_csr(source, tmp.get()));
+}
+
+
+template <typename ValueType, typename IndexType>
+void Csr<ValueType, IndexType>::move_to(DeltaCsr<ValueType, IndexType>* result)
+{
+    this->convert_to(result);
+}
+
+
 template <typename ValueType, typename IndexType>
 void Csr<ValueType, IndexType>::convert_to(Dense<ValueType>* result) const
 {
@@ -335,22 +401,35 @@ void Csr<ValueType, IndexType>::convert_to(
     auto exec = this->get_executor();
     const auto stride_factor = result->get_stride_factor();
     const auto slice_size = result->get_slice_size();
+    const auto sorting_window = result->get_sorting_window();
     const auto num_rows = this->get_size()[0];
     const auto num_slices = ceildiv(num_rows, slice_size);
+    // SELL-C-sigma stores the rows sorted by length within each window
+    array<IndexType> permutation{exec};
+    std::unique_ptr<LinOp> sorted;
+    auto source = this;
+    if (sorting_window > 1) {
+        permutation = sellp::compute_sorting_permutation<IndexType>(
+            exec, this->row_ptrs_, sorting_window);
+        sorted = this->row_permute(&permutation);
+        source = as<Csr>(sorted.get());
+    }
     auto tmp = make_temporary_clone(exec, result);
     tmp->slice_sets_.resize_and_reset(num_slices + 1);
     tmp->slice_lengths_.resize_and_reset(num_slices);
     tmp->stride_factor_ = stride_factor;
     tmp->slice_size_ = slice_size;
-    exec->run(csr::make_compute_slice_sets(this->row_ptrs_, slice_size,
-                                           stride_factor, tmp->get_slice_sets(),
-                                           tmp->get_slice_lengths()));
+    tmp->sorting_window_ = sorting_window;
+    exec->run(csr::make_compute_slice_sets(
+        source->row_ptrs_, slice_size, stride_factor, tmp->get_slice_sets(),
+        tmp->get_slice_lengths()));
     auto total_cols =
         exec->copy_val_to_host(tmp->get_slice_sets() + num_slices);
     tmp->col_idxs_.resize_and_reset(total_cols * slice_size);
     tmp->values_.resize_and_reset(total_cols * slice_size);
+    tmp->permutation_ = std::move(permutation);
     tmp->set_size(this->get_size());
-    exec->run(csr::make_convert_to_sellp(this, tmp.get()));
+    exec->run(csr::make_convert_to_sellp(source, tmp.get()));
 }
 
 
@@ -383,6 +462,41 @@ void Csr<ValueType, IndexType>::move_to(
 }
 
 
+template <typename ValueType, typename IndexType>
+void Csr<ValueType, IndexType>::convert_to(
+    SymmetricCsr<ValueType, IndexType>* result) const
+{
+    GKO_ASSERT_IS_SQUARE_MATRIX(this);
+    auto exec = this->get_executor();
+    const auto num_rows = this->get_size()[0];
+    std::unique_ptr<Csr> sorted;
+    auto source = this;
+    if (!this->is_sorted_by_column_index()) {
+        sorted = gko::clone(this);
+        sorted->sort_by_column_index();
+        source = sorted.get();
+    }
+    auto tmp = make_temporary_clone(exec, result);
+    tmp->row_ptrs_.resize_and_reset(num_rows + 1);
+    exec->run(csr::make_count_upper_nonzeros(source, tmp->get_row_ptrs()));
+    exec->run(csr::make_prefix_sum(tmp->get_row_ptrs(), num_rows + 1));
+    const auto nnz =
+        exec->copy_val_to_host(tmp->get_const_row_ptrs() + num_rows);
+    tmp->values_.resize_and_reset(nnz);
+    tmp->col_idxs_.resize_and_reset(nnz);
+    tmp->set_size(this->get_size());
+    exec->run(csr::make_convert_to_symmetric_csr(source, tmp.get()));
+}
+
+
+template <typename ValueType, typename IndexType>
+void Csr<ValueType, IndexType>::move_to(
+    SymmetricCsr<ValueType, IndexType>* result)
+{
+    this->convert_to(result);
+}
+
+
 template <typename ValueType, typename IndexType>
 void Csr<ValueType, IndexType>::convert_to(
     Ell<ValueType, IndexType>* result) const
@@ -70,6 +70,21 @@ namespace kernels {
                        const matrix::Dense<ValueType>* beta,        \
                        matrix::Dense<ValueType>* c)
 
+#define GKO_DECLARE_CSR_MIXED_SPMV_KERNEL(ValueType, IndexType)        \
+    void mixed_spmv(std::shared_ptr<const DefaultExecutor> exec,       \
+                    const matrix::Csr<ValueType, IndexType>* a,        \
+                    const matrix::Dense<next_precision<ValueType>>* b, \
+                    matrix::Dense<next_precision<ValueType>>* c)
+
+#define GKO_DECLARE_CSR_ADVANCED_MIXED_SPMV_KERNEL(ValueType, IndexType) \
+    void advanced_mixed_spmv(                                            \
+        std::shared_ptr<const DefaultExecutor> exec,                     \
+        const matrix::Dense<next_precision<ValueType>>* alpha,           \
+        const matrix::Csr<ValueType, IndexType>* a,                      \
+        const matrix::Dense<next_precision<ValueType>>* b,               \
+        const matrix::Dense<next_precision<ValueType>>* beta,            \
+        matrix::Dense<next_precision<ValueType>>* c)
+
 #define GKO_DECLARE_CSR_SPGEMM_KERNEL(ValueType, IndexType)  \
     void spgemm(std::shared_ptr<const DefaultExecutor> exec, \
                 const matrix::Csr<ValueType, IndexType>* a,  \
@@ -85,6 +100,18 @@ namespace kernels {
                          const matrix::Csr<ValueType, IndexType>* d,  \
                          matrix::Csr<ValueType, IndexType>* c)
 
+#define GKO_DECLARE_CSR_SPGEMM_NUMERIC_KERNEL(ValueType, IndexType)  \
+    void spgemm_numeric(std::shared_ptr<const DefaultExecutor> exec, \
+                        const matrix::Csr<ValueType, IndexType>* a,  \
+                        const matrix::Csr<ValueType, IndexType>* b,  \
+                        matrix::Csr<ValueType, IndexType>* c)
+
+#define GKO_DECLARE_CSR_SPGEMM_SYMBOLIC_KERNEL(ValueType, IndexType)  \
+    void spgemm_symbolic(std::shared_ptr<const DefaultExecutor> exec, \
+                         const matrix::Csr<ValueType, IndexType>* a,  \
+                         const matrix::Csr<ValueType, IndexType>* b,  \
+                         IndexType* c_row_ptrs, array<IndexType>& c_col_idxs)
+
 #define GKO_DECLARE_CSR_SPGEAM_KERNEL(ValueType, IndexType)  \
     void spgeam(std::shared_ptr<const DefaultExecutor> exec, \
                 const matrix::Dense<ValueType>* alpha,       \
@@ -246,10 +273,18 @@ namespace kernels {
     template <typename ValueType, typename IndexType>                      \
     GKO_DECLARE_CSR_ADVANCED_SPMV_KERNEL(ValueType, IndexType);            \
     template <typename ValueType, typename IndexType>                      \
+    GKO_DECLARE_CSR_MIXED_SPMV_KERNEL(ValueType, IndexType);               \
+    template <typename ValueType, typename IndexType>                      \
+    GKO_DECLARE_CSR_ADVANCED_MIXED_SPMV_KERNEL(ValueType, IndexType);      \
+    template <typename ValueType, typename IndexType>                      \
     GKO_DECLARE_CSR_SPGEMM_KERNEL(ValueType, IndexType);                   \
     template <typename ValueType, typename IndexType>                      \
     GKO_DECLARE_CSR_ADVANCED_SPGEMM_KERNEL(ValueType, IndexType);          \
     template <typename ValueType, typename IndexType>                      \
+    GKO_DECLARE_CSR_SPGEMM_NUMERIC_KERNEL(ValueType, IndexType);           \
+    template <typename ValueType, typename IndexType>                      \
+    GKO_DECLARE_CSR_SPGEMM_SYMBOLIC_KERNEL(ValueType, IndexType);          \
+    template <typename ValueType, typename IndexType>                      \
     GKO_DECLARE_CSR_SPGEAM_KERNEL(ValueType, IndexType);                   \
     template <typename ValueType, typename IndexType>                      \
     GKO_DECLARE_CSR_FILL_IN_DENSE_KERNEL(ValueType, IndexType);            \
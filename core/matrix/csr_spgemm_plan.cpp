@@ -0,0 +1,109 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2022, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include <ginkgo/core/matrix/csr_spgemm_plan.hpp>
+
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/temporary_clone.hpp>
+
+
+#include "core/matrix/csr_kernels.hpp"
+
+
+namespace gko {
+namespace matrix {
+namespace csr_spgemm_plan {
+namespace {
+
+
+GKO_REGISTER_OPERATION(spgemm_symbolic, csr::spgemm_symbolic);
+GKO_REGISTER_OPERATION(spgemm_numeric, csr::spgemm_numeric);
+
+
+}  // anonymous namespace
+}  // namespace csr_spgemm_plan
+
+
+template <typename ValueType, typename IndexType>
+CsrSpgemmPlan<ValueType, IndexType>::CsrSpgemmPlan(
+    std::shared_ptr<const Executor> exec, const matrix_type* a,
+    const matrix_type* b)
+    : exec_{std::move(exec)},
+      size_{a->get_size()[0], b->get_size()[1]},
+      row_ptrs_{exec_, size_[0] + 1},
+      col_idxs_{exec_}
+{
+    GKO_ASSERT_CONFORMANT(a, b);
+    auto local_a = make_temporary_clone(exec_, a);
+    auto local_b = make_temporary_clone(exec_, b);
+    exec_->run(csr_spgemm_plan::make_spgemm_symbolic(
+        local_a.get(), local_b.get(), row_ptrs_.get_data(), col_idxs_));
+}
+
+
+template <typename ValueType, typename IndexType>
+std::unique_ptr<Csr<ValueType, IndexType>>
+CsrSpgemmPlan<ValueType, IndexType>::create_product() const
+{
+    return matrix_type::create(
+        exec_, size_, array<value_type>{exec_, get_num_stored_elements()},
+        col_idxs_, row_ptrs_);
+}
+
+
+template <typename ValueType, typename IndexType>
+void CsrSpgemmPlan<ValueType, IndexType>::compute(const matrix_type* a,
+                                                  const matrix_type* b,
+                                                  matrix_type* c) const
+{
+    GKO_ASSERT_CONFORMANT(a, b);
+    GKO_ASSERT_EQUAL_ROWS(a, size_);
+    GKO_ASSERT_EQUAL_COLS(b, size_);
+    GKO_ASSERT_EQUAL_DIMENSIONS(c, size_);
+    GKO_ASSERT_EQ(c->get_num_stored_elements(), get_num_stored_elements());
+    auto local_a = make_temporary_clone(exec_, a);
+    auto local_b = make_temporary_clone(exec_, b);
+    auto local_c = make_temporary_clone(exec_, c);
+    exec_->run(csr_spgemm_plan::make_spgemm_numeric(
+        local_a.get(), local_b.get(), local_c.get()));
+}
+
+
+#define GKO_DECLARE_CSR_SPGEMM_PLAN(ValueType, IndexType) \
+    class CsrSpgemmPlan<ValueType, IndexType>
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_CSR_SPGEMM_PLAN);
+
+
+}  // namespace matrix
+}  // namespace gko
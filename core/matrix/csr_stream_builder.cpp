@@ -0,0 +1,148 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2022, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#include <ginkgo/core/matrix/csr_stream_builder.hpp>
+
+
+#include <algorithm>
+
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/utils.hpp>
+
+
+#include "core/matrix/csr_builder.hpp"
+
+
+namespace gko {
+namespace matrix {
+
+
+template <typename ValueType, typename IndexType>
+CsrStreamBuilder<ValueType, IndexType>::CsrStreamBuilder(
+    std::shared_ptr<const Executor> exec, const dim<2>& size,
+    size_type expected_num_nonzeros)
+    : exec_{std::move(exec)},
+      matrix_{Csr<ValueType, IndexType>::create(exec_->get_master(), size,
+                                                expected_num_nonzeros)},
+      capacity_{expected_num_nonzeros},
+      num_nonzeros_{},
+      row_{},
+      col_{}
+{}
+
+
+template <typename ValueType, typename IndexType>
+void CsrStreamBuilder<ValueType, IndexType>::reserve(size_type capacity)
+{
+    CsrBuilder<ValueType, IndexType> builder{matrix_.get()};
+    auto& col_idxs = builder.get_col_idx_array();
+    auto& values = builder.get_value_array();
+    const auto host_exec = exec_->get_master();
+    array<IndexType> new_col_idxs{host_exec, capacity};
+    array<ValueType> new_values{host_exec, capacity};
+    const auto num_copied = std::min(num_nonzeros_, capacity);
+    std::copy_n(col_idxs.get_const_data(), num_copied,
+                new_col_idxs.get_data());
+    std::copy_n(values.get_const_data(), num_copied, new_values.get_data());
+    col_idxs = std::move(new_col_idxs);
+    values = std::move(new_values);
+    capacity_ = capacity;
+}
+
+
+template <typename ValueType, typename IndexType>
+void CsrStreamBuilder<ValueType, IndexType>::append(
+    const nonzero_type* entries, size_type num_entries)
+{
+    const auto num_rows = matrix_->get_size()[0];
+    const auto num_cols = matrix_->get_size()[1];
+    if (num_nonzeros_ + num_entries > capacity_) {
+        this->reserve(
+            std::max(2 * capacity_, num_nonzeros_ + num_entries));
+    }
+    const auto row_ptrs = matrix_->get_row_ptrs();
+    const auto col_idxs = matrix_->get_col_idxs();
+    const auto values = matrix_->get_values();
+    for (size_type i = 0; i < num_entries; i++) {
+        const auto& entry = entries[i];
+        const auto row = static_cast<size_type>(entry.row);
+        const auto col = static_cast<size_type>(entry.column);
+        GKO_ENSURE_IN_BOUNDS(row, num_rows);
+        GKO_ENSURE_IN_BOUNDS(col, num_cols);
+        if (row < row_ || (row == row_ && num_nonzeros_ > 0 &&
+                           entry.column < col_)) {
+            GKO_UNSUPPORTED_MATRIX_PROPERTY(
+                "the entries need to be appended in row-major order");
+        }
+        // the rows up to the current one start behind the previous entries
+        for (; row_ < row; row_++) {
+            row_ptrs[row_ + 1] = static_cast<IndexType>(num_nonzeros_);
+        }
+        col_idxs[num_nonzeros_] = entry.column;
+        values[num_nonzeros_] = entry.value;
+        col_ = entry.column;
+        num_nonzeros_++;
+    }
+}
+
+
+template <typename ValueType, typename IndexType>
+std::unique_ptr<Csr<ValueType, IndexType>>
+CsrStreamBuilder<ValueType, IndexType>::finalize()
+{
+    const auto num_rows = matrix_->get_size()[0];
+    const auto row_ptrs = matrix_->get_row_ptrs();
+    for (; row_ < num_rows; row_++) {
+        row_ptrs[row_ + 1] = static_cast<IndexType>(num_nonzeros_);
+    }
+    if (capacity_ != num_nonzeros_) {
+        this->reserve(num_nonzeros_);
+    }
+    // update the strategy information for the final arrays
+    { CsrBuilder<ValueType, IndexType> builder{matrix_.get()}; }
+    if (exec_ == exec_->get_master()) {
+        return std::move(matrix_);
+    }
+    auto result = clone(exec_, matrix_);
+    matrix_.reset();
+    return result;
+}
+
+
+#define GKO_DECLARE_CSR_STREAM_BUILDER(ValueType, IndexType) \
+    class CsrStreamBuilder<ValueType, IndexType>
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_CSR_STREAM_BUILDER);
+
+
+}  // namespace matrix
+}  // namespace gko
@@ -0,0 +1,212 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2022, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#include <ginkgo/core/matrix/delta_csr.hpp>
+
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/precision_dispatch.hpp>
+#include <ginkgo/core/base/utils.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+
+#include "core/matrix/delta_csr_kernels.hpp"
+
+
+namespace gko {
+namespace matrix {
+namespace delta_csr {
+namespace {
+
+
+GKO_REGISTER_OPERATION(spmv, delta_csr::spmv);
+GKO_REGISTER_OPERATION(advanced_spmv, delta_csr::advanced_spmv);
+GKO_REGISTER_OPERATION(convert_to_csr, delta_csr::convert_to_csr);
+
+
+}  // anonymous namespace
+}  // namespace delta_csr
+
+
+template <typename ValueType, typename IndexType>
+constexpr typename DeltaCsr<ValueType, IndexType>::delta_type
+    DeltaCsr<ValueType, IndexType>::escape_delta;
+
+
+template <typename ValueType, typename IndexType>
+void DeltaCsr<ValueType, IndexType>::apply_impl(const LinOp* b, LinOp* x) const
+{
+    precision_dispatch_real_complex<ValueType>(
+        [this](auto dense_b, auto dense_x) {
+            this->get_executor()->run(
+                delta_csr::make_spmv(this, dense_b, dense_x));
+        },
+        b, x);
+}
+
+
+template <typename ValueType, typename IndexType>
+void DeltaCsr<ValueType, IndexType>::apply_impl(const LinOp* alpha,
+                                                const LinOp* b,
+                                                const LinOp* beta,
+                                                LinOp* x) const
+{
+    precision_dispatch_real_complex<ValueType>(
+        [this](auto dense_alpha, auto dense_b, auto dense_beta, auto dense_x) {
+            this->get_executor()->run(delta_csr::make_advanced_spmv(
+                dense_alpha, this, dense_b, dense_beta, dense_x));
+        },
+        alpha, b, beta, x);
+}
+
+
+template <typename ValueType, typename IndexType>
+DeltaCsr<ValueType, IndexType>& DeltaCsr<ValueType, IndexType>::operator=(
+    const DeltaCsr<ValueType, IndexType>& other)
+{
+    if (&other != this) {
+        EnableLinOp<DeltaCsr>::operator=(other);
+        values_ = other.values_;
+        col_deltas_ = other.col_deltas_;
+        col_bases_ = other.col_bases_;
+        row_ptrs_ = other.row_ptrs_;
+        escape_ptrs_ = other.escape_ptrs_;
+        escape_col_idxs_ = other.escape_col_idxs_;
+    }
+    return *this;
+}
+
+
+template <typename ValueType, typename IndexType>
+DeltaCsr<ValueType, IndexType>& DeltaCsr<ValueType, IndexType>::operator=(
+    DeltaCsr<ValueType, IndexType>&& other)
+{
+    if (&other != this) {
+        EnableLinOp<DeltaCsr>::operator=(std::move(other));
+        values_ = std::move(other.values_);
+        col_deltas_ = std::move(other.col_deltas_);
+        col_bases_ = std::move(other.col_bases_);
+        row_ptrs_ = std::move(other.row_ptrs_);
+        escape_ptrs_ = std::move(other.escape_ptrs_);
+        escape_col_idxs_ = std::move(other.escape_col_idxs_);
+        // restore other invariant
+        other.row_ptrs_.resize_and_reset(1);
+        other.row_ptrs_.fill(0);
+        other.escape_ptrs_.resize_and_reset(1);
+        other.escape_ptrs_.fill(0);
+    }
+    return *this;
+}
+
+
+template <typename ValueType, typename IndexType>
+DeltaCsr<ValueType, IndexType>::DeltaCsr(
+    const DeltaCsr<ValueType, IndexType>& other)
+    : DeltaCsr{other.get_executor()}
+{
+    *this = other;
+}
+
+
+template <typename ValueType, typename IndexType>
+DeltaCsr<ValueType, IndexType>::DeltaCsr(DeltaCsr<ValueType, IndexType>&& other)
+    : DeltaCsr{other.get_executor()}
+{
+    *this = std::move(other);
+}
+
+
+template <typename ValueType, typename IndexType>
+void DeltaCsr<ValueType, IndexType>::convert_to(
+    Csr<ValueType, IndexType>* result) const
+{
+    auto exec = this->get_executor();
+    auto tmp = make_temporary_clone(exec, result);
+    tmp->values_ = this->values_;
+    tmp->row_ptrs_ = this->row_ptrs_;
+    tmp->col_idxs_.resize_and_reset(this->get_num_stored_elements());
+    tmp->set_size(this->get_size());
+    exec->run(delta_csr::make_convert_to_csr(this, tmp.get()));
+    tmp->make_srow();
+}
+
+
+template <typename ValueType, typename IndexType>
+void DeltaCsr<ValueType, IndexType>::move_to(Csr<ValueType, IndexType>* result)
+{
+    this->convert_to(result);
+}
+
+
+template <typename ValueType, typename IndexType>
+void DeltaCsr<ValueType, IndexType>::read(const mat_data& data)
+{
+    this->read(device_mat_data::create_from_host(this->get_executor(), data));
+}
+
+
+template <typename ValueType, typename IndexType>
+void DeltaCsr<ValueType, IndexType>::read(const device_mat_data& data)
+{
+    // make a copy, read the data in
+    this->read(device_mat_data{this->get_executor(), data});
+}
+
+
+template <typename ValueType, typename IndexType>
+void DeltaCsr<ValueType, IndexType>::read(device_mat_data&& data)
+{
+    auto tmp = Csr<ValueType, IndexType>::create(this->get_executor());
+    tmp->read(std::move(data));
+    tmp->convert_to(this);
+}
+
+
+template <typename ValueType, typename IndexType>
+void DeltaCsr<ValueType, IndexType>::write(mat_data& data) const
+{
+    auto tmp = Csr<ValueType, IndexType>::create(this->get_executor());
+    this->convert_to(tmp.get());
+    tmp->write(data);
+}
+
+
+#define GKO_DECLARE_DELTA_CSR_MATRIX(ValueType, IndexType) \
+    class DeltaCsr<ValueType, IndexType>
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_DELTA_CSR_MATRIX);
+
+
+}  // namespace matrix
+}  // namespace gko
@@ -791,6 +791,13 @@ template <typename IndexType>
 void Dense<ValueType>::convert_impl(Sellp<ValueType, IndexType>* result) const
 {
     auto exec = this->get_executor();
+    if (result->get_sorting_window() > 1) {
+        // the row sorting of SELL-C-sigma is based on the Csr row pointers
+        auto csr = Csr<ValueType, IndexType>::create(exec);
+        this->convert_to(csr.get());
+        csr->convert_to(result);
+        return;
+    }
     const auto num_rows = this->get_size()[0];
     const auto stride_factor = result->get_stride_factor();
     const auto slice_size = result->get_slice_size();
@@ -35,6 +35,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <limits>
 #include <map>
+#include <vector>
 
 
 #include <ginkgo/core/base/array.hpp>
@@ -46,6 +47,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ginkgo/core/base/temporary_clone.hpp>
 #include <ginkgo/core/base/types.hpp>
 #include <ginkgo/core/base/utils.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
 #include <ginkgo/core/matrix/dense.hpp>
 #include <ginkgo/core/matrix/identity.hpp>
 #include <ginkgo/core/matrix/sparsity_csr.hpp>
@@ -53,6 +55,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "accessor/block_col_major.hpp"
 #include "accessor/range.hpp"
+#include "core/base/block_sizes.hpp"
 #include "core/components/absolute_array_kernels.hpp"
 #include "core/components/fill_array_kernels.hpp"
 #include "core/matrix/fbcsr_kernels.hpp"
@@ -422,5 +425,79 @@ Fbcsr<ValueType, IndexType>::compute_absolute() const
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_FBCSR_MATRIX);
 
 
+template <typename ValueType, typename IndexType>
+block_structure detect_block_structure(const Csr<ValueType, IndexType>* mtx,
+                                       double max_fill_ratio)
+{
+    const auto exec = mtx->get_executor();
+    // the host executors have kernels for additional block sizes
+    const auto compiled_sizes = syn::as_array(fixedblock::compiled_kernels());
+    const auto host_sizes = syn::as_array(fixedblock::host_kernels());
+    const auto candidates =
+        exec == exec->get_master()
+            ? std::vector<int>(host_sizes.begin(), host_sizes.end())
+            : std::vector<int>(compiled_sizes.begin(), compiled_sizes.end());
+    const auto host_mtx = make_temporary_clone(exec->get_master(), mtx);
+    const auto num_rows = static_cast<IndexType>(host_mtx->get_size()[0]);
+    const auto num_cols = static_cast<IndexType>(host_mtx->get_size()[1]);
+    const auto nnz = host_mtx->get_num_stored_elements();
+    const auto row_ptrs = host_mtx->get_const_row_ptrs();
+    const auto col_idxs = host_mtx->get_const_col_idxs();
+    block_structure result{1, 1.0};
+    if (nnz == 0) {
+        return result;
+    }
+    // stores the last block row in which each block column was encountered
+    std::vector<IndexType> last_block_row;
+    for (const auto bs : candidates) {
+        if (bs <= result.block_size || num_rows % bs != 0 ||
+            num_cols % bs != 0) {
+            continue;
+        }
+        last_block_row.assign(num_cols / bs, invalid_index<IndexType>());
+        size_type num_blocks{};
+        for (IndexType brow = 0; brow < num_rows / bs; brow++) {
+            for (auto nz = row_ptrs[brow * bs]; nz < row_ptrs[(brow + 1) * bs];
+                 nz++) {
+                const auto bcol = col_idxs[nz] / bs;
+                if (last_block_row[bcol] != brow) {
+                    last_block_row[bcol] = brow;
+                    num_blocks++;
+                }
+            }
+        }
+        const auto fill_ratio = static_cast<double>(num_blocks * bs * bs) /
+                                static_cast<double>(nnz);
+        if (fill_ratio <= max_fill_ratio) {
+            result = {bs, fill_ratio};
+        }
+    }
+    return result;
+}
+
+#define GKO_DECLARE_DETECT_BLOCK_STRUCTURE(ValueType, IndexType) \
+    block_structure detect_block_structure(                      \
+        const Csr<ValueType, IndexType>* mtx, double max_fill_ratio)
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_DETECT_BLOCK_STRUCTURE);
+
+
+template <typename ValueType, typename IndexType>
+std::unique_ptr<Fbcsr<ValueType, IndexType>> convert_to_fbcsr(
+    const Csr<ValueType, IndexType>* mtx, double max_fill_ratio)
+{
+    const auto structure = detect_block_structure(mtx, max_fill_ratio);
+    auto result = Fbcsr<ValueType, IndexType>::create(mtx->get_executor(),
+                                                      structure.block_size);
+    mtx->convert_to(result.get());
+    return result;
+}
+
+#define GKO_DECLARE_CONVERT_TO_FBCSR(ValueType, IndexType)         \
+    std::unique_ptr<Fbcsr<ValueType, IndexType>> convert_to_fbcsr( \
+        const Csr<ValueType, IndexType>* mtx, double max_fill_ratio)
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_CONVERT_TO_FBCSR);
+
+
 }  // namespace matrix
 }  // namespace gko
@@ -0,0 +1,78 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2022, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#ifndef GKO_CORE_MATRIX_MIXED_PRECISION_SPMV_HPP_
+#define GKO_CORE_MATRIX_MIXED_PRECISION_SPMV_HPP_
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/lin_op.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+
+namespace gko {
+namespace matrix {
+
+
+/**
+ * Checks whether a matrix storing its values in ValueType can apply itself to
+ * `b` and `x` without converting the vectors, i.e. whether both are dense
+ * vectors in next_precision<ValueType> and the executor provides the
+ * mixed-precision SpMV kernels.
+ *
+ * Only the host executors implement these kernels. The check tests for
+ * OmpExecutor, which also covers the ReferenceExecutor since it derives from
+ * OmpExecutor. All device executors fall back to converting the vectors to
+ * ValueType.
+ *
+ * @param exec  the executor the matrix is stored on
+ * @param b  the input vector of the apply
+ * @param x  the output vector of the apply
+ */
+template <typename ValueType>
+bool use_mixed_precision_spmv(const Executor* exec, const LinOp* b,
+                              const LinOp* x)
+{
+    using vector_type = Dense<next_precision<ValueType>>;
+    return dynamic_cast<const OmpExecutor*>(exec) != nullptr &&
+           dynamic_cast<const vector_type*>(b) != nullptr &&
+           dynamic_cast<const vector_type*>(x) != nullptr;
+}
+
+
+}  // namespace matrix
+}  // namespace gko
+
+
+#endif  // GKO_CORE_MATRIX_MIXED_PRECISION_SPMV_HPP_
@@ -48,6 +48,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "core/components/fill_array_kernels.hpp"
 #include "core/components/format_conversion_kernels.hpp"
 #include "core/components/prefix_sum_kernels.hpp"
+#include "core/matrix/mixed_precision_spmv.hpp"
 #include "core/matrix/sellp_kernels.hpp"
 
 
@@ -59,6 +60,8 @@ namespace {
 
 GKO_REGISTER_OPERATION(spmv, sellp::spmv);
 GKO_REGISTER_OPERATION(advanced_spmv, sellp::advanced_spmv);
+GKO_REGISTER_OPERATION(mixed_spmv, sellp::mixed_spmv);
+GKO_REGISTER_OPERATION(advanced_mixed_spmv, sellp::advanced_mixed_spmv);
 GKO_REGISTER_OPERATION(convert_idxs_to_ptrs, components::convert_idxs_to_ptrs);
 GKO_REGISTER_OPERATION(prefix_sum, components::prefix_sum);
 GKO_REGISTER_OPERATION(compute_slice_sets, sellp::compute_slice_sets);
@@ -88,8 +91,10 @@ Sellp<ValueType, IndexType>& Sellp<ValueType, IndexType>::operator=(
         col_idxs_ = other.col_idxs_;
         slice_lengths_ = other.slice_lengths_;
         slice_sets_ = other.slice_sets_;
+        permutation_ = other.permutation_;
         slice_size_ = other.slice_size_;
         stride_factor_ = other.stride_factor_;
+        sorting_window_ = other.sorting_window_;
     }
     return *this;
 }
@@ -105,9 +110,11 @@ Sellp<ValueType, IndexType>& Sellp<ValueType, IndexType>::operator=(
         col_idxs_ = std::move(other.col_idxs_);
         slice_lengths_ = std::move(other.slice_lengths_);
         slice_sets_ = std::move(other.slice_sets_);
-        // slice_size and stride_factor are immutable
+        permutation_ = std::move(other.permutation_);
+        // slice_size, stride_factor and sorting_window are immutable
         slice_size_ = other.slice_size_;
         stride_factor_ = other.stride_factor_;
+        sorting_window_ = other.sorting_window_;
         // restore other invariant
         other.slice_sets_.resize_and_reset(1);
         other.slice_sets_.fill(0);
@@ -134,6 +141,15 @@ Sellp<ValueType, IndexType>::Sellp(Sellp&& other) : Sellp(other.get_executor())
 template <typename ValueType, typename IndexType>
 void Sellp<ValueType, IndexType>::apply_impl(const LinOp* b, LinOp* x) const
 {
+    if (use_mixed_precision_spmv<ValueType>(this->get_executor().get(), b,
+                                            x)) {
+        // apply the stored values directly to the vectors in the other
+        // precision instead of converting the vectors
+        using MixedDense = Dense<next_precision<ValueType>>;
+        this->get_executor()->run(sellp::make_mixed_spmv(
+            this, as<MixedDense>(b), as<MixedDense>(x)));
+        return;
+    }
     precision_dispatch_real_complex<ValueType>(
         [this](auto dense_b, auto dense_x) {
             this->get_executor()->run(sellp::make_spmv(this, dense_b, dense_x));
@@ -146,6 +162,16 @@ template <typename ValueType, typename IndexType>
 void Sellp<ValueType, IndexType>::apply_impl(const LinOp* alpha, const LinOp* b,
                                              const LinOp* beta, LinOp* x) const
 {
+    if (use_mixed_precision_spmv<ValueType>(this->get_executor().get(), b,
+                                            x)) {
+        using mixed_type = next_precision<ValueType>;
+        auto dense_alpha = make_temporary_conversion<mixed_type>(alpha);
+        auto dense_beta = make_temporary_conversion<mixed_type>(beta);
+        this->get_executor()->run(sellp::make_advanced_mixed_spmv(
+            dense_alpha.get(), this, as<Dense<mixed_type>>(b),
+            dense_beta.get(), as<Dense<mixed_type>>(x)));
+        return;
+    }
     precision_dispatch_real_complex<ValueType>(
         [this](auto dense_alpha, auto dense_b, auto dense_beta, auto dense_x) {
             this->get_executor()->run(sellp::make_advanced_spmv(
@@ -163,8 +189,10 @@ void Sellp<ValueType, IndexType>::convert_to(
     result->col_idxs_ = this->col_idxs_;
     result->slice_lengths_ = this->slice_lengths_;
     result->slice_sets_ = this->slice_sets_;
+    result->permutation_ = this->permutation_;
     result->slice_size_ = this->slice_size_;
     result->stride_factor_ = this->stride_factor_;
+    result->sorting_window_ = this->sorting_window_;
     result->set_size(this->get_size());
 }
 
@@ -183,8 +211,15 @@ void Sellp<ValueType, IndexType>::convert_to(Dense<ValueType>* result) const
     auto exec = this->get_executor();
     auto tmp_result = make_temporary_output_clone(exec, result);
     tmp_result->resize(this->get_size());
-    tmp_result->fill(zero<ValueType>());
-    exec->run(sellp::make_fill_in_dense(this, tmp_result.get()));
+    if (permutation_.get_num_elems() > 0) {
+        auto sorted = Dense<ValueType>::create(exec, this->get_size());
+        sorted->fill(zero<ValueType>());
+        exec->run(sellp::make_fill_in_dense(this, sorted.get()));
+        sorted->inverse_row_permute(&permutation_, tmp_result.get());
+    } else {
+        tmp_result->fill(zero<ValueType>());
+        exec->run(sellp::make_fill_in_dense(this, tmp_result.get()));
+    }
 }
 
 
@@ -214,6 +249,12 @@ void Sellp<ValueType, IndexType>::convert_to(
         tmp->values_.resize_and_reset(nnz);
         tmp->set_size(this->get_size());
         exec->run(sellp::make_convert_to_csr(this, tmp.get()));
+        if (permutation_.get_num_elems() > 0) {
+            // the kernels produce the rows in their stored order
+            auto unsorted = tmp->inverse_row_permute(&permutation_);
+            *tmp.get() =
+                std::move(*as<Csr<ValueType, IndexType>>(unsorted.get()));
+        }
     }
     result->make_srow();
 }
@@ -230,6 +271,12 @@ template <typename ValueType, typename IndexType>
 void Sellp<ValueType, IndexType>::read(const device_mat_data& data)
 {
     auto exec = this->get_executor();
+    if (sorting_window_ > 1) {
+        auto csr = Csr<ValueType, IndexType>::create(exec);
+        csr->read(data);
+        csr->convert_to(this);
+        return;
+    }
     const auto size = data.get_size();
     slice_lengths_.resize_and_reset(ceildiv(size[0], slice_size_));
     slice_sets_.resize_and_reset(ceildiv(size[0], slice_size_) + 1);
@@ -273,6 +320,7 @@ void Sellp<ValueType, IndexType>::write(mat_data& data) const
 
     data = {tmp->get_size(), {}};
 
+    const auto perm = tmp->get_const_permutation();
     auto slice_size = tmp->get_slice_size();
     size_type slice_num = static_cast<index_type>(
         (tmp->get_size()[0] + slice_size - 1) / slice_size);
@@ -287,12 +335,17 @@ void Sellp<ValueType, IndexType>::write(mat_data& data) const
                     const auto col = tmp->col_at(row_in_slice, slice_offset, i);
                     const auto val = tmp->val_at(row_in_slice, slice_offset, i);
                     if (col != invalid_index<IndexType>()) {
-                        data.nonzeros.emplace_back(row, col, val);
+                        data.nonzeros.emplace_back(
+                            perm ? perm[row] : static_cast<IndexType>(row), col,
+                            val);
                     }
                 }
             }
         }
     }
+    if (perm) {
+        data.ensure_row_major_order();
+    }
 }
 
 
@@ -301,6 +354,12 @@ std::unique_ptr<Diagonal<ValueType>>
 Sellp<ValueType, IndexType>::extract_diagonal() const
 {
     auto exec = this->get_executor();
+    if (permutation_.get_num_elems() > 0) {
+        // the diagonal entries are not on the diagonal of the stored rows
+        auto csr = Csr<ValueType, IndexType>::create(exec);
+        this->convert_to(csr.get());
+        return csr->extract_diagonal();
+    }
 
     const auto diag_size = std::min(this->get_size()[0], this->get_size()[1]);
     auto diag = Diagonal<ValueType>::create(exec, diag_size);
@@ -329,11 +388,13 @@ Sellp<ValueType, IndexType>::compute_absolute() const
 
     auto abs_sellp = absolute_type::create(
         exec, this->get_size(), this->get_slice_size(),
-        this->get_stride_factor(), this->get_total_cols());
+        this->get_stride_factor(), this->get_sorting_window(),
+        this->get_total_cols());
 
     abs_sellp->col_idxs_ = col_idxs_;
     abs_sellp->slice_lengths_ = slice_lengths_;
     abs_sellp->slice_sets_ = slice_sets_;
+    abs_sellp->permutation_ = permutation_;
     exec->run(sellp::make_outplace_absolute_array(
         this->get_const_values(), this->get_num_stored_elements(),
         abs_sellp->get_values()));
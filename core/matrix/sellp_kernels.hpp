@@ -62,6 +62,21 @@ namespace kernels {
                        const matrix::Dense<ValueType>* beta,         \
                        matrix::Dense<ValueType>* c)
 
+#define GKO_DECLARE_SELLP_MIXED_SPMV_KERNEL(ValueType, IndexType)      \
+    void mixed_spmv(std::shared_ptr<const DefaultExecutor> exec,       \
+                    const matrix::Sellp<ValueType, IndexType>* a,      \
+                    const matrix::Dense<next_precision<ValueType>>* b, \
+                    matrix::Dense<next_precision<ValueType>>* c)
+
+#define GKO_DECLARE_SELLP_ADVANCED_MIXED_SPMV_KERNEL(ValueType, IndexType) \
+    void advanced_mixed_spmv(                                              \
+        std::shared_ptr<const DefaultExecutor> exec,                       \
+        const matrix::Dense<next_precision<ValueType>>* alpha,             \
+        const matrix::Sellp<ValueType, IndexType>* a,                      \
+        const matrix::Dense<next_precision<ValueType>>* b,                 \
+        const matrix::Dense<next_precision<ValueType>>* beta,              \
+        matrix::Dense<next_precision<ValueType>>* c)
+
 #define GKO_DECLARE_SELLP_FILL_IN_MATRIX_DATA_KERNEL(ValueType, IndexType) \
     void fill_in_matrix_data(                                              \
         std::shared_ptr<const DefaultExecutor> exec,                       \
@@ -100,6 +115,10 @@ namespace kernels {
     template <typename ValueType, typename IndexType>                      \
     GKO_DECLARE_SELLP_ADVANCED_SPMV_KERNEL(ValueType, IndexType);          \
     template <typename ValueType, typename IndexType>                      \
+    GKO_DECLARE_SELLP_MIXED_SPMV_KERNEL(ValueType, IndexType);             \
+    template <typename ValueType, typename IndexType>                      \
+    GKO_DECLARE_SELLP_ADVANCED_MIXED_SPMV_KERNEL(ValueType, IndexType);    \
+    template <typename ValueType, typename IndexType>                      \
     GKO_DECLARE_SELLP_FILL_IN_MATRIX_DATA_KERNEL(ValueType, IndexType);    \
     template <typename IndexType>                                          \
     GKO_DECLARE_SELLP_COMPUTE_SLICE_SETS_KERNEL(IndexType);                \
@@ -0,0 +1,93 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2022, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#ifndef GKO_CORE_MATRIX_SELLP_SORTING_HPP_
+#define GKO_CORE_MATRIX_SELLP_SORTING_HPP_
+
+
+#include <algorithm>
+#include <numeric>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/temporary_clone.hpp>
+#include <ginkgo/core/base/types.hpp>
+
+
+namespace gko {
+namespace matrix {
+namespace sellp {
+
+
+/**
+ * Computes the row permutation of a SELL-C-sigma matrix: within each window of
+ * `sorting_window` consecutive rows, the rows are stably sorted by decreasing
+ * length.
+ *
+ * @param exec  the executor the permutation should be stored on
+ * @param row_ptrs  the row pointers describing the row lengths
+ * @param sorting_window  the number of rows sorted together (sigma)
+ *
+ * @return the permutation, mapping each stored row to its original row
+ */
+template <typename IndexType, typename RowPtrType>
+array<IndexType> compute_sorting_permutation(
+    std::shared_ptr<const Executor> exec, const array<RowPtrType>& row_ptrs,
+    size_type sorting_window)
+{
+    const auto host_exec = exec->get_master();
+    const auto host_row_ptrs = make_temporary_clone(host_exec, &row_ptrs);
+    const auto ptrs = host_row_ptrs->get_const_data();
+    const auto num_rows = row_ptrs.get_num_elems() - 1;
+    array<IndexType> permutation{host_exec, num_rows};
+    const auto perm = permutation.get_data();
+    std::iota(perm, perm + num_rows, IndexType{});
+    for (size_type begin = 0; begin < num_rows; begin += sorting_window) {
+        const auto end = std::min(begin + sorting_window, num_rows);
+        std::stable_sort(perm + begin, perm + end,
+                         [ptrs](IndexType first, IndexType second) {
+                             return ptrs[first + 1] - ptrs[first] >
+                                    ptrs[second + 1] - ptrs[second];
+                         });
+    }
+    return array<IndexType>{exec, std::move(permutation)};
+}
+
+
+}  // namespace sellp
+}  // namespace matrix
+}  // namespace gko
+
+
+#endif  // GKO_CORE_MATRIX_SELLP_SORTING_HPP_
@@ -0,0 +1,215 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2022, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include <ginkgo/core/matrix/symmetric_csr.hpp>
+
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/precision_dispatch.hpp>
+#include <ginkgo/core/base/utils.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+
+#include "core/components/prefix_sum_kernels.hpp"
+#include "core/matrix/symmetric_csr_kernels.hpp"
+
+
+namespace gko {
+namespace matrix {
+namespace symmetric_csr {
+namespace {
+
+
+GKO_REGISTER_OPERATION(spmv, symmetric_csr::spmv);
+GKO_REGISTER_OPERATION(advanced_spmv, symmetric_csr::advanced_spmv);
+GKO_REGISTER_OPERATION(count_csr_nonzeros, symmetric_csr::count_csr_nonzeros);
+GKO_REGISTER_OPERATION(convert_to_csr, symmetric_csr::convert_to_csr);
+GKO_REGISTER_OPERATION(prefix_sum, components::prefix_sum);
+
+
+}  // anonymous namespace
+}  // namespace symmetric_csr
+
+
+template <typename ValueType, typename IndexType>
+void SymmetricCsr<ValueType, IndexType>::apply_impl(const LinOp* b,
+                                                    LinOp* x) const
+{
+    precision_dispatch_real_complex<ValueType>(
+        [this](auto dense_b, auto dense_x) {
+            this->get_executor()->run(
+                symmetric_csr::make_spmv(this, dense_b, dense_x, buffer_));
+        },
+        b, x);
+}
+
+
+template <typename ValueType, typename IndexType>
+void SymmetricCsr<ValueType, IndexType>::apply_impl(const LinOp* alpha,
+                                                    const LinOp* b,
+                                                    const LinOp* beta,
+                                                    LinOp* x) const
+{
+    precision_dispatch_real_complex<ValueType>(
+        [this](auto dense_alpha, auto dense_b, auto dense_beta, auto dense_x) {
+            this->get_executor()->run(symmetric_csr::make_advanced_spmv(
+                dense_alpha, this, dense_b, dense_beta, dense_x, buffer_));
+        },
+        alpha, b, beta, x);
+}
+
+
+template <typename ValueType, typename IndexType>
+SymmetricCsr<ValueType, IndexType>&
+SymmetricCsr<ValueType, IndexType>::operator=(
+    const SymmetricCsr<ValueType, IndexType>& other)
+{
+    if (&other != this) {
+        EnableLinOp<SymmetricCsr>::operator=(other);
+        values_ = other.values_;
+        col_idxs_ = other.col_idxs_;
+        row_ptrs_ = other.row_ptrs_;
+    }
+    return *this;
+}
+
+
+template <typename ValueType, typename IndexType>
+SymmetricCsr<ValueType, IndexType>&
+SymmetricCsr<ValueType, IndexType>::operator=(
+    SymmetricCsr<ValueType, IndexType>&& other)
+{
+    if (&other != this) {
+        EnableLinOp<SymmetricCsr>::operator=(std::move(other));
+        values_ = std::move(other.values_);
+        col_idxs_ = std::move(other.col_idxs_);
+        row_ptrs_ = std::move(other.row_ptrs_);
+        // restore other invariant
+        other.row_ptrs_.resize_and_reset(1);
+        other.row_ptrs_.fill(0);
+    }
+    return *this;
+}
+
+
+template <typename ValueType, typename IndexType>
+SymmetricCsr<ValueType, IndexType>::SymmetricCsr(
+    const SymmetricCsr<ValueType, IndexType>& other)
+    : SymmetricCsr{other.get_executor()}
+{
+    *this = other;
+}
+
+
+template <typename ValueType, typename IndexType>
+SymmetricCsr<ValueType, IndexType>::SymmetricCsr(
+    SymmetricCsr<ValueType, IndexType>&& other)
+    : SymmetricCsr{other.get_executor()}
+{
+    *this = std::move(other);
+}
+
+
+template <typename ValueType, typename IndexType>
+void SymmetricCsr<ValueType, IndexType>::convert_to(
+    Csr<ValueType, IndexType>* result) const
+{
+    auto exec = this->get_executor();
+    const auto num_rows = this->get_size()[0];
+    auto tmp = make_temporary_clone(exec, result);
+    tmp->row_ptrs_.resize_and_reset(num_rows + 1);
+    exec->run(
+        symmetric_csr::make_count_csr_nonzeros(this, tmp->get_row_ptrs()));
+    exec->run(
+        symmetric_csr::make_prefix_sum(tmp->get_row_ptrs(), num_rows + 1));
+    const auto nnz =
+        exec->copy_val_to_host(tmp->get_const_row_ptrs() + num_rows);
+    tmp->values_.resize_and_reset(nnz);
+    tmp->col_idxs_.resize_and_reset(nnz);
+    tmp->set_size(this->get_size());
+    exec->run(symmetric_csr::make_convert_to_csr(this, tmp.get()));
+    tmp->make_srow();
+}
+
+
+template <typename ValueType, typename IndexType>
+void SymmetricCsr<ValueType, IndexType>::move_to(
+    Csr<ValueType, IndexType>* result)
+{
+    this->convert_to(result);
+}
+
+
+template <typename ValueType, typename IndexType>
+void SymmetricCsr<ValueType, IndexType>::read(const mat_data& data)
+{
+    this->read(device_mat_data::create_from_host(this->get_executor(), data));
+}
+
+
+template <typename ValueType, typename IndexType>
+void SymmetricCsr<ValueType, IndexType>::read(const device_mat_data& data)
+{
+    // make a copy, read the data in
+    this->read(device_mat_data{this->get_executor(), data});
+}
+
+
+template <typename ValueType, typename IndexType>
+void SymmetricCsr<ValueType, IndexType>::read(device_mat_data&& data)
+{
+    auto tmp = Csr<ValueType, IndexType>::create(this->get_executor());
+    tmp->read(std::move(data));
+    tmp->convert_to(this);
+}
+
+
+template <typename ValueType, typename IndexType>
+void SymmetricCsr<ValueType, IndexType>::write(mat_data& data) const
+{
+    auto tmp = Csr<ValueType, IndexType>::create(this->get_executor());
+    this->convert_to(tmp.get());
+    tmp->write(data);
+}
+
+
+#define GKO_DECLARE_SYMMETRIC_CSR_MATRIX(ValueType, IndexType) \
+    class SymmetricCsr<ValueType, IndexType>
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_SYMMETRIC_CSR_MATRIX);
+
+
+}  // namespace matrix
+}  // namespace gko
@@ -0,0 +1,117 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2022, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#ifndef GKO_CORE_MATRIX_SYMMETRIC_CSR_KERNELS_HPP_
+#define GKO_CORE_MATRIX_SYMMETRIC_CSR_KERNELS_HPP_
+
+
+#include <ginkgo/core/matrix/symmetric_csr.hpp>
+
+
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+
+#include "core/base/kernel_declaration.hpp"
+
+
+namespace gko {
+namespace kernels {
+
+
+#define GKO_DECLARE_SYMMETRIC_CSR_SPMV_KERNEL(ValueType, IndexType)           \
+    void spmv(std::shared_ptr<const DefaultExecutor> exec,                    \
+              const matrix::SymmetricCsr<ValueType, IndexType>* a,            \
+              const matrix::Dense<ValueType>* b, matrix::Dense<ValueType>* c, \
+              array<char>& buffer)
+
+#define GKO_DECLARE_SYMMETRIC_CSR_ADVANCED_SPMV_KERNEL(ValueType, IndexType) \
+    void advanced_spmv(std::shared_ptr<const DefaultExecutor> exec,          \
+                       const matrix::Dense<ValueType>* alpha,                \
+                       const matrix::SymmetricCsr<ValueType, IndexType>* a,  \
+                       const matrix::Dense<ValueType>* b,                    \
+                       const matrix::Dense<ValueType>* beta,                 \
+                       matrix::Dense<ValueType>* c, array<char>& buffer)
+
+#define GKO_DECLARE_SYMMETRIC_CSR_COUNT_UPPER_NNZ_KERNEL(ValueType, IndexType) \
+    void count_upper_nonzeros(                                                 \
+        std::shared_ptr<const DefaultExecutor> exec,                           \
+        const matrix::Csr<ValueType, IndexType>* source, IndexType* row_nnz)
+
+#define GKO_DECLARE_SYMMETRIC_CSR_CONVERT_FROM_CSR_KERNEL(ValueType, \
+                                                          IndexType) \
+    void convert_from_csr(                                           \
+        std::shared_ptr<const DefaultExecutor> exec,                 \
+        const matrix::Csr<ValueType, IndexType>* source,             \
+        matrix::SymmetricCsr<ValueType, IndexType>* result)
+
+#define GKO_DECLARE_SYMMETRIC_CSR_COUNT_CSR_NNZ_KERNEL(ValueType, IndexType) \
+    void count_csr_nonzeros(                                                 \
+        std::shared_ptr<const DefaultExecutor> exec,                         \
+        const matrix::SymmetricCsr<ValueType, IndexType>* source,            \
+        IndexType* row_nnz)
+
+#define GKO_DECLARE_SYMMETRIC_CSR_CONVERT_TO_CSR_KERNEL(ValueType, IndexType) \
+    void convert_to_csr(                                                      \
+        std::shared_ptr<const DefaultExecutor> exec,                          \
+        const matrix::SymmetricCsr<ValueType, IndexType>* source,             \
+        matrix::Csr<ValueType, IndexType>* result)
+
+#define GKO_DECLARE_ALL_AS_TEMPLATES                                         \
+    template <typename ValueType, typename IndexType>                        \
+    GKO_DECLARE_SYMMETRIC_CSR_SPMV_KERNEL(ValueType, IndexType);             \
+    template <typename ValueType, typename IndexType>                        \
+    GKO_DECLARE_SYMMETRIC_CSR_ADVANCED_SPMV_KERNEL(ValueType, IndexType);    \
+    template <typename ValueType, typename IndexType>                        \
+    GKO_DECLARE_SYMMETRIC_CSR_COUNT_UPPER_NNZ_KERNEL(ValueType, IndexType);  \
+    template <typename ValueType, typename IndexType>                        \
+    GKO_DECLARE_SYMMETRIC_CSR_CONVERT_FROM_CSR_KERNEL(ValueType, IndexType); \
+    template <typename ValueType, typename IndexType>                        \
+    GKO_DECLARE_SYMMETRIC_CSR_COUNT_CSR_NNZ_KERNEL(ValueType, IndexType);    \
+    template <typename ValueType, typename IndexType>                        \
+    GKO_DECLARE_SYMMETRIC_CSR_CONVERT_TO_CSR_KERNEL(ValueType, IndexType)
+
+
+GKO_DECLARE_FOR_ALL_EXECUTOR_NAMESPACES(symmetric_csr,
+                                        GKO_DECLARE_ALL_AS_TEMPLATES);
+
+
+#undef GKO_DECLARE_ALL_AS_TEMPLATES
+
+
+}  // namespace kernels
+}  // namespace gko
+
+
+#endif  // GKO_CORE_MATRIX_SYMMETRIC_CSR_KERNELS_HPP_
@@ -71,6 +71,7 @@ GKO_REGISTER_OPERATION(map_col, pgm::map_col);
 GKO_REGISTER_OPERATION(sort_row_major, pgm::sort_row_major);
 GKO_REGISTER_OPERATION(count_unrepeated_nnz, pgm::count_unrepeated_nnz);
 GKO_REGISTER_OPERATION(compute_coarse_coo, pgm::compute_coarse_coo);
+GKO_REGISTER_OPERATION(compute_coarse_csr, pgm::compute_coarse_csr);
 GKO_REGISTER_OPERATION(fill_array, components::fill_array);
 GKO_REGISTER_OPERATION(fill_seq_array, components::fill_seq_array);
 GKO_REGISTER_OPERATION(convert_idxs_to_ptrs, components::convert_idxs_to_ptrs);
@@ -106,6 +107,16 @@ std::shared_ptr<matrix::Csr<ValueType, IndexType>> generate_coarse(
 {
     const auto num = fine_csr->get_size()[0];
     const auto nnz = fine_csr->get_num_stored_elements();
+    if (exec->get_master() == exec) {
+        // host executors accumulate each coarse row directly from the fine
+        // rows of its aggregate, which avoids sorting all fine nonzeros
+        auto coarse_csr = matrix::Csr<ValueType, IndexType>::create(
+            exec, gko::dim<2>{static_cast<size_type>(num_agg),
+                              static_cast<size_type>(num_agg)});
+        exec->run(pgm::make_compute_coarse_csr(fine_csr, agg,
+                                               gko::lend(coarse_csr)));
+        return std::move(coarse_csr);
+    }
     gko::array<IndexType> row_idxs(exec, nnz);
     gko::array<IndexType> col_idxs(exec, nnz);
     gko::array<ValueType> vals(exec, nnz);
@@ -0,0 +1,113 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2022, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include <ginkgo/core/reorder/amd.hpp>
+
+
+#include <memory>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/polymorphic_object.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/base/utils.hpp>
+#include <ginkgo/core/matrix/permutation.hpp>
+#include <ginkgo/core/matrix/sparsity_csr.hpp>
+
+
+#include "core/reorder/amd_kernels.hpp"
+
+
+namespace gko {
+namespace reorder {
+namespace amd {
+namespace {
+
+
+GKO_REGISTER_OPERATION(get_permutation, amd::get_permutation);
+
+
+}  // anonymous namespace
+}  // namespace amd
+
+
+template <typename ValueType, typename IndexType>
+Amd<ValueType, IndexType>::Amd(const Factory* factory,
+                               const ReorderingBaseArgs& args)
+    : EnablePolymorphicObject<Amd, ReorderingBase<IndexType>>(
+          factory->get_executor()),
+      parameters_{factory->get_parameters()}
+{
+    // The reordering is always computed on the host.
+    const auto exec = this->get_executor();
+    const auto host_exec = exec->get_master();
+    GKO_ASSERT_IS_SQUARE_MATRIX(args.system_matrix);
+    const auto size = args.system_matrix->get_size();
+    auto adjacency_matrix = SparsityMatrix::create(host_exec);
+    if (size) {
+        auto tmp =
+            copy_and_convert_to<SparsityMatrix>(host_exec, args.system_matrix);
+        // removes the diagonal elements
+        adjacency_matrix = tmp->to_adjacency_matrix();
+    }
+    auto host_permutation = PermutationMatrix::create(host_exec, size);
+    std::unique_ptr<PermutationMatrix> host_inv_permutation;
+    if (parameters_.construct_inverse_permutation) {
+        host_inv_permutation = PermutationMatrix::create(host_exec, size);
+    }
+    host_exec->run(amd::make_get_permutation(
+        static_cast<IndexType>(size[0]), adjacency_matrix->get_const_row_ptrs(),
+        adjacency_matrix->get_const_col_idxs(),
+        host_permutation->get_permutation(),
+        host_inv_permutation ? host_inv_permutation->get_permutation()
+                             : nullptr));
+
+    // Copy back results to the device if necessary.
+    permutation_ = clone(exec, host_permutation);
+    if (host_inv_permutation) {
+        inv_permutation_ = clone(exec, host_inv_permutation);
+    }
+    auto permutation_array = make_array_view(exec, size[0],
+                                             permutation_->get_permutation());
+    this->set_permutation_array(permutation_array);
+}
+
+
+#define GKO_DECLARE_AMD(ValueType, IndexType) class Amd<ValueType, IndexType>
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_AMD);
+
+
+}  // namespace reorder
+}  // namespace gko
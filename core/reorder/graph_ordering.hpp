@@ -0,0 +1,460 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2022, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#ifndef GKO_CORE_REORDER_GRAPH_ORDERING_HPP_
+#define GKO_CORE_REORDER_GRAPH_ORDERING_HPP_
+
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/types.hpp>
+
+
+#include "core/base/allocator.hpp"
+
+
+namespace gko {
+namespace reorder {
+namespace detail {
+
+
+/**
+ * @internal
+ *
+ * Computes an approximate minimum degree (AMD) ordering of an undirected graph
+ * (Amestoy, Davis, Duff: An Approximate Minimum Degree Ordering Algorithm).
+ *
+ * The elimination is simulated on the quotient graph: every eliminated vertex
+ * becomes an element representing the clique formed by its neighbors, which
+ * absorbs all elements adjacent to it. Instead of the exact external degree,
+ * the upper bound
+ * `d_i = min(n - k, d_i_old + |L_p \ i|, |A_i \ i| + |L_p \ i| +
+ * sum_{e in E_i \ p} |L_e \ L_p|)`
+ * is used to select the next vertex, which can be computed in time
+ * proportional to the size of the quotient graph. Elements whose variables
+ * are all contained in the new element are absorbed aggressively.
+ *
+ * @param exec  the executor used for temporary allocations
+ * @param num_vertices  the number of vertices in the graph
+ * @param row_ptrs  the row pointers of the adjacency matrix
+ * @param col_idxs  the column indices of the adjacency matrix, which needs to
+ *                  be symmetric. Diagonal entries are ignored.
+ * @param permutation  the output ordering, `permutation[k]` is the vertex
+ *                     eliminated in step `k`.
+ */
+template <typename IndexType>
+void amd_order(std::shared_ptr<const Executor> exec, IndexType num_vertices,
+               const IndexType* row_ptrs, const IndexType* col_idxs,
+               IndexType* permutation)
+{
+    const auto n = num_vertices;
+    const auto none = invalid_index<IndexType>();
+    enum : uint8 { variable, element, absorbed };
+    // quotient graph: adjacent variables and elements of each variable, and
+    // the variables of each element
+    vector<vector<IndexType>> var_adj(n, vector<IndexType>(exec), exec);
+    vector<vector<IndexType>> elem_adj(n, vector<IndexType>(exec), exec);
+    vector<vector<IndexType>> elem_vars(n, vector<IndexType>(exec), exec);
+    vector<uint8> status(n, variable, exec);
+    // doubly linked lists of variables of equal (approximate) degree
+    vector<IndexType> degree(n, exec);
+    vector<IndexType> head(n, none, exec);
+    vector<IndexType> next(n, none, exec);
+    vector<IndexType> prev(n, none, exec);
+    // marks the variables of the current element
+    vector<IndexType> marker(n, none, exec);
+    // |L_e \ L_p| for all elements adjacent to the current element p
+    vector<IndexType> weight(n, exec);
+    vector<IndexType> weight_stamp(n, none, exec);
+    IndexType min_degree{};
+    auto insert = [&](IndexType i) {
+        const auto d = degree[i];
+        prev[i] = none;
+        next[i] = head[d];
+        if (head[d] != none) {
+            prev[head[d]] = i;
+        }
+        head[d] = i;
+        min_degree = std::min(min_degree, d);
+    };
+    auto remove = [&](IndexType i) {
+        if (prev[i] != none) {
+            next[prev[i]] = next[i];
+        } else {
+            head[degree[i]] = next[i];
+        }
+        if (next[i] != none) {
+            prev[next[i]] = prev[i];
+        }
+    };
+    auto release = [&](vector<IndexType>& list) {
+        vector<IndexType>(exec).swap(list);
+    };
+    for (IndexType i = 0; i < n; i++) {
+        for (auto nz = row_ptrs[i]; nz < row_ptrs[i + 1]; nz++) {
+            if (col_idxs[nz] != i) {
+                var_adj[i].push_back(col_idxs[nz]);
+            }
+        }
+        degree[i] = static_cast<IndexType>(var_adj[i].size());
+        insert(i);
+    }
+    for (IndexType k = 0; k < n;) {
+        while (head[min_degree] == none) {
+            min_degree++;
+        }
+        const auto p = head[min_degree];
+        remove(p);
+        permutation[k++] = p;
+        status[p] = element;
+        // form the new element p from its variables and absorbed elements
+        auto& lp = elem_vars[p];
+        marker[p] = p;
+        for (auto j : var_adj[p]) {
+            if (status[j] == variable && marker[j] != p) {
+                marker[j] = p;
+                lp.push_back(j);
+            }
+        }
+        for (auto e : elem_adj[p]) {
+            if (status[e] != element) {
+                continue;
+            }
+            for (auto j : elem_vars[e]) {
+                if (status[j] == variable && marker[j] != p) {
+                    marker[j] = p;
+                    lp.push_back(j);
+                }
+            }
+            status[e] = absorbed;
+            release(elem_vars[e]);
+        }
+        release(var_adj[p]);
+        release(elem_adj[p]);
+        // compute |L_e \ L_p| for all elements adjacent to L_p, removing the
+        // variables eliminated since e was formed from L_e
+        for (auto i : lp) {
+            for (auto e : elem_adj[i]) {
+                if (status[e] == element) {
+                    if (weight_stamp[e] != p) {
+                        weight_stamp[e] = p;
+                        auto& le = elem_vars[e];
+                        le.erase(std::remove_if(le.begin(), le.end(),
+                                                [&](IndexType j) {
+                                                    return status[j] !=
+                                                           variable;
+                                                }),
+                                 le.end());
+                        weight[e] = static_cast<IndexType>(le.size());
+                    }
+                    weight[e]--;
+                }
+            }
+        }
+        // update the adjacency and approximate degree of all variables in L_p
+        const auto lp_size = static_cast<IndexType>(lp.size()) - 1;
+        for (auto i : lp) {
+            remove(i);
+            auto& adj = var_adj[i];
+            // variables in L_p are already adjacent to i through element p
+            adj.erase(std::remove_if(adj.begin(), adj.end(),
+                                     [&](IndexType j) {
+                                         return status[j] != variable ||
+                                                marker[j] == p;
+                                     }),
+                      adj.end());
+            auto& eadj = elem_adj[i];
+            IndexType external_degree{};
+            auto out = eadj.begin();
+            for (auto e : eadj) {
+                if (status[e] != element) {
+                    continue;
+                }
+                if (weight[e] == 0) {
+                    // aggressive absorption: L_e is a subset of L_p
+                    status[e] = absorbed;
+                    release(elem_vars[e]);
+                    continue;
+                }
+                external_degree += weight[e];
+                *out = e;
+                ++out;
+            }
+            eadj.erase(out, eadj.end());
+            eadj.push_back(p);
+            const auto bound = static_cast<IndexType>(adj.size()) + lp_size +
+                               external_degree;
+            degree[i] = std::min({n - k - 1, degree[i] + lp_size, bound});
+            insert(i);
+        }
+    }
+}
+
+
+/**
+ * @internal
+ *
+ * Computes a rooted level structure of the connected component containing
+ * `root` using a breadth-first search.
+ *
+ * @param level  output level of each vertex, `invalid_index` for vertices in
+ *               other components. It needs to have one entry per vertex.
+ * @param queue  output vertices of the component, sorted by level
+ * @return  the number of levels
+ */
+template <typename IndexType>
+IndexType level_structure(IndexType num_vertices, const IndexType* row_ptrs,
+                          const IndexType* col_idxs, IndexType root,
+                          vector<IndexType>& level, vector<IndexType>& queue)
+{
+    std::fill_n(level.begin(), num_vertices, invalid_index<IndexType>());
+    queue.clear();
+    queue.push_back(root);
+    level[root] = 0;
+    for (size_type i = 0; i < queue.size(); i++) {
+        const auto v = queue[i];
+        for (auto nz = row_ptrs[v]; nz < row_ptrs[v + 1]; nz++) {
+            const auto w = col_idxs[nz];
+            if (level[w] == invalid_index<IndexType>()) {
+                level[w] = level[v] + 1;
+                queue.push_back(w);
+            }
+        }
+    }
+    return level[queue.back()] + 1;
+}
+
+
+/**
+ * @internal
+ *
+ * Recursive step of nested_dissection_order for the subgraph given in local
+ * numbering, where `vertices` maps local to global vertex indices.
+ */
+template <typename IndexType, typename ForkJoin>
+void nested_dissection_step(std::shared_ptr<const Executor> exec,
+                            IndexType num_vertices, const IndexType* row_ptrs,
+                            const IndexType* col_idxs,
+                            const IndexType* vertices, IndexType leaf_size,
+                            IndexType* permutation, ForkJoin fork_join)
+{
+    const auto n = num_vertices;
+    if (n == 0) {
+        return;
+    }
+    auto order_leaf = [&] {
+        vector<IndexType> local_perm(n, exec);
+        amd_order(exec, n, row_ptrs, col_idxs, local_perm.data());
+        for (IndexType i = 0; i < n; i++) {
+            permutation[i] = vertices[local_perm[i]];
+        }
+    };
+    if (n <= leaf_size) {
+        order_leaf();
+        return;
+    }
+    // find a pseudo-peripheral vertex (George, Liu) to get a deep level
+    // structure, starting from a vertex of minimum degree
+    auto vertex_degree = [&](IndexType v) {
+        return row_ptrs[v + 1] - row_ptrs[v];
+    };
+    IndexType root{};
+    for (IndexType v = 1; v < n; v++) {
+        if (vertex_degree(v) < vertex_degree(root)) {
+            root = v;
+        }
+    }
+    vector<IndexType> level(n, exec);
+    vector<IndexType> queue(exec);
+    auto num_levels =
+        level_structure(n, row_ptrs, col_idxs, root, level, queue);
+    while (true) {
+        auto candidate = queue.back();
+        for (auto it = queue.rbegin();
+             it != queue.rend() && level[*it] == num_levels - 1; ++it) {
+            if (vertex_degree(*it) < vertex_degree(candidate)) {
+                candidate = *it;
+            }
+        }
+        vector<IndexType> candidate_level(n, exec);
+        vector<IndexType> candidate_queue(exec);
+        const auto candidate_num_levels = level_structure(
+            n, row_ptrs, col_idxs, candidate, candidate_level, candidate_queue);
+        if (candidate_num_levels <= num_levels) {
+            break;
+        }
+        num_levels = candidate_num_levels;
+        level.swap(candidate_level);
+        queue.swap(candidate_queue);
+    }
+    // part[v] is 0 or 1 for the two parts, 2 for the separator
+    vector<uint8> part(n, exec);
+    const auto component_size = static_cast<IndexType>(queue.size());
+    if (component_size < n) {
+        // the graph is disconnected: split off the component of the root
+        for (IndexType v = 0; v < n; v++) {
+            part[v] = level[v] == invalid_index<IndexType>() ? 1 : 0;
+        }
+    } else if (num_levels < 3) {
+        // the graph is too dense to be separated by a level
+        order_leaf();
+        return;
+    } else {
+        // choose the level that splits the remaining vertices most evenly as
+        // the separator
+        vector<IndexType> level_ptrs(num_levels + 1, 0, exec);
+        for (auto v : queue) {
+            level_ptrs[level[v] + 1]++;
+        }
+        std::partial_sum(level_ptrs.begin(), level_ptrs.end(),
+                         level_ptrs.begin());
+        IndexType separator_level = 1;
+        for (IndexType l = 1; l < num_levels - 1; l++) {
+            const auto imbalance = [&](IndexType sep) {
+                const auto before = level_ptrs[sep];
+                const auto after = n - level_ptrs[sep + 1];
+                return before > after ? before - after : after - before;
+            };
+            if (imbalance(l) < imbalance(separator_level)) {
+                separator_level = l;
+            }
+        }
+        for (IndexType v = 0; v < n; v++) {
+            part[v] = level[v] < separator_level
+                          ? 0
+                          : (level[v] > separator_level ? 1 : 2);
+        }
+        // separator vertices without neighbors in the second part can be
+        // moved to the first part
+        for (IndexType v = 0; v < n; v++) {
+            if (part[v] == 2 &&
+                std::none_of(col_idxs + row_ptrs[v],
+                             col_idxs + row_ptrs[v + 1],
+                             [&](IndexType w) { return part[w] == 1; })) {
+                part[v] = 0;
+            }
+        }
+    }
+    // extract the subgraphs induced by both parts, the parts are ordered
+    // first, followed by the separator
+    vector<IndexType> local_idx(n, exec);
+    IndexType part_sizes[3]{};
+    for (IndexType v = 0; v < n; v++) {
+        local_idx[v] = part_sizes[part[v]]++;
+    }
+    auto separator_out = permutation + part_sizes[0] + part_sizes[1];
+    for (IndexType v = 0; v < n; v++) {
+        if (part[v] == 2) {
+            separator_out[local_idx[v]] = vertices[v];
+        }
+    }
+    auto recurse = [&](uint8 id, IndexType* out) {
+        const auto sub_n = part_sizes[id];
+        vector<IndexType> sub_row_ptrs(sub_n + 1, 0, exec);
+        vector<IndexType> sub_col_idxs(exec);
+        vector<IndexType> sub_vertices(sub_n, exec);
+        for (IndexType v = 0; v < n; v++) {
+            if (part[v] != id) {
+                continue;
+            }
+            const auto local_v = local_idx[v];
+            sub_vertices[local_v] = vertices[v];
+            for (auto nz = row_ptrs[v]; nz < row_ptrs[v + 1]; nz++) {
+                const auto w = col_idxs[nz];
+                if (part[w] == id) {
+                    sub_col_idxs.push_back(local_idx[w]);
+                }
+            }
+            sub_row_ptrs[local_v + 1] =
+                static_cast<IndexType>(sub_col_idxs.size());
+        }
+        nested_dissection_step(exec, sub_n, sub_row_ptrs.data(),
+                               sub_col_idxs.data(), sub_vertices.data(),
+                               leaf_size, out, fork_join);
+    };
+    fork_join([&] { recurse(0, permutation); },
+              [&] { recurse(1, permutation + part_sizes[0]); });
+}
+
+
+/**
+ * @internal
+ *
+ * Computes a nested dissection ordering of an undirected graph.
+ *
+ * The graph is recursively split into two parts by a vertex separator, which
+ * is ordered after both parts, so eliminating the parts creates no fill-in
+ * between them. The separators are taken from the level structure rooted at a
+ * pseudo-peripheral vertex, using the level that splits the graph most evenly
+ * (George: Nested Dissection of a Regular Finite Element Mesh). Disconnected
+ * components are ordered independently, and subgraphs with at most
+ * `leaf_size` vertices are ordered using amd_order.
+ *
+ * @param exec  the executor used for temporary allocations
+ * @param num_vertices  the number of vertices in the graph
+ * @param row_ptrs  the row pointers of the adjacency matrix
+ * @param col_idxs  the column indices of the adjacency matrix, which needs to
+ *                  be symmetric. Diagonal entries are ignored.
+ * @param leaf_size  the maximum number of vertices of a subgraph that is not
+ *                   dissected further
+ * @param permutation  the output ordering, `permutation[k]` is the vertex
+ *                     eliminated in step `k`.
+ * @param fork_join  callable with signature `fork_join(f1, f2)` that executes
+ *                   both callables `f1()` and `f2()` before returning. Their
+ *                   subproblems are independent, so they can be executed in
+ *                   parallel.
+ */
+template <typename IndexType, typename ForkJoin>
+void nested_dissection_order(std::shared_ptr<const Executor> exec,
+                             IndexType num_vertices, const IndexType* row_ptrs,
+                             const IndexType* col_idxs, IndexType leaf_size,
+                             IndexType* permutation, ForkJoin fork_join)
+{
+    vector<IndexType> vertices(num_vertices, exec);
+    std::iota(vertices.begin(), vertices.end(), IndexType{});
+    nested_dissection_step(exec, num_vertices, row_ptrs, col_idxs,
+                           vertices.data(), std::max(leaf_size, IndexType{1}),
+                           permutation, fork_join);
+}
+
+
+}  // namespace detail
+}  // namespace reorder
+}  // namespace gko
+
+
+#endif  // GKO_CORE_REORDER_GRAPH_ORDERING_HPP_
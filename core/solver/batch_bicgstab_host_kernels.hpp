@@ -0,0 +1,163 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2022, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#ifndef GKO_CORE_SOLVER_BATCH_BICGSTAB_HOST_KERNELS_HPP_
+#define GKO_CORE_SOLVER_BATCH_BICGSTAB_HOST_KERNELS_HPP_
+
+
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/stop/residual_norm.hpp>
+
+
+#include "core/matrix/batch_struct.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace host {
+namespace batch_bicgstab {
+
+
+/**
+ * Returns the number of values of workspace needed to solve a single batch
+ * system with `num_rows` rows.
+ */
+inline size_type workspace_size(size_type num_rows) { return 8 * num_rows; }
+
+
+/**
+ * Solves the system of batch item `item` for right-hand side `rhs` with the
+ * unpreconditioned BiCGSTAB method, using the values in x as initial guess.
+ *
+ * @return the number of iterations performed
+ */
+template <typename BatchItemType, typename ValueType>
+inline int32 solve(const BatchItemType& a, const matrix::Dense<ValueType>* b,
+                   matrix::Dense<ValueType>* x, size_type item, size_type rhs,
+                   ValueType* workspace, size_type max_iterations,
+                   remove_complex<ValueType> tolerance,
+                   stop::mode tolerance_type,
+                   remove_complex<ValueType>& residual_norm)
+{
+    const auto n = a.num_rows;
+    auto local_b = workspace;
+    auto local_x = local_b + n;
+    auto r = local_x + n;
+    auto r_hat = r + n;
+    auto p = r_hat + n;
+    auto v = p + n;
+    auto s = v + n;
+    auto t = s + n;
+    load_item_vector(b, item, rhs, n, local_b);
+    load_item_vector(x, item, rhs, n, local_x);
+
+    // r = r_hat = b - A * x, p = v = 0
+    simple_apply(a, local_x, v);
+    for (size_type i = 0; i < n; i++) {
+        r[i] = local_b[i] - v[i];
+        r_hat[i] = r[i];
+        p[i] = zero<ValueType>();
+        v[i] = zero<ValueType>();
+    }
+    residual_norm = norm2(n, r);
+    const auto threshold = convergence_threshold(
+        tolerance_type, tolerance, norm2(n, local_b), residual_norm);
+
+    auto rho = one<ValueType>();
+    auto alpha = one<ValueType>();
+    auto omega = one<ValueType>();
+    int32 iter = 0;
+    while (residual_norm > threshold && iter < max_iterations) {
+        const auto new_rho = dot(n, r_hat, r);
+        if (is_zero(new_rho)) {
+            // breakdown, the system cannot make any further progress
+            break;
+        }
+        const auto beta = (new_rho / rho) * (alpha / omega);
+        for (size_type i = 0; i < n; i++) {
+            p[i] = r[i] + beta * (p[i] - omega * v[i]);
+        }
+        simple_apply(a, p, v);
+        const auto r_hat_v = dot(n, r_hat, v);
+        if (is_zero(r_hat_v)) {
+            break;
+        }
+        alpha = new_rho / r_hat_v;
+        for (size_type i = 0; i < n; i++) {
+            s[i] = r[i] - alpha * v[i];
+        }
+        iter++;
+        const auto s_norm = norm2(n, s);
+        if (s_norm <= threshold) {
+            // early exit, the half step already converged
+            for (size_type i = 0; i < n; i++) {
+                local_x[i] += alpha * p[i];
+            }
+            residual_norm = s_norm;
+            break;
+        }
+        simple_apply(a, s, t);
+        const auto t_t = dot(n, t, t);
+        if (is_zero(t_t)) {
+            for (size_type i = 0; i < n; i++) {
+                local_x[i] += alpha * p[i];
+            }
+            residual_norm = s_norm;
+            break;
+        }
+        omega = dot(n, t, s) / t_t;
+        for (size_type i = 0; i < n; i++) {
+            local_x[i] += alpha * p[i] + omega * s[i];
+            r[i] = s[i] - omega * t[i];
+        }
+        residual_norm = norm2(n, r);
+        rho = new_rho;
+        if (is_zero(omega)) {
+            break;
+        }
+    }
+
+    store_item_vector(local_x, item, rhs, n, x);
+    return iter;
+}
+
+
+}  // namespace batch_bicgstab
+}  // namespace host
+}  // namespace kernels
+}  // namespace gko
+
+
+#endif  // GKO_CORE_SOLVER_BATCH_BICGSTAB_HOST_KERNELS_HPP_
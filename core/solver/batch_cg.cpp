@@ -0,0 +1,80 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2022, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include <ginkgo/core/solver/batch_cg.hpp>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/executor.hpp>
+
+
+#include "core/solver/batch_dispatch.hpp"
+#include "core/solver/batch_cg_kernels.hpp"
+
+
+namespace gko {
+namespace solver {
+namespace batch_cg {
+namespace {
+
+
+GKO_REGISTER_OPERATION(apply, batch_cg::apply);
+
+
+}  // anonymous namespace
+}  // namespace batch_cg
+
+
+template <typename ValueType>
+void BatchCg<ValueType>::apply_batch_kernel(
+    const matrix::Dense<ValueType>* b, matrix::Dense<ValueType>* x,
+    array<ValueType>& workspace, array<int32>& num_iterations,
+    matrix::Dense<real_type>* residual_norms) const
+{
+    auto exec = this->get_executor();
+    detail::run_batch<ValueType>(
+        this->get_system_matrix().get(), [&](auto batch_matrix) {
+            exec->run(batch_cg::make_apply(
+                batch_matrix, b, x, parameters_.max_iterations,
+                parameters_.tolerance, parameters_.tolerance_type,
+                &num_iterations, residual_norms, workspace));
+        });
+}
+
+
+#define GKO_DECLARE_BATCH_CG(_type) class BatchCg<_type>
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_BATCH_CG);
+
+
+}  // namespace solver
+}  // namespace gko
@@ -0,0 +1,128 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2022, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#ifndef GKO_CORE_SOLVER_BATCH_CG_HOST_KERNELS_HPP_
+#define GKO_CORE_SOLVER_BATCH_CG_HOST_KERNELS_HPP_
+
+
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/stop/residual_norm.hpp>
+
+
+#include "core/matrix/batch_struct.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace host {
+namespace batch_cg {
+
+
+/**
+ * Returns the number of values of workspace needed to solve a single batch
+ * system with `num_rows` rows.
+ */
+inline size_type workspace_size(size_type num_rows) { return 5 * num_rows; }
+
+
+/**
+ * Solves the system of batch item `item` for right-hand side `rhs` with the
+ * unpreconditioned CG method, using the values in x as initial guess.
+ *
+ * @return the number of iterations performed
+ */
+template <typename BatchItemType, typename ValueType>
+inline int32 solve(const BatchItemType& a, const matrix::Dense<ValueType>* b,
+                   matrix::Dense<ValueType>* x, size_type item, size_type rhs,
+                   ValueType* workspace, size_type max_iterations,
+                   remove_complex<ValueType> tolerance,
+                   stop::mode tolerance_type,
+                   remove_complex<ValueType>& residual_norm)
+{
+    const auto n = a.num_rows;
+    auto local_b = workspace;
+    auto local_x = local_b + n;
+    auto r = local_x + n;
+    auto p = r + n;
+    auto q = p + n;
+    load_item_vector(b, item, rhs, n, local_b);
+    load_item_vector(x, item, rhs, n, local_x);
+
+    // r = p = b - A * x
+    simple_apply(a, local_x, q);
+    for (size_type i = 0; i < n; i++) {
+        r[i] = local_b[i] - q[i];
+        p[i] = r[i];
+    }
+    auto rho = dot(n, r, r);
+    residual_norm = sqrt(abs(rho));
+    const auto threshold = convergence_threshold(
+        tolerance_type, tolerance, norm2(n, local_b), residual_norm);
+
+    int32 iter = 0;
+    while (residual_norm > threshold && iter < max_iterations) {
+        simple_apply(a, p, q);
+        const auto pq = dot(n, p, q);
+        if (is_zero(pq)) {
+            // breakdown, the system cannot make any further progress
+            break;
+        }
+        const auto alpha = rho / pq;
+        for (size_type i = 0; i < n; i++) {
+            local_x[i] += alpha * p[i];
+            r[i] -= alpha * q[i];
+        }
+        const auto new_rho = dot(n, r, r);
+        const auto beta = new_rho / rho;
+        for (size_type i = 0; i < n; i++) {
+            p[i] = r[i] + beta * p[i];
+        }
+        rho = new_rho;
+        residual_norm = sqrt(abs(rho));
+        iter++;
+    }
+
+    store_item_vector(local_x, item, rhs, n, x);
+    return iter;
+}
+
+
+}  // namespace batch_cg
+}  // namespace host
+}  // namespace kernels
+}  // namespace gko
+
+
+#endif  // GKO_CORE_SOLVER_BATCH_CG_HOST_KERNELS_HPP_
@@ -0,0 +1,95 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2022, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#ifndef GKO_CORE_SOLVER_BATCH_DISPATCH_HPP_
+#define GKO_CORE_SOLVER_BATCH_DISPATCH_HPP_
+
+
+#include <ginkgo/core/base/lin_op.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/matrix/batch_csr.hpp>
+#include <ginkgo/core/matrix/batch_dense.hpp>
+#include <ginkgo/core/matrix/batch_ell.hpp>
+
+
+#include "core/base/dispatch_helper.hpp"
+
+
+/**
+ * Instantiates a template for each value type and batch matrix format
+ * supported by the batched solvers.
+ *
+ * @param _macro  A macro which expands the template instantiation
+ *                (not including the leading `template` specifier).
+ *                Should take two arguments, which are replaced by the
+ *                value type and the batch matrix type, respectively.
+ */
+#define GKO_INSTANTIATE_FOR_EACH_BATCH_MATRIX_TYPE_HELPER(_macro, _vtype) \
+    template _macro(_vtype, matrix::BatchCsr<_vtype>);                    \
+    template _macro(_vtype, matrix::BatchEll<_vtype>);                    \
+    template _macro(_vtype, matrix::BatchDense<_vtype>)
+
+#define GKO_INSTANTIATE_FOR_EACH_BATCH_MATRIX_TYPE(_macro)                  \
+    GKO_INSTANTIATE_FOR_EACH_BATCH_MATRIX_TYPE_HELPER(_macro, float);       \
+    GKO_INSTANTIATE_FOR_EACH_BATCH_MATRIX_TYPE_HELPER(_macro, double);      \
+    GKO_INSTANTIATE_FOR_EACH_BATCH_MATRIX_TYPE_HELPER(_macro,               \
+                                                      std::complex<float>); \
+    GKO_INSTANTIATE_FOR_EACH_BATCH_MATRIX_TYPE_HELPER(_macro,               \
+                                                      std::complex<double>)
+
+
+namespace gko {
+namespace solver {
+namespace detail {
+
+
+/**
+ * Calls `fn` with the system matrix cast to the batch matrix format it is
+ * stored in.
+ *
+ * @throw NotImplemented  if the system matrix is not a supported batch matrix
+ */
+template <typename ValueType, typename Function>
+void run_batch(const LinOp* system_matrix, Function fn)
+{
+    run<const matrix::BatchCsr<ValueType>*, const matrix::BatchEll<ValueType>*,
+        const matrix::BatchDense<ValueType>*>(system_matrix, fn);
+}
+
+
+}  // namespace detail
+}  // namespace solver
+}  // namespace gko
+
+
+#endif  // GKO_CORE_SOLVER_BATCH_DISPATCH_HPP_
@@ -0,0 +1,197 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2022, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#ifndef GKO_CORE_SOLVER_BATCH_GMRES_HOST_KERNELS_HPP_
+#define GKO_CORE_SOLVER_BATCH_GMRES_HOST_KERNELS_HPP_
+
+
+#include <cmath>
+
+
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/stop/residual_norm.hpp>
+
+
+#include "core/matrix/batch_struct.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace host {
+namespace batch_gmres {
+
+
+/**
+ * Returns the number of values of workspace needed to solve a single batch
+ * system with `num_rows` rows and a Krylov subspace of dimension `krylov_dim`.
+ */
+inline size_type workspace_size(size_type num_rows, size_type krylov_dim)
+{
+    // b, x, r, the Krylov basis, the Hessenberg matrix, the Givens rotations
+    // and the right-hand side of the least-squares problem
+    return (krylov_dim + 4) * num_rows + (krylov_dim + 1) * krylov_dim +
+           3 * krylov_dim + 1;
+}
+
+
+/**
+ * Solves the system of batch item `item` for right-hand side `rhs` with the
+ * restarted GMRES method, using the values in x as initial guess. The basis is
+ * orthogonalized with modified Gram-Schmidt and the Hessenberg matrix is
+ * reduced by Givens rotations.
+ *
+ * @return the number of iterations performed
+ */
+template <typename BatchItemType, typename ValueType>
+inline int32 solve(const BatchItemType& a, const matrix::Dense<ValueType>* b,
+                   matrix::Dense<ValueType>* x, size_type item, size_type rhs,
+                   ValueType* workspace, size_type max_iterations,
+                   remove_complex<ValueType> tolerance,
+                   stop::mode tolerance_type, size_type krylov_dim,
+                   remove_complex<ValueType>& residual_norm)
+{
+    const auto n = a.num_rows;
+    const auto m = krylov_dim;
+    auto local_b = workspace;
+    auto local_x = local_b + n;
+    auto r = local_x + n;
+    auto krylov_bases = r + n;
+    // column k of the Hessenberg matrix starts at hessenberg + k * (m + 1)
+    auto hessenberg = krylov_bases + (m + 1) * n;
+    auto givens_cos = hessenberg + (m + 1) * m;
+    auto givens_sin = givens_cos + m;
+    auto g = givens_sin + m;
+    load_item_vector(b, item, rhs, n, local_b);
+    load_item_vector(x, item, rhs, n, local_x);
+
+    const auto compute_residual = [&] {
+        simple_apply(a, local_x, r);
+        for (size_type i = 0; i < n; i++) {
+            r[i] = local_b[i] - r[i];
+        }
+        return norm2(n, r);
+    };
+
+    residual_norm = compute_residual();
+    const auto threshold = convergence_threshold(
+        tolerance_type, tolerance, norm2(n, local_b), residual_norm);
+
+    int32 iter = 0;
+    while (residual_norm > threshold && iter < max_iterations) {
+        // start a new restart cycle from the current residual
+        const auto beta = residual_norm;
+        for (size_type i = 0; i < n; i++) {
+            krylov_bases[i] = r[i] / beta;
+        }
+        g[0] = beta;
+        size_type k = 0;
+        while (k < m && iter < max_iterations && residual_norm > threshold) {
+            const auto v = krylov_bases + k * n;
+            auto w = v + n;
+            auto h = hessenberg + k * (m + 1);
+            simple_apply(a, v, w);
+            for (size_type j = 0; j <= k; j++) {
+                const auto basis = krylov_bases + j * n;
+                h[j] = dot(n, basis, w);
+                for (size_type i = 0; i < n; i++) {
+                    w[i] -= h[j] * basis[i];
+                }
+            }
+            const auto next_norm = norm2(n, w);
+            h[k + 1] = next_norm;
+            for (size_type j = 0; j < k; j++) {
+                const auto temp =
+                    givens_cos[j] * h[j] + givens_sin[j] * h[j + 1];
+                h[j + 1] = -conj(givens_sin[j]) * h[j] +
+                           conj(givens_cos[j]) * h[j + 1];
+                h[j] = temp;
+            }
+            if (is_zero(h[k])) {
+                givens_cos[k] = zero<ValueType>();
+                givens_sin[k] = one<ValueType>();
+            } else {
+                const auto scale = abs(h[k]) + abs(h[k + 1]);
+                const remove_complex<ValueType> hypotenuse =
+                    scale * std::sqrt(abs(h[k] / scale) * abs(h[k] / scale) +
+                                 abs(h[k + 1] / scale) * abs(h[k + 1] / scale));
+                givens_cos[k] = conj(h[k]) / hypotenuse;
+                givens_sin[k] = conj(h[k + 1]) / hypotenuse;
+            }
+            h[k] = givens_cos[k] * h[k] + givens_sin[k] * h[k + 1];
+            h[k + 1] = zero<ValueType>();
+            g[k + 1] = -conj(givens_sin[k]) * g[k];
+            g[k] = givens_cos[k] * g[k];
+            residual_norm = abs(g[k + 1]);
+            k++;
+            iter++;
+            if (is_zero(next_norm)) {
+                // the Krylov subspace is invariant, the solution is exact
+                break;
+            }
+            for (size_type i = 0; i < n; i++) {
+                w[i] /= next_norm;
+            }
+        }
+        // solve the triangular least-squares system in place of g
+        for (auto row = k; row-- > 0;) {
+            auto value = g[row];
+            for (auto col = row + 1; col < k; col++) {
+                value -= hessenberg[col * (m + 1) + row] * g[col];
+            }
+            const auto diag = hessenberg[row * (m + 1) + row];
+            // a singular Hessenberg matrix only occurs on breakdown
+            g[row] = is_zero(diag) ? zero<ValueType>() : value / diag;
+        }
+        for (size_type j = 0; j < k; j++) {
+            const auto basis = krylov_bases + j * n;
+            for (size_type i = 0; i < n; i++) {
+                local_x[i] += g[j] * basis[i];
+            }
+        }
+        residual_norm = compute_residual();
+    }
+
+    store_item_vector(local_x, item, rhs, n, x);
+    return iter;
+}
+
+
+}  // namespace batch_gmres
+}  // namespace host
+}  // namespace kernels
+}  // namespace gko
+
+
+#endif  // GKO_CORE_SOLVER_BATCH_GMRES_HOST_KERNELS_HPP_
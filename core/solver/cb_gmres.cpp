@@ -205,6 +205,13 @@ void CbGmres<ValueType>::apply_dense_impl(
     const matrix::Dense<ValueType>* dense_b,
     matrix::Dense<ValueType>* dense_x) const
 {
+    // the compressed basis is only processed in fused classical Gram-Schmidt
+    // passes
+    const auto ortho = parameters_.orthogonalization;
+    if (ortho == gmres::ortho_method::mgs ||
+        ortho == gmres::ortho_method::dcgs2) {
+        GKO_NOT_SUPPORTED(ortho);
+    }
     // Current workaround to get a lambda with a template argument (only
     // the type of `value` matters, the content does not)
     auto apply_templated = [&](auto value) {
@@ -441,7 +448,8 @@ void CbGmres<ValueType>::apply_dense_impl(
                 residual_norm.get(), residual_norm_collection.get(),
                 krylov_bases_range, hessenberg_iter.get(), buffer_iter.get(),
                 arnoldi_norm.get(), restart_iter, &final_iter_nums,
-                &stop_status, &reorth_status, &num_reorth));
+                &stop_status, &reorth_status, &num_reorth,
+                parameters_.orthogonalization));
             // for i in 0:restart_iter
             //     hessenberg(restart_iter, i) = next_krylov_basis' *
             //     krylov_bases(:, i) next_krylov_basis  -=
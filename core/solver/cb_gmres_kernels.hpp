@@ -39,6 +39,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ginkgo/core/base/range.hpp>
 #include <ginkgo/core/base/types.hpp>
 #include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/solver/gmres.hpp>
 
 
 #include "accessor/reduced_row_major.hpp"
@@ -157,7 +158,8 @@ namespace kernels {
         matrix::Dense<remove_complex<_type1>>* arnoldi_norm, size_type iter,  \
         array<size_type>* final_iter_nums,                                    \
         const array<stopping_status>* stop_status,                            \
-        array<stopping_status>* reorth_status, array<size_type>* num_reorth)
+        array<stopping_status>* reorth_status, array<size_type>* num_reorth,  \
+        solver::gmres::ortho_method ortho)
 
 #define GKO_DECLARE_CB_GMRES_SOLVE_KRYLOV_KERNEL(_type1, _range)             \
     void solve_krylov(std::shared_ptr<const DefaultExecutor> exec,           \
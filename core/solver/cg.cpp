@@ -40,6 +40,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ginkgo/core/base/name_demangling.hpp>
 #include <ginkgo/core/base/precision_dispatch.hpp>
 #include <ginkgo/core/base/utils.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/identity.hpp>
 
 
 #include "core/distributed/helpers.hpp"
@@ -56,6 +58,49 @@ namespace {
 GKO_REGISTER_OPERATION(initialize, cg::initialize);
 GKO_REGISTER_OPERATION(step_1, cg::step_1);
 GKO_REGISTER_OPERATION(step_2, cg::step_2);
+GKO_REGISTER_OPERATION(step_2_norm, cg::step_2_norm);
+GKO_REGISTER_OPERATION(spmv_conj_dot, cg::spmv_conj_dot);
+
+
+/**
+ * Returns true if the Csr matrix uses a strategy that distributes whole rows,
+ * which is the work distribution of the fused spmv_conj_dot kernel.
+ */
+template <typename CsrType>
+bool has_row_based_strategy(const CsrType* csr)
+{
+    const auto strategy = csr->get_strategy()->get_name();
+    return strategy != "load_balance" && strategy != "merge_path";
+}
+
+
+/**
+ * Computes q = A * p and beta = dot(p, q) in a single sweep if A is stored in
+ * Csr format with a row-based strategy.
+ *
+ * @return true if the fused kernel was run, false if A is not a suitable Csr
+ *         matrix and the caller needs to fall back to separate SpMV and dot.
+ */
+template <typename ValueType>
+bool try_spmv_conj_dot(std::shared_ptr<const Executor> exec, const LinOp* a,
+                       const matrix::Dense<ValueType>* p,
+                       matrix::Dense<ValueType>* q,
+                       matrix::Dense<ValueType>* beta, array<char>& tmp)
+{
+    if (auto csr = dynamic_cast<const matrix::Csr<ValueType, int32>*>(a)) {
+        if (has_row_based_strategy(csr)) {
+            exec->run(make_spmv_conj_dot(csr, p, q, beta, tmp));
+            return true;
+        }
+    }
+    if (auto csr = dynamic_cast<const matrix::Csr<ValueType, int64>*>(a)) {
+        if (has_row_based_strategy(csr)) {
+            exec->run(make_spmv_conj_dot(csr, p, q, beta, tmp));
+            return true;
+        }
+    }
+    return false;
+}
 
 
 }  // anonymous namespace
@@ -144,6 +189,24 @@ void Cg<ValueType>::apply_dense_impl(const VectorType* dense_b,
         this->get_system_matrix(),
         std::shared_ptr<const LinOp>(dense_b, [](const LinOp*) {}), dense_x, r);
 
+    // On host executors, the vector updates are fused with the reductions
+    // that follow them, which saves a pass over r and z (step 2 + norm + dot)
+    // and over p and q (SpMV + dot) in every iteration. The fused update
+    // requires z == r, i.e. no preconditioner.
+    const bool fuse_kernels =
+        std::is_same<VectorType, LocalVector>::value &&
+        exec == exec->get_master();
+    const bool fuse_update =
+        fuse_kernels &&
+        dynamic_cast<const matrix::Identity<ValueType>*>(
+            this->get_preconditioner().get()) != nullptr;
+    matrix::Dense<remove_complex<ValueType>>* residual_norm = nullptr;
+    if (fuse_update) {
+        residual_norm =
+            this->template create_workspace_scalar<remove_complex<ValueType>>(
+                GKO_SOLVER_TRAITS::residual_norm, dense_b->get_size()[1]);
+    }
+
     int iter = -1;
     /* Memory movement summary:
      * 18n * values + matrix/preconditioner storage
@@ -153,12 +216,20 @@ void Cg<ValueType>::apply_dense_impl(const VectorType* dense_b,
      * 1x step 1 (axpy)   3n
      * 1x step 2 (axpys)  6n
      * 1x norm2 residual   n
+     *
+     * Fused (host executor, Csr matrix, no preconditioner):
+     * 11n * values + matrix storage
+     * 1x SpMV + dot:     2n * values + storage
+     * 1x step 1 (axpy)   3n
+     * 1x step 2 + norm   6n
      */
     while (true) {
-        // z = preconditioner * r
-        this->get_preconditioner()->apply(r, z);
-        // rho = dot(r, z)
-        r->compute_conj_dot(z, rho, reduction_tmp);
+        if (!fuse_update || iter < 0) {
+            // z = preconditioner * r
+            this->get_preconditioner()->apply(r, z);
+            // rho = dot(r, z)
+            r->compute_conj_dot(z, rho, reduction_tmp);
+        }
 
         ++iter;
         this->template log<log::Logger::iteration_complete>(
@@ -166,6 +237,8 @@ void Cg<ValueType>::apply_dense_impl(const VectorType* dense_b,
         if (stop_criterion->update()
                 .num_iterations(iter)
                 .residual(r)
+                .residual_norm(fuse_update && iter > 0 ? residual_norm
+                                                       : nullptr)
                 .implicit_sq_residual_norm(rho)
                 .solution(dense_x)
                 .check(RelativeStoppingId, true, &stop_status, &one_changed)) {
@@ -175,19 +248,34 @@ void Cg<ValueType>::apply_dense_impl(const VectorType* dense_b,
         // tmp = rho / prev_rho
         // p = z + tmp * p
         exec->run(cg::make_step_1(gko::detail::get_local(p),
-                                  gko::detail::get_local(z), rho, prev_rho,
-                                  &stop_status));
+                                  gko::detail::get_local(fuse_update ? r : z),
+                                  rho, prev_rho, &stop_status));
         // q = A * p
-        this->get_system_matrix()->apply(p, q);
         // beta = dot(p, q)
-        p->compute_conj_dot(q, beta, reduction_tmp);
+        if (!fuse_kernels ||
+            !cg::try_spmv_conj_dot(exec, this->get_system_matrix().get(),
+                                   gko::detail::get_local(p),
+                                   gko::detail::get_local(q), beta,
+                                   reduction_tmp)) {
+            this->get_system_matrix()->apply(p, q);
+            p->compute_conj_dot(q, beta, reduction_tmp);
+        }
         // tmp = rho / beta
         // x = x + tmp * p
         // r = r - tmp * q
-        exec->run(cg::make_step_2(
-            gko::detail::get_local(dense_x), gko::detail::get_local(r),
-            gko::detail::get_local(p), gko::detail::get_local(q), beta, rho,
-            &stop_status));
+        if (fuse_update) {
+            // prev_rho = dot(r, r), swapped into rho below
+            // residual_norm = norm2(r)
+            exec->run(cg::make_step_2_norm(
+                gko::detail::get_local(dense_x), gko::detail::get_local(r),
+                gko::detail::get_local(p), gko::detail::get_local(q), beta,
+                rho, prev_rho, residual_norm, &stop_status, reduction_tmp));
+        } else {
+            exec->run(cg::make_step_2(
+                gko::detail::get_local(dense_x), gko::detail::get_local(r),
+                gko::detail::get_local(p), gko::detail::get_local(q), beta,
+                rho, &stop_status));
+        }
         swap(prev_rho, rho);
     }
 }
@@ -221,7 +309,7 @@ int workspace_traits<Cg<ValueType>>::num_arrays(const Solver&)
 template <typename ValueType>
 int workspace_traits<Cg<ValueType>>::num_vectors(const Solver&)
 {
-    return 10;
+    return 11;
 }
 
 
@@ -230,8 +318,8 @@ std::vector<std::string> workspace_traits<Cg<ValueType>>::op_names(
     const Solver&)
 {
     return {
-        "r",    "z",        "p",   "q",   "alpha",
-        "beta", "prev_rho", "rho", "one", "minus_one",
+        "r",        "z",   "p",   "q",         "alpha",         "beta",
+        "prev_rho", "rho", "one", "minus_one", "residual_norm",
     };
 }
 
@@ -247,7 +335,7 @@ std::vector<std::string> workspace_traits<Cg<ValueType>>::array_names(
 template <typename ValueType>
 std::vector<int> workspace_traits<Cg<ValueType>>::scalars(const Solver&)
 {
-    return {alpha, beta, prev_rho, rho};
+    return {alpha, beta, prev_rho, rho, residual_norm};
 }
 
 
@@ -40,6 +40,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ginkgo/core/base/array.hpp>
 #include <ginkgo/core/base/math.hpp>
 #include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
 #include <ginkgo/core/matrix/dense.hpp>
 #include <ginkgo/core/stop/stopping_status.hpp>
 
@@ -78,13 +79,39 @@ namespace cg {
                 const array<stopping_status>* stop_status)
 
 
-#define GKO_DECLARE_ALL_AS_TEMPLATES             \
-    template <typename ValueType>                \
-    GKO_DECLARE_CG_INITIALIZE_KERNEL(ValueType); \
-    template <typename ValueType>                \
-    GKO_DECLARE_CG_STEP_1_KERNEL(ValueType);     \
-    template <typename ValueType>                \
-    GKO_DECLARE_CG_STEP_2_KERNEL(ValueType)
+#define GKO_DECLARE_CG_STEP_2_NORM_KERNEL(_type)                          \
+    void step_2_norm(std::shared_ptr<const DefaultExecutor> exec,         \
+                     matrix::Dense<_type>* x, matrix::Dense<_type>* r,    \
+                     const matrix::Dense<_type>* p,                       \
+                     const matrix::Dense<_type>* q,                       \
+                     const matrix::Dense<_type>* beta,                    \
+                     const matrix::Dense<_type>* rho,                     \
+                     matrix::Dense<_type>* next_rho,                      \
+                     matrix::Dense<remove_complex<_type>>* residual_norm, \
+                     const array<stopping_status>* stop_status,           \
+                     array<char>& tmp)
+
+
+#define GKO_DECLARE_CG_SPMV_CONJ_DOT_KERNEL(ValueType, IndexType)   \
+    void spmv_conj_dot(std::shared_ptr<const DefaultExecutor> exec, \
+                       const matrix::Csr<ValueType, IndexType>* a,  \
+                       const matrix::Dense<ValueType>* p,           \
+                       matrix::Dense<ValueType>* q,                 \
+                       matrix::Dense<ValueType>* beta,              \
+                       array<char>& tmp)
+
+
+#define GKO_DECLARE_ALL_AS_TEMPLATES                  \
+    template <typename ValueType>                     \
+    GKO_DECLARE_CG_INITIALIZE_KERNEL(ValueType);      \
+    template <typename ValueType>                     \
+    GKO_DECLARE_CG_STEP_1_KERNEL(ValueType);          \
+    template <typename ValueType>                     \
+    GKO_DECLARE_CG_STEP_2_KERNEL(ValueType);          \
+    template <typename ValueType>                     \
+    GKO_DECLARE_CG_STEP_2_NORM_KERNEL(ValueType);     \
+    template <typename ValueType, typename IndexType> \
+    GKO_DECLARE_CG_SPMV_CONJ_DOT_KERNEL(ValueType, IndexType)
 
 
 }  // namespace cg
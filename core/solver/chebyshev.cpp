@@ -0,0 +1,364 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2022, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#include <ginkgo/core/solver/chebyshev.hpp>
+
+
+#include <random>
+
+
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/matrix_data.hpp>
+#include <ginkgo/core/base/precision_dispatch.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/solver/solver_base.hpp>
+
+
+#include "core/distributed/helpers.hpp"
+#include "core/solver/chebyshev_kernels.hpp"
+#include "core/solver/ir_kernels.hpp"
+#include "core/solver/solver_base.hpp"
+#include "core/solver/solver_boilerplate.hpp"
+
+
+namespace gko {
+namespace solver {
+namespace chebyshev {
+namespace {
+
+
+GKO_REGISTER_OPERATION(initialize, ir::initialize);
+GKO_REGISTER_OPERATION(init_update, chebyshev::init_update);
+GKO_REGISTER_OPERATION(update, chebyshev::update);
+
+
+}  // anonymous namespace
+}  // namespace chebyshev
+
+
+template <typename ValueType>
+std::pair<remove_complex<ValueType>, remove_complex<ValueType>>
+Chebyshev<ValueType>::compute_eigenvalue_bounds() const
+{
+    using Vector = matrix::Dense<ValueType>;
+    using NormVector = matrix::Dense<eigenvalue_type>;
+    auto lower = parameters_.eigenvalue_bounds.first;
+    auto upper = parameters_.eigenvalue_bounds.second;
+    const auto num_rows = this->get_size()[0];
+    if (upper == zero<eigenvalue_type>() && num_rows > 0) {
+        auto exec = this->get_executor();
+        // power iteration on M A, starting from a fixed pseudo-random vector
+        // to get the same estimate on all executors
+        auto x = Vector::create(exec, dim<2>{num_rows, 1});
+        x->read(matrix_data<ValueType>(
+            x->get_size(), std::uniform_real_distribution<>(-1.0, 1.0),
+            std::default_random_engine(42)));
+        auto tmp = Vector::create(exec, x->get_size());
+        auto norm = NormVector::create(exec, dim<2>{1, 1});
+        auto inv_norm = Vector::create(exec, dim<2>{1, 1});
+        x->compute_norm2(norm.get());
+        auto estimate = exec->copy_val_to_host(norm->get_const_values());
+        for (size_type i = 0;
+             i < parameters_.num_power_iterations && is_nonzero(estimate);
+             i++) {
+            // x = M A x / norm(x)
+            inv_norm->fill(one<ValueType>() / estimate);
+            x->scale(inv_norm.get());
+            this->get_system_matrix()->apply(x.get(), tmp.get());
+            this->get_preconditioner()->apply(tmp.get(), x.get());
+            x->compute_norm2(norm.get());
+            estimate = exec->copy_val_to_host(norm->get_const_values());
+        }
+        upper = parameters_.max_eigenvalue_scale * estimate;
+    }
+    if (lower == zero<eigenvalue_type>()) {
+        lower = upper / parameters_.eigenvalue_ratio;
+    }
+    return {lower, upper};
+}
+
+
+template <typename ValueType>
+std::unique_ptr<LinOp> Chebyshev<ValueType>::transpose() const
+{
+    return build()
+        .with_generated_preconditioner(
+            share(as<Transposable>(this->get_preconditioner())->transpose()))
+        .with_criteria(this->get_stop_criterion_factory())
+        .with_eigenvalue_bounds(eigenvalue_bounds_)
+        .with_default_initial_guess(parameters_.default_initial_guess)
+        .on(this->get_executor())
+        ->generate(
+            share(as<Transposable>(this->get_system_matrix())->transpose()));
+}
+
+
+template <typename ValueType>
+std::unique_ptr<LinOp> Chebyshev<ValueType>::conj_transpose() const
+{
+    return build()
+        .with_generated_preconditioner(share(
+            as<Transposable>(this->get_preconditioner())->conj_transpose()))
+        .with_criteria(this->get_stop_criterion_factory())
+        .with_eigenvalue_bounds(eigenvalue_bounds_)
+        .with_default_initial_guess(parameters_.default_initial_guess)
+        .on(this->get_executor())
+        ->generate(share(
+            as<Transposable>(this->get_system_matrix())->conj_transpose()));
+}
+
+
+template <typename ValueType>
+void Chebyshev<ValueType>::apply_impl(const LinOp* b, LinOp* x) const
+{
+    this->apply_with_initial_guess(b, x, this->get_default_initial_guess());
+}
+
+
+template <typename ValueType>
+void Chebyshev<ValueType>::apply_with_initial_guess_impl(
+    const LinOp* b, LinOp* x, initial_guess_mode guess) const
+{
+    if (!this->get_system_matrix()) {
+        return;
+    }
+    experimental::precision_dispatch_real_complex_distributed<ValueType>(
+        [this, guess](auto dense_b, auto dense_x) {
+            prepare_initial_guess(dense_b, dense_x, guess);
+            this->apply_dense_impl(dense_b, dense_x, guess);
+        },
+        b, x);
+}
+
+
+template <typename ValueType>
+template <typename VectorType>
+void Chebyshev<ValueType>::apply_dense_impl(const VectorType* dense_b,
+                                            VectorType* dense_x,
+                                            initial_guess_mode guess) const
+{
+    using ws = workspace_traits<Chebyshev>;
+    constexpr uint8 relative_stopping_id{1};
+
+    auto exec = this->get_executor();
+    this->setup_workspace();
+
+    GKO_SOLVER_VECTOR(residual, dense_b);
+    GKO_SOLVER_VECTOR(inner_solution, dense_b);
+    GKO_SOLVER_VECTOR(update_solution, dense_b);
+
+    GKO_SOLVER_ONE_MINUS_ONE();
+
+    bool one_changed{};
+    auto& stop_status = this->template create_workspace_array<stopping_status>(
+        ws::stop, dense_b->get_size()[1]);
+    exec->run(chebyshev::make_initialize(&stop_status));
+    if (guess != initial_guess_mode::zero) {
+        residual->copy_from(dense_b);
+        this->get_system_matrix()->apply(neg_one_op, dense_x, one_op, residual);
+    }
+    // zero input the residual is dense_b
+    const VectorType* residual_ptr =
+        guess == initial_guess_mode::zero ? dense_b : residual;
+
+    auto stop_criterion = this->get_stop_criterion_factory()->generate(
+        this->get_system_matrix(),
+        std::shared_ptr<const LinOp>(dense_b, [](const LinOp*) {}), dense_x,
+        residual_ptr);
+
+    // the coefficients only depend on the eigenvalue bounds, so they are
+    // computed on the host and no reductions are necessary
+    const auto theta = (eigenvalue_bounds_.second + eigenvalue_bounds_.first) /
+                       eigenvalue_type{2};
+    const auto delta = (eigenvalue_bounds_.second - eigenvalue_bounds_.first) /
+                       eigenvalue_type{2};
+    auto tau = delta * delta / theta;
+    int iter = -1;
+    /* Memory movement summary:
+     * 11n * values + matrix/preconditioner storage
+     * 1x SpMV:                2n * values + storage
+     * 1x Preconditioner:      2n * values + storage
+     * 1x copy residual        2n
+     * 1x update (fused axpys) 5n
+     */
+    while (true) {
+        ++iter;
+        this->template log<log::Logger::iteration_complete>(
+            this, iter, residual_ptr, dense_x);
+
+        if (iter == 0) {
+            // In iter 0, the iteration and residual are updated.
+            if (stop_criterion->update()
+                    .num_iterations(iter)
+                    .residual(residual_ptr)
+                    .solution(dense_x)
+                    .check(relative_stopping_id, true, &stop_status,
+                           &one_changed)) {
+                break;
+            }
+        } else {
+            // In the other iterations, the residual can be updated separately.
+            if (stop_criterion->update()
+                    .num_iterations(iter)
+                    .solution(dense_x)
+                    .check(relative_stopping_id, false, &stop_status,
+                           &one_changed)) {
+                break;
+            }
+            residual_ptr = residual;
+            // residual = b - A * x
+            residual->copy_from(dense_b);
+            this->get_system_matrix()->apply(neg_one_op, dense_x, one_op,
+                                             residual);
+            if (stop_criterion->update()
+                    .num_iterations(iter)
+                    .residual(residual_ptr)
+                    .solution(dense_x)
+                    .check(relative_stopping_id, true, &stop_status,
+                           &one_changed)) {
+                break;
+            }
+        }
+
+        // inner_solution = preconditioner * residual
+        this->get_preconditioner()->apply(residual_ptr, inner_solution);
+        if (iter == 0) {
+            // update_solution = inner_solution / theta
+            // x = x + update_solution
+            exec->run(chebyshev::make_init_update(
+                static_cast<ValueType>(one<eigenvalue_type>() / theta),
+                gko::detail::get_local(inner_solution),
+                gko::detail::get_local(update_solution),
+                gko::detail::get_local(dense_x), &stop_status));
+        } else {
+            const auto alpha =
+                eigenvalue_type{2} / (eigenvalue_type{2} * theta - tau);
+            const auto beta = tau * alpha / eigenvalue_type{2};
+            // update_solution = alpha * inner_solution
+            //                   + beta * update_solution
+            // x = x + update_solution
+            exec->run(chebyshev::make_update(
+                static_cast<ValueType>(alpha), static_cast<ValueType>(beta),
+                gko::detail::get_local(inner_solution),
+                gko::detail::get_local(update_solution),
+                gko::detail::get_local(dense_x), &stop_status));
+            tau = delta * delta * alpha / eigenvalue_type{2};
+        }
+    }
+}
+
+
+template <typename ValueType>
+void Chebyshev<ValueType>::apply_impl(const LinOp* alpha, const LinOp* b,
+                                      const LinOp* beta, LinOp* x) const
+{
+    this->apply_with_initial_guess(alpha, b, beta, x,
+                                   this->get_default_initial_guess());
+}
+
+
+template <typename ValueType>
+void Chebyshev<ValueType>::apply_with_initial_guess_impl(
+    const LinOp* alpha, const LinOp* b, const LinOp* beta, LinOp* x,
+    initial_guess_mode guess) const
+{
+    if (!this->get_system_matrix()) {
+        return;
+    }
+    experimental::precision_dispatch_real_complex_distributed<ValueType>(
+        [this, guess](auto dense_alpha, auto dense_b, auto dense_beta,
+                      auto dense_x) {
+            prepare_initial_guess(dense_b, dense_x, guess);
+            auto x_clone = dense_x->clone();
+            this->apply_dense_impl(dense_b, x_clone.get(), guess);
+            dense_x->scale(dense_beta);
+            dense_x->add_scaled(dense_alpha, x_clone.get());
+        },
+        alpha, b, beta, x);
+}
+
+
+template <typename ValueType>
+int workspace_traits<Chebyshev<ValueType>>::num_arrays(const Solver&)
+{
+    return 1;
+}
+
+
+template <typename ValueType>
+int workspace_traits<Chebyshev<ValueType>>::num_vectors(const Solver&)
+{
+    return 5;
+}
+
+
+template <typename ValueType>
+std::vector<std::string> workspace_traits<Chebyshev<ValueType>>::op_names(
+    const Solver&)
+{
+    return {
+        "residual", "inner_solution", "update_solution", "one", "minus_one",
+    };
+}
+
+
+template <typename ValueType>
+std::vector<std::string> workspace_traits<Chebyshev<ValueType>>::array_names(
+    const Solver&)
+{
+    return {"stop"};
+}
+
+
+template <typename ValueType>
+std::vector<int> workspace_traits<Chebyshev<ValueType>>::scalars(const Solver&)
+{
+    return {};
+}
+
+
+template <typename ValueType>
+std::vector<int> workspace_traits<Chebyshev<ValueType>>::vectors(const Solver&)
+{
+    return {residual, inner_solution, update_solution};
+}
+
+
+#define GKO_DECLARE_CHEBYSHEV(_type) class Chebyshev<_type>
+#define GKO_DECLARE_CHEBYSHEV_TRAITS(_type) \
+    struct workspace_traits<Chebyshev<_type>>
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_CHEBYSHEV);
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_CHEBYSHEV_TRAITS);
+
+
+}  // namespace solver
+}  // namespace gko
@@ -33,6 +33,11 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ginkgo/core/solver/gmres.hpp>
 
 
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+
 #include <ginkgo/core/base/array.hpp>
 #include <ginkgo/core/base/exception.hpp>
 #include <ginkgo/core/base/exception_helpers.hpp>
@@ -61,6 +66,307 @@ GKO_REGISTER_OPERATION(restart, gmres::restart);
 GKO_REGISTER_OPERATION(hessenberg_qr, common_gmres::hessenberg_qr);
 GKO_REGISTER_OPERATION(solve_krylov, common_gmres::solve_krylov);
 GKO_REGISTER_OPERATION(multi_axpy, gmres::multi_axpy);
+GKO_REGISTER_OPERATION(multi_dot, gmres::multi_dot);
+GKO_REGISTER_OPERATION(multi_update, gmres::multi_update);
+
+
+/**
+ * One pass of block classical Gram-Schmidt with CholQR for the s-step block W
+ * against the previous Krylov bases V, computed on the host for every
+ * right-hand side from the inner products dots = [V W]^H W:
+ * proj = C = V^H W, factor = R with R^H R = W^H W - C^H C, and the
+ * coefficients of the update W := (W - V C) R^{-1} = W R^{-1} - V C R^{-1},
+ * coeffs = C R^{-1} and inv_factor = R^{-1}.
+ *
+ * A Cholesky pivot that is lost to rounding errors means that the
+ * corresponding block vector is numerically linearly dependent on the previous
+ * ones. The block vectors from this one onwards are set to zero and the number
+ * of leading vectors that can be used, which is at least one, is returned.
+ * For stopped right-hand sides, the update leaves the block unchanged.
+ */
+template <typename ValueType>
+size_type block_cholqr(const matrix::Dense<ValueType>* dots,
+                       const stopping_status* stop,
+                       matrix::Dense<ValueType>* proj,
+                       matrix::Dense<ValueType>* factor,
+                       matrix::Dense<ValueType>* coeffs,
+                       matrix::Dense<ValueType>* inv_factor)
+{
+    using real_type = remove_complex<ValueType>;
+    const auto num_prev = proj->get_size()[0];
+    const auto block_size = factor->get_size()[0];
+    const auto num_rhs = factor->get_size()[1] / block_size;
+    const auto tolerance = 100 * std::numeric_limits<real_type>::epsilon();
+    auto num_valid = block_size;
+    for (size_type rhs = 0; rhs < num_rhs; ++rhs) {
+        const auto col = [&](size_type k) { return k * num_rhs + rhs; };
+        const auto stopped = stop[rhs].has_stopped();
+        for (size_type k = 0; k < block_size; ++k) {
+            for (size_type i = 0; i < num_prev; ++i) {
+                proj->at(i, col(k)) =
+                    stopped ? zero<ValueType>() : dots->at(i, col(k));
+                coeffs->at(i, col(k)) = zero<ValueType>();
+            }
+            for (size_type l = 0; l < block_size; ++l) {
+                factor->at(l, col(k)) = zero<ValueType>();
+                inv_factor->at(l, col(k)) =
+                    stopped && l == k ? one<ValueType>() : zero<ValueType>();
+            }
+        }
+        if (stopped) {
+            continue;
+        }
+        // Cholesky factorization of W^H W - C^H C, row by row
+        auto num_factored = block_size;
+        for (size_type l = 0; l < block_size; ++l) {
+            for (size_type k = l; k < block_size; ++k) {
+                auto value = dots->at(num_prev + l, col(k));
+                for (size_type i = 0; i < num_prev; ++i) {
+                    value -= conj(proj->at(i, col(l))) * proj->at(i, col(k));
+                }
+                for (size_type m = 0; m < l; ++m) {
+                    value -=
+                        conj(factor->at(m, col(l))) * factor->at(m, col(k));
+                }
+                factor->at(l, col(k)) = value;
+            }
+            const auto pivot = real(factor->at(l, col(l)));
+            if (!(pivot > tolerance * abs(dots->at(num_prev + l, col(l))))) {
+                num_factored = l;
+                for (size_type k = l; k < block_size; ++k) {
+                    factor->at(l, col(k)) = zero<ValueType>();
+                }
+                break;
+            }
+            const auto diag = sqrt(pivot);
+            factor->at(l, col(l)) = diag;
+            for (size_type k = l + 1; k < block_size; ++k) {
+                factor->at(l, col(k)) /= diag;
+            }
+        }
+        // invert the factored part of R, the remaining block vectors are
+        // mapped to zero
+        for (size_type k = 0; k < num_factored; ++k) {
+            inv_factor->at(k, col(k)) =
+                one<ValueType>() / factor->at(k, col(k));
+            for (auto l = k; l-- > 0;) {
+                auto value = zero<ValueType>();
+                for (size_type m = l + 1; m <= k; ++m) {
+                    value += factor->at(l, col(m)) * inv_factor->at(m, col(k));
+                }
+                inv_factor->at(l, col(k)) = -value / factor->at(l, col(l));
+            }
+            for (size_type i = 0; i < num_prev; ++i) {
+                auto value = zero<ValueType>();
+                for (size_type m = 0; m <= k; ++m) {
+                    value += proj->at(i, col(m)) * inv_factor->at(m, col(k));
+                }
+                coeffs->at(i, col(k)) = value;
+            }
+        }
+        num_valid = std::min(num_valid, std::max<size_type>(num_factored, 1));
+    }
+    return num_valid;
+}
+
+
+/**
+ * Computes the Hessenberg columns block_start, ..., block_start + num_valid - 1
+ * of the s-step block on the host from the two block Gram-Schmidt passes.
+ *
+ * The block was generated as w_k = (A M / scale)^k v_j with j = block_start,
+ * so with K = [v_j, w_1, ..., w_s] = [V, Q] B, where B contains the unit vector
+ * e_j and the combined coefficients of both passes, A M K(:, 0:s-1) =
+ * scale * K(:, 1:s). Splitting B(0:j+s-1, 0:s-1) into the rows for the
+ * previous bases B_old and the ones for [v_j, Q] B_new gives
+ * H(:, j:j+s-1) = (scale * B(:, 1:s) - H(:, 0:j-1) B_old) B_new^{-1}.
+ * hessenberg needs to contain the columns 0:j-1 before the Givens rotations.
+ */
+template <typename ValueType>
+void block_hessenberg(const matrix::Dense<ValueType>* proj1,
+                      const matrix::Dense<ValueType>* factor1,
+                      const matrix::Dense<ValueType>* proj2,
+                      const matrix::Dense<ValueType>* factor2,
+                      const matrix::Dense<ValueType>* scale,
+                      const stopping_status* stop, size_type num_valid,
+                      matrix::Dense<ValueType>* hessenberg)
+{
+    const auto num_prev = proj1->get_size()[0];
+    const auto block_start = num_prev - 1;
+    const auto block_size = factor1->get_size()[0];
+    const auto num_rhs = factor1->get_size()[1] / block_size;
+    std::vector<ValueType> proj(num_prev * block_size);
+    std::vector<ValueType> factor(block_size * block_size);
+    std::vector<ValueType> column(hessenberg->get_size()[0]);
+    for (size_type rhs = 0; rhs < num_rhs; ++rhs) {
+        const auto col = [&](size_type k) { return k * num_rhs + rhs; };
+        const auto h_col = [&](size_type k) {
+            return (block_start + k) * num_rhs + rhs;
+        };
+        if (stop[rhs].has_stopped()) {
+            for (size_type m = 0; m < num_valid; ++m) {
+                for (size_type i = 0; i < hessenberg->get_size()[0]; ++i) {
+                    hessenberg->at(i, h_col(m)) = zero<ValueType>();
+                }
+            }
+            continue;
+        }
+        // combine both passes: W = V (C1 + C2 R1) + Q R2 R1
+        for (size_type k = 0; k < block_size; ++k) {
+            for (size_type i = 0; i < num_prev; ++i) {
+                auto value = proj1->at(i, col(k));
+                for (size_type l = 0; l <= k; ++l) {
+                    value += proj2->at(i, col(l)) * factor1->at(l, col(k));
+                }
+                proj[i * block_size + k] = value;
+            }
+            for (size_type l = 0; l <= k; ++l) {
+                auto value = zero<ValueType>();
+                for (size_type m = l; m <= k; ++m) {
+                    value += factor2->at(l, col(m)) * factor1->at(m, col(k));
+                }
+                factor[l * block_size + k] = value;
+            }
+        }
+        // B(i, k) for the columns v_j, w_1, ..., w_s and the rows V, Q
+        const auto basis_coeff = [&](size_type i, size_type k) {
+            if (k == 0) {
+                return i == block_start ? one<ValueType>() : zero<ValueType>();
+            }
+            return i < num_prev ? proj[i * block_size + k - 1]
+                                : factor[(i - num_prev) * block_size + k - 1];
+        };
+        for (size_type m = 0; m < num_valid; ++m) {
+            const auto num_entries = block_start + m + 2;
+            for (size_type i = 0; i < num_entries; ++i) {
+                column[i] = scale->at(0, rhs) * basis_coeff(i, m + 1);
+            }
+            for (size_type k = 0; k < block_start; ++k) {
+                const auto coeff = basis_coeff(k, m);
+                for (size_type i = 0; i <= k + 1; ++i) {
+                    column[i] -= hessenberg->at(i, k * num_rhs + rhs) * coeff;
+                }
+            }
+            for (size_type l = 0; l < m; ++l) {
+                const auto coeff = basis_coeff(block_start + l, m);
+                for (size_type i = 0; i < block_start + l + 2; ++i) {
+                    column[i] -= hessenberg->at(i, h_col(l)) * coeff;
+                }
+            }
+            const auto diag = basis_coeff(block_start + m, m);
+            for (size_type i = 0; i < hessenberg->get_size()[0]; ++i) {
+                hessenberg->at(i, h_col(m)) =
+                    i < num_entries ? column[i] / diag : zero<ValueType>();
+            }
+        }
+    }
+}
+
+
+/**
+ * Finalizes the Hessenberg column `col` of the one-reduce classical
+ * Gram-Schmidt with delayed reorthogonalization (DCGS2) on the host.
+ *
+ * krylov_bases(:, col + 1) was orthogonalized only once, and dots contains
+ * the inner products s = V^H u of the previous bases V = krylov_bases(:, 0:col)
+ * and u^H u in row col + 1. The reorthogonalization u := u - V s is added to
+ * the column and the norm of the reorthogonalized vector
+ * sqrt(u^H u - s^H s) becomes its subdiagonal entry.
+ */
+template <typename ValueType>
+void finish_dcgs2_column(const matrix::Dense<ValueType>* dots,
+                         const stopping_status* stop, size_type col,
+                         matrix::Dense<ValueType>* hessenberg)
+{
+    const auto num_rhs =
+        hessenberg->get_size()[1] / (hessenberg->get_size()[0] - 1);
+    for (size_type rhs = 0; rhs < num_rhs; ++rhs) {
+        if (stop[rhs].has_stopped()) {
+            continue;
+        }
+        const auto h_col = col * num_rhs + rhs;
+        auto norm_sq = real(dots->at(col + 1, rhs));
+        for (size_type i = 0; i <= col; ++i) {
+            const auto proj = dots->at(i, rhs);
+            hessenberg->at(i, h_col) += proj;
+            norm_sq -= squared_norm(proj);
+        }
+        hessenberg->at(col + 1, h_col) =
+            norm_sq > zero(norm_sq) ? sqrt(norm_sq) : zero(norm_sq);
+    }
+}
+
+
+/**
+ * Computes the coefficients of one DCGS2 step on the host from the inner
+ * products dots = [V, u]^H [u, z] of the previous bases V, the once
+ * orthogonalized basis vector u = krylov_bases(:, iter) and z = A M u.
+ *
+ * It finalizes the Hessenberg column iter - 1, which yields the norm of the
+ * reorthogonalized vector v = (u - V s) / norm.
+ * As A M v = (z - A M V s) / norm, the projection of z onto [V, v]
+ * determines the tentative Hessenberg column iter, while the next basis
+ * vector is
+ * z := (z - [V, v] [t; v^H z]) / norm with t = V^H z.
+ * The resulting updates are u := u / norm - V correction and
+ * z := z / norm - [V, v] coeffs with inv_norm = 1 / norm.
+ * krylov_bases(:, 0) is normalized exactly, so nothing is corrected for
+ * iter == 0. A vanishing norm means breakdown and maps both vectors to zero.
+ */
+template <typename ValueType>
+void dcgs2_step(const matrix::Dense<ValueType>* dots,
+                const stopping_status* stop, size_type iter,
+                matrix::Dense<ValueType>* hessenberg,
+                matrix::Dense<ValueType>* correction,
+                matrix::Dense<ValueType>* coeffs,
+                matrix::Dense<ValueType>* inv_norm)
+{
+    const auto num_rhs = inv_norm->get_size()[1];
+    if (iter > 0) {
+        finish_dcgs2_column(dots, stop, iter - 1, hessenberg);
+    }
+    std::vector<ValueType> column(iter + 1);
+    for (size_type rhs = 0; rhs < num_rhs; ++rhs) {
+        const auto h_col = [&](size_type k) { return k * num_rhs + rhs; };
+        if (stop[rhs].has_stopped()) {
+            for (size_type i = 0; i < iter; ++i) {
+                correction->at(i, rhs) = zero<ValueType>();
+            }
+            for (size_type i = 0; i <= iter; ++i) {
+                coeffs->at(i, rhs) = zero<ValueType>();
+            }
+            inv_norm->at(0, rhs) = one<ValueType>();
+            continue;
+        }
+        // s = dots(0:iter-1, 0), t = dots(0:iter-1, 1)
+        const auto norm = iter > 0 ? hessenberg->at(iter, h_col(iter - 1))
+                                   : one<ValueType>();
+        const auto inv = is_zero(norm) ? zero<ValueType>()
+                                       : one<ValueType>() / norm;
+        auto dot_vz = dots->at(iter, num_rhs + rhs);
+        for (size_type i = 0; i < iter; ++i) {
+            dot_vz -= conj(dots->at(i, rhs)) * dots->at(i, num_rhs + rhs);
+            correction->at(i, rhs) = dots->at(i, rhs) * inv;
+            column[i] = dots->at(i, num_rhs + rhs);
+        }
+        column[iter] = dot_vz * inv;
+        for (size_type i = 0; i <= iter; ++i) {
+            coeffs->at(i, rhs) = column[i] * inv;
+        }
+        // hessenberg(:, iter) = ([t; v^H z] - H(:, 0:iter-1) s) / norm
+        for (size_type l = 0; l < iter; ++l) {
+            const auto proj = dots->at(l, rhs);
+            for (size_type i = 0; i <= l + 1; ++i) {
+                column[i] -= hessenberg->at(i, h_col(l)) * proj;
+            }
+        }
+        for (size_type i = 0; i < hessenberg->get_size()[0]; ++i) {
+            hessenberg->at(i, h_col(iter)) =
+                i <= iter ? column[i] * inv : zero<ValueType>();
+        }
+        inv_norm->at(0, rhs) = inv;
+    }
+}
 
 
 }  // anonymous namespace
@@ -75,6 +381,8 @@ std::unique_ptr<LinOp> Gmres<ValueType>::transpose() const
             share(as<Transposable>(this->get_preconditioner())->transpose()))
         .with_criteria(this->get_stop_criterion_factory())
         .with_krylov_dim(this->get_krylov_dim())
+        .with_s_step(this->get_parameters().s_step)
+        .with_orthogonalization(this->get_parameters().orthogonalization)
         .on(this->get_executor())
         ->generate(
             share(as<Transposable>(this->get_system_matrix())->transpose()));
@@ -89,6 +397,8 @@ std::unique_ptr<LinOp> Gmres<ValueType>::conj_transpose() const
             as<Transposable>(this->get_preconditioner())->conj_transpose()))
         .with_criteria(this->get_stop_criterion_factory())
         .with_krylov_dim(this->get_krylov_dim())
+        .with_s_step(this->get_parameters().s_step)
+        .with_orthogonalization(this->get_parameters().orthogonalization)
         .on(this->get_executor())
         ->generate(share(
             as<Transposable>(this->get_system_matrix())->conj_transpose()));
@@ -178,6 +488,63 @@ void Gmres<ValueType>::apply_dense_impl(const matrix::Dense<ValueType>* dense_b,
     GKO_SOLVER_VECTOR(before_preconditioner, dense_x);
     GKO_SOLVER_VECTOR(after_preconditioner, dense_x);
 
+    // the workspace for the fused inner products is only required for the
+    // s-step variant and the classical Gram-Schmidt variants
+    const auto s_step = std::max<size_type>(parameters_.s_step, 1);
+    const auto use_s_step = s_step > 1;
+    const auto ortho = use_s_step ? gmres::ortho_method::cgs2
+                                  : parameters_.orthogonalization;
+    const auto use_dcgs2 = !use_s_step && ortho == gmres::ortho_method::dcgs2;
+    const auto use_block_dots = use_s_step || ortho != gmres::ortho_method::mgs;
+    // number of vectors the inner products are computed for at once
+    const auto block_width = use_s_step ? s_step : (use_dcgs2 ? 2 : 1);
+    const auto block_dot_size =
+        use_block_dots ? (krylov_dim + 1) * block_width * num_rhs : 0;
+    auto block_dot = this->template create_workspace_op<Vector>(
+        ws::block_dot, dim<2>{1, block_dot_size});
+    auto block_coeffs = this->template create_workspace_op<Vector>(
+        ws::block_coeffs, dim<2>{1, block_dot_size});
+    auto block_triangular = this->template create_workspace_op<Vector>(
+        ws::block_triangular,
+        dim<2>{1, use_block_dots ? s_step * s_step * num_rhs : 0});
+    auto basis_scale = this->template create_workspace_op<Vector>(
+        ws::basis_scale, dim<2>{1, use_s_step ? num_rhs : 0});
+    // the Hessenberg matrix before the Givens rotations and the small dense
+    // problems of the block orthogonalization are kept on the host
+    const auto use_host_hessenberg = use_s_step || use_dcgs2;
+    auto host_hessenberg = this->template create_host_workspace_op<Vector>(
+        ws::host_hessenberg,
+        use_host_hessenberg ? hessenberg->get_size() : dim<2>{});
+    // the s-step variant keeps the results of both Gram-Schmidt passes
+    const auto num_passes = use_s_step ? 2 : 1;
+    const auto triangular_size = use_s_step ? s_step * s_step * num_rhs : 0;
+    auto host_block_dot = this->template create_host_workspace_op<Vector>(
+        ws::host_block_dot, dim<2>{1, num_passes * block_dot_size});
+    auto host_block_proj = this->template create_host_workspace_op<Vector>(
+        ws::host_block_proj, dim<2>{1, num_passes * block_dot_size});
+    auto host_block_coeffs = this->template create_host_workspace_op<Vector>(
+        ws::host_block_coeffs, dim<2>{1, block_dot_size});
+    auto host_block_factor = this->template create_host_workspace_op<Vector>(
+        ws::host_block_factor, dim<2>{1, num_passes * triangular_size});
+    auto host_block_triangular =
+        this->template create_host_workspace_op<Vector>(
+            ws::host_block_triangular, dim<2>{1, triangular_size});
+    auto host_scale = this->template create_host_workspace_op<Vector>(
+        ws::host_scale, dim<2>{1, use_block_dots ? num_rhs : 0});
+    auto& host_stop_status =
+        this->template create_host_workspace_array<stopping_status>(
+            ws::host_stop, use_block_dots ? num_rhs : 0);
+    // contiguous views on the flat workspace
+    auto make_block_view = [](Vector* storage, dim<2> size,
+                              size_type offset = 0) {
+        auto exec = storage->get_executor();
+        return Vector::create(exec, size,
+                              make_array_view(exec, size[0] * size[1],
+                                              storage->get_values() + offset),
+                              size[1]);
+    };
+    size_type block_remaining = 0;
+
     GKO_SOLVER_ONE_MINUS_ONE();
 
     bool one_changed{};
@@ -207,6 +574,27 @@ void Gmres<ValueType>::apply_dense_impl(const matrix::Dense<ValueType>* dense_b,
         this->get_system_matrix(),
         std::shared_ptr<const LinOp>(dense_b, [](const LinOp*) {}), dense_x,
         residual);
+    if (use_s_step) {
+        basis_scale->fill(one<ValueType>());
+    } else if (use_block_dots && !use_dcgs2) {
+        make_block_view(block_triangular, dim<2>{1, num_rhs})
+            ->fill(one<ValueType>());
+    }
+    // copies the Hessenberg column col from the host and updates the QR
+    // factorization with it
+    auto finish_hessenberg_column = [&](size_type col) {
+        const span cols{num_rhs * col, num_rhs * (col + 1)};
+        auto host_column =
+            host_hessenberg->create_submatrix(span{0, krylov_dim + 1}, cols);
+        hessenberg->create_submatrix(span{0, krylov_dim + 1}, cols)
+            ->copy_from(host_column.get());
+        auto hessenberg_col =
+            hessenberg->create_submatrix(span{0, col + 2}, cols);
+        exec->run(gmres::make_hessenberg_qr(
+            givens_sin, givens_cos, residual_norm, residual_norm_collection,
+            hessenberg_col.get(), col, final_iter_nums.get_data(),
+            stop_status.get_const_data()));
+    };
 
     int total_iter = -1;
     size_type restart_iter = 0;
@@ -228,6 +616,13 @@ void Gmres<ValueType>::apply_dense_impl(const matrix::Dense<ValueType>* dense_b,
      *       1x Advanced SpMV      3n * values + storage
      *       1x norm2               n
      *       1x scal               2n
+     * The s-step variant replaces MGS by two passes of block Gram-Schmidt
+     * over the whole basis, which reads each basis vector twice per pass
+     * for the dots and the update, but needs only 2 reductions per block.
+     * CGS reads the basis twice per pass as well (multi-dot and update), but
+     * needs one reduction per pass plus the norm instead of one per basis
+     * vector. DCGS2 merges the reorthogonalization into the next iteration
+     * and needs a single reduction for two passes over the basis.
      */
     while (true) {
         ++total_iter;
@@ -274,50 +669,330 @@ void Gmres<ValueType>::apply_dense_impl(const matrix::Dense<ValueType>* dense_b,
                 final_iter_nums.get_data()));
             restart_iter = 0;
         }
-        auto this_krylov = krylov_bases->create_submatrix(
-            span{num_rows * restart_iter, num_rows * (restart_iter + 1)},
-            span{0, num_rhs});
-
-        auto next_krylov = krylov_bases->create_submatrix(
-            span{num_rows * (restart_iter + 1), num_rows * (restart_iter + 2)},
-            span{0, num_rhs});
-        // preconditioned_vector = get_preconditioner() * this_krylov
-        this->get_preconditioner()->apply(this_krylov.get(),
-                                          preconditioned_vector);
-
         // Create view of current column in the hessenberg matrix:
         // hessenberg_iter = hessenberg(:, restart_iter);
         auto hessenberg_iter = hessenberg->create_submatrix(
             span{0, restart_iter + 2},
             span{num_rhs * restart_iter, num_rhs * (restart_iter + 1)});
 
-        // Start of Arnoldi
-        // next_krylov = A * preconditioned_vector
-        this->get_system_matrix()->apply(preconditioned_vector,
-                                         next_krylov.get());
-
-        for (size_type i = 0; i <= restart_iter; i++) {
-            // orthogonalize against krylov_bases(:, i):
-            // hessenberg(i, restart_iter) = next_krylov' * krylov_bases(:, i)
-            // next_krylov -= hessenberg(i, restart_iter) * krylov_bases(:, i)
-            auto hessenberg_entry = hessenberg_iter->create_submatrix(
-                span{i, i + 1}, span{0, num_rhs});
-            auto krylov_basis = krylov_bases->create_submatrix(
-                span{num_rows * i, num_rows * (i + 1)}, span{0, num_rhs});
-            next_krylov->compute_conj_dot(
-                krylov_basis.get(), hessenberg_entry.get(), reduction_tmp);
-            next_krylov->sub_scaled(hessenberg_entry.get(), krylov_basis.get());
+        if (use_s_step) {
+            if (block_remaining == 0) {
+                // s-step Arnoldi: generate the block
+                // w_k = (A M / basis_scale)^k * krylov_bases(:, restart_iter)
+                // in krylov_bases(:, restart_iter + 1 : restart_iter + s)
+                const auto block_start = restart_iter;
+                const auto block_size =
+                    std::min(s_step, krylov_dim - block_start);
+                const auto num_bases = block_start + 1 + block_size;
+                for (size_type k = 0; k < block_size; k++) {
+                    auto source = krylov_bases->create_submatrix(
+                        span{num_rows * (block_start + k),
+                             num_rows * (block_start + k + 1)},
+                        span{0, num_rhs});
+                    auto target = krylov_bases->create_submatrix(
+                        span{num_rows * (block_start + k + 1),
+                             num_rows * (block_start + k + 2)},
+                        span{0, num_rhs});
+                    this->get_preconditioner()->apply(source.get(),
+                                                      preconditioned_vector);
+                    this->get_system_matrix()->apply(preconditioned_vector,
+                                                     target.get());
+                    target->inv_scale(basis_scale);
+                }
+                auto prev_bases = krylov_bases->create_submatrix(
+                    span{0, num_rows * (block_start + 1)}, span{0, num_rhs});
+                auto all_bases = krylov_bases->create_submatrix(
+                    span{0, num_rows * num_bases}, span{0, num_rhs});
+                auto block = krylov_bases->create_submatrix(
+                    span{num_rows * (block_start + 1), num_rows * num_bases},
+                    span{0, num_rhs});
+                auto dots = make_block_view(
+                    block_dot, dim<2>{num_bases, block_size * num_rhs});
+                auto coeffs =
+                    make_block_view(block_coeffs, dim<2>{block_start + 1,
+                                                         block_size * num_rhs});
+                auto triangular = make_block_view(
+                    block_triangular, dim<2>{block_size, block_size * num_rhs});
+                host_stop_status = stop_status;
+                const dim<2> proj_size{block_start + 1, block_size * num_rhs};
+                std::unique_ptr<Vector> host_dots[2];
+                std::unique_ptr<Vector> host_proj[2];
+                std::unique_ptr<Vector> host_factor[2];
+                for (int pass = 0; pass < 2; pass++) {
+                    host_dots[pass] =
+                        make_block_view(host_block_dot, dots->get_size(),
+                                        pass * block_dot_size);
+                    host_proj[pass] = make_block_view(
+                        host_block_proj, proj_size, pass * block_dot_size);
+                    host_factor[pass] =
+                        make_block_view(host_block_factor,
+                                        triangular->get_size(),
+                                        pass * triangular_size);
+                }
+                auto host_coeffs =
+                    make_block_view(host_block_coeffs, coeffs->get_size());
+                auto host_triangular = make_block_view(
+                    host_block_triangular, triangular->get_size());
+                block_remaining = block_size;
+                // two passes of block Gram-Schmidt with CholQR:
+                // dots = [V W]^H W
+                // W = (W - V C) R^{-1}
+                for (int pass = 0; pass < 2; pass++) {
+                    exec->run(gmres::make_multi_dot(
+                        all_bases.get(), block.get(), dots.get(),
+                        reduction_tmp));
+                    host_dots[pass]->copy_from(dots.get());
+                    block_remaining = std::min(
+                        block_remaining,
+                        gmres::block_cholqr(
+                            host_dots[pass].get(),
+                            host_stop_status.get_const_data(),
+                            host_proj[pass].get(), host_factor[pass].get(),
+                            host_coeffs.get(), host_triangular.get()));
+                    coeffs->copy_from(host_coeffs.get());
+                    triangular->copy_from(host_triangular.get());
+                    exec->run(gmres::make_multi_update(
+                        prev_bases.get(), coeffs.get(), triangular.get(),
+                        block.get()));
+                }
+                host_scale->copy_from(basis_scale);
+                gmres::block_hessenberg(
+                    host_proj[0].get(), host_factor[0].get(),
+                    host_proj[1].get(), host_factor[1].get(), host_scale,
+                    host_stop_status.get_const_data(), block_remaining,
+                    host_hessenberg);
+                const span block_cols{
+                    num_rhs * block_start,
+                    num_rhs * (block_start + block_remaining)};
+                auto host_hessenberg_block = host_hessenberg->create_submatrix(
+                    span{0, krylov_dim + 1}, block_cols);
+                hessenberg->create_submatrix(span{0, krylov_dim + 1},
+                                             block_cols)
+                    ->copy_from(host_hessenberg_block.get());
+                // rescale the next block by the growth of the first vector:
+                // basis_scale *= norm(w_1)
+                for (size_type rhs = 0; rhs < num_rhs; rhs++) {
+                    const auto growth =
+                        sqrt(abs(host_dots[0]->at(block_start + 1, rhs)));
+                    if (is_finite(growth) && growth > zero(growth)) {
+                        host_scale->at(0, rhs) *= growth;
+                    }
+                }
+                basis_scale->copy_from(host_scale);
+            }
+            block_remaining--;
+        } else if (ortho == gmres::ortho_method::mgs) {
+            auto this_krylov = krylov_bases->create_submatrix(
+                span{num_rows * restart_iter, num_rows * (restart_iter + 1)},
+                span{0, num_rhs});
+
+            auto next_krylov = krylov_bases->create_submatrix(
+                span{num_rows * (restart_iter + 1),
+                     num_rows * (restart_iter + 2)},
+                span{0, num_rhs});
+            // preconditioned_vector = get_preconditioner() * this_krylov
+            this->get_preconditioner()->apply(this_krylov.get(),
+                                              preconditioned_vector);
+
+            // Start of Arnoldi
+            // next_krylov = A * preconditioned_vector
+            this->get_system_matrix()->apply(preconditioned_vector,
+                                             next_krylov.get());
+
+            for (size_type i = 0; i <= restart_iter; i++) {
+                // orthogonalize against krylov_bases(:, i):
+                // hessenberg(i, restart_iter) =
+                //     next_krylov' * krylov_bases(:, i)
+                // next_krylov -=
+                //     hessenberg(i, restart_iter) * krylov_bases(:, i)
+                auto hessenberg_entry = hessenberg_iter->create_submatrix(
+                    span{i, i + 1}, span{0, num_rhs});
+                auto krylov_basis = krylov_bases->create_submatrix(
+                    span{num_rows * i, num_rows * (i + 1)}, span{0, num_rhs});
+                next_krylov->compute_conj_dot(
+                    krylov_basis.get(), hessenberg_entry.get(), reduction_tmp);
+                next_krylov->sub_scaled(hessenberg_entry.get(),
+                                        krylov_basis.get());
+            }
+            // normalize next_krylov:
+            // hessenberg(restart_iter+1, restart_iter) = norm(next_krylov)
+            // next_krylov /= hessenberg(restart_iter+1, restart_iter)
+            auto hessenberg_norm_entry = hessenberg_iter->create_submatrix(
+                span{restart_iter + 1, restart_iter + 2}, span{0, num_rhs});
+            help_compute_norm<ValueType>::
+                compute_next_krylov_norm_into_hessenberg(
+                    next_krylov.get(), hessenberg_norm_entry.get(),
+                    next_krylov_norm_tmp, reduction_tmp);
+            next_krylov->inv_scale(hessenberg_norm_entry.get());
+            // End of Arnoldi
+        } else if (use_dcgs2) {
+            // krylov_bases(:, restart_iter) is orthogonalized only once and
+            // not normalized yet, it is reorthogonalized using the same
+            // reduction as the projection of next_krylov
+            auto this_krylov = krylov_bases->create_submatrix(
+                span{num_rows * restart_iter, num_rows * (restart_iter + 1)},
+                span{0, num_rhs});
+            auto next_krylov = krylov_bases->create_submatrix(
+                span{num_rows * (restart_iter + 1),
+                     num_rows * (restart_iter + 2)},
+                span{0, num_rhs});
+            this->get_preconditioner()->apply(this_krylov.get(),
+                                              preconditioned_vector);
+            this->get_system_matrix()->apply(preconditioned_vector,
+                                             next_krylov.get());
+            auto prev_bases = krylov_bases->create_submatrix(
+                span{0, num_rows * restart_iter}, span{0, num_rhs});
+            auto bases = krylov_bases->create_submatrix(
+                span{0, num_rows * (restart_iter + 1)}, span{0, num_rhs});
+            auto pair = krylov_bases->create_submatrix(
+                span{num_rows * restart_iter, num_rows * (restart_iter + 2)},
+                span{0, num_rhs});
+            // dots = krylov_bases(:, 0:restart_iter)' *
+            //        [this_krylov, next_krylov]
+            auto dots = make_block_view(
+                block_dot, dim<2>{restart_iter + 1, 2 * num_rhs});
+            exec->run(gmres::make_multi_dot(bases.get(), pair.get(),
+                                            dots.get(), reduction_tmp));
+            host_stop_status = stop_status;
+            auto host_dots = make_block_view(
+                host_block_dot, dim<2>{restart_iter + 1, 2 * num_rhs});
+            host_dots->copy_from(dots.get());
+            auto host_correction = make_block_view(
+                host_block_proj, dim<2>{restart_iter, num_rhs});
+            auto host_coeffs = make_block_view(
+                host_block_coeffs, dim<2>{restart_iter + 1, num_rhs});
+            gmres::dcgs2_step(host_dots.get(),
+                              host_stop_status.get_const_data(), restart_iter,
+                              host_hessenberg, host_correction.get(),
+                              host_coeffs.get(), host_scale);
+            auto inv_norm =
+                make_block_view(block_triangular, dim<2>{1, num_rhs});
+            inv_norm->copy_from(host_scale);
+            if (restart_iter > 0) {
+                // this_krylov = (this_krylov - prev_bases * s) / norm
+                auto correction = make_block_view(
+                    block_coeffs, dim<2>{restart_iter, num_rhs});
+                correction->copy_from(host_correction.get());
+                exec->run(gmres::make_multi_update(
+                    prev_bases.get(), correction.get(), inv_norm.get(),
+                    this_krylov.get()));
+                finish_hessenberg_column(restart_iter - 1);
+            }
+            // next_krylov = (next_krylov - bases * [t; v' * z]) / norm
+            auto coeffs = make_block_view(block_coeffs,
+                                          dim<2>{restart_iter + 1, num_rhs});
+            coeffs->copy_from(host_coeffs.get());
+            exec->run(gmres::make_multi_update(bases.get(), coeffs.get(),
+                                               inv_norm.get(),
+                                               next_krylov.get()));
+            if (restart_iter + 1 == krylov_dim) {
+                // the last column is completed with an additional reduction
+                // before the restart
+                auto all_bases = krylov_bases->create_submatrix(
+                    span{0, num_rows * (restart_iter + 2)}, span{0, num_rhs});
+                auto last_dots = make_block_view(
+                    block_dot, dim<2>{restart_iter + 2, num_rhs});
+                exec->run(gmres::make_multi_dot(
+                    all_bases.get(), next_krylov.get(), last_dots.get(),
+                    reduction_tmp));
+                auto host_last_dots = make_block_view(
+                    host_block_dot, dim<2>{restart_iter + 2, num_rhs});
+                host_last_dots->copy_from(last_dots.get());
+                gmres::finish_dcgs2_column(host_last_dots.get(),
+                                           host_stop_status.get_const_data(),
+                                           restart_iter, host_hessenberg);
+                finish_hessenberg_column(restart_iter);
+            }
+        } else {
+            // classical Gram-Schmidt with optional reorthogonalization
+            auto this_krylov = krylov_bases->create_submatrix(
+                span{num_rows * restart_iter, num_rows * (restart_iter + 1)},
+                span{0, num_rhs});
+            auto next_krylov = krylov_bases->create_submatrix(
+                span{num_rows * (restart_iter + 1),
+                     num_rows * (restart_iter + 2)},
+                span{0, num_rhs});
+            this->get_preconditioner()->apply(this_krylov.get(),
+                                              preconditioned_vector);
+            this->get_system_matrix()->apply(preconditioned_vector,
+                                             next_krylov.get());
+            auto bases = krylov_bases->create_submatrix(
+                span{0, num_rows * (restart_iter + 1)}, span{0, num_rhs});
+            auto all_bases = krylov_bases->create_submatrix(
+                span{0, num_rows * (restart_iter + 2)}, span{0, num_rhs});
+            // dots(0:restart_iter) are the projections onto the bases,
+            // dots(restart_iter + 1) is the squared norm of next_krylov
+            auto dots = make_block_view(block_dot,
+                                        dim<2>{restart_iter + 2, num_rhs});
+            auto proj = make_block_view(block_dot,
+                                        dim<2>{restart_iter + 1, num_rhs});
+            auto ones = make_block_view(block_triangular, dim<2>{1, num_rhs});
+            auto hessenberg_proj = hessenberg_iter->create_submatrix(
+                span{0, restart_iter + 1}, span{0, num_rhs});
+            auto hessenberg_norm_entry = hessenberg_iter->create_submatrix(
+                span{restart_iter + 1, restart_iter + 2}, span{0, num_rhs});
+            const int max_passes =
+                ortho == gmres::ortho_method::cgs
+                    ? 1
+                    : (ortho == gmres::ortho_method::cgs2 ? 2 : 3);
+            bool norm_computed = false;
+            for (int pass = 0; pass < max_passes; pass++) {
+                if (ortho == gmres::ortho_method::cgs_conditional &&
+                    pass > 0) {
+                    // reorthogonalize only if the norm dropped by more
+                    // than 1 / sqrt(2) for any right-hand side
+                    help_compute_norm<ValueType>::
+                        compute_next_krylov_norm_into_hessenberg(
+                            next_krylov.get(), hessenberg_norm_entry.get(),
+                            next_krylov_norm_tmp, reduction_tmp);
+                    norm_computed = true;
+                    host_stop_status = stop_status;
+                    auto host_dots = make_block_view(
+                        host_block_dot, dim<2>{restart_iter + 2, num_rhs});
+                    host_dots->copy_from(dots.get());
+                    host_scale->copy_from(hessenberg_norm_entry.get());
+                    const remove_complex<ValueType> eta_squared = 0.5;
+                    bool reorth = false;
+                    for (size_type rhs = 0; rhs < num_rhs; rhs++) {
+                        reorth = reorth ||
+                                 (!host_stop_status.get_const_data()[rhs]
+                                       .has_stopped() &&
+                                  squared_norm(host_scale->at(0, rhs)) <
+                                      eta_squared *
+                                          abs(host_dots->at(restart_iter + 1,
+                                                            rhs)));
+                    }
+                    if (!reorth) {
+                        break;
+                    }
+                    norm_computed = false;
+                }
+                // hessenberg(0:restart_iter, restart_iter) +=
+                //     krylov_bases(:, 0:restart_iter)' * next_krylov
+                // next_krylov -= krylov_bases(:, 0:restart_iter) * proj
+                exec->run(gmres::make_multi_dot(all_bases.get(),
+                                                next_krylov.get(), dots.get(),
+                                                reduction_tmp));
+                if (pass == 0) {
+                    hessenberg_proj->copy_from(proj.get());
+                } else {
+                    hessenberg_proj->add_scaled(one_op, proj.get());
+                }
+                exec->run(gmres::make_multi_update(bases.get(), proj.get(),
+                                                   ones.get(),
+                                                   next_krylov.get()));
+            }
+            // normalize next_krylov:
+            // hessenberg(restart_iter+1, restart_iter) = norm(next_krylov)
+            // next_krylov /= hessenberg(restart_iter+1, restart_iter)
+            if (!norm_computed) {
+                help_compute_norm<ValueType>::
+                    compute_next_krylov_norm_into_hessenberg(
+                        next_krylov.get(), hessenberg_norm_entry.get(),
+                        next_krylov_norm_tmp, reduction_tmp);
+            }
+            next_krylov->inv_scale(hessenberg_norm_entry.get());
         }
-        // normalize next_krylov:
-        // hessenberg(restart_iter+1, restart_iter) = norm(next_krylov)
-        // next_krylov /= hessenberg(restart_iter+1, restart_iter)
-        auto hessenberg_norm_entry = hessenberg_iter->create_submatrix(
-            span{restart_iter + 1, restart_iter + 2}, span{0, num_rhs});
-        help_compute_norm<ValueType>::compute_next_krylov_norm_into_hessenberg(
-            next_krylov.get(), hessenberg_norm_entry.get(),
-            next_krylov_norm_tmp, reduction_tmp);
-        next_krylov->inv_scale(hessenberg_norm_entry.get());
-        // End of Arnoldi
 
         // update QR factorization and Krylov RHS for last column:
         // apply givens rotation
@@ -341,10 +1016,13 @@ void Gmres<ValueType>::apply_dense_impl(const matrix::Dense<ValueType>* dense_b,
         //              cos(restart_iter) * this_rnc
         // residual_norm_collection(restart_iter + 1) =
         //              -conj(sin(restart_iter)) * this_rnc
-        exec->run(gmres::make_hessenberg_qr(
-            givens_sin, givens_cos, residual_norm, residual_norm_collection,
-            hessenberg_iter.get(), restart_iter, final_iter_nums.get_data(),
-            stop_status.get_const_data()));
+        // DCGS2 updates the QR factorization one iteration later
+        if (!use_dcgs2) {
+            exec->run(gmres::make_hessenberg_qr(
+                givens_sin, givens_cos, residual_norm, residual_norm_collection,
+                hessenberg_iter.get(), restart_iter, final_iter_nums.get_data(),
+                stop_status.get_const_data()));
+        }
 
         restart_iter++;
     }
@@ -392,14 +1070,14 @@ void Gmres<ValueType>::apply_impl(const LinOp* alpha, const LinOp* b,
 template <typename ValueType>
 int workspace_traits<Gmres<ValueType>>::num_arrays(const Solver&)
 {
-    return 3;
+    return 4;
 }
 
 
 template <typename ValueType>
 int workspace_traits<Gmres<ValueType>>::num_vectors(const Solver&)
 {
-    return 14;
+    return 25;
 }
 
 
@@ -420,7 +1098,18 @@ std::vector<std::string> workspace_traits<Gmres<ValueType>>::op_names(
             "after_preconditioner",
             "one",
             "minus_one",
-            "next_krylov_norm_tmp"};
+            "next_krylov_norm_tmp",
+            "block_dot",
+            "block_coeffs",
+            "block_triangular",
+            "basis_scale",
+            "host_hessenberg",
+            "host_block_dot",
+            "host_block_proj",
+            "host_block_coeffs",
+            "host_scale",
+            "host_block_factor",
+            "host_block_triangular"};
 }
 
 
@@ -428,17 +1117,22 @@ template <typename ValueType>
 std::vector<std::string> workspace_traits<Gmres<ValueType>>::array_names(
     const Solver&)
 {
-    return {"stop", "tmp", "final_iter_nums"};
+    return {"stop", "tmp", "final_iter_nums", "host_stop"};
 }
 
 
 template <typename ValueType>
 std::vector<int> workspace_traits<Gmres<ValueType>>::scalars(const Solver&)
 {
-    return {hessenberg,          givens_sin,
-            givens_cos,          residual_norm_collection,
-            residual_norm,       y,
-            next_krylov_norm_tmp};
+    return {hessenberg,           givens_sin,
+            givens_cos,           residual_norm_collection,
+            residual_norm,        y,
+            next_krylov_norm_tmp, block_dot,
+            block_coeffs,         block_triangular,
+            basis_scale,          host_hessenberg,
+            host_block_dot,       host_block_proj,
+            host_block_coeffs,    host_scale,
+            host_block_factor,    host_block_triangular};
 }
 
 
@@ -67,11 +67,30 @@ namespace gmres {
                     stopping_status* stop_status)
 
 
-#define GKO_DECLARE_ALL_AS_TEMPLATES             \
-    template <typename ValueType>                \
-    GKO_DECLARE_GMRES_RESTART_KERNEL(ValueType); \
-    template <typename ValueType>                \
-    GKO_DECLARE_GMRES_MULTI_AXPY_KERNEL(ValueType)
+#define GKO_DECLARE_GMRES_MULTI_DOT_KERNEL(_type)               \
+    void multi_dot(std::shared_ptr<const DefaultExecutor> exec, \
+                   const matrix::Dense<_type>* krylov_bases,    \
+                   const matrix::Dense<_type>* block,           \
+                   matrix::Dense<_type>* result, array<char>& tmp)
+
+
+#define GKO_DECLARE_GMRES_MULTI_UPDATE_KERNEL(_type)               \
+    void multi_update(std::shared_ptr<const DefaultExecutor> exec, \
+                      const matrix::Dense<_type>* krylov_bases,    \
+                      const matrix::Dense<_type>* coeffs,          \
+                      const matrix::Dense<_type>* triangular,      \
+                      matrix::Dense<_type>* block)
+
+
+#define GKO_DECLARE_ALL_AS_TEMPLATES                \
+    template <typename ValueType>                   \
+    GKO_DECLARE_GMRES_RESTART_KERNEL(ValueType);    \
+    template <typename ValueType>                   \
+    GKO_DECLARE_GMRES_MULTI_AXPY_KERNEL(ValueType); \
+    template <typename ValueType>                   \
+    GKO_DECLARE_GMRES_MULTI_DOT_KERNEL(ValueType);  \
+    template <typename ValueType>                   \
+    GKO_DECLARE_GMRES_MULTI_UPDATE_KERNEL(ValueType)
 
 
 }  // namespace gmres
@@ -0,0 +1,375 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2022, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#include <ginkgo/core/solver/pipe_bicgstab.hpp>
+
+
+#include <ginkgo/core/base/exception.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/precision_dispatch.hpp>
+#include <ginkgo/core/base/utils.hpp>
+#include <ginkgo/core/solver/solver_base.hpp>
+
+
+#include "core/distributed/helpers.hpp"
+#include "core/solver/pipe_bicgstab_kernels.hpp"
+#include "core/solver/solver_boilerplate.hpp"
+
+
+namespace gko {
+namespace solver {
+namespace pipe_bicgstab {
+namespace {
+
+
+GKO_REGISTER_OPERATION(initialize, pipe_bicgstab::initialize);
+GKO_REGISTER_OPERATION(step_1, pipe_bicgstab::step_1);
+GKO_REGISTER_OPERATION(step_2, pipe_bicgstab::step_2);
+GKO_REGISTER_OPERATION(step_3, pipe_bicgstab::step_3);
+
+
+}  // anonymous namespace
+}  // namespace pipe_bicgstab
+
+
+template <typename ValueType>
+std::unique_ptr<LinOp> PipeBicgstab<ValueType>::transpose() const
+{
+    return build()
+        .with_generated_preconditioner(
+            share(as<Transposable>(this->get_preconditioner())->transpose()))
+        .with_criteria(this->get_stop_criterion_factory())
+        .on(this->get_executor())
+        ->generate(
+            share(as<Transposable>(this->get_system_matrix())->transpose()));
+}
+
+
+template <typename ValueType>
+std::unique_ptr<LinOp> PipeBicgstab<ValueType>::conj_transpose() const
+{
+    return build()
+        .with_generated_preconditioner(share(
+            as<Transposable>(this->get_preconditioner())->conj_transpose()))
+        .with_criteria(this->get_stop_criterion_factory())
+        .on(this->get_executor())
+        ->generate(share(
+            as<Transposable>(this->get_system_matrix())->conj_transpose()));
+}
+
+
+template <typename ValueType>
+void PipeBicgstab<ValueType>::apply_impl(const LinOp* b, LinOp* x) const
+{
+    if (!this->get_system_matrix()) {
+        return;
+    }
+    experimental::precision_dispatch_real_complex_distributed<ValueType>(
+        [this](auto dense_b, auto dense_x) {
+            this->apply_dense_impl(dense_b, dense_x);
+        },
+        b, x);
+}
+
+
+template <typename ValueType>
+template <typename VectorType>
+void PipeBicgstab<ValueType>::apply_dense_impl(const VectorType* dense_b,
+                                               VectorType* dense_x) const
+{
+    constexpr uint8 RelativeStoppingId{1};
+
+    auto exec = this->get_executor();
+    this->setup_workspace();
+
+    GKO_SOLVER_VECTOR(r, dense_b);
+    GKO_SOLVER_VECTOR(rr, dense_b);
+    GKO_SOLVER_VECTOR(pr, dense_b);
+    GKO_SOLVER_VECTOR(w, dense_b);
+    GKO_SOLVER_VECTOR(pw, dense_b);
+    GKO_SOLVER_VECTOR(t, dense_b);
+    GKO_SOLVER_VECTOR(p, dense_b);
+    GKO_SOLVER_VECTOR(s, dense_b);
+    GKO_SOLVER_VECTOR(ps, dense_b);
+    GKO_SOLVER_VECTOR(z, dense_b);
+    GKO_SOLVER_VECTOR(pz, dense_b);
+    GKO_SOLVER_VECTOR(q, dense_b);
+    GKO_SOLVER_VECTOR(pq, dense_b);
+    GKO_SOLVER_VECTOR(y, dense_b);
+    GKO_SOLVER_VECTOR(v, dense_b);
+
+    // the scalars computed by each of the two reductions are stored as the
+    // rows of a single matrix, so each set is reduced over all processes by a
+    // single reduction
+    const auto num_rhs = dense_b->get_size()[1];
+    auto omega_dots =
+        this->template create_workspace_op<matrix::Dense<ValueType>>(
+            GKO_SOLVER_TRAITS::omega_dots, dim<2>{2, num_rhs});
+    auto rho_dots =
+        this->template create_workspace_op<matrix::Dense<ValueType>>(
+            GKO_SOLVER_TRAITS::rho_dots, dim<2>{5, num_rhs});
+    auto get_row = [num_rhs](matrix::Dense<ValueType>* dots, size_type row) {
+        return dots->create_submatrix(span{row, row + 1}, span{0, num_rhs});
+    };
+    auto qy = get_row(omega_dots, 0);
+    auto yy = get_row(omega_dots, 1);
+    auto rho = get_row(rho_dots, 0);
+    auto rw = get_row(rho_dots, 1);
+    auto rs = get_row(rho_dots, 2);
+    auto rz = get_row(rho_dots, 3);
+    auto res_norm = get_row(rho_dots, 4);
+    GKO_SOLVER_SCALAR(prev_rho, dense_b);
+    GKO_SOLVER_SCALAR(alpha, dense_b);
+    GKO_SOLVER_SCALAR(beta, dense_b);
+    GKO_SOLVER_SCALAR(omega, dense_b);
+
+    GKO_SOLVER_ONE_MINUS_ONE();
+
+    bool one_changed{};
+    GKO_SOLVER_STOP_REDUCTION_ARRAYS();
+
+    // computes the local parts of rho_dots, i.e.
+    // rho = dot(rr, r), rw = dot(rr, w), rs = dot(rr, s), rz = dot(rr, z)
+    // and res_norm = dot(r, r)
+    auto compute_rho_dots = [&] {
+        auto local_rr = gko::detail::get_local(rr);
+        local_rr->compute_conj_dot(gko::detail::get_local(r), rho.get(),
+                                   reduction_tmp);
+        local_rr->compute_conj_dot(gko::detail::get_local(w), rw.get(),
+                                   reduction_tmp);
+        local_rr->compute_conj_dot(gko::detail::get_local(s), rs.get(),
+                                   reduction_tmp);
+        local_rr->compute_conj_dot(gko::detail::get_local(z), rz.get(),
+                                   reduction_tmp);
+        gko::detail::get_local(r)->compute_conj_dot(
+            gko::detail::get_local(r), res_norm.get(), reduction_tmp);
+    };
+
+    // r = dense_b
+    // prev_rho = beta = 0.0
+    // alpha = omega = 1.0
+    // p = s = ps = z = pz = v = 0
+    exec->run(pipe_bicgstab::make_initialize(
+        gko::detail::get_local(dense_b), gko::detail::get_local(r),
+        gko::detail::get_local(p), gko::detail::get_local(s),
+        gko::detail::get_local(ps), gko::detail::get_local(z),
+        gko::detail::get_local(pz), gko::detail::get_local(v), prev_rho, alpha,
+        beta, omega, &stop_status));
+
+    // r = b - Ax
+    this->get_system_matrix()->apply(neg_one_op, dense_x, one_op, r);
+    auto stop_criterion = this->get_stop_criterion_factory()->generate(
+        this->get_system_matrix(),
+        std::shared_ptr<const LinOp>(dense_b, [](const LinOp*) {}), dense_x, r);
+    // rr = r
+    rr->copy_from(r);
+    // pr = preconditioner * r
+    this->get_preconditioner()->apply(r, pr);
+    // w = A * pr
+    this->get_system_matrix()->apply(pr, w);
+    compute_rho_dots();
+    auto rho_reduction = gko::detail::start_global_sum(dense_b, rho_dots);
+    // pw = preconditioner * w
+    this->get_preconditioner()->apply(w, pw);
+    // t = A * pw
+    this->get_system_matrix()->apply(pw, t);
+    rho_reduction.wait();
+    // alpha = rho / rw
+    // beta = 0
+    // prev_rho = rho
+    exec->run(pipe_bicgstab::make_step_3(rho.get(), rw.get(), rs.get(),
+                                         rz.get(), prev_rho, alpha, beta,
+                                         omega, &stop_status));
+
+    int iter = -1;
+
+    /* Memory movement summary:
+     * 54n * values + 2 * matrix/preconditioner storage
+     * 2x SpMV:                 4n * values + 2 * storage
+     * 2x Preconditioner:       4n * values + 2 * storage
+     * 7x dot                  14n
+     * 1x step 1 (fused axpys) 18n
+     * 1x step 2 (fused axpys) 13n
+     * 1x norm2 residual        n
+     */
+    while (true) {
+        ++iter;
+        this->template log<log::Logger::iteration_complete>(
+            this, iter, r, dense_x, nullptr, res_norm.get());
+        if (stop_criterion->update()
+                .num_iterations(iter)
+                .residual(r)
+                .implicit_sq_residual_norm(res_norm.get())
+                .solution(dense_x)
+                .check(RelativeStoppingId, true, &stop_status, &one_changed)) {
+            break;
+        }
+
+        // p = pr + beta * (p - omega * ps)
+        // s = w + beta * (s - omega * z)
+        // ps = pw + beta * (ps - omega * pz)
+        // z = t + beta * (z - omega * v)
+        // q = r - alpha * s
+        // pq = pr - alpha * ps
+        // y = w - alpha * z
+        exec->run(pipe_bicgstab::make_step_1(
+            gko::detail::get_local(r), gko::detail::get_local(pr),
+            gko::detail::get_local(w), gko::detail::get_local(pw),
+            gko::detail::get_local(t), gko::detail::get_local(p),
+            gko::detail::get_local(s), gko::detail::get_local(ps),
+            gko::detail::get_local(z), gko::detail::get_local(pz),
+            gko::detail::get_local(v), gko::detail::get_local(q),
+            gko::detail::get_local(pq), gko::detail::get_local(y), alpha, beta,
+            omega, &stop_status));
+        // qy = dot(y, q)
+        // yy = dot(y, y)
+        gko::detail::get_local(y)->compute_conj_dot(
+            gko::detail::get_local(q), qy.get(), reduction_tmp);
+        gko::detail::get_local(y)->compute_conj_dot(
+            gko::detail::get_local(y), yy.get(), reduction_tmp);
+        auto omega_reduction =
+            gko::detail::start_global_sum(dense_b, omega_dots);
+        // pz = preconditioner * z
+        this->get_preconditioner()->apply(z, pz);
+        // v = A * pz
+        this->get_system_matrix()->apply(pz, v);
+        omega_reduction.wait();
+        // omega = qy / yy
+        // x = x + alpha * p + omega * pq
+        // r = q - omega * y
+        // pr = pq - omega * (pw - alpha * pz)
+        // w = y - omega * (t - alpha * v)
+        exec->run(pipe_bicgstab::make_step_2(
+            gko::detail::get_local(dense_x), gko::detail::get_local(r),
+            gko::detail::get_local(pr), gko::detail::get_local(w),
+            gko::detail::get_local(pw), gko::detail::get_local(t),
+            gko::detail::get_local(p), gko::detail::get_local(q),
+            gko::detail::get_local(pq), gko::detail::get_local(y),
+            gko::detail::get_local(pz), gko::detail::get_local(v), qy.get(),
+            yy.get(), alpha, omega, &stop_status));
+        compute_rho_dots();
+        auto rho_reduction = gko::detail::start_global_sum(dense_b, rho_dots);
+        // pw = preconditioner * w
+        this->get_preconditioner()->apply(w, pw);
+        // t = A * pw
+        this->get_system_matrix()->apply(pw, t);
+        rho_reduction.wait();
+        // beta = rho / prev_rho * alpha / omega
+        // alpha = rho / (rw + beta * (rs - omega * rz))
+        // prev_rho = rho
+        exec->run(pipe_bicgstab::make_step_3(rho.get(), rw.get(), rs.get(),
+                                             rz.get(), prev_rho, alpha, beta,
+                                             omega, &stop_status));
+    }
+}
+
+
+template <typename ValueType>
+void PipeBicgstab<ValueType>::apply_impl(const LinOp* alpha, const LinOp* b,
+                                         const LinOp* beta, LinOp* x) const
+{
+    if (!this->get_system_matrix()) {
+        return;
+    }
+    experimental::precision_dispatch_real_complex_distributed<ValueType>(
+        [this](auto dense_alpha, auto dense_b, auto dense_beta, auto dense_x) {
+            auto x_clone = dense_x->clone();
+            this->apply_dense_impl(dense_b, x_clone.get());
+            dense_x->scale(dense_beta);
+            dense_x->add_scaled(dense_alpha, x_clone.get());
+        },
+        alpha, b, beta, x);
+}
+
+
+template <typename ValueType>
+int workspace_traits<PipeBicgstab<ValueType>>::num_arrays(const Solver&)
+{
+    return 2;
+}
+
+
+template <typename ValueType>
+int workspace_traits<PipeBicgstab<ValueType>>::num_vectors(const Solver&)
+{
+    return 23;
+}
+
+
+template <typename ValueType>
+std::vector<std::string> workspace_traits<PipeBicgstab<ValueType>>::op_names(
+    const Solver&)
+{
+    return {
+        "r",     "rr",   "pr",    "w",          "pw",        "t",
+        "p",     "s",    "ps",    "z",          "pz",        "q",
+        "pq",    "y",    "v",     "omega_dots", "rho_dots",  "prev_rho",
+        "alpha", "beta", "omega", "one",        "minus_one",
+    };
+}
+
+
+template <typename ValueType>
+std::vector<std::string>
+workspace_traits<PipeBicgstab<ValueType>>::array_names(const Solver&)
+{
+    return {"stop", "tmp"};
+}
+
+
+template <typename ValueType>
+std::vector<int> workspace_traits<PipeBicgstab<ValueType>>::scalars(
+    const Solver&)
+{
+    return {omega_dots, rho_dots, prev_rho, alpha, beta, omega};
+}
+
+
+template <typename ValueType>
+std::vector<int> workspace_traits<PipeBicgstab<ValueType>>::vectors(
+    const Solver&)
+{
+    return {r, rr, pr, w, pw, t, p, s, ps, z, pz, q, pq, y, v};
+}
+
+
+#define GKO_DECLARE_PIPE_BICGSTAB(_type) class PipeBicgstab<_type>
+#define GKO_DECLARE_PIPE_BICGSTAB_TRAITS(_type) \
+    struct workspace_traits<PipeBicgstab<_type>>
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_PIPE_BICGSTAB);
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_PIPE_BICGSTAB_TRAITS);
+
+
+}  // namespace solver
+}  // namespace gko
@@ -0,0 +1,293 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2022, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#include <ginkgo/core/solver/pipe_cg.hpp>
+
+
+#include <ginkgo/core/base/exception.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/name_demangling.hpp>
+#include <ginkgo/core/base/precision_dispatch.hpp>
+#include <ginkgo/core/base/utils.hpp>
+
+
+#include "core/distributed/helpers.hpp"
+#include "core/solver/pipe_cg_kernels.hpp"
+#include "core/solver/solver_boilerplate.hpp"
+
+
+namespace gko {
+namespace solver {
+namespace pipe_cg {
+namespace {
+
+
+GKO_REGISTER_OPERATION(initialize, pipe_cg::initialize);
+GKO_REGISTER_OPERATION(step_1, pipe_cg::step_1);
+GKO_REGISTER_OPERATION(step_2, pipe_cg::step_2);
+
+
+}  // anonymous namespace
+}  // namespace pipe_cg
+
+
+template <typename ValueType>
+std::unique_ptr<LinOp> PipeCg<ValueType>::transpose() const
+{
+    return build()
+        .with_generated_preconditioner(
+            share(as<Transposable>(this->get_preconditioner())->transpose()))
+        .with_criteria(this->get_stop_criterion_factory())
+        .on(this->get_executor())
+        ->generate(
+            share(as<Transposable>(this->get_system_matrix())->transpose()));
+}
+
+
+template <typename ValueType>
+std::unique_ptr<LinOp> PipeCg<ValueType>::conj_transpose() const
+{
+    return build()
+        .with_generated_preconditioner(share(
+            as<Transposable>(this->get_preconditioner())->conj_transpose()))
+        .with_criteria(this->get_stop_criterion_factory())
+        .on(this->get_executor())
+        ->generate(share(
+            as<Transposable>(this->get_system_matrix())->conj_transpose()));
+}
+
+
+template <typename ValueType>
+void PipeCg<ValueType>::apply_impl(const LinOp* b, LinOp* x) const
+{
+    if (!this->get_system_matrix()) {
+        return;
+    }
+    experimental::precision_dispatch_real_complex_distributed<ValueType>(
+        [this](auto dense_b, auto dense_x) {
+            this->apply_dense_impl(dense_b, dense_x);
+        },
+        b, x);
+}
+
+
+template <typename ValueType>
+template <typename VectorType>
+void PipeCg<ValueType>::apply_dense_impl(const VectorType* dense_b,
+                                         VectorType* dense_x) const
+{
+    constexpr uint8 RelativeStoppingId{1};
+
+    auto exec = this->get_executor();
+    this->setup_workspace();
+
+    GKO_SOLVER_VECTOR(r, dense_b);
+    GKO_SOLVER_VECTOR(u, dense_b);
+    GKO_SOLVER_VECTOR(w, dense_b);
+    GKO_SOLVER_VECTOR(m, dense_b);
+    GKO_SOLVER_VECTOR(n, dense_b);
+    GKO_SOLVER_VECTOR(p, dense_b);
+    GKO_SOLVER_VECTOR(q, dense_b);
+    GKO_SOLVER_VECTOR(s, dense_b);
+    GKO_SOLVER_VECTOR(z, dense_b);
+
+    // rho and delta are stored as the rows of dots, so they can be reduced
+    // over all processes by a single reduction
+    const auto num_rhs = dense_b->get_size()[1];
+    auto dots = this->template create_workspace_op<matrix::Dense<ValueType>>(
+        GKO_SOLVER_TRAITS::dots, dim<2>{2, num_rhs});
+    auto rho = dots->create_submatrix(span{0, 1}, span{0, num_rhs});
+    auto delta = dots->create_submatrix(span{1, 2}, span{0, num_rhs});
+    GKO_SOLVER_SCALAR(prev_rho, dense_b);
+    GKO_SOLVER_SCALAR(alpha, dense_b);
+    GKO_SOLVER_SCALAR(beta, dense_b);
+
+    GKO_SOLVER_ONE_MINUS_ONE();
+
+    bool one_changed{};
+    GKO_SOLVER_STOP_REDUCTION_ARRAYS();
+
+    // r = dense_b
+    // prev_rho = beta = 0.0
+    // alpha = 1.0
+    // p = q = s = z = 0
+    exec->run(pipe_cg::make_initialize(
+        gko::detail::get_local(dense_b), gko::detail::get_local(r),
+        gko::detail::get_local(p), gko::detail::get_local(q),
+        gko::detail::get_local(s), gko::detail::get_local(z), prev_rho, alpha,
+        beta, &stop_status));
+
+    this->get_system_matrix()->apply(neg_one_op, dense_x, one_op, r);
+    auto stop_criterion = this->get_stop_criterion_factory()->generate(
+        this->get_system_matrix(),
+        std::shared_ptr<const LinOp>(dense_b, [](const LinOp*) {}), dense_x, r);
+    // u = preconditioner * r
+    this->get_preconditioner()->apply(r, u);
+    // w = A * u
+    this->get_system_matrix()->apply(u, w);
+
+    int iter = -1;
+    /* Memory movement summary:
+     * 27n * values + matrix/preconditioner storage
+     * 1x SpMV:                2n * values + storage
+     * 1x Preconditioner:      2n * values + storage
+     * 2x dot                  4n
+     * 1x step 2 (fused axpys) 18n
+     * 1x norm2 residual        n
+     */
+    while (true) {
+        // rho = dot(r, u)
+        // delta = dot(w, u)
+        gko::detail::get_local(r)->compute_conj_dot(
+            gko::detail::get_local(u), rho.get(), reduction_tmp);
+        gko::detail::get_local(w)->compute_conj_dot(
+            gko::detail::get_local(u), delta.get(), reduction_tmp);
+        auto reduction = gko::detail::start_global_sum(dense_b, dots);
+        // m = preconditioner * w
+        this->get_preconditioner()->apply(w, m);
+        // n = A * m
+        this->get_system_matrix()->apply(m, n);
+        reduction.wait();
+
+        ++iter;
+        this->template log<log::Logger::iteration_complete>(
+            this, iter, r, dense_x, nullptr, rho.get());
+        if (stop_criterion->update()
+                .num_iterations(iter)
+                .residual(r)
+                .implicit_sq_residual_norm(rho.get())
+                .solution(dense_x)
+                .check(RelativeStoppingId, true, &stop_status, &one_changed)) {
+            break;
+        }
+
+        // beta = rho / prev_rho
+        // alpha = rho / (delta - beta * rho / alpha)
+        // prev_rho = rho
+        exec->run(pipe_cg::make_step_1(rho.get(), delta.get(), prev_rho,
+                                       alpha, beta, &stop_status));
+        // z = n + beta * z
+        // q = m + beta * q
+        // s = w + beta * s
+        // p = u + beta * p
+        // x = x + alpha * p
+        // r = r - alpha * s
+        // u = u - alpha * q
+        // w = w - alpha * z
+        exec->run(pipe_cg::make_step_2(
+            gko::detail::get_local(dense_x), gko::detail::get_local(r),
+            gko::detail::get_local(u), gko::detail::get_local(w),
+            gko::detail::get_local(m), gko::detail::get_local(n),
+            gko::detail::get_local(p), gko::detail::get_local(q),
+            gko::detail::get_local(s), gko::detail::get_local(z), alpha, beta,
+            &stop_status));
+    }
+}
+
+
+template <typename ValueType>
+void PipeCg<ValueType>::apply_impl(const LinOp* alpha, const LinOp* b,
+                                   const LinOp* beta, LinOp* x) const
+{
+    if (!this->get_system_matrix()) {
+        return;
+    }
+    experimental::precision_dispatch_real_complex_distributed<ValueType>(
+        [this](auto dense_alpha, auto dense_b, auto dense_beta, auto dense_x) {
+            auto x_clone = dense_x->clone();
+            this->apply_dense_impl(dense_b, x_clone.get());
+            dense_x->scale(dense_beta);
+            dense_x->add_scaled(dense_alpha, x_clone.get());
+        },
+        alpha, b, beta, x);
+}
+
+
+template <typename ValueType>
+int workspace_traits<PipeCg<ValueType>>::num_arrays(const Solver&)
+{
+    return 2;
+}
+
+
+template <typename ValueType>
+int workspace_traits<PipeCg<ValueType>>::num_vectors(const Solver&)
+{
+    return 15;
+}
+
+
+template <typename ValueType>
+std::vector<std::string> workspace_traits<PipeCg<ValueType>>::op_names(
+    const Solver&)
+{
+    return {
+        "r",    "u",   "w",         "m",    "n",        "p",
+        "q",    "s",   "z",         "dots", "prev_rho", "alpha",
+        "beta", "one", "minus_one",
+    };
+}
+
+
+template <typename ValueType>
+std::vector<std::string> workspace_traits<PipeCg<ValueType>>::array_names(
+    const Solver&)
+{
+    return {"stop", "tmp"};
+}
+
+
+template <typename ValueType>
+std::vector<int> workspace_traits<PipeCg<ValueType>>::scalars(const Solver&)
+{
+    return {dots, prev_rho, alpha, beta};
+}
+
+
+template <typename ValueType>
+std::vector<int> workspace_traits<PipeCg<ValueType>>::vectors(const Solver&)
+{
+    return {r, u, w, m, n, p, q, s, z};
+}
+
+
+#define GKO_DECLARE_PIPE_CG(_type) class PipeCg<_type>
+#define GKO_DECLARE_PIPE_CG_TRAITS(_type) \
+    struct workspace_traits<PipeCg<_type>>
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_PIPE_CG);
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_PIPE_CG_TRAITS);
+
+
+}  // namespace solver
+}  // namespace gko
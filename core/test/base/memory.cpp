@@ -0,0 +1,292 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2022, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include <ginkgo/core/base/memory.hpp>
+
+
+#include <memory>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/executor.hpp>
+
+
+namespace {
+
+
+struct AllocationLogger : public gko::log::Logger {
+    AllocationLogger()
+        : gko::log::Logger(gko::log::Logger::executor_events_mask)
+    {}
+
+    void on_allocation_started(const gko::Executor* exec,
+                               const gko::size_type& num_bytes) const override
+    {
+        allocation_started++;
+    }
+
+    void on_allocation_completed(const gko::Executor* exec,
+                                 const gko::size_type& num_bytes,
+                                 const gko::uintptr& location) const override
+    {
+        allocation_completed++;
+    }
+
+    void on_free_completed(const gko::Executor* exec,
+                           const gko::uintptr& location) const override
+    {
+        free_completed++;
+    }
+
+    mutable int allocation_started = 0;
+    mutable int allocation_completed = 0;
+    mutable int free_completed = 0;
+};
+
+
+TEST(CpuAllocator, AllocatesAndDeallocates)
+{
+    gko::CpuAllocator alloc;
+
+    auto ptr = static_cast<int*>(alloc.allocate(10 * sizeof(int)));
+    // This test can only fail with sanitizers
+    ptr[0] = 0;
+    ptr[9] = 0;
+
+    ASSERT_NO_THROW(alloc.deallocate(ptr));
+}
+
+
+TEST(AlignedCpuAllocator, AlignsToCacheLine)
+{
+    gko::AlignedCpuAllocator alloc;
+
+    auto ptr = alloc.allocate(100);
+
+    ASSERT_EQ(alloc.get_alignment(), 64);
+    ASSERT_EQ(reinterpret_cast<gko::uintptr>(ptr) % 64, 0);
+    alloc.deallocate(ptr);
+}
+
+
+TEST(AlignedCpuAllocator, RoundsAlignmentToPowerOfTwo)
+{
+    gko::AlignedCpuAllocator alloc{48};
+
+    auto ptr = alloc.allocate(100);
+
+    ASSERT_EQ(alloc.get_alignment(), 64);
+    ASSERT_EQ(reinterpret_cast<gko::uintptr>(ptr) % 64, 0);
+    alloc.deallocate(ptr);
+}
+
+
+TEST(AlignedCpuAllocator, AlignsToHugePage)
+{
+    gko::AlignedCpuAllocator alloc{
+        gko::AlignedCpuAllocator::huge_page_alignment};
+
+    auto ptr = alloc.allocate(100);
+
+    ASSERT_EQ(reinterpret_cast<gko::uintptr>(ptr) %
+                  gko::AlignedCpuAllocator::huge_page_alignment,
+              0);
+    alloc.deallocate(ptr);
+}
+
+
+TEST(FirstTouchCpuAllocator, AllocatesAndDeallocates)
+{
+    gko::FirstTouchCpuAllocator alloc;
+    const gko::size_type num_elems = 100000;
+
+    auto ptr = static_cast<double*>(alloc.allocate(num_elems * sizeof(double)));
+    // This test can only fail with sanitizers
+    ptr[0] = 0;
+    ptr[num_elems - 1] = 0;
+
+    ASSERT_EQ(reinterpret_cast<gko::uintptr>(ptr) %
+                  gko::AlignedCpuAllocator::cache_line_alignment,
+              0);
+    ASSERT_NO_THROW(alloc.deallocate(ptr));
+}
+
+
+TEST(FirstTouchCpuAllocator, AllocatesBelowAndAboveThreshold)
+{
+    gko::FirstTouchCpuAllocator alloc{std::make_shared<gko::CpuAllocator>(),
+                                      1000};
+
+    auto ptr = static_cast<char*>(alloc.allocate(999));
+    auto ptr2 = static_cast<char*>(alloc.allocate(1000000));
+    // This test can only fail with sanitizers
+    ptr[998] = 0;
+    ptr2[999999] = 0;
+
+    ASSERT_EQ(alloc.get_parallel_threshold(), 1000);
+    alloc.deallocate(ptr);
+    alloc.deallocate(ptr2);
+}
+
+
+TEST(FirstTouchCpuAllocator, AllocatesWithHugePages)
+{
+    gko::FirstTouchCpuAllocator alloc{
+        std::make_shared<gko::AlignedCpuAllocator>(
+            gko::AlignedCpuAllocator::huge_page_alignment),
+        0};
+    const gko::size_type num_bytes =
+        64 * gko::AlignedCpuAllocator::huge_page_alignment + 1;
+
+    auto ptr = static_cast<char*>(alloc.allocate(num_bytes));
+    // This test can only fail with sanitizers
+    ptr[num_bytes - 1] = 0;
+
+    ASSERT_EQ(reinterpret_cast<gko::uintptr>(ptr) %
+                  gko::AlignedCpuAllocator::huge_page_alignment,
+              0);
+    alloc.deallocate(ptr);
+}
+
+
+TEST(FirstTouchCpuAllocator, AllocatesEmptyAndUnalignedBlocks)
+{
+    gko::FirstTouchCpuAllocator alloc{std::make_shared<gko::CpuAllocator>()};
+
+    auto ptr = alloc.allocate(0);
+    auto ptr2 = alloc.allocate(10001);
+
+    alloc.deallocate(ptr);
+    alloc.deallocate(ptr2);
+}
+
+
+TEST(CachingCpuAllocator, ReusesDeallocatedBlock)
+{
+    gko::CachingCpuAllocator alloc;
+
+    auto ptr = alloc.allocate(100);
+    alloc.deallocate(ptr);
+    auto ptr2 = alloc.allocate(120);
+
+    ASSERT_EQ(ptr, ptr2);
+    ASSERT_EQ(alloc.get_num_hits(), 1);
+    ASSERT_EQ(alloc.get_num_misses(), 1);
+    ASSERT_EQ(alloc.get_cached_bytes(), 0);
+    alloc.deallocate(ptr2);
+}
+
+
+TEST(CachingCpuAllocator, SeparatesSizeClasses)
+{
+    gko::CachingCpuAllocator alloc;
+
+    auto ptr = alloc.allocate(100);
+    alloc.deallocate(ptr);
+    auto ptr2 = alloc.allocate(1000);
+
+    ASSERT_EQ(alloc.get_num_hits(), 0);
+    ASSERT_EQ(alloc.get_num_misses(), 2);
+    ASSERT_EQ(alloc.get_cached_bytes(), 128);
+    alloc.deallocate(ptr2);
+    ASSERT_EQ(alloc.get_cached_bytes(), 128 + 1024);
+}
+
+
+TEST(CachingCpuAllocator, RespectsCacheLimit)
+{
+    auto logger = std::make_shared<AllocationLogger>();
+    gko::CachingCpuAllocator alloc{std::make_shared<gko::CpuAllocator>(),
+                                   1000};
+    alloc.add_logger(logger);
+
+    auto ptr = alloc.allocate(100);
+    auto ptr2 = alloc.allocate(1000);
+    alloc.deallocate(ptr);
+    alloc.deallocate(ptr2);
+
+    ASSERT_EQ(alloc.get_cached_bytes(), 128);
+    ASSERT_EQ(logger->free_completed, 1);
+}
+
+
+TEST(CachingCpuAllocator, ReleasesCachedBlocks)
+{
+    auto logger = std::make_shared<AllocationLogger>();
+    gko::CachingCpuAllocator alloc;
+    alloc.add_logger(logger);
+
+    alloc.deallocate(alloc.allocate(100));
+    alloc.release_cached();
+
+    ASSERT_EQ(alloc.get_cached_bytes(), 0);
+    ASSERT_EQ(logger->free_completed, 1);
+}
+
+
+TEST(CachingCpuAllocator, LogsOnlyMisses)
+{
+    auto logger = std::make_shared<AllocationLogger>();
+    gko::CachingCpuAllocator alloc;
+    alloc.add_logger(logger);
+
+    alloc.deallocate(alloc.allocate(100));
+    alloc.deallocate(alloc.allocate(100));
+    alloc.deallocate(alloc.allocate(100));
+
+    ASSERT_EQ(logger->allocation_started, 1);
+    ASSERT_EQ(logger->allocation_completed, 1);
+    ASSERT_EQ(logger->free_completed, 0);
+}
+
+
+TEST(CachingCpuAllocator, IsUsedByExecutor)
+{
+    auto alloc = std::make_shared<gko::CachingCpuAllocator>();
+    auto exec = gko::ReferenceExecutor::create(alloc);
+    auto logger = std::make_shared<AllocationLogger>();
+    exec->add_logger(logger);
+
+    { gko::array<double> array(exec, 10); }
+    { gko::array<double> array(exec, 10); }
+
+    ASSERT_EQ(logger->allocation_completed, 2);
+    ASSERT_EQ(alloc->get_num_hits(), 1);
+    ASSERT_EQ(alloc->get_num_misses(), 1);
+}
+
+
+}  // namespace
@@ -33,7 +33,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ginkgo/core/base/mtx_io.hpp>
 
 
+#include <cstdio>
 #include <cstring>
+#include <fstream>
 #include <sstream>
 
 
@@ -43,6 +45,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ginkgo/core/base/exception.hpp>
 #include <ginkgo/core/base/lin_op.hpp>
 #include <ginkgo/core/base/name_demangling.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
 #include <ginkgo/core/matrix/dense.hpp>
 
 
@@ -396,6 +399,217 @@ TEST(MtxReader, ReadsSparseComplexHermitianMtx)
 }
 
 
+template <typename ValueType>
+void assert_reads_in_parallel(const std::string& mtx)
+{
+    std::istringstream iss(mtx);
+    const auto ref_data = gko::read_raw<ValueType, gko::int32>(iss);
+
+    for (gko::size_type num_threads : {0, 1, 2, 3, 7}) {
+        SCOPED_TRACE(num_threads);
+        std::istringstream parallel_iss(mtx);
+
+        const auto data = gko::read_raw_parallel<ValueType, gko::int32>(
+            parallel_iss, num_threads);
+
+        ASSERT_EQ(data.size, ref_data.size);
+        ASSERT_EQ(data.nonzeros, ref_data.nonzeros);
+    }
+}
+
+
+TEST(MtxReader, ReadsDenseMtxInParallel)
+{
+    assert_reads_in_parallel<double>(
+        "%%MatrixMarket matrix array real general\n"
+        "% a comment\n"
+        "3 2\n"
+        "1.0\n"
+        "0.0\n"
+        "\n"
+        "3.0\n"
+        "5.0\r\n"
+        "  2.0\n"
+        "-0.5e+1");
+}
+
+
+TEST(MtxReader, ReadsDenseSymmetricMtxInParallel)
+{
+    assert_reads_in_parallel<double>(
+        "%%MatrixMarket matrix array real symmetric\n"
+        "3 3\n"
+        "1.0\n"
+        "2.0\n"
+        "3.0\n"
+        "4.0\n"
+        "5.0\n"
+        "6.0\n");
+}
+
+
+TEST(MtxReader, ReadsDenseSkewSymmetricIntegerMtxInParallel)
+{
+    assert_reads_in_parallel<float>(
+        "%%MatrixMarket matrix array integer skew-symmetric\n"
+        "3 3\n"
+        "1\n"
+        "2\n"
+        "3\n");
+}
+
+
+TEST(MtxReader, ReadsDenseComplexMtxInParallel)
+{
+    assert_reads_in_parallel<std::complex<double>>(
+        "%%MatrixMarket matrix array complex general\n"
+        "2 2\n"
+        "1.0 2.0\n"
+        "3.0 -4.0\n"
+        "5.0 6.0\n"
+        "7.0 8.0\n");
+}
+
+
+TEST(MtxReader, ReadsSparseMtxInParallel)
+{
+    assert_reads_in_parallel<double>(
+        "%%MatrixMarket matrix coordinate real general\n"
+        "4 3 7\n"
+        "1 1 1.0\n"
+        "4 2 5.0\n"
+        "\t1 2\t3.0\n"
+        "2 3 0.1\n"
+        "3 3 1.0000000000000002\n"
+        "1 3 3.14159265358979323846264338\n"
+        "4 1 -1e-300\n");
+}
+
+
+TEST(MtxReader, ReadsSparseSymmetricMtxInParallel)
+{
+    assert_reads_in_parallel<double>(
+        "%%MatrixMarket matrix coordinate real symmetric\n"
+        "3 3 4\n"
+        "1 1 1.0\n"
+        "2 1 2.0\n"
+        "3 3 6.0\n"
+        "3 1 3.0\n");
+}
+
+
+TEST(MtxReader, ReadsSparseSkewSymmetricMtxInParallel)
+{
+    assert_reads_in_parallel<double>(
+        "%%MatrixMarket matrix coordinate real skew-symmetric\n"
+        "3 3 2\n"
+        "2 1 2.0\n"
+        "3 1 3.0\n");
+}
+
+
+TEST(MtxReader, ReadsSparsePatternMtxInParallel)
+{
+    assert_reads_in_parallel<double>(
+        "%%MatrixMarket matrix coordinate pattern general\n"
+        "2 3 4\n"
+        "1 1\n"
+        "2 2\n"
+        "1 2\n"
+        "1 3\n");
+}
+
+
+TEST(MtxReader, ReadsSparseComplexHermitianMtxInParallel)
+{
+    assert_reads_in_parallel<std::complex<float>>(
+        "%%MatrixMarket matrix coordinate complex hermitian\n"
+        "2 3 2\n"
+        "1 2 3.0 1.0\n"
+        "1 3 2.0 4.0\n");
+}
+
+
+TEST(MtxReader, ReadsLargeSparseMtxInParallel)
+{
+    std::ostringstream oss;
+    oss << "%%MatrixMarket matrix coordinate real general\n"
+        << "1000 1000 3000\n";
+    for (int i = 1000; i > 0; i--) {
+        oss << i << ' ' << i << ' ' << i * 0.25 << '\n'
+            << i << ' ' << 1001 - i << ' ' << -i << '\n'
+            << (i % 7) + 1 << ' ' << i << ' ' << 1.0 / i << '\n';
+    }
+
+    assert_reads_in_parallel<double>(oss.str());
+}
+
+
+TEST(MtxReader, ReadsMtxFileInParallel)
+{
+    using tpl = gko::matrix_data<double, gko::int64>::nonzero_type;
+    const std::string filename = "mtx_io_reads_in_parallel.mtx";
+    {
+        std::ofstream stream{filename};
+        stream << "%%MatrixMarket matrix coordinate real general\n"
+                  "2 3 4\n"
+                  "1 1 1.0\n"
+                  "2 2 5.0\n"
+                  "1 2 3.0\n"
+                  "1 3 2.0\n";
+    }
+
+    auto data = gko::read_raw_parallel<double, gko::int64>(filename, 2);
+
+    ASSERT_EQ(data.size, gko::dim<2>(2, 3));
+    auto& v = data.nonzeros;
+    ASSERT_EQ(v.size(), 4);
+    ASSERT_EQ(v[0], tpl(0, 0, 1.0));
+    ASSERT_EQ(v[1], tpl(0, 1, 3.0));
+    ASSERT_EQ(v[2], tpl(0, 2, 2.0));
+    ASSERT_EQ(v[3], tpl(1, 1, 5.0));
+    std::remove(filename.c_str());
+}
+
+
+TEST(MtxReader, ReadsInParallelFailsForMissingEntries)
+{
+    std::istringstream iss(
+        "%%MatrixMarket matrix coordinate real general\n"
+        "2 3 4\n"
+        "1 1 1.0\n"
+        "2 2 5.0\n");
+
+    ASSERT_THROW((gko::read_raw_parallel<double, gko::int32>(iss, 2)),
+                 gko::StreamError);
+}
+
+
+TEST(MtxReader, ReadsInParallelFailsForInvalidEntries)
+{
+    std::istringstream iss(
+        "%%MatrixMarket matrix coordinate real general\n"
+        "2 3 2\n"
+        "1 1 1.0\n"
+        "2 1.5 5.0\n");
+
+    ASSERT_THROW((gko::read_raw_parallel<double, gko::int32>(iss, 2)),
+                 gko::StreamError);
+}
+
+
+TEST(MtxReader, ReadsInParallelFailsForComplexIntoReal)
+{
+    std::istringstream iss(
+        "%%MatrixMarket matrix coordinate complex general\n"
+        "2 3 1\n"
+        "1 1 1.0 2.0\n");
+
+    ASSERT_THROW((gko::read_raw_parallel<double, gko::int32>(iss)),
+                 gko::StreamError);
+}
+
+
 std::array<gko::uint64, 20> build_binary_complex_data()
 {
     gko::uint64 int_val{};
@@ -600,6 +814,174 @@ TEST(MtxReader, ReadsGenericBinary)
 }
 
 
+void write_to_file(const std::string& filename, const char* data,
+                   std::size_t size)
+{
+    std::ofstream stream{filename, std::ios::binary};
+    stream.write(data, size);
+}
+
+
+TEST(MtxReader, ReadsBinaryMapped)
+{
+    auto exec = gko::ReferenceExecutor::create();
+    auto raw_data = build_binary_real_data();
+    const std::string filename = "mtx_io_reads_binary_mapped.bin";
+    write_to_file(filename, reinterpret_cast<char*>(raw_data.data()),
+                  raw_data.size() * sizeof(gko::uint64));
+    auto test_read = [&](auto mtx_data) {
+        SCOPED_TRACE(gko::name_demangling::get_static_type(mtx_data));
+        using value_type =
+            typename std::decay_t<decltype(mtx_data)>::value_type;
+        using index_type =
+            typename std::decay_t<decltype(mtx_data)>::index_type;
+
+        auto data = gko::read_binary_mapped_raw<value_type, index_type>(
+                        exec, filename)
+                        .copy_to_host();
+
+        ASSERT_EQ(data.size, gko::dim<2>(64, 32));
+        ASSERT_EQ(data.nonzeros.size(), 4);
+        ASSERT_EQ(data.nonzeros[0].row, 0);
+        ASSERT_EQ(data.nonzeros[1].row, 1);
+        ASSERT_EQ(data.nonzeros[2].row, 4);
+        ASSERT_EQ(data.nonzeros[3].row, 16);
+        ASSERT_EQ(data.nonzeros[0].column, 1);
+        ASSERT_EQ(data.nonzeros[1].column, 1);
+        ASSERT_EQ(data.nonzeros[2].column, 2);
+        ASSERT_EQ(data.nonzeros[3].column, 25);
+        ASSERT_EQ(data.nonzeros[0].value, value_type{0.0});
+        ASSERT_EQ(data.nonzeros[1].value, value_type{2.5});
+        ASSERT_EQ(data.nonzeros[2].value, value_type{-2.5});
+        ASSERT_EQ(data.nonzeros[3].value, value_type{0.0});
+    };
+
+    test_read(gko::matrix_data<float, gko::int32>{});
+    test_read(gko::matrix_data<double, gko::int32>{});
+    test_read(gko::matrix_data<std::complex<float>, gko::int32>{});
+    test_read(gko::matrix_data<std::complex<double>, gko::int32>{});
+    test_read(gko::matrix_data<float, gko::int64>{});
+    test_read(gko::matrix_data<double, gko::int64>{});
+    test_read(gko::matrix_data<std::complex<float>, gko::int64>{});
+    test_read(gko::matrix_data<std::complex<double>, gko::int64>{});
+    std::remove(filename.c_str());
+}
+
+
+TEST(MtxReader, ReadsComplexBinaryMappedFailsForReal)
+{
+    auto exec = gko::ReferenceExecutor::create();
+    auto raw_data = build_binary_complex_data();
+    const std::string filename = "mtx_io_reads_complex_binary_mapped.bin";
+    write_to_file(filename, reinterpret_cast<char*>(raw_data.data()),
+                  raw_data.size() * sizeof(gko::uint64));
+
+    ASSERT_THROW((gko::read_binary_mapped_raw<double, gko::int32>(exec,
+                                                                  filename)),
+                 gko::StreamError);
+    std::remove(filename.c_str());
+}
+
+
+TEST(MtxReader, ReadsBinaryMappedFailsForTruncatedFile)
+{
+    auto exec = gko::ReferenceExecutor::create();
+    auto raw_data = build_binary_real_data();
+    const std::string filename = "mtx_io_reads_truncated_binary_mapped.bin";
+    write_to_file(filename, reinterpret_cast<char*>(raw_data.data()),
+                  (raw_data.size() - 1) * sizeof(gko::uint64));
+
+    ASSERT_THROW((gko::read_binary_mapped_raw<double, gko::int64>(exec,
+                                                                  filename)),
+                 gko::StreamError);
+    std::remove(filename.c_str());
+}
+
+
+TEST(MtxReader, ReadsBinaryMappedFailsForMissingFile)
+{
+    auto exec = gko::ReferenceExecutor::create();
+
+    ASSERT_THROW((gko::read_binary_mapped_raw<double, gko::int32>(
+                     exec, "mtx_io_missing_file.bin")),
+                 gko::StreamError);
+}
+
+
+TEST(MtxReader, WritesAndReadsBinaryCsr)
+{
+    using Csr = gko::matrix::Csr<double, gko::int64>;
+    auto exec = gko::ReferenceExecutor::create();
+    const std::string filename = "mtx_io_binary_csr.bin";
+    auto mtx = gko::initialize<Csr>(
+        {{1.0, 0.0, 2.0}, {0.0, 0.0, 0.0}, {0.0, -3.0, 4.5}}, exec);
+    {
+        std::ofstream stream{filename, std::ios::binary};
+        gko::write_binary_csr(stream, mtx.get());
+    }
+
+    auto result = gko::read_binary_csr<double, gko::int64>(exec, filename);
+
+    GKO_ASSERT_MTX_NEAR(result, mtx, 0.0);
+    ASSERT_EQ(result->get_num_stored_elements(), 4);
+    ASSERT_EQ(result->get_executor(), exec);
+    std::remove(filename.c_str());
+}
+
+
+TEST(MtxReader, ReadsBinaryCsrFailsForOtherTypes)
+{
+    using Csr = gko::matrix::Csr<double, gko::int32>;
+    auto exec = gko::ReferenceExecutor::create();
+    const std::string filename = "mtx_io_binary_csr_types.bin";
+    auto mtx = gko::initialize<Csr>({{1.0, 0.0}, {0.0, 2.0}}, exec);
+    {
+        std::ofstream stream{filename, std::ios::binary};
+        gko::write_binary_csr(stream, mtx.get());
+    }
+
+    ASSERT_THROW((gko::read_binary_csr<float, gko::int32>(exec, filename)),
+                 gko::StreamError);
+    ASSERT_THROW((gko::read_binary_csr<double, gko::int64>(exec, filename)),
+                 gko::StreamError);
+    std::ifstream stream{filename, std::ios::binary};
+    ASSERT_THROW((gko::read_binary_raw<double, gko::int32>(stream)),
+                 gko::StreamError);
+    stream.close();
+    std::remove(filename.c_str());
+}
+
+
+TEST(MtxReader, ReadsBinaryStreaming)
+{
+    using Csr = gko::matrix::Csr<double, gko::int32>;
+    auto exec = gko::ReferenceExecutor::create();
+    auto mtx = gko::initialize<Csr>(
+        {{1.0, 0.0, 2.0}, {0.0, 0.0, 0.0}, {0.0, -3.0, 4.5}, {0.0, 0.0, 5.0}},
+        exec);
+    std::stringstream ss;
+    gko::write_binary(ss, mtx.get());
+
+    auto result =
+        gko::read_binary_streaming<double, gko::int32>(ss, exec, 2);
+
+    GKO_ASSERT_MTX_NEAR(result, mtx, 0.0);
+    ASSERT_EQ(result->get_num_stored_elements(), 5);
+}
+
+
+TEST(MtxReader, ReadsBinaryStreamingFailsForUnsortedEntries)
+{
+    auto exec = gko::ReferenceExecutor::create();
+    auto raw_data = build_binary_real_data();
+    std::stringstream ss{std::string{reinterpret_cast<char*>(raw_data.data()),
+                                     raw_data.size() * sizeof(gko::uint64)}};
+
+    ASSERT_THROW((gko::read_binary_streaming<double, gko::int32>(ss, exec)),
+                 gko::UnsupportedMatrixProperty);
+}
+
+
 TEST(MtxReader, ReadsGenericMtx)
 {
     using tpl = gko::matrix_data<double, gko::int32>::nonzero_type;
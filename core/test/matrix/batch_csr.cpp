@@ -0,0 +1,248 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2022, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include <ginkgo/core/matrix/batch_csr.hpp>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/matrix/csr.hpp>
+
+
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename T>
+class BatchCsr : public ::testing::Test {
+protected:
+    using value_type = T;
+    using index_type = gko::int32;
+    using Mtx = gko::matrix::BatchCsr<value_type, index_type>;
+    using mat_data = gko::matrix_data<value_type, index_type>;
+
+    BatchCsr()
+        : exec(gko::ReferenceExecutor::create()),
+          data{mat_data{{2.0, -1.0, 0.0}, {-1.0, 3.0, -1.0}, {0.0, -1.0, 2.0}},
+               mat_data{{4.0, 1.0, 0.0}, {1.0, 5.0, 2.0}, {0.0, 2.0, 6.0}}},
+          mtx(Mtx::create(exec))
+    {
+        mtx->read(data);
+    }
+
+    void assert_equal_to_original_mtx(const Mtx* m)
+    {
+        auto v = m->get_const_values();
+        auto c = m->get_const_col_idxs();
+        auto r = m->get_const_row_ptrs();
+        ASSERT_EQ(m->get_size(), gko::dim<2>(6, 6));
+        ASSERT_EQ(m->get_common_size(), gko::dim<2>(3, 3));
+        ASSERT_EQ(m->get_num_batch_items(), 2);
+        ASSERT_EQ(m->get_num_stored_elements_per_item(), 7);
+        ASSERT_EQ(m->get_num_stored_elements(), 14);
+        EXPECT_EQ(r[0], 0);
+        EXPECT_EQ(r[1], 2);
+        EXPECT_EQ(r[2], 5);
+        EXPECT_EQ(r[3], 7);
+        EXPECT_EQ(c[0], 0);
+        EXPECT_EQ(c[1], 1);
+        EXPECT_EQ(c[2], 0);
+        EXPECT_EQ(c[3], 1);
+        EXPECT_EQ(c[4], 2);
+        EXPECT_EQ(c[5], 1);
+        EXPECT_EQ(c[6], 2);
+        EXPECT_EQ(v[0], value_type{2.0});
+        EXPECT_EQ(v[3], value_type{3.0});
+        EXPECT_EQ(v[6], value_type{2.0});
+        EXPECT_EQ(v[7], value_type{4.0});
+        EXPECT_EQ(v[10], value_type{5.0});
+        EXPECT_EQ(v[13], value_type{6.0});
+    }
+
+    std::shared_ptr<const gko::ReferenceExecutor> exec;
+    std::vector<mat_data> data;
+    std::unique_ptr<Mtx> mtx;
+};
+
+TYPED_TEST_SUITE(BatchCsr, gko::test::ValueTypes, TypenameNameGenerator);
+
+
+TYPED_TEST(BatchCsr, CanBeEmpty)
+{
+    using Mtx = typename TestFixture::Mtx;
+
+    auto mtx = Mtx::create(this->exec);
+
+    ASSERT_EQ(mtx->get_size(), gko::dim<2>(0, 0));
+    ASSERT_EQ(mtx->get_num_batch_items(), 0);
+    ASSERT_EQ(mtx->get_num_stored_elements(), 0);
+}
+
+
+TYPED_TEST(BatchCsr, ReadsData)
+{
+    this->assert_equal_to_original_mtx(this->mtx.get());
+}
+
+
+TYPED_TEST(BatchCsr, CanBeCreatedFromExistingData)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    value_type values[] = {1.0, 2.0, 3.0, 4.0, 5.0, 6.0};
+    index_type col_idxs[] = {0, 1, 1};
+    index_type row_ptrs[] = {0, 2, 3};
+
+    auto mtx = gko::matrix::BatchCsr<value_type, index_type>::create(
+        this->exec, 2, gko::dim<2>{2, 2},
+        gko::make_array_view(this->exec, 6, values),
+        gko::make_array_view(this->exec, 3, col_idxs),
+        gko::make_array_view(this->exec, 3, row_ptrs));
+
+    ASSERT_EQ(mtx->get_size(), gko::dim<2>(4, 4));
+    ASSERT_EQ(mtx->get_const_values(), values);
+    ASSERT_EQ(mtx->get_const_values_for_item(1), values + 3);
+    ASSERT_EQ(mtx->get_const_col_idxs(), col_idxs);
+    ASSERT_EQ(mtx->get_const_row_ptrs(), row_ptrs);
+}
+
+
+TYPED_TEST(BatchCsr, ThrowsOnMismatchingValuesSize)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+
+    ASSERT_THROW(Mtx::create(this->exec, 2, gko::dim<2>{2, 2},
+                             gko::array<value_type>(this->exec, 5),
+                             gko::array<index_type>(this->exec, 3),
+                             gko::array<index_type>(this->exec, 3)),
+                 gko::ValueMismatch);
+}
+
+
+TYPED_TEST(BatchCsr, CanBeCopied)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto copy = Mtx::create(this->exec);
+
+    copy->copy_from(this->mtx.get());
+
+    this->assert_equal_to_original_mtx(copy.get());
+}
+
+
+TYPED_TEST(BatchCsr, CanBeCloned)
+{
+    auto clone = this->mtx->clone();
+
+    this->assert_equal_to_original_mtx(clone.get());
+}
+
+
+TYPED_TEST(BatchCsr, CanWriteData)
+{
+    using mat_data = typename TestFixture::mat_data;
+    std::vector<mat_data> data;
+
+    this->mtx->write(data);
+
+    ASSERT_EQ(data.size(), 2);
+    for (int item = 0; item < 2; item++) {
+        auto expected = this->data[item];
+        expected.ensure_row_major_order();
+        ASSERT_EQ(data[item].size, expected.size);
+        ASSERT_EQ(data[item].nonzeros, expected.nonzeros);
+    }
+}
+
+
+TYPED_TEST(BatchCsr, ThrowsOnReadingDifferentPatterns)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using mat_data = typename TestFixture::mat_data;
+    auto data = this->data;
+    data[1] = mat_data{{4.0, 1.0, 1.0}, {1.0, 5.0, 2.0}, {0.0, 2.0, 6.0}};
+    auto mtx = Mtx::create(this->exec);
+
+    ASSERT_THROW(mtx->read(data), gko::ValueMismatch);
+}
+
+
+TYPED_TEST(BatchCsr, ThrowsOnReadingDifferentSizes)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using mat_data = typename TestFixture::mat_data;
+    auto data = this->data;
+    data[1] = mat_data{{4.0, 1.0}, {1.0, 5.0}};
+    auto mtx = Mtx::create(this->exec);
+
+    ASSERT_THROW(mtx->read(data), gko::DimensionMismatch);
+}
+
+
+TYPED_TEST(BatchCsr, CreatesViewForItem)
+{
+    using value_type = typename TestFixture::value_type;
+
+    auto view = this->mtx->create_view_for_item(1);
+    view->get_values()[0] = value_type{7.0};
+
+    ASSERT_EQ(view->get_size(), gko::dim<2>(3, 3));
+    ASSERT_EQ(view->get_num_stored_elements(), 7);
+    ASSERT_EQ(view->get_const_col_idxs(), this->mtx->get_const_col_idxs());
+    ASSERT_EQ(view->get_const_row_ptrs(), this->mtx->get_const_row_ptrs());
+    ASSERT_EQ(this->mtx->get_const_values_for_item(1)[0], value_type{7.0});
+}
+
+
+TYPED_TEST(BatchCsr, CreatesConstViewForItem)
+{
+    auto view = this->mtx->create_const_view_for_item(0);
+
+    ASSERT_EQ(view->get_size(), gko::dim<2>(3, 3));
+    ASSERT_EQ(view->get_const_values(), this->mtx->get_const_values());
+}
+
+
+TYPED_TEST(BatchCsr, ThrowsOnViewOfInvalidItem)
+{
+    ASSERT_THROW(this->mtx->create_view_for_item(2), gko::OutOfBoundsError);
+}
+
+
+}  // namespace
@@ -0,0 +1,170 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2022, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include <ginkgo/core/matrix/batch_dense.hpp>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/matrix/dense.hpp>
+
+
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename T>
+class BatchDense : public ::testing::Test {
+protected:
+    using value_type = T;
+    using Mtx = gko::matrix::BatchDense<value_type>;
+    using mat_data = gko::matrix_data<value_type, gko::int64>;
+    using mat_data32 = gko::matrix_data<value_type, gko::int32>;
+
+    BatchDense()
+        : exec(gko::ReferenceExecutor::create()),
+          data{mat_data{{1.0, 2.0, 0.0}, {0.0, 3.0, 4.0}},
+               mat_data{{5.0, 0.0, 6.0}, {7.0, 8.0, 0.0}}},
+          mtx(Mtx::create(exec))
+    {
+        mtx->read(data);
+    }
+
+    void assert_equal_to_original_mtx(const Mtx* m)
+    {
+        ASSERT_EQ(m->get_size(), gko::dim<2>(4, 6));
+        ASSERT_EQ(m->get_common_size(), gko::dim<2>(2, 3));
+        ASSERT_EQ(m->get_num_batch_items(), 2);
+        ASSERT_EQ(m->get_num_stored_elements(), 12);
+        EXPECT_EQ(m->at(0, 0, 0), value_type{1.0});
+        EXPECT_EQ(m->at(0, 0, 1), value_type{2.0});
+        EXPECT_EQ(m->at(0, 1, 0), value_type{0.0});
+        EXPECT_EQ(m->at(0, 1, 2), value_type{4.0});
+        EXPECT_EQ(m->at(1, 0, 2), value_type{6.0});
+        EXPECT_EQ(m->at(1, 1, 1), value_type{8.0});
+        EXPECT_EQ(m->get_const_values()[6], value_type{5.0});
+    }
+
+    std::shared_ptr<const gko::ReferenceExecutor> exec;
+    std::vector<mat_data> data;
+    std::unique_ptr<Mtx> mtx;
+};
+
+TYPED_TEST_SUITE(BatchDense, gko::test::ValueTypes, TypenameNameGenerator);
+
+
+TYPED_TEST(BatchDense, CanBeEmpty)
+{
+    using Mtx = typename TestFixture::Mtx;
+
+    auto mtx = Mtx::create(this->exec);
+
+    ASSERT_EQ(mtx->get_size(), gko::dim<2>(0, 0));
+    ASSERT_EQ(mtx->get_num_batch_items(), 0);
+    ASSERT_EQ(mtx->get_num_stored_elements(), 0);
+}
+
+
+TYPED_TEST(BatchDense, ReadsData)
+{
+    this->assert_equal_to_original_mtx(this->mtx.get());
+}
+
+
+TYPED_TEST(BatchDense, ReadsData32)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using mat_data32 = typename TestFixture::mat_data32;
+    auto mtx = Mtx::create(this->exec);
+
+    mtx->read({mat_data32{{1.0, 2.0, 0.0}, {0.0, 3.0, 4.0}},
+               mat_data32{{5.0, 0.0, 6.0}, {7.0, 8.0, 0.0}}});
+
+    this->assert_equal_to_original_mtx(mtx.get());
+}
+
+
+TYPED_TEST(BatchDense, CanBeCopied)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto copy = Mtx::create(this->exec);
+
+    copy->copy_from(this->mtx.get());
+
+    this->assert_equal_to_original_mtx(copy.get());
+}
+
+
+TYPED_TEST(BatchDense, CanWriteData)
+{
+    using mat_data = typename TestFixture::mat_data;
+    std::vector<mat_data> data;
+
+    this->mtx->write(data);
+
+    ASSERT_EQ(data.size(), 2);
+    ASSERT_EQ(data[0].size, this->data[0].size);
+    ASSERT_EQ(data[0].nonzeros, this->data[0].nonzeros);
+    ASSERT_EQ(data[1].nonzeros, this->data[1].nonzeros);
+}
+
+
+TYPED_TEST(BatchDense, ThrowsOnReadingDifferentSizes)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using mat_data = typename TestFixture::mat_data;
+    auto data = this->data;
+    data[1] = mat_data{{1.0, 2.0}, {3.0, 4.0}};
+    auto mtx = Mtx::create(this->exec);
+
+    ASSERT_THROW(mtx->read(data), gko::DimensionMismatch);
+}
+
+
+TYPED_TEST(BatchDense, CreatesViewForItem)
+{
+    using value_type = typename TestFixture::value_type;
+
+    auto view = this->mtx->create_view_for_item(1);
+    view->at(1, 2) = value_type{9.0};
+
+    ASSERT_EQ(view->get_size(), gko::dim<2>(2, 3));
+    ASSERT_EQ(view->at(0, 0), value_type{5.0});
+    ASSERT_EQ(this->mtx->at(1, 1, 2), value_type{9.0});
+}
+
+
+}  // namespace
@@ -0,0 +1,182 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2022, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include <ginkgo/core/matrix/batch_ell.hpp>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/matrix/ell.hpp>
+
+
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename T>
+class BatchEll : public ::testing::Test {
+protected:
+    using value_type = T;
+    using index_type = gko::int32;
+    using Mtx = gko::matrix::BatchEll<value_type, index_type>;
+    using mat_data = gko::matrix_data<value_type, index_type>;
+
+    index_type invalid_index = gko::invalid_index<index_type>();
+
+    BatchEll()
+        : exec(gko::ReferenceExecutor::create()),
+          data{mat_data{{2.0, -1.0, 0.0}, {-1.0, 3.0, -1.0}, {0.0, -1.0, 2.0}},
+               mat_data{{4.0, 1.0, 0.0}, {1.0, 5.0, 2.0}, {0.0, 2.0, 6.0}}},
+          mtx(Mtx::create(exec))
+    {
+        mtx->read(data);
+    }
+
+    void assert_equal_to_original_mtx(const Mtx* m)
+    {
+        auto v = m->get_const_values();
+        auto c = m->get_const_col_idxs();
+        ASSERT_EQ(m->get_size(), gko::dim<2>(6, 6));
+        ASSERT_EQ(m->get_common_size(), gko::dim<2>(3, 3));
+        ASSERT_EQ(m->get_num_batch_items(), 2);
+        ASSERT_EQ(m->get_num_stored_elements_per_row(), 3);
+        ASSERT_EQ(m->get_num_stored_elements(), 18);
+        EXPECT_EQ(c[0], 0);
+        EXPECT_EQ(c[1], 0);
+        EXPECT_EQ(c[2], 1);
+        EXPECT_EQ(c[3], 1);
+        EXPECT_EQ(c[4], 1);
+        EXPECT_EQ(c[5], 2);
+        EXPECT_EQ(c[6], invalid_index);
+        EXPECT_EQ(c[7], 2);
+        EXPECT_EQ(c[8], invalid_index);
+        EXPECT_EQ(v[0], value_type{2.0});
+        EXPECT_EQ(v[4], value_type{3.0});
+        EXPECT_EQ(v[6], value_type{0.0});
+        EXPECT_EQ(v[9], value_type{4.0});
+        EXPECT_EQ(v[13], value_type{5.0});
+        EXPECT_EQ(v[14], value_type{6.0});
+    }
+
+    std::shared_ptr<const gko::ReferenceExecutor> exec;
+    std::vector<mat_data> data;
+    std::unique_ptr<Mtx> mtx;
+};
+
+TYPED_TEST_SUITE(BatchEll, gko::test::ValueTypes, TypenameNameGenerator);
+
+
+TYPED_TEST(BatchEll, CanBeEmpty)
+{
+    using Mtx = typename TestFixture::Mtx;
+
+    auto mtx = Mtx::create(this->exec);
+
+    ASSERT_EQ(mtx->get_size(), gko::dim<2>(0, 0));
+    ASSERT_EQ(mtx->get_num_batch_items(), 0);
+    ASSERT_EQ(mtx->get_num_stored_elements(), 0);
+}
+
+
+TYPED_TEST(BatchEll, ReadsData)
+{
+    this->assert_equal_to_original_mtx(this->mtx.get());
+}
+
+
+TYPED_TEST(BatchEll, CanBeCopied)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto copy = Mtx::create(this->exec);
+
+    copy->copy_from(this->mtx.get());
+
+    this->assert_equal_to_original_mtx(copy.get());
+}
+
+
+TYPED_TEST(BatchEll, CanWriteData)
+{
+    using mat_data = typename TestFixture::mat_data;
+    std::vector<mat_data> data;
+
+    this->mtx->write(data);
+
+    ASSERT_EQ(data.size(), 2);
+    for (int item = 0; item < 2; item++) {
+        auto expected = this->data[item];
+        expected.ensure_row_major_order();
+        ASSERT_EQ(data[item].size, expected.size);
+        ASSERT_EQ(data[item].nonzeros, expected.nonzeros);
+    }
+}
+
+
+TYPED_TEST(BatchEll, ThrowsOnReadingDifferentPatterns)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using mat_data = typename TestFixture::mat_data;
+    auto data = this->data;
+    data[1] = mat_data{{4.0, 1.0, 1.0}, {1.0, 5.0, 2.0}, {0.0, 2.0, 6.0}};
+    auto mtx = Mtx::create(this->exec);
+
+    ASSERT_THROW(mtx->read(data), gko::ValueMismatch);
+}
+
+
+TYPED_TEST(BatchEll, CreatesViewForItem)
+{
+    using value_type = typename TestFixture::value_type;
+
+    auto view = this->mtx->create_view_for_item(1);
+    view->get_values()[0] = value_type{7.0};
+
+    ASSERT_EQ(view->get_size(), gko::dim<2>(3, 3));
+    ASSERT_EQ(view->get_num_stored_elements_per_row(), 3);
+    ASSERT_EQ(view->get_stride(), 3);
+    ASSERT_EQ(view->get_const_col_idxs(), this->mtx->get_const_col_idxs());
+    ASSERT_EQ(this->mtx->get_const_values_for_item(1)[0], value_type{7.0});
+}
+
+
+TYPED_TEST(BatchEll, ThrowsOnViewOfInvalidItem)
+{
+    ASSERT_THROW(this->mtx->create_const_view_for_item(2),
+                 gko::OutOfBoundsError);
+}
+
+
+}  // namespace
@@ -0,0 +1,185 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2022, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#include <ginkgo/core/matrix/csr_stream_builder.hpp>
+
+
+#include <memory>
+#include <vector>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/exception.hpp>
+
+
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename ValueIndexType>
+class CsrStreamBuilder : public ::testing::Test {
+protected:
+    using value_type =
+        typename std::tuple_element<0, decltype(ValueIndexType())>::type;
+    using index_type =
+        typename std::tuple_element<1, decltype(ValueIndexType())>::type;
+    using Mtx = gko::matrix::Csr<value_type, index_type>;
+    using Builder = gko::matrix::CsrStreamBuilder<value_type, index_type>;
+    using nonzero_type = typename Builder::nonzero_type;
+
+    CsrStreamBuilder()
+        : exec(gko::ReferenceExecutor::create()),
+          entries{{0, 1, 1.0}, {0, 2, 2.0}, {2, 0, 3.0},
+                  {2, 2, 4.0}, {3, 1, 5.0}, {3, 3, 6.0}}
+    {}
+
+    void assert_equal_to_entries(const Mtx* mtx)
+    {
+        ASSERT_EQ(mtx->get_size(), gko::dim<2>(5, 4));
+        ASSERT_EQ(mtx->get_num_stored_elements(), 6);
+        const auto row_ptrs = mtx->get_const_row_ptrs();
+        const auto col_idxs = mtx->get_const_col_idxs();
+        const auto values = mtx->get_const_values();
+        EXPECT_EQ(row_ptrs[0], 0);
+        EXPECT_EQ(row_ptrs[1], 2);
+        EXPECT_EQ(row_ptrs[2], 2);
+        EXPECT_EQ(row_ptrs[3], 4);
+        EXPECT_EQ(row_ptrs[4], 6);
+        EXPECT_EQ(row_ptrs[5], 6);
+        for (gko::size_type i = 0; i < entries.size(); i++) {
+            EXPECT_EQ(col_idxs[i], entries[i].column);
+            EXPECT_EQ(values[i], entries[i].value);
+        }
+    }
+
+    std::shared_ptr<const gko::Executor> exec;
+    std::vector<nonzero_type> entries;
+};
+
+TYPED_TEST_SUITE(CsrStreamBuilder, gko::test::ValueIndexTypes,
+                 PairTypenameNameGenerator);
+
+
+TYPED_TEST(CsrStreamBuilder, BuildsFromSingleBatch)
+{
+    typename TestFixture::Builder builder{this->exec, gko::dim<2>{5, 4}, 6};
+
+    builder.append(this->entries);
+    auto mtx = builder.finalize();
+
+    this->assert_equal_to_entries(mtx.get());
+    ASSERT_EQ(mtx->get_executor(), this->exec);
+}
+
+
+TYPED_TEST(CsrStreamBuilder, BuildsFromMultipleBatchesWithoutSizeHint)
+{
+    typename TestFixture::Builder builder{this->exec, gko::dim<2>{5, 4}};
+
+    builder.append(this->entries.data(), 1);
+    builder.append(this->entries.data() + 1, 0);
+    builder.append(this->entries.data() + 1, 2);
+    builder.append(this->entries.data() + 3, 3);
+    auto mtx = builder.finalize();
+
+    this->assert_equal_to_entries(mtx.get());
+}
+
+
+TYPED_TEST(CsrStreamBuilder, BuildsWithTooLargeSizeHint)
+{
+    typename TestFixture::Builder builder{this->exec, gko::dim<2>{5, 4}, 100};
+
+    builder.append(this->entries);
+    auto mtx = builder.finalize();
+
+    this->assert_equal_to_entries(mtx.get());
+}
+
+
+TYPED_TEST(CsrStreamBuilder, BuildsEmptyMatrix)
+{
+    typename TestFixture::Builder builder{this->exec, gko::dim<2>{3, 2}};
+
+    auto mtx = builder.finalize();
+
+    ASSERT_EQ(mtx->get_size(), gko::dim<2>(3, 2));
+    ASSERT_EQ(mtx->get_num_stored_elements(), 0);
+    for (int row = 0; row <= 3; row++) {
+        EXPECT_EQ(mtx->get_const_row_ptrs()[row], 0);
+    }
+}
+
+
+TYPED_TEST(CsrStreamBuilder, CountsStoredElements)
+{
+    typename TestFixture::Builder builder{this->exec, gko::dim<2>{5, 4}};
+
+    builder.append(this->entries.data(), 4);
+
+    ASSERT_EQ(builder.get_num_stored_elements(), 4);
+}
+
+
+TYPED_TEST(CsrStreamBuilder, ThrowsOnUnsortedRows)
+{
+    typename TestFixture::Builder builder{this->exec, gko::dim<2>{5, 4}};
+    builder.append(this->entries.data() + 2, 1);
+
+    ASSERT_THROW(builder.append(this->entries.data(), 1),
+                 gko::UnsupportedMatrixProperty);
+}
+
+
+TYPED_TEST(CsrStreamBuilder, ThrowsOnUnsortedColumns)
+{
+    typename TestFixture::Builder builder{this->exec, gko::dim<2>{5, 4}};
+    builder.append(this->entries.data() + 1, 1);
+
+    ASSERT_THROW(builder.append(this->entries.data(), 1),
+                 gko::UnsupportedMatrixProperty);
+}
+
+
+TYPED_TEST(CsrStreamBuilder, ThrowsOnEntryOutOfBounds)
+{
+    typename TestFixture::Builder builder{this->exec, gko::dim<2>{3, 4}};
+
+    ASSERT_THROW(builder.append(this->entries), gko::OutOfBoundsError);
+}
+
+
+}  // namespace
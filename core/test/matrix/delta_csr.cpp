@@ -0,0 +1,241 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2022, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#include <ginkgo/core/matrix/delta_csr.hpp>
+
+
+#include <memory>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/dim.hpp>
+
+
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename ValueIndexType>
+class DeltaCsr : public ::testing::Test {
+protected:
+    using value_type =
+        typename std::tuple_element<0, decltype(ValueIndexType())>::type;
+    using index_type =
+        typename std::tuple_element<1, decltype(ValueIndexType())>::type;
+    using Mtx = gko::matrix::DeltaCsr<value_type, index_type>;
+    using delta_type = typename Mtx::delta_type;
+
+    DeltaCsr()
+        : exec(gko::ReferenceExecutor::create()),
+          mtx(Mtx::create(exec, gko::dim<2>{2, 70001}, 4, 1))
+    {
+        /*
+         * 1   2   0 ... 0   3
+         * 0   0   0   4 ... 0
+         */
+        auto v = mtx->get_values();
+        auto d = mtx->get_col_deltas();
+        auto b = mtx->get_col_bases();
+        auto r = mtx->get_row_ptrs();
+        auto er = mtx->get_escape_ptrs();
+        auto ec = mtx->get_escape_col_idxs();
+        r[0] = 0;
+        r[1] = 3;
+        r[2] = 4;
+        b[0] = 0;
+        b[1] = 3;
+        d[0] = 0;
+        d[1] = 1;
+        d[2] = Mtx::escape_delta;
+        d[3] = 0;
+        er[0] = 0;
+        er[1] = 1;
+        er[2] = 1;
+        ec[0] = 70000;
+        v[0] = 1.0;
+        v[1] = 2.0;
+        v[2] = 3.0;
+        v[3] = 4.0;
+    }
+
+    std::shared_ptr<const gko::Executor> exec;
+    std::unique_ptr<Mtx> mtx;
+
+    void assert_equal_to_original_mtx(const Mtx* m)
+    {
+        auto v = m->get_const_values();
+        auto d = m->get_const_col_deltas();
+        auto b = m->get_const_col_bases();
+        auto r = m->get_const_row_ptrs();
+        auto er = m->get_const_escape_ptrs();
+        auto ec = m->get_const_escape_col_idxs();
+        ASSERT_EQ(m->get_size(), gko::dim<2>(2, 70001));
+        ASSERT_EQ(m->get_num_stored_elements(), 4);
+        ASSERT_EQ(m->get_num_escapes(), 1);
+        EXPECT_EQ(r[0], 0);
+        EXPECT_EQ(r[1], 3);
+        EXPECT_EQ(r[2], 4);
+        EXPECT_EQ(b[0], 0);
+        EXPECT_EQ(b[1], 3);
+        EXPECT_EQ(d[0], delta_type{0});
+        EXPECT_EQ(d[1], delta_type{1});
+        EXPECT_EQ(d[2], delta_type{65535});
+        EXPECT_EQ(d[3], delta_type{0});
+        EXPECT_EQ(er[0], 0);
+        EXPECT_EQ(er[1], 1);
+        EXPECT_EQ(er[2], 1);
+        EXPECT_EQ(ec[0], 70000);
+        EXPECT_EQ(v[0], value_type{1.0});
+        EXPECT_EQ(v[1], value_type{2.0});
+        EXPECT_EQ(v[2], value_type{3.0});
+        EXPECT_EQ(v[3], value_type{4.0});
+    }
+
+    void assert_empty(const Mtx* m)
+    {
+        ASSERT_EQ(m->get_size(), gko::dim<2>(0, 0));
+        ASSERT_EQ(m->get_num_stored_elements(), 0);
+        ASSERT_EQ(m->get_num_escapes(), 0);
+        ASSERT_EQ(m->get_const_values(), nullptr);
+        ASSERT_EQ(m->get_const_col_deltas(), nullptr);
+        ASSERT_EQ(m->get_const_escape_col_idxs(), nullptr);
+        ASSERT_NE(m->get_const_row_ptrs(), nullptr);
+        ASSERT_NE(m->get_const_escape_ptrs(), nullptr);
+        EXPECT_EQ(m->get_const_row_ptrs()[0], 0);
+        EXPECT_EQ(m->get_const_escape_ptrs()[0], 0);
+    }
+};
+
+TYPED_TEST_SUITE(DeltaCsr, gko::test::ValueIndexTypes,
+                 PairTypenameNameGenerator);
+
+
+TYPED_TEST(DeltaCsr, KnowsItsSize)
+{
+    ASSERT_EQ(this->mtx->get_size(), gko::dim<2>(2, 70001));
+    ASSERT_EQ(this->mtx->get_num_stored_elements(), 4);
+    ASSERT_EQ(this->mtx->get_num_escapes(), 1);
+}
+
+
+TYPED_TEST(DeltaCsr, ContainsCorrectData)
+{
+    this->assert_equal_to_original_mtx(this->mtx.get());
+}
+
+
+TYPED_TEST(DeltaCsr, CanBeEmpty)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto mtx = Mtx::create(this->exec);
+
+    this->assert_empty(mtx.get());
+}
+
+
+TYPED_TEST(DeltaCsr, CanBeCopied)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto copy = Mtx::create(this->exec);
+
+    copy->copy_from(this->mtx.get());
+
+    this->assert_equal_to_original_mtx(this->mtx.get());
+    this->assert_equal_to_original_mtx(copy.get());
+}
+
+
+TYPED_TEST(DeltaCsr, CanBeMoved)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto copy = Mtx::create(this->exec);
+
+    copy->copy_from(std::move(this->mtx));
+
+    this->assert_equal_to_original_mtx(copy.get());
+}
+
+
+TYPED_TEST(DeltaCsr, CanBeCloned)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto clone = this->mtx->clone();
+
+    this->assert_equal_to_original_mtx(this->mtx.get());
+    this->assert_equal_to_original_mtx(dynamic_cast<Mtx*>(clone.get()));
+}
+
+
+TYPED_TEST(DeltaCsr, CanBeCleared)
+{
+    this->mtx->clear();
+
+    this->assert_empty(this->mtx.get());
+}
+
+
+TYPED_TEST(DeltaCsr, CanBeReadFromMatrixData)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto m = Mtx::create(this->exec);
+
+    m->read({{2, 70001},
+             {{0, 0, 1.0}, {0, 1, 2.0}, {0, 70000, 3.0}, {1, 3, 4.0}}});
+
+    this->assert_equal_to_original_mtx(m.get());
+}
+
+
+TYPED_TEST(DeltaCsr, GeneratesCorrectMatrixData)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    using tpl = typename gko::matrix_data<value_type, index_type>::nonzero_type;
+    gko::matrix_data<value_type, index_type> data;
+
+    this->mtx->write(data);
+
+    ASSERT_EQ(data.size, gko::dim<2>(2, 70001));
+    ASSERT_EQ(data.nonzeros.size(), 4);
+    EXPECT_EQ(data.nonzeros[0], tpl(0, 0, value_type{1.0}));
+    EXPECT_EQ(data.nonzeros[1], tpl(0, 1, value_type{2.0}));
+    EXPECT_EQ(data.nonzeros[2], tpl(0, 70000, value_type{3.0}));
+    EXPECT_EQ(data.nonzeros[3], tpl(1, 3, value_type{4.0}));
+}
+
+
+}  // namespace
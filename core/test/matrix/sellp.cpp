@@ -179,6 +179,21 @@ TYPED_TEST(Sellp, CanBeConstructedWithSliceSizeAndStrideFactor)
 }
 
 
+TYPED_TEST(Sellp, CanBeConstructedWithSortingWindow)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto mtx = Mtx::create(this->exec, gko::dim<2>{2, 3}, 2, 2, 4, 3);
+
+    ASSERT_EQ(mtx->get_size(), gko::dim<2>(2, 3));
+    ASSERT_EQ(mtx->get_num_stored_elements(), 6);
+    ASSERT_EQ(mtx->get_slice_size(), 2);
+    ASSERT_EQ(mtx->get_stride_factor(), 2);
+    ASSERT_EQ(mtx->get_sorting_window(), 4);
+    ASSERT_EQ(mtx->get_total_cols(), 3);
+    ASSERT_EQ(mtx->get_const_permutation(), nullptr);
+}
+
+
 TYPED_TEST(Sellp, CanBeCopied)
 {
     using Mtx = typename TestFixture::Mtx;
@@ -243,6 +258,39 @@ TYPED_TEST(Sellp, CanBeReadFromMatrixDataWithSliceSizeAndStrideFactor)
 }
 
 
+TYPED_TEST(Sellp, CanBeReadFromMatrixDataWithSortingWindow)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    auto m = Mtx::create(this->exec, gko::dim<2>{3, 3}, 2, 1, 3, 0);
+    gko::matrix_data<value_type, index_type> data{
+        {3, 3},
+        {{0, 0, 1.0},
+         {1, 0, 2.0},
+         {1, 1, 3.0},
+         {1, 2, 4.0},
+         {2, 1, 5.0},
+         {2, 2, 6.0}}};
+
+    m->read(data);
+    gko::matrix_data<value_type, index_type> result;
+    m->write(result);
+
+    auto perm = m->get_const_permutation();
+    ASSERT_EQ(m->get_sorting_window(), 3);
+    ASSERT_EQ(perm[0], 1);
+    ASSERT_EQ(perm[1], 2);
+    ASSERT_EQ(perm[2], 0);
+    // rows 1 and 2 share the first slice, leaving row 0 without padding
+    ASSERT_EQ(m->get_total_cols(), 4);
+    ASSERT_EQ(m->get_const_slice_lengths()[0], 3);
+    ASSERT_EQ(m->get_const_slice_lengths()[1], 1);
+    ASSERT_EQ(result.size, data.size);
+    ASSERT_EQ(result.nonzeros, data.nonzeros);
+}
+
+
 TYPED_TEST(Sellp, GeneratesCorrectMatrixData)
 {
     using value_type = typename TestFixture::value_type;
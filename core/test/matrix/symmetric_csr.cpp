@@ -0,0 +1,243 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2022, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include <ginkgo/core/matrix/symmetric_csr.hpp>
+
+
+#include <memory>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/dim.hpp>
+#include <ginkgo/core/base/exception.hpp>
+
+
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename ValueIndexType>
+class SymmetricCsr : public ::testing::Test {
+protected:
+    using value_type =
+        typename std::tuple_element<0, decltype(ValueIndexType())>::type;
+    using index_type =
+        typename std::tuple_element<1, decltype(ValueIndexType())>::type;
+    using Mtx = gko::matrix::SymmetricCsr<value_type, index_type>;
+
+    SymmetricCsr()
+        : exec(gko::ReferenceExecutor::create()),
+          mtx(Mtx::create(exec, gko::dim<2>{3, 3}, 5))
+    {
+        /*
+         * 2   1   0
+         * 1   3   4
+         * 0   4   5
+         */
+        auto v = mtx->get_values();
+        auto c = mtx->get_col_idxs();
+        auto r = mtx->get_row_ptrs();
+        r[0] = 0;
+        r[1] = 2;
+        r[2] = 4;
+        r[3] = 5;
+        c[0] = 0;
+        c[1] = 1;
+        c[2] = 1;
+        c[3] = 2;
+        c[4] = 2;
+        v[0] = 2.0;
+        v[1] = 1.0;
+        v[2] = 3.0;
+        v[3] = 4.0;
+        v[4] = 5.0;
+    }
+
+    std::shared_ptr<const gko::Executor> exec;
+    std::unique_ptr<Mtx> mtx;
+
+    void assert_equal_to_original_mtx(const Mtx* m)
+    {
+        auto v = m->get_const_values();
+        auto c = m->get_const_col_idxs();
+        auto r = m->get_const_row_ptrs();
+        ASSERT_EQ(m->get_size(), gko::dim<2>(3, 3));
+        ASSERT_EQ(m->get_num_stored_elements(), 5);
+        EXPECT_EQ(r[0], 0);
+        EXPECT_EQ(r[1], 2);
+        EXPECT_EQ(r[2], 4);
+        EXPECT_EQ(r[3], 5);
+        EXPECT_EQ(c[0], 0);
+        EXPECT_EQ(c[1], 1);
+        EXPECT_EQ(c[2], 1);
+        EXPECT_EQ(c[3], 2);
+        EXPECT_EQ(c[4], 2);
+        EXPECT_EQ(v[0], value_type{2.0});
+        EXPECT_EQ(v[1], value_type{1.0});
+        EXPECT_EQ(v[2], value_type{3.0});
+        EXPECT_EQ(v[3], value_type{4.0});
+        EXPECT_EQ(v[4], value_type{5.0});
+    }
+
+    void assert_empty(const Mtx* m)
+    {
+        ASSERT_EQ(m->get_size(), gko::dim<2>(0, 0));
+        ASSERT_EQ(m->get_num_stored_elements(), 0);
+        ASSERT_EQ(m->get_const_values(), nullptr);
+        ASSERT_EQ(m->get_const_col_idxs(), nullptr);
+        ASSERT_NE(m->get_const_row_ptrs(), nullptr);
+        EXPECT_EQ(m->get_const_row_ptrs()[0], 0);
+    }
+};
+
+TYPED_TEST_SUITE(SymmetricCsr, gko::test::ValueIndexTypes,
+                 PairTypenameNameGenerator);
+
+
+TYPED_TEST(SymmetricCsr, KnowsItsSize)
+{
+    ASSERT_EQ(this->mtx->get_size(), gko::dim<2>(3, 3));
+    ASSERT_EQ(this->mtx->get_num_stored_elements(), 5);
+}
+
+
+TYPED_TEST(SymmetricCsr, ContainsCorrectData)
+{
+    this->assert_equal_to_original_mtx(this->mtx.get());
+}
+
+
+TYPED_TEST(SymmetricCsr, CanBeEmpty)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto mtx = Mtx::create(this->exec);
+
+    this->assert_empty(mtx.get());
+}
+
+
+TYPED_TEST(SymmetricCsr, ThrowsOnRectangularSize)
+{
+    using Mtx = typename TestFixture::Mtx;
+
+    ASSERT_THROW(Mtx::create(this->exec, gko::dim<2>{2, 3}),
+                 gko::DimensionMismatch);
+}
+
+
+TYPED_TEST(SymmetricCsr, CanBeCopied)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto copy = Mtx::create(this->exec);
+
+    copy->copy_from(this->mtx.get());
+
+    this->assert_equal_to_original_mtx(this->mtx.get());
+    this->assert_equal_to_original_mtx(copy.get());
+}
+
+
+TYPED_TEST(SymmetricCsr, CanBeMoved)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto copy = Mtx::create(this->exec);
+
+    copy->copy_from(std::move(this->mtx));
+
+    this->assert_equal_to_original_mtx(copy.get());
+}
+
+
+TYPED_TEST(SymmetricCsr, CanBeCloned)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto clone = this->mtx->clone();
+
+    this->assert_equal_to_original_mtx(this->mtx.get());
+    this->assert_equal_to_original_mtx(dynamic_cast<Mtx*>(clone.get()));
+}
+
+
+TYPED_TEST(SymmetricCsr, CanBeCleared)
+{
+    this->mtx->clear();
+
+    this->assert_empty(this->mtx.get());
+}
+
+
+TYPED_TEST(SymmetricCsr, CanBeReadFromMatrixData)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto m = Mtx::create(this->exec);
+
+    m->read({{3, 3},
+             {{0, 0, 2.0},
+              {0, 1, 1.0},
+              {1, 0, 1.0},
+              {1, 1, 3.0},
+              {1, 2, 4.0},
+              {2, 1, 4.0},
+              {2, 2, 5.0}}});
+
+    this->assert_equal_to_original_mtx(m.get());
+}
+
+
+TYPED_TEST(SymmetricCsr, GeneratesCorrectMatrixData)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    using tpl = typename gko::matrix_data<value_type, index_type>::nonzero_type;
+    gko::matrix_data<value_type, index_type> data;
+
+    this->mtx->write(data);
+
+    ASSERT_EQ(data.size, gko::dim<2>(3, 3));
+    ASSERT_EQ(data.nonzeros.size(), 7);
+    EXPECT_EQ(data.nonzeros[0], tpl(0, 0, value_type{2.0}));
+    EXPECT_EQ(data.nonzeros[1], tpl(0, 1, value_type{1.0}));
+    EXPECT_EQ(data.nonzeros[2], tpl(1, 0, value_type{1.0}));
+    EXPECT_EQ(data.nonzeros[3], tpl(1, 1, value_type{3.0}));
+    EXPECT_EQ(data.nonzeros[4], tpl(1, 2, value_type{4.0}));
+    EXPECT_EQ(data.nonzeros[5], tpl(2, 1, value_type{4.0}));
+    EXPECT_EQ(data.nonzeros[6], tpl(2, 2, value_type{5.0}));
+}
+
+
+}  // namespace
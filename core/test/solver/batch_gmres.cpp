@@ -0,0 +1,151 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2022, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include <ginkgo/core/solver/batch_gmres.hpp>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/exception.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/batch_csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename T>
+class BatchGmres : public ::testing::Test {
+protected:
+    using value_type = T;
+    using Mtx = gko::matrix::BatchCsr<value_type>;
+    using Solver = gko::solver::BatchGmres<value_type>;
+
+    BatchGmres()
+        : exec(gko::ReferenceExecutor::create()),
+          mtx(Mtx::create(exec)),
+          factory(Solver::build().on(exec))
+    {
+        using mat_data = gko::matrix_data<value_type, gko::int32>;
+        mtx->read({mat_data{{2.0, -1.0}, {-1.0, 2.0}},
+                   mat_data{{4.0, 1.0}, {1.0, 3.0}},
+                   mat_data{{1.0, 0.5}, {0.5, 1.0}}});
+        solver = factory->generate(mtx);
+    }
+
+    std::shared_ptr<const gko::Executor> exec;
+    std::shared_ptr<Mtx> mtx;
+    std::unique_ptr<typename Solver::Factory> factory;
+    std::unique_ptr<gko::LinOp> solver;
+};
+
+TYPED_TEST_SUITE(BatchGmres, gko::test::ValueTypes, TypenameNameGenerator);
+
+
+TYPED_TEST(BatchGmres, FactoryKnowsItsExecutor)
+{
+    ASSERT_EQ(this->factory->get_executor(), this->exec);
+}
+
+
+TYPED_TEST(BatchGmres, FactoryCreatesCorrectSolver)
+{
+    using Solver = typename TestFixture::Solver;
+
+    auto solver = static_cast<Solver*>(this->solver.get());
+
+    ASSERT_EQ(solver->get_size(), gko::dim<2>(6, 6));
+    ASSERT_EQ(solver->get_system_matrix(), this->mtx);
+    ASSERT_TRUE(solver->apply_uses_initial_guess());
+}
+
+
+TYPED_TEST(BatchGmres, HasDefaultParameters)
+{
+    auto params = this->factory->get_parameters();
+
+    ASSERT_EQ(params.max_iterations, 100u);
+    ASSERT_EQ(params.tolerance_type, gko::stop::mode::rhs_norm);
+    ASSERT_EQ(params.krylov_dim, 30u);
+}
+
+
+TYPED_TEST(BatchGmres, CanSetParameters)
+{
+    using Solver = typename TestFixture::Solver;
+    using real_type = gko::remove_complex<typename TestFixture::value_type>;
+
+    auto factory = Solver::build()
+                       .with_max_iterations(5u)
+                       .with_tolerance(real_type{1e-3})
+                       .with_tolerance_type(gko::stop::mode::absolute)
+                       .with_krylov_dim(10u)
+                       .on(this->exec);
+
+    auto params = factory->get_parameters();
+    ASSERT_EQ(params.max_iterations, 5u);
+    ASSERT_EQ(params.tolerance, real_type{1e-3});
+    ASSERT_EQ(params.tolerance_type, gko::stop::mode::absolute);
+    ASSERT_EQ(params.krylov_dim, 10u);
+}
+
+
+TYPED_TEST(BatchGmres, CanBeCopied)
+{
+    using Solver = typename TestFixture::Solver;
+    auto copy = this->factory->generate(this->mtx);
+
+    copy->copy_from(this->solver.get());
+
+    ASSERT_EQ(copy->get_size(), gko::dim<2>(6, 6));
+    ASSERT_EQ(static_cast<Solver*>(copy.get())->get_system_matrix(),
+              this->mtx);
+}
+
+
+TYPED_TEST(BatchGmres, ThrowsOnUnbatchedSystemMatrix)
+{
+    using value_type = typename TestFixture::value_type;
+    auto mtx = gko::share(
+        gko::matrix::Dense<value_type>::create(this->exec, gko::dim<2>{2, 2}));
+
+    ASSERT_THROW(this->factory->generate(mtx), gko::NotSupported);
+}
+
+
+}  // namespace
@@ -308,6 +308,52 @@ TYPED_TEST(CbGmres, CanUseSetKrylovDim)
 }
 
 
+TYPED_TEST(CbGmres, DefaultsToConditionalReorthogonalization)
+{
+    using Solver = typename TestFixture::Solver;
+
+    auto factory = Solver::build().on(this->exec);
+
+    ASSERT_EQ(factory->get_parameters().orthogonalization,
+              gko::solver::gmres::ortho_method::cgs_conditional);
+}
+
+
+TYPED_TEST(CbGmres, CanSetOrthogonalization)
+{
+    using Solver = typename TestFixture::Solver;
+    auto cb_gmres_factory =
+        Solver::build()
+            .with_criteria(
+                gko::stop::Iteration::build().with_max_iters(3u).on(this->exec))
+            .with_orthogonalization(gko::solver::gmres::ortho_method::cgs2)
+            .on(this->exec);
+
+    auto solver = cb_gmres_factory->generate(this->mtx);
+
+    ASSERT_EQ(solver->get_parameters().orthogonalization,
+              gko::solver::gmres::ortho_method::cgs2);
+}
+
+
+TYPED_TEST(CbGmres, ThrowsOnUnsupportedOrthogonalization)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Solver = typename TestFixture::Solver;
+    auto solver =
+        Solver::build()
+            .with_criteria(
+                gko::stop::Iteration::build().with_max_iters(3u).on(this->exec))
+            .with_orthogonalization(gko::solver::gmres::ortho_method::mgs)
+            .on(this->exec)
+            ->generate(this->mtx);
+    auto b = gko::initialize<Mtx>({1.0, 2.0, 3.0}, this->exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0}, this->exec);
+
+    ASSERT_THROW(solver->apply(b.get(), x.get()), gko::NotSupported);
+}
+
+
 TYPED_TEST(CbGmres, CanSetPreconditionerInFactory)
 {
     using Solver = typename TestFixture::Solver;
@@ -284,6 +284,79 @@ TYPED_TEST(Gmres, CanSetKrylovDimAgain)
 }
 
 
+TYPED_TEST(Gmres, DefaultsToSingleStep)
+{
+    using Solver = typename TestFixture::Solver;
+
+    ASSERT_EQ(Solver::build().on(this->exec)->get_parameters().s_step, 1);
+}
+
+
+TYPED_TEST(Gmres, CanSetSStep)
+{
+    using Solver = typename TestFixture::Solver;
+    auto gmres_factory = Solver::build()
+                             .with_criteria(gko::stop::Iteration::build()
+                                                .with_max_iters(3u)
+                                                .on(this->exec))
+                             .with_s_step(4u)
+                             .on(this->exec);
+
+    auto solver = gmres_factory->generate(this->mtx);
+
+    ASSERT_EQ(solver->get_parameters().s_step, 4);
+}
+
+
+TYPED_TEST(Gmres, DefaultsToModifiedGramSchmidt)
+{
+    using Solver = typename TestFixture::Solver;
+
+    auto factory = Solver::build().on(this->exec);
+
+    ASSERT_EQ(factory->get_parameters().orthogonalization,
+              gko::solver::gmres::ortho_method::mgs);
+}
+
+
+TYPED_TEST(Gmres, CanSetOrthogonalization)
+{
+    using Solver = typename TestFixture::Solver;
+    auto gmres_factory =
+        Solver::build()
+            .with_criteria(
+                gko::stop::Iteration::build().with_max_iters(3u).on(this->exec))
+            .with_orthogonalization(gko::solver::gmres::ortho_method::dcgs2)
+            .on(this->exec);
+
+    auto solver = gmres_factory->generate(this->mtx);
+
+    ASSERT_EQ(solver->get_parameters().orthogonalization,
+              gko::solver::gmres::ortho_method::dcgs2);
+}
+
+
+TYPED_TEST(Gmres, TransposeKeepsOrthogonalization)
+{
+    using Solver = typename TestFixture::Solver;
+    auto solver =
+        Solver::build()
+            .with_criteria(
+                gko::stop::Iteration::build().with_max_iters(3u).on(this->exec))
+            .with_orthogonalization(gko::solver::gmres::ortho_method::cgs2)
+            .on(this->exec)
+            ->generate(this->mtx);
+
+    auto transposed = gko::as<Solver>(solver->transpose());
+    auto conj_transposed = gko::as<Solver>(solver->conj_transpose());
+
+    ASSERT_EQ(transposed->get_parameters().orthogonalization,
+              gko::solver::gmres::ortho_method::cgs2);
+    ASSERT_EQ(conj_transposed->get_parameters().orthogonalization,
+              gko::solver::gmres::ortho_method::cgs2);
+}
+
+
 TYPED_TEST(Gmres, CanSetPreconditionerInFactory)
 {
     using Solver = typename TestFixture::Solver;
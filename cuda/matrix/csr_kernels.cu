@@ -542,6 +542,33 @@ GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
     GKO_DECLARE_CSR_ADVANCED_SPMV_KERNEL);
 
 
+// The mixed-precision SpMV is only used on the host executors, see
+// core/matrix/mixed_precision_spmv.hpp. The device stubs are kept so the
+// kernel registration, which covers all executors, links.
+template <typename ValueType, typename IndexType>
+void mixed_spmv(std::shared_ptr<const CudaExecutor> exec,
+                const matrix::Csr<ValueType, IndexType>* a,
+                const matrix::Dense<next_precision<ValueType>>* b,
+                matrix::Dense<next_precision<ValueType>>* c)
+    GKO_NOT_IMPLEMENTED;
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_CSR_MIXED_SPMV_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void advanced_mixed_spmv(std::shared_ptr<const CudaExecutor> exec,
+                         const matrix::Dense<next_precision<ValueType>>* alpha,
+                         const matrix::Csr<ValueType, IndexType>* a,
+                         const matrix::Dense<next_precision<ValueType>>* b,
+                         const matrix::Dense<next_precision<ValueType>>* beta,
+                         matrix::Dense<next_precision<ValueType>>* c)
+    GKO_NOT_IMPLEMENTED;
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_CSR_ADVANCED_MIXED_SPMV_KERNEL);
+
+
 template <typename ValueType, typename IndexType>
 void spgemm(std::shared_ptr<const CudaExecutor> exec,
             const matrix::Csr<ValueType, IndexType>* a,
@@ -667,6 +694,28 @@ void spgemm(std::shared_ptr<const CudaExecutor> exec,
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_CSR_SPGEMM_KERNEL);
 
 
+template <typename ValueType, typename IndexType>
+void spgemm_symbolic(std::shared_ptr<const CudaExecutor> exec,
+                     const matrix::Csr<ValueType, IndexType>* a,
+                     const matrix::Csr<ValueType, IndexType>* b,
+                     IndexType* c_row_ptrs, array<IndexType>& c_col_idxs)
+{
+    // the SpGEMM here has no separate symbolic phase, so we compute the full
+    // product and only keep its sparsity pattern
+    const auto num_rows = a->get_size()[0];
+    auto c = matrix::Csr<ValueType, IndexType>::create(
+        exec, dim<2>{num_rows, b->get_size()[1]});
+    spgemm(exec, a, b, c.get());
+    const auto nnz = c->get_num_stored_elements();
+    exec->copy(num_rows + 1, c->get_const_row_ptrs(), c_row_ptrs);
+    c_col_idxs.resize_and_reset(nnz);
+    exec->copy(nnz, c->get_const_col_idxs(), c_col_idxs.get_data());
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_CSR_SPGEMM_SYMBOLIC_KERNEL);
+
+
 namespace {
 
 
@@ -78,7 +78,8 @@ void spmv(std::shared_ptr<const CudaExecutor> exec,
             a->get_size()[0], b->get_size()[1], b->get_stride(),
             c->get_stride(), a->get_slice_size(), a->get_const_slice_sets(),
             as_cuda_type(a->get_const_values()), a->get_const_col_idxs(),
-            as_cuda_type(b->get_const_values()), as_cuda_type(c->get_values()));
+            a->get_const_permutation(), as_cuda_type(b->get_const_values()),
+            as_cuda_type(c->get_values()));
     }
 }
 
@@ -102,7 +103,7 @@ void advanced_spmv(std::shared_ptr<const CudaExecutor> exec,
             c->get_stride(), a->get_slice_size(), a->get_const_slice_sets(),
             as_cuda_type(alpha->get_const_values()),
             as_cuda_type(a->get_const_values()), a->get_const_col_idxs(),
-            as_cuda_type(b->get_const_values()),
+            a->get_const_permutation(), as_cuda_type(b->get_const_values()),
             as_cuda_type(beta->get_const_values()),
             as_cuda_type(c->get_values()));
     }
@@ -112,6 +113,33 @@ GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
     GKO_DECLARE_SELLP_ADVANCED_SPMV_KERNEL);
 
 
+// The mixed-precision SpMV is only used on the host executors, see
+// core/matrix/mixed_precision_spmv.hpp. The device stubs are kept so the
+// kernel registration, which covers all executors, links.
+template <typename ValueType, typename IndexType>
+void mixed_spmv(std::shared_ptr<const CudaExecutor> exec,
+                const matrix::Sellp<ValueType, IndexType>* a,
+                const matrix::Dense<next_precision<ValueType>>* b,
+                matrix::Dense<next_precision<ValueType>>* c)
+    GKO_NOT_IMPLEMENTED;
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SELLP_MIXED_SPMV_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void advanced_mixed_spmv(std::shared_ptr<const CudaExecutor> exec,
+                         const matrix::Dense<next_precision<ValueType>>* alpha,
+                         const matrix::Sellp<ValueType, IndexType>* a,
+                         const matrix::Dense<next_precision<ValueType>>* b,
+                         const matrix::Dense<next_precision<ValueType>>* beta,
+                         matrix::Dense<next_precision<ValueType>>* c)
+    GKO_NOT_IMPLEMENTED;
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SELLP_ADVANCED_MIXED_SPMV_KERNEL);
+
+
 }  // namespace sellp
 }  // namespace cuda
 }  // namespace kernels
@@ -35,6 +35,11 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <mutex>
 
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+
 #include <ginkgo/core/base/machine_topology.hpp>
 
 
@@ -123,9 +128,26 @@ machine_topology::machine_topology()
 }
 
 
+void machine_topology::bind_omp_threads_to_cores() const
+{
+#if defined(_OPENMP) && GKO_HAVE_HWLOC
+    const auto num_cores = static_cast<int>(this->cores_.size());
+    if (num_cores == 0) {
+        return;
+    }
+#pragma omp parallel
+    {
+        const auto core = omp_get_thread_num() % num_cores;
+        hwloc_binding_helper(this->cores_, std::vector<int>{core}, true, true);
+    }
+#endif
+}
+
+
 void machine_topology::hwloc_binding_helper(
     const std::vector<machine_topology::normal_obj_info>& obj,
-    const std::vector<int>& bind_ids, const bool singlify) const
+    const std::vector<int>& bind_ids, const bool singlify,
+    const bool bind_thread) const
 {
 #if GKO_HAVE_HWLOC
     detail::topo_bitmap bitmap_toset;
@@ -142,7 +164,8 @@ void machine_topology::hwloc_binding_helper(
     if (singlify) {
         hwloc_bitmap_singlify(bitmap_toset.get());
     }
-    hwloc_set_cpubind(this->topo_.get(), bitmap_toset.get(), 0);
+    hwloc_set_cpubind(this->topo_.get(), bitmap_toset.get(),
+                      bind_thread ? HWLOC_CPUBIND_THREAD : 0);
 #endif
 }
 
@@ -0,0 +1,310 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2022, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include <ginkgo/core/base/memory.hpp>
+
+
+#include <algorithm>
+#include <cstdlib>
+
+
+#ifdef _WIN32
+#include <malloc.h>
+#else
+#include <sys/mman.h>
+#endif
+
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+
+#include <ginkgo/core/base/executor.hpp>
+
+
+namespace gko {
+
+
+void* CpuAllocator::allocate(size_type num_bytes)
+{
+    return std::malloc(num_bytes);
+}
+
+
+void CpuAllocator::deallocate(void* ptr) { std::free(ptr); }
+
+
+constexpr size_type AlignedCpuAllocator::cache_line_alignment;
+constexpr size_type AlignedCpuAllocator::huge_page_alignment;
+
+
+AlignedCpuAllocator::AlignedCpuAllocator(size_type alignment)
+    : alignment_{sizeof(void*)}
+{
+    while (alignment_ < alignment) {
+        alignment_ *= 2;
+    }
+}
+
+
+void* AlignedCpuAllocator::allocate(size_type num_bytes)
+{
+#ifdef _WIN32
+    return _aligned_malloc(num_bytes, alignment_);
+#else
+    void* ptr{};
+    if (posix_memalign(&ptr, alignment_, num_bytes) != 0) {
+        return nullptr;
+    }
+#ifdef MADV_HUGEPAGE
+    if (alignment_ >= huge_page_alignment) {
+        // this is only a hint, so failures can be ignored
+        madvise(ptr, num_bytes, MADV_HUGEPAGE);
+    }
+#endif
+    return ptr;
+#endif
+}
+
+
+void AlignedCpuAllocator::deallocate(void* ptr)
+{
+#ifdef _WIN32
+    _aligned_free(ptr);
+#else
+    std::free(ptr);
+#endif
+}
+
+
+constexpr size_type FirstTouchCpuAllocator::default_parallel_threshold;
+
+
+FirstTouchCpuAllocator::FirstTouchCpuAllocator(
+    std::shared_ptr<CpuAllocatorBase> upstream, size_type parallel_threshold)
+    : upstream_{std::move(upstream)},
+      parallel_threshold_{parallel_threshold},
+      // the smallest page size on all supported systems
+      page_size_{4096}
+{
+    const auto aligned =
+        std::dynamic_pointer_cast<AlignedCpuAllocator>(upstream_);
+    if (aligned && aligned->get_alignment() >=
+                       AlignedCpuAllocator::huge_page_alignment) {
+        page_size_ = AlignedCpuAllocator::huge_page_alignment;
+    }
+}
+
+
+void* FirstTouchCpuAllocator::allocate(size_type num_bytes)
+{
+    const auto ptr = static_cast<char*>(upstream_->allocate(num_bytes));
+#ifdef _OPENMP
+    const auto num_threads = static_cast<size_type>(omp_get_max_threads());
+    // small allocations are touched by the calling thread on first use
+    if (!ptr || num_threads == 1 || num_bytes < parallel_threshold_ ||
+        num_bytes < num_threads * page_size_) {
+        return ptr;
+    }
+    const auto page_size = page_size_;
+#pragma omp parallel
+    {
+        const auto nthreads = static_cast<size_type>(omp_get_num_threads());
+        const auto tid = static_cast<size_type>(omp_get_thread_num());
+        const auto chunk_size = (num_bytes + nthreads - 1) / nthreads;
+        const auto begin = std::min(tid * chunk_size, num_bytes);
+        const auto end = std::min(begin + chunk_size, num_bytes);
+        // touch the first byte of the chunk and of every page starting in it
+        if (begin < end) {
+            ptr[begin] = 0;
+            const auto page_offset =
+                (page_size -
+                 reinterpret_cast<uintptr>(ptr + begin) % page_size) %
+                page_size;
+            for (auto i = begin + page_offset; i < end; i += page_size) {
+                ptr[i] = 0;
+            }
+        }
+    }
+#endif
+    return ptr;
+}
+
+
+void FirstTouchCpuAllocator::deallocate(void* ptr)
+{
+    upstream_->deallocate(ptr);
+}
+
+
+constexpr size_type CachingCpuAllocator::min_block_size;
+
+
+namespace {
+
+
+int get_size_class(size_type num_bytes)
+{
+    int size_class{};
+    while ((CachingCpuAllocator::min_block_size << size_class) < num_bytes) {
+        size_class++;
+    }
+    return size_class;
+}
+
+
+}  // namespace
+
+
+CachingCpuAllocator::CachingCpuAllocator(
+    std::shared_ptr<CpuAllocatorBase> upstream, size_type max_cached_bytes)
+    : upstream_{std::move(upstream)},
+      max_cached_bytes_{max_cached_bytes},
+      cached_bytes_{},
+      num_hits_{},
+      num_misses_{}
+{}
+
+
+CachingCpuAllocator::~CachingCpuAllocator() { this->release_cached(); }
+
+
+void* CachingCpuAllocator::allocate(size_type num_bytes)
+{
+    const auto size_class = get_size_class(num_bytes);
+    const auto block_size = min_block_size << size_class;
+    {
+        std::lock_guard<std::mutex> guard{mutex_};
+        if (size_class < static_cast<int>(free_blocks_.size()) &&
+            !free_blocks_[size_class].empty()) {
+            const auto ptr = free_blocks_[size_class].back();
+            free_blocks_[size_class].pop_back();
+            cached_bytes_ -= block_size;
+            num_hits_++;
+            block_classes_[ptr] = size_class;
+            return ptr;
+        }
+        num_misses_++;
+    }
+    this->log<log::Logger::allocation_started>(
+        static_cast<const Executor*>(nullptr), block_size);
+    const auto ptr = upstream_->allocate(block_size);
+    this->log<log::Logger::allocation_completed>(
+        static_cast<const Executor*>(nullptr), block_size,
+        reinterpret_cast<uintptr>(ptr));
+    if (ptr) {
+        std::lock_guard<std::mutex> guard{mutex_};
+        block_classes_[ptr] = size_class;
+    }
+    return ptr;
+}
+
+
+void CachingCpuAllocator::deallocate(void* ptr)
+{
+    if (!ptr) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> guard{mutex_};
+        const auto it = block_classes_.find(ptr);
+        if (it == block_classes_.end()) {
+            // the block was not allocated by this pool
+            upstream_->deallocate(ptr);
+            return;
+        }
+        const auto size_class = it->second;
+        const auto block_size = min_block_size << size_class;
+        block_classes_.erase(it);
+        if (cached_bytes_ + block_size <= max_cached_bytes_) {
+            if (size_class >= static_cast<int>(free_blocks_.size())) {
+                free_blocks_.resize(size_class + 1);
+            }
+            free_blocks_[size_class].push_back(ptr);
+            cached_bytes_ += block_size;
+            return;
+        }
+    }
+    this->upstream_deallocate(ptr);
+}
+
+
+void CachingCpuAllocator::release_cached()
+{
+    std::vector<std::vector<void*>> free_blocks;
+    {
+        std::lock_guard<std::mutex> guard{mutex_};
+        std::swap(free_blocks, free_blocks_);
+        cached_bytes_ = 0;
+    }
+    for (const auto& blocks : free_blocks) {
+        for (const auto ptr : blocks) {
+            this->upstream_deallocate(ptr);
+        }
+    }
+}
+
+
+size_type CachingCpuAllocator::get_num_hits() const
+{
+    std::lock_guard<std::mutex> guard{mutex_};
+    return num_hits_;
+}
+
+
+size_type CachingCpuAllocator::get_num_misses() const
+{
+    std::lock_guard<std::mutex> guard{mutex_};
+    return num_misses_;
+}
+
+
+size_type CachingCpuAllocator::get_cached_bytes() const
+{
+    std::lock_guard<std::mutex> guard{mutex_};
+    return cached_bytes_;
+}
+
+
+void CachingCpuAllocator::upstream_deallocate(void* ptr)
+{
+    this->log<log::Logger::free_started>(
+        static_cast<const Executor*>(nullptr), reinterpret_cast<uintptr>(ptr));
+    upstream_->deallocate(ptr);
+    this->log<log::Logger::free_completed>(
+        static_cast<const Executor*>(nullptr), reinterpret_cast<uintptr>(ptr));
+}
+
+
+}  // namespace gko
@@ -128,6 +128,17 @@ GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
     GKO_DECLARE_PGM_COMPUTE_COARSE_COO);
 
 
+template <typename ValueType, typename IndexType>
+void compute_coarse_csr(std::shared_ptr<const DefaultExecutor> exec,
+                        const matrix::Csr<ValueType, IndexType>* fine,
+                        const array<IndexType>& agg,
+                        matrix::Csr<ValueType, IndexType>* coarse)
+    GKO_NOT_IMPLEMENTED;
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_PGM_COMPUTE_COARSE_CSR);
+
+
 }  // namespace pgm
 }  // namespace dpcpp
 }  // namespace kernels
@@ -754,7 +754,8 @@ void check_arnoldi_norms(
     size_type stride_hessenberg, size_type iter, Accessor3d krylov_bases,
     const stopping_status* __restrict__ stop_status,
     stopping_status* __restrict__ reorth_status,
-    size_type* __restrict__ num_reorth, sycl::nd_item<3> item_ct1)
+    size_type* __restrict__ num_reorth, bool always_reorth,
+    sycl::nd_item<3> item_ct1)
 {
     const remove_complex<ValueType> eta_squared = 1.0 / 2.0;
     const auto col_idx = thread::get_thread_id_flat(item_ct1);
@@ -766,7 +767,7 @@ void check_arnoldi_norms(
         const auto num11 = std::sqrt(arnoldi_norm[col_idx + stride_norm]);
         const auto num2 = has_scalar ? (arnoldi_norm[col_idx + 2 * stride_norm])
                                      : remove_complex<ValueType>{};
-        if (num11 < num0) {
+        if (always_reorth || num11 < num0) {
             reorth_status[col_idx].reset();
             atomic_add(num_reorth, one<size_type>());
         } else {
@@ -788,7 +789,8 @@ void check_arnoldi_norms(dim3 grid, dim3 block, size_type dynamic_shared_memory,
                          size_type stride_hessenberg, size_type iter,
                          Accessor3d krylov_bases,
                          const stopping_status* stop_status,
-                         stopping_status* reorth_status, size_type* num_reorth)
+                         stopping_status* reorth_status, size_type* num_reorth,
+                         bool always_reorth)
 {
     queue->submit([&](sycl::handler& cgh) {
         cgh.parallel_for(
@@ -796,7 +798,7 @@ void check_arnoldi_norms(dim3 grid, dim3 block, size_type dynamic_shared_memory,
                 check_arnoldi_norms<block_size>(
                     num_rhs, arnoldi_norm, stride_norm, hessenberg_iter,
                     stride_hessenberg, iter, krylov_bases, stop_status,
-                    reorth_status, num_reorth, item_ct1);
+                    reorth_status, num_reorth, always_reorth, item_ct1);
             });
     });
 }
@@ -1061,7 +1063,8 @@ void finish_arnoldi_CGS(std::shared_ptr<const DpcppExecutor> exec,
                         matrix::Dense<remove_complex<ValueType>>* arnoldi_norm,
                         size_type iter, const stopping_status* stop_status,
                         stopping_status* reorth_status,
-                        array<size_type>* num_reorth)
+                        array<size_type>* num_reorth,
+                        solver::gmres::ortho_method ortho)
 {
     const auto dim_size = next_krylov_basis->get_size();
     if (dim_size[1] == 0) {
@@ -1089,6 +1092,12 @@ void finish_arnoldi_CGS(std::shared_ptr<const DpcppExecutor> exec,
                                       iter + 1);
     const dim3 block_size_iters_single(singledot_block_size);
     size_type num_reorth_host;
+    // cgs2 always reorthogonalizes once, cgs_conditional up to two times if
+    // the norm dropped by more than 1 / sqrt(2)
+    const bool always_reorth = ortho == solver::gmres::ortho_method::cgs2;
+    const size_type max_reorth = ortho == solver::gmres::ortho_method::cgs
+                                     ? 0
+                                     : (always_reorth ? 1 : 2);
 
     components::fill_array(exec, arnoldi_norm->get_values(), dim_size[1],
                            zero<non_complex>());
@@ -1144,10 +1153,10 @@ void finish_arnoldi_CGS(std::shared_ptr<const DpcppExecutor> exec,
         exec->get_queue(), dim_size[1], arnoldi_norm->get_values(),
         stride_arnoldi, hessenberg_iter->get_values(), stride_hessenberg,
         iter + 1, krylov_bases, stop_status, reorth_status,
-        num_reorth->get_data());
+        num_reorth->get_data(), always_reorth);
     num_reorth_host = exec->copy_val_to_host(num_reorth->get_const_data());
     // num_reorth_host := number of next_krylov vector to be reorthogonalization
-    for (size_type l = 1; (num_reorth_host > 0) && (l < 3); l++) {
+    for (size_type l = 0; (num_reorth_host > 0) && (l < max_reorth); l++) {
         zero_matrix(exec, iter + 1, dim_size[1], stride_buffer,
                     buffer_iter->get_values());
         if (dim_size[1] > 1) {
@@ -1198,7 +1207,7 @@ void finish_arnoldi_CGS(std::shared_ptr<const DpcppExecutor> exec,
             exec->get_queue(), dim_size[1], arnoldi_norm->get_values(),
             stride_arnoldi, hessenberg_iter->get_values(), stride_hessenberg,
             iter + 1, krylov_bases, stop_status, reorth_status,
-            num_reorth->get_data());
+            num_reorth->get_data(), always_reorth);
         num_reorth_host = exec->copy_val_to_host(num_reorth->get_const_data());
     }
 
@@ -1253,7 +1262,7 @@ void arnoldi(std::shared_ptr<const DpcppExecutor> exec,
              size_type iter, array<size_type>* final_iter_nums,
              const array<stopping_status>* stop_status,
              array<stopping_status>* reorth_status,
-             array<size_type>* num_reorth)
+             array<size_type>* num_reorth, solver::gmres::ortho_method ortho)
 {
     increase_final_iteration_numbers_kernel(
         static_cast<unsigned int>(
@@ -1263,7 +1272,7 @@ void arnoldi(std::shared_ptr<const DpcppExecutor> exec,
     finish_arnoldi_CGS(exec, next_krylov_basis, krylov_bases, hessenberg_iter,
                        buffer_iter, arnoldi_norm, iter,
                        stop_status->get_const_data(), reorth_status->get_data(),
-                       num_reorth);
+                       num_reorth, ortho);
     givens_rotation(exec, givens_sin, givens_cos, hessenberg_iter,
                     residual_norm, residual_norm_collection, iter, stop_status);
 }
@@ -201,7 +201,8 @@ void finish_arnoldi_CGS(std::shared_ptr<const HipExecutor> exec,
                         matrix::Dense<remove_complex<ValueType>>* arnoldi_norm,
                         size_type iter, const stopping_status* stop_status,
                         stopping_status* reorth_status,
-                        array<size_type>* num_reorth)
+                        array<size_type>* num_reorth,
+                        solver::gmres::ortho_method ortho)
 {
     const auto dim_size = next_krylov_basis->get_size();
     if (dim_size[1] == 0) {
@@ -229,6 +230,12 @@ void finish_arnoldi_CGS(std::shared_ptr<const HipExecutor> exec,
                                       iter + 1);
     const auto block_size_iters_single = singledot_block_size;
     size_type num_reorth_host;
+    // cgs2 always reorthogonalizes once, cgs_conditional up to two times if
+    // the norm dropped by more than 1 / sqrt(2)
+    const bool always_reorth = ortho == solver::gmres::ortho_method::cgs2;
+    const size_type max_reorth = ortho == solver::gmres::ortho_method::cgs
+                                     ? 0
+                                     : (always_reorth ? 1 : 2);
 
     components::fill_array(exec, arnoldi_norm->get_values(), dim_size[1],
                            zero<non_complex>());
@@ -294,10 +301,11 @@ void finish_arnoldi_CGS(std::shared_ptr<const HipExecutor> exec,
         dim_size[1], as_hip_type(arnoldi_norm->get_values()), stride_arnoldi,
         as_hip_type(hessenberg_iter->get_values()), stride_hessenberg, iter + 1,
         acc::as_hip_range(krylov_bases), as_hip_type(stop_status),
-        as_hip_type(reorth_status), as_hip_type(num_reorth->get_data()));
+        as_hip_type(reorth_status), as_hip_type(num_reorth->get_data()),
+        always_reorth);
     num_reorth_host = exec->copy_val_to_host(num_reorth->get_const_data());
     // num_reorth_host := number of next_krylov vector to be reorthogonalization
-    for (size_type l = 1; (num_reorth_host > 0) && (l < 3); l++) {
+    for (size_type l = 0; (num_reorth_host > 0) && (l < max_reorth); l++) {
         zero_matrix(iter + 1, dim_size[1], stride_buffer,
                     buffer_iter->get_values());
         if (dim_size[1] > 1) {
@@ -358,7 +366,7 @@ void finish_arnoldi_CGS(std::shared_ptr<const HipExecutor> exec,
             stride_arnoldi, as_hip_type(hessenberg_iter->get_values()),
             stride_hessenberg, iter + 1, acc::as_hip_range(krylov_bases),
             as_hip_type(stop_status), as_hip_type(reorth_status),
-            as_hip_type(num_reorth->get_data()));
+            as_hip_type(num_reorth->get_data()), always_reorth);
         num_reorth_host = exec->copy_val_to_host(num_reorth->get_const_data());
         // num_reorth_host := number of next_krylov vector to be
         // reorthogonalization
@@ -419,7 +427,7 @@ void arnoldi(std::shared_ptr<const HipExecutor> exec,
              size_type iter, array<size_type>* final_iter_nums,
              const array<stopping_status>* stop_status,
              array<stopping_status>* reorth_status,
-             array<size_type>* num_reorth)
+             array<size_type>* num_reorth, solver::gmres::ortho_method ortho)
 {
     hipLaunchKernelGGL(
         increase_final_iteration_numbers_kernel,
@@ -431,7 +439,7 @@ void arnoldi(std::shared_ptr<const HipExecutor> exec,
     finish_arnoldi_CGS(exec, next_krylov_basis, krylov_bases, hessenberg_iter,
                        buffer_iter, arnoldi_norm, iter,
                        stop_status->get_const_data(), reorth_status->get_data(),
-                       num_reorth);
+                       num_reorth, ortho);
     givens_rotation(exec, givens_sin, givens_cos, hessenberg_iter,
                     residual_norm, residual_norm_collection, iter, stop_status);
 }
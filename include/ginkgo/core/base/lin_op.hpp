@@ -714,6 +714,38 @@ private:
 };
 
 
+/**
+ * Linear operators which represent a batch of independent operators of the
+ * same size should implement the Batched interface.
+ *
+ * Such an operator acts as the block-diagonal operator built from its batch
+ * items: item `i` maps rows `[i * n, (i + 1) * n)` of the input vectors to the
+ * same rows of the output vectors, where `n` is the number of rows of the
+ * common size. The vectors of all items are thus stored back to back in a
+ * single Dense matrix.
+ *
+ * @ingroup LinOp
+ */
+class Batched {
+public:
+    virtual ~Batched() = default;
+
+    /**
+     * Returns the number of batch items.
+     *
+     * @return the number of batch items
+     */
+    virtual size_type get_num_batch_items() const = 0;
+
+    /**
+     * Returns the size shared by all batch items.
+     *
+     * @return the size of each batch item
+     */
+    virtual dim<2> get_common_size() const = 0;
+};
+
+
 /**
  * The diagonal of a LinOp can be extracted. It will be implemented by
  * DiagonalExtractable<ValueType>, so the class does not need to implement it.
@@ -260,6 +260,19 @@ public:
         hwloc_binding_helper(this->pus_, ids, singlify);
     }
 
+    /**
+     * Binds each thread of the OpenMP thread pool to a single core. Thread i
+     * is bound to core i modulo the number of cores, such that the threads
+     * are spread compactly over the cores in the order of their logical ids,
+     * i.e. filling one NUMA node after another.
+     *
+     * Together with the FirstTouchCpuAllocator, this keeps the data a thread
+     * works on in OpenMP kernels on the NUMA node the thread is running on.
+     *
+     * @note This has no effect if Ginkgo was built without OpenMP or hwloc.
+     */
+    void bind_omp_threads_to_cores() const;
+
     /**
      * Bind to a Processing unit (PU)
      *
@@ -345,12 +358,13 @@ public:
     /**
      * @internal
      *
-     * A helper function that binds the calling process with the ids of `obj`
-     * object .
+     * A helper function that binds the calling process (or only the calling
+     * thread if `bind_thread` is set) with the ids of `obj` object .
      */
     void hwloc_binding_helper(
         const std::vector<machine_topology::normal_obj_info>& obj,
-        const std::vector<int>& ids, const bool singlify = true) const;
+        const std::vector<int>& ids, const bool singlify = true,
+        const bool bind_thread = false) const;
 
     /**
      * @internal
@@ -0,0 +1,275 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2022, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#ifndef GKO_PUBLIC_CORE_BASE_MEMORY_HPP_
+#define GKO_PUBLIC_CORE_BASE_MEMORY_HPP_
+
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/log/logger.hpp>
+
+
+namespace gko {
+
+
+/**
+ * Provides generic allocation and deallocation functionality to be used by an
+ * Executor.
+ */
+class Allocator {
+public:
+    virtual ~Allocator() = default;
+
+    /**
+     * Allocates a block of memory.
+     *
+     * @param num_bytes  the size of the block in bytes
+     *
+     * @return a pointer to the allocated memory, or nullptr if the allocation
+     *         failed.
+     */
+    virtual void* allocate(size_type num_bytes) = 0;
+
+    /**
+     * Deallocates a block of memory previously returned by allocate.
+     *
+     * @param ptr  the pointer to the memory, may be nullptr.
+     */
+    virtual void deallocate(void* ptr) = 0;
+};
+
+
+/**
+ * Implement this interface to provide an allocator for OmpExecutor or
+ * ReferenceExecutor.
+ */
+class CpuAllocatorBase : public Allocator {};
+
+
+/**
+ * Allocator using std::malloc and std::free.
+ */
+class CpuAllocator : public CpuAllocatorBase {
+public:
+    void* allocate(size_type num_bytes) override;
+
+    void deallocate(void* ptr) override;
+};
+
+
+/**
+ * Allocator returning memory aligned to a fixed boundary, e.g. a cache line
+ * to avoid false sharing and split vector loads, or a huge page to reduce TLB
+ * misses for large arrays. For huge page alignment, the operating system is
+ * additionally advised to back the allocation with transparent huge pages,
+ * if it supports them.
+ */
+class AlignedCpuAllocator : public CpuAllocatorBase {
+public:
+    /** The size of a cache line on most current CPUs. */
+    static constexpr size_type cache_line_alignment = 64;
+
+    /** The size of a huge page on x86-64 and most ARM systems. */
+    static constexpr size_type huge_page_alignment = 2 * 1024 * 1024;
+
+    /**
+     * Creates an AlignedCpuAllocator.
+     *
+     * @param alignment  the alignment of all allocations in bytes. It is
+     *                   rounded up to the next power of two that is at least
+     *                   the size of a pointer.
+     */
+    explicit AlignedCpuAllocator(size_type alignment = cache_line_alignment);
+
+    void* allocate(size_type num_bytes) override;
+
+    void deallocate(void* ptr) override;
+
+    /** Returns the alignment of all allocations in bytes. */
+    size_type get_alignment() const noexcept { return alignment_; }
+
+private:
+    size_type alignment_;
+};
+
+
+/**
+ * Allocator that places new memory on the NUMA nodes of the OpenMP threads
+ * that work on it. Operating systems usually map a page of memory to the NUMA
+ * node of the thread that first writes to it. This allocator thus touches the
+ * pages of each new allocation in parallel, with a static partitioning of the
+ * allocation into one contiguous chunk per thread. This matches the static
+ * partitioning of the rows in the OpenMP kernels, so vectors and matrices
+ * are mostly accessed from the NUMA node they reside on. For best results,
+ * the threads should be bound to cores, e.g. using
+ * machine_topology::bind_omp_threads_to_cores.
+ *
+ * Allocations smaller than a threshold are left to be touched by the calling
+ * thread, since their placement hardly matters and a parallel region would
+ * dominate the cost of the allocation. If the upstream allocator is an
+ * AlignedCpuAllocator with huge page alignment, a page can only be placed on
+ * a single NUMA node, so the pages are only touched in parallel if every
+ * thread's chunk spans at least one huge page.
+ *
+ * @note If Ginkgo was built without OpenMP, the pages are left to be touched
+ *       by the calling thread.
+ */
+class FirstTouchCpuAllocator : public CpuAllocatorBase {
+public:
+    /** The default size of the smallest allocation touched in parallel. */
+    static constexpr size_type default_parallel_threshold = 1024 * 1024;
+
+    /**
+     * Creates a FirstTouchCpuAllocator.
+     *
+     * @param upstream  the allocator used to allocate the memory. It should
+     *                  not touch the allocated memory itself.
+     * @param parallel_threshold  the size in bytes of the smallest allocation
+     *                            whose pages are touched in parallel.
+     */
+    explicit FirstTouchCpuAllocator(
+        std::shared_ptr<CpuAllocatorBase> upstream =
+            std::make_shared<AlignedCpuAllocator>(),
+        size_type parallel_threshold = default_parallel_threshold);
+
+    void* allocate(size_type num_bytes) override;
+
+    void deallocate(void* ptr) override;
+
+    /** Returns the underlying allocator. */
+    std::shared_ptr<CpuAllocatorBase> get_upstream() const { return upstream_; }
+
+    /**
+     * Returns the size in bytes of the smallest allocation whose pages are
+     * touched in parallel.
+     */
+    size_type get_parallel_threshold() const noexcept
+    {
+        return parallel_threshold_;
+    }
+
+private:
+    std::shared_ptr<CpuAllocatorBase> upstream_;
+    size_type parallel_threshold_;
+    // the granularity at which the upstream memory is mapped to NUMA nodes
+    size_type page_size_;
+};
+
+
+/**
+ * Allocator that caches deallocated blocks and reuses them for later
+ * allocations of the same size class, instead of returning them to the
+ * underlying allocator. The size classes are the powers of two, starting at
+ * min_block_size bytes.
+ *
+ * This avoids repeated allocations of the workspace, temporary vectors and
+ * communication buffers that are created in every apply call. All
+ * allocations that cannot be served from the cache (misses) and all
+ * deallocations on the underlying allocator are reported to the loggers of
+ * the pool as allocation_started, allocation_completed, free_started and
+ * free_completed events without an associated executor. Allocations that
+ * are served from the cache (hits) are only reported by the executor using
+ * the pool.
+ *
+ * The cached memory is only released when the pool is destroyed or
+ * release_cached is called.
+ */
+class CachingCpuAllocator : public CpuAllocatorBase,
+                            public log::EnableLogging<CachingCpuAllocator> {
+public:
+    /** The size of the smallest size class in bytes. */
+    static constexpr size_type min_block_size = 64;
+
+    /**
+     * Creates a CachingCpuAllocator.
+     *
+     * @param upstream  the allocator used to allocate new blocks
+     * @param max_cached_bytes  the maximum total size of all blocks kept in
+     *                          the cache. Deallocated blocks that would exceed
+     *                          this limit are returned to the upstream
+     *                          allocator.
+     */
+    explicit CachingCpuAllocator(
+        std::shared_ptr<CpuAllocatorBase> upstream =
+            std::make_shared<CpuAllocator>(),
+        size_type max_cached_bytes = ~size_type{});
+
+    ~CachingCpuAllocator() override;
+
+    void* allocate(size_type num_bytes) override;
+
+    void deallocate(void* ptr) override;
+
+    /**
+     * Returns all cached blocks to the upstream allocator.
+     */
+    void release_cached();
+
+    /** Returns the number of allocations that were served from the cache. */
+    size_type get_num_hits() const;
+
+    /** Returns the number of allocations that needed a new block. */
+    size_type get_num_misses() const;
+
+    /** Returns the total size of all cached blocks in bytes. */
+    size_type get_cached_bytes() const;
+
+    /** Returns the underlying allocator. */
+    std::shared_ptr<CpuAllocatorBase> get_upstream() const { return upstream_; }
+
+private:
+    void upstream_deallocate(void* ptr);
+
+    std::shared_ptr<CpuAllocatorBase> upstream_;
+    size_type max_cached_bytes_;
+    mutable std::mutex mutex_;
+    // size class of each block handed out by this allocator
+    std::unordered_map<void*, int> block_classes_;
+    // cached blocks for each size class
+    std::vector<std::vector<void*>> free_blocks_;
+    size_type cached_bytes_;
+    size_type num_hits_;
+    size_type num_misses_;
+};
+
+
+}  // namespace gko
+
+
+#endif  // GKO_PUBLIC_CORE_BASE_MEMORY_HPP_
@@ -35,12 +35,23 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 
 #include <istream>
+#include <memory>
+#include <string>
 
 
+#include <ginkgo/core/base/device_matrix_data.hpp>
 #include <ginkgo/core/base/matrix_data.hpp>
 
 
 namespace gko {
+namespace matrix {
+
+
+template <typename ValueType, typename IndexType>
+class Csr;
+
+
+}  // namespace matrix
 
 
 /**
@@ -61,6 +72,58 @@ template <typename ValueType = default_precision, typename IndexType = int32>
 matrix_data<ValueType, IndexType> read_raw(std::istream& is);
 
 
+/**
+ * Reads a matrix stored in matrix market format from an input stream, using
+ * multiple threads.
+ *
+ * The whole stream is read into memory and split into chunks of complete
+ * lines, which are parsed in parallel and merged in the end. This requires
+ * every entry of the matrix to be stored on a separate line, as mandated by
+ * the matrix market format. Otherwise, the result is the same as for
+ * read_raw(std::istream&).
+ *
+ * @tparam ValueType  type of matrix values
+ * @tparam IndexType  type of matrix indexes
+ *
+ * @param is  input stream from which to read the data
+ * @param num_threads  the number of threads to use. If it is 0, the number of
+ *                     hardware threads is used, but small inputs are parsed
+ *                     with fewer threads.
+ *
+ * @return A matrix_data structure containing the matrix. The nonzero elements
+ *         are sorted in lexicographic order of their (row, column) indexes.
+ *
+ * @note This is an advanced routine that will return the raw matrix data
+ *       structure. Consider using gko::read_parallel instead.
+ */
+template <typename ValueType = default_precision, typename IndexType = int32>
+matrix_data<ValueType, IndexType> read_raw_parallel(std::istream& is,
+                                                    size_type num_threads = 0);
+
+
+/**
+ * Reads a matrix stored in matrix market format from a file, using multiple
+ * threads. The file is mapped into memory instead of being read, where the
+ * operating system supports it.
+ *
+ * @see read_raw_parallel(std::istream&, size_type)
+ *
+ * @tparam ValueType  type of matrix values
+ * @tparam IndexType  type of matrix indexes
+ *
+ * @param filename  the name of the file from which to read the data
+ * @param num_threads  the number of threads to use. If it is 0, the number of
+ *                     hardware threads is used, but small inputs are parsed
+ *                     with fewer threads.
+ *
+ * @return A matrix_data structure containing the matrix. The nonzero elements
+ *         are sorted in lexicographic order of their (row, column) indexes.
+ */
+template <typename ValueType = default_precision, typename IndexType = int32>
+matrix_data<ValueType, IndexType> read_raw_parallel(const std::string& filename,
+                                                    size_type num_threads = 0);
+
+
 /**
  * Reads a matrix stored in Ginkgo's binary matrix format from an input stream.
  * Note that this format depends on the processor's endianness,
@@ -96,6 +159,102 @@ template <typename ValueType = default_precision, typename IndexType = int32>
 matrix_data<ValueType, IndexType> read_binary_raw(std::istream& is);
 
 
+/**
+ * Reads a matrix stored in Ginkgo's binary matrix format from a file, by
+ * mapping the file into memory instead of reading it through a stream.
+ *
+ * The entries are unpacked into a device_matrix_data object on the given
+ * executor by the executor's kernels, so this runs in parallel on parallel
+ * executors. If the file was written with the requested value and index type,
+ * the entries are unpacked straight from the mapped file without any
+ * intermediate copy. Otherwise, they are converted on the host first.
+ * The format is described in read_binary_raw(std::istream&).
+ *
+ * @tparam ValueType  type of matrix values
+ * @tparam IndexType  type of matrix indexes
+ *
+ * @param exec  the executor on which the data should be stored
+ * @param filename  the name of the file from which to read the data
+ *
+ * @return A device_matrix_data structure containing the matrix. The nonzero
+ *         elements are sorted in lexicographic order of their (row, column)
+ *         indexes.
+ *
+ * @note This is an advanced routine that will return the raw matrix data
+ *       structure. Consider using gko::read_binary_mapped instead.
+ */
+template <typename ValueType = default_precision, typename IndexType = int32>
+device_matrix_data<ValueType, IndexType> read_binary_mapped_raw(
+    std::shared_ptr<const Executor> exec, const std::string& filename);
+
+
+/**
+ * Reads a matrix stored in Ginkgo's binary matrix format from an input stream
+ * directly into a Csr matrix, without storing the whole list of entries.
+ *
+ * The entries are read in batches of a fixed size and appended to the matrix
+ * by a matrix::CsrStreamBuilder, so besides the matrix itself, only one batch
+ * of entries is held in memory. This requires the entries to be stored in
+ * row-major order, as they are when they were written by
+ * write_binary(StreamType&&, MatrixType*). The format is described in
+ * read_binary_raw(std::istream&).
+ *
+ * @tparam ValueType  type of matrix values
+ * @tparam IndexType  type of matrix indexes
+ *
+ * @param is  input stream from which to read the data
+ * @param exec  the executor on which the matrix should be stored
+ * @param batch_size  the number of entries read in each batch
+ *
+ * @return A Csr matrix containing the entries of the stream.
+ *
+ * @throws UnsupportedMatrixProperty  if the entries are not sorted in
+ *                                    row-major order
+ */
+template <typename ValueType = default_precision, typename IndexType = int32>
+std::unique_ptr<matrix::Csr<ValueType, IndexType>> read_binary_streaming(
+    std::istream& is, std::shared_ptr<const Executor> exec,
+    size_type batch_size = 1 << 16);
+
+
+/**
+ * Reads a Csr matrix stored in Ginkgo's binary CSR format from a file.
+ * Note that this format depends on the processor's endianness,
+ * so files from a big endian processor can't be read from a little endian
+ * processor and vice-versa.
+ *
+ * The binary CSR format has the following structure (in system endianness):
+ * 1. A 32 byte header consisting of 4 uint64_t values:
+ *    magic = GKOCSR__: The highest two bytes stand for value and index type,
+ *                      see read_binary_raw(std::istream&).
+ *    num_rows: Number of rows
+ *    num_cols: Number of columns
+ *    num_entries: Number of stored entries
+ * 2. The num_rows + 1 row pointers stored as IndexType
+ * 3. The num_entries column indexes stored as IndexType
+ * 4. The num_entries values stored as ValueType
+ * Each of the three arrays starts at an offset that is a multiple of 64 bytes,
+ * the gaps before them are filled with zeros.
+ *
+ * The file is mapped into memory and, if `exec` is a host executor, the
+ * matrix uses the mapped arrays directly without copying them. Pages of the
+ * file are only loaded when they are first accessed, and modifications of the
+ * matrix are never written back to the file.
+ *
+ * @tparam ValueType  type of matrix values, has to match the file
+ * @tparam IndexType  type of matrix indexes, has to match the file
+ *
+ * @param exec  the executor on which the matrix should be stored
+ * @param filename  the name of the file from which to read the matrix
+ *
+ * @return A Csr matrix using the row pointers, column indexes and values
+ *         stored in the file.
+ */
+template <typename ValueType = default_precision, typename IndexType = int32>
+std::unique_ptr<matrix::Csr<ValueType, IndexType>> read_binary_csr(
+    std::shared_ptr<const Executor> exec, const std::string& filename);
+
+
 /**
  * Reads a matrix stored in either binary or matrix market format from an input
  * stream.
@@ -194,6 +353,34 @@ inline std::unique_ptr<MatrixType> read(StreamType&& is, MatrixArgs&&... args)
 }
 
 
+/**
+ * Reads a matrix stored in matrix market format from an input stream or a
+ * file, using multiple threads.
+ *
+ * @tparam MatrixType  a ReadableFromMatrixData LinOp type used to store the
+ *                     matrix once it's been read from disk.
+ * @tparam InputType  type of the input, either an input stream or a file name
+ * @tparam MatrixArgs  additional argument types passed to MatrixType
+ *                     constructor
+ *
+ * @param input  input stream or file name from which to read the data
+ * @param args  additional arguments passed to MatrixType constructor
+ *
+ * @return A MatrixType LinOp filled with data from filename
+ *
+ * @see read_raw_parallel
+ */
+template <typename MatrixType, typename InputType, typename... MatrixArgs>
+inline std::unique_ptr<MatrixType> read_parallel(InputType&& input,
+                                                 MatrixArgs&&... args)
+{
+    auto mtx = MatrixType::create(std::forward<MatrixArgs>(args)...);
+    mtx->read(read_raw_parallel<typename MatrixType::value_type,
+                                typename MatrixType::index_type>(input));
+    return mtx;
+}
+
+
 /**
  * Reads a matrix stored in binary format from an input stream.
  *
@@ -219,6 +406,36 @@ inline std::unique_ptr<MatrixType> read_binary(StreamType&& is,
 }
 
 
+/**
+ * Reads a matrix stored in binary format from a file, by mapping the file into
+ * memory.
+ *
+ * @tparam MatrixType  a ReadableFromMatrixData LinOp type used to store the
+ *                     matrix once it's been read from disk.
+ * @tparam MatrixArgs  additional argument types passed to MatrixType
+ *                     constructor
+ *
+ * @param exec  the executor on which the matrix should be stored
+ * @param filename  the name of the file from which to read the data
+ * @param args  additional arguments passed to MatrixType constructor
+ *
+ * @return A MatrixType LinOp filled with data from filename
+ *
+ * @see read_binary_mapped_raw
+ */
+template <typename MatrixType, typename... MatrixArgs>
+inline std::unique_ptr<MatrixType> read_binary_mapped(
+    std::shared_ptr<const Executor> exec, const std::string& filename,
+    MatrixArgs&&... args)
+{
+    auto mtx = MatrixType::create(exec, std::forward<MatrixArgs>(args)...);
+    mtx->read(read_binary_mapped_raw<typename MatrixType::value_type,
+                                     typename MatrixType::index_type>(
+        exec, filename));
+    return mtx;
+}
+
+
 /**
  * Reads a matrix stored either in binary or matrix market format from an input
  * stream.
@@ -358,6 +575,24 @@ inline void write_binary(StreamType&& os, MatrixType* matrix)
 }
 
 
+/**
+ * Writes a Csr matrix into an output stream in binary CSR format, which can be
+ * read without any conversion by read_binary_csr.
+ * Note that this format depends on the processor's endianness,
+ * so files from a big endian processor can't be read from a little endian
+ * processor and vice-versa.
+ *
+ * @tparam ValueType  type of matrix values
+ * @tparam IndexType  type of matrix indexes
+ *
+ * @param os  output stream where the data is to be written
+ * @param matrix  the matrix to write
+ */
+template <typename ValueType, typename IndexType>
+void write_binary_csr(std::ostream& os,
+                      const matrix::Csr<ValueType, IndexType>* matrix);
+
+
 }  // namespace gko
 
 
@@ -33,6 +33,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <memory>
 
 
+#include <ginkgo/core/base/array.hpp>
 #include <ginkgo/core/base/composition.hpp>
 #include <ginkgo/core/base/lin_op.hpp>
 #include <ginkgo/core/base/polymorphic_object.hpp>
@@ -52,6 +53,10 @@ namespace factorization {
  * matrix::Csr format. If no symbolic factorization is provided, it will be
  * computed first.
  *
+ * When many matrices with the same sparsity pattern need to be factorized,
+ * the symbolic phase can be computed only once using generate_symbolic, and
+ * each matrix can then be factorized numerically using generate_numeric.
+ *
  * @tparam ValueType  the type used to store values of the system matrix
  * @tparam IndexType  the type used to store sparsity pattern indices of the
  *                    system matrix
@@ -115,6 +120,68 @@ public:
     std::unique_ptr<factorization_type> generate(
         std::shared_ptr<const LinOp> system_matrix) const;
 
+    /**
+     * The result of the symbolic phase of the factorization: the combined
+     * sparsity pattern L + U of the factors together with the lookup structure
+     * used to locate entries of the factors during the numerical
+     * factorization. Since it only depends on the sparsity pattern of the
+     * system matrix, it can be reused to factorize any number of matrices
+     * sharing this sparsity pattern, e.g. inside of a Newton iteration.
+     */
+    class symbolic_type {
+        friend class Lu;
+
+    public:
+        /** Returns the combined sparsity pattern L + U of the factors. */
+        std::shared_ptr<const sparsity_pattern_type> get_pattern() const
+        {
+            return pattern_;
+        }
+
+    private:
+        explicit symbolic_type(std::shared_ptr<const Executor> exec)
+            : storage_offsets_{exec}, row_descs_{exec}, storage_{exec}
+        {}
+
+        std::shared_ptr<const sparsity_pattern_type> pattern_;
+        array<index_type> storage_offsets_;
+        array<int64> row_descs_;
+        array<int32> storage_;
+    };
+
+    /**
+     * Computes the symbolic factorization of the given matrix, i.e. the
+     * sparsity pattern of the factors and the lookup structure used by the
+     * numerical factorization. If the `symbolic_factorization` parameter is
+     * set, it is used as the sparsity pattern of the factors.
+     *
+     * @param system_matrix  the matrix whose sparsity pattern is analyzed
+     *
+     * @return  the symbolic factorization, which can be passed to
+     *          generate_numeric for all matrices with this sparsity pattern.
+     */
+    std::shared_ptr<const symbolic_type> generate_symbolic(
+        std::shared_ptr<const LinOp> system_matrix) const;
+
+    /**
+     * Computes the numerical factorization of the given matrix based on a
+     * previously computed symbolic factorization. Neither the sparsity pattern
+     * of the factors nor the lookup structure are recomputed, which makes
+     * repeated refactorizations of matrices with an unchanged sparsity pattern
+     * significantly cheaper than calling generate().
+     *
+     * @param symbolic  the symbolic factorization computed by
+     *                  generate_symbolic
+     * @param system_matrix  the matrix to factorize. Its sparsity pattern must
+     *                       be contained in the pattern of `symbolic`,
+     *                       otherwise the results are undefined.
+     *
+     * @return  the Factorization storing the combined L and U factors.
+     */
+    std::unique_ptr<factorization_type> generate_numeric(
+        const symbolic_type* symbolic,
+        std::shared_ptr<const LinOp> system_matrix) const;
+
     /** Creates a new parameter_type to set up the factory. */
     static parameters_type build() { return {}; }
 
@@ -118,6 +118,21 @@ public:
         }
     }
 
+    /**
+     * Recomputes the factors for a matrix with the same sparsity pattern as
+     * the matrix this factorization was generated from, but different values.
+     * The sparsity pattern of the factor is reused, and the fixed-point
+     * iterations are started from the current factor instead of the system
+     * matrix, which gives a more accurate factor for slowly changing values.
+     *
+     * @param system_matrix  the matrix to factorize. Its sparsity pattern
+     *                       must match the one of the original system matrix.
+     *
+     * @return  a new ParIc containing the factors of system_matrix
+     */
+    std::unique_ptr<ParIc> refactorize(
+        std::shared_ptr<const LinOp> system_matrix) const;
+
     // Remove the possibility of calling `create`, which was enabled by
     // `Composition`
     template <typename... Args>
@@ -116,6 +116,21 @@ public:
             this->get_operators()[1]);
     }
 
+    /**
+     * Recomputes the factors for a matrix with the same sparsity pattern as
+     * the matrix this factorization was generated from, but different values.
+     * The sparsity patterns of the factors are reused, and the fixed-point
+     * iterations are started from the current factors instead of the system
+     * matrix, which gives more accurate factors for slowly changing values.
+     *
+     * @param system_matrix  the matrix to factorize. Its sparsity pattern
+     *                       must match the one of the original system matrix.
+     *
+     * @return  a new ParIlu containing the factors of system_matrix
+     */
+    std::unique_ptr<ParIlu> refactorize(
+        std::shared_ptr<const LinOp> system_matrix) const;
+
     // Remove the possibility of calling `create`, which was enabled by
     // `Composition`
     template <typename... Args>
@@ -118,6 +118,21 @@ public:
             this->get_operators()[1]);
     }
 
+    /**
+     * Recomputes the factors for a matrix with the same sparsity pattern as
+     * the matrix this factorization was generated from, but different values.
+     * The sparsity patterns of the factors are kept fixed, i.e. no candidates
+     * are added or removed, and only `iterations` fixed-point sweeps are
+     * executed on the current factors.
+     *
+     * @param system_matrix  the matrix to factorize. Its sparsity pattern
+     *                       must match the one of the original system matrix.
+     *
+     * @return  a new ParIlut containing the factors of system_matrix
+     */
+    std::unique_ptr<ParIlut> refactorize(
+        std::shared_ptr<const LinOp> system_matrix) const;
+
     // Remove the possibility of calling `create`, which was enabled by
     // `Composition`
     template <typename... Args>
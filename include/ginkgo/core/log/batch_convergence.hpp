@@ -0,0 +1,129 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2022, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#ifndef GKO_PUBLIC_CORE_LOG_BATCH_CONVERGENCE_HPP_
+#define GKO_PUBLIC_CORE_LOG_BATCH_CONVERGENCE_HPP_
+
+
+#include <memory>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/log/logger.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+
+namespace gko {
+namespace log {
+
+
+/**
+ * BatchConvergence is a Logger which logs the results of batched solvers from
+ * the `batch_solver_completed` event. It gives access to the number of
+ * iterations and the final residual norm of every system in the batch.
+ *
+ * @tparam ValueType  the value type of the batched solver
+ *
+ * @ingroup log
+ */
+template <typename ValueType = default_precision>
+class BatchConvergence : public Logger {
+public:
+    using real_type = remove_complex<ValueType>;
+
+    void on_batch_solver_completed(
+        const LinOp* solver, const array<int32>* num_iterations,
+        const LinOp* residual_norms) const override;
+
+    /**
+     * Creates a batch convergence logger. This dynamically allocates the
+     * memory, constructs the object and returns an std::unique_ptr to this
+     * object.
+     *
+     * @param enabled_events  the events enabled for this logger. By default all
+     *                        events.
+     *
+     * @return an std::unique_ptr to the the constructed object
+     */
+    static std::unique_ptr<BatchConvergence> create(
+        const mask_type& enabled_events = Logger::batch_solver_completed_mask)
+    {
+        return std::unique_ptr<BatchConvergence>(
+            new BatchConvergence(enabled_events));
+    }
+
+    /**
+     * Returns the number of iterations of each system and right-hand side,
+     * stored item-major.
+     *
+     * @return the number of iterations
+     */
+    const array<int32>& get_num_iterations() const noexcept
+    {
+        return num_iterations_;
+    }
+
+    /**
+     * Returns the final residual norms, one row per system and one column per
+     * right-hand side.
+     *
+     * @return the residual norms
+     */
+    const matrix::Dense<real_type>* get_residual_norms() const noexcept
+    {
+        return residual_norms_.get();
+    }
+
+protected:
+    /**
+     * Creates a BatchConvergence logger.
+     *
+     * @param enabled_events  the events enabled for this logger. By default
+     *                        only the batch_solver_completed event.
+     */
+    explicit BatchConvergence(
+        const mask_type& enabled_events = Logger::batch_solver_completed_mask)
+        : Logger(enabled_events)
+    {}
+
+private:
+    mutable array<int32> num_iterations_{};
+    mutable std::unique_ptr<matrix::Dense<real_type>> residual_norms_{};
+};
+
+
+}  // namespace log
+}  // namespace gko
+
+
+#endif  // GKO_PUBLIC_CORE_LOG_BATCH_CONVERGENCE_HPP_
@@ -483,6 +483,20 @@ public:
                               const PolymorphicObject* input,
                               const PolymorphicObject* output)
 
+    /**
+     * Batched solver completed event. It is logged once per solver
+     * application and reports the results of all systems in the batch.
+     *
+     * @param solver  the batched solver
+     * @param num_iterations  the number of iterations performed for each
+     *                        system and right-hand side, stored item-major
+     * @param residual_norms  the final residual norms, a Dense matrix with one
+     *                        row per system and one column per right-hand side
+     */
+    GKO_LOGGER_REGISTER_EVENT(24, batch_solver_completed, const LinOp* solver,
+                              const array<int32>* num_iterations,
+                              const LinOp* residual_norms)
+
 #undef GKO_LOGGER_REGISTER_EVENT
 
     /**
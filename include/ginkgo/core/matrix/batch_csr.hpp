@@ -0,0 +1,319 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2022, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#ifndef GKO_PUBLIC_CORE_MATRIX_BATCH_CSR_HPP_
+#define GKO_PUBLIC_CORE_MATRIX_BATCH_CSR_HPP_
+
+
+#include <vector>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/lin_op.hpp>
+#include <ginkgo/core/base/matrix_data.hpp>
+
+
+namespace gko {
+namespace matrix {
+
+
+template <typename ValueType, typename IndexType>
+class Csr;
+
+
+/**
+ * BatchCsr stores a batch of CSR matrices which all share the same sparsity
+ * pattern. The row pointers and column indices are stored only once, while
+ * the values of the batch items are stored back to back, i.e. the values of
+ * item `i` start at `get_values() + i * get_num_stored_elements_per_item()`.
+ *
+ * As a LinOp, BatchCsr represents the block-diagonal matrix formed by its
+ * batch items, see Batched. Applying it to a Dense vector with
+ * `get_num_batch_items() * get_common_size()[1]` rows computes all batch
+ * SpMVs at once.
+ *
+ * @tparam ValueType  precision of matrix elements
+ * @tparam IndexType  precision of matrix indexes, only int32 is supported
+ *
+ * @ingroup batch_csr
+ * @ingroup mat_formats
+ * @ingroup LinOp
+ */
+template <typename ValueType = default_precision, typename IndexType = int32>
+class BatchCsr : public EnableLinOp<BatchCsr<ValueType, IndexType>>,
+                 public EnableCreateMethod<BatchCsr<ValueType, IndexType>>,
+                 public Batched {
+    friend class EnableCreateMethod<BatchCsr>;
+    friend class EnablePolymorphicObject<BatchCsr, LinOp>;
+
+public:
+    using value_type = ValueType;
+    using index_type = IndexType;
+    using mat_data = matrix_data<ValueType, IndexType>;
+    using unbatch_type = Csr<ValueType, IndexType>;
+
+    size_type get_num_batch_items() const override { return num_batch_items_; }
+
+    dim<2> get_common_size() const override { return common_size_; }
+
+    /**
+     * Returns the values of all batch items.
+     *
+     * @return the values of all batch items.
+     */
+    value_type* get_values() noexcept { return values_.get_data(); }
+
+    /**
+     * @copydoc BatchCsr::get_values()
+     *
+     * @note This is the constant version of the function, which can be
+     *       significantly more memory efficient than the non-constant version,
+     *       so always prefer this version.
+     */
+    const value_type* get_const_values() const noexcept
+    {
+        return values_.get_const_data();
+    }
+
+    /**
+     * Returns the values of the given batch item.
+     *
+     * @param item  the index of the batch item
+     *
+     * @return the values of the batch item
+     */
+    value_type* get_values_for_item(size_type item) noexcept
+    {
+        return values_.get_data() + item * get_num_stored_elements_per_item();
+    }
+
+    /**
+     * @copydoc BatchCsr::get_values_for_item(size_type)
+     */
+    const value_type* get_const_values_for_item(size_type item) const noexcept
+    {
+        return values_.get_const_data() +
+               item * get_num_stored_elements_per_item();
+    }
+
+    /**
+     * Returns the column indices shared by all batch items.
+     *
+     * @return the column indices of the matrix.
+     */
+    index_type* get_col_idxs() noexcept { return col_idxs_.get_data(); }
+
+    /**
+     * @copydoc BatchCsr::get_col_idxs()
+     */
+    const index_type* get_const_col_idxs() const noexcept
+    {
+        return col_idxs_.get_const_data();
+    }
+
+    /**
+     * Returns the row pointers shared by all batch items.
+     *
+     * @return the row pointers of the matrix.
+     */
+    index_type* get_row_ptrs() noexcept { return row_ptrs_.get_data(); }
+
+    /**
+     * @copydoc BatchCsr::get_row_ptrs()
+     */
+    const index_type* get_const_row_ptrs() const noexcept
+    {
+        return row_ptrs_.get_const_data();
+    }
+
+    /**
+     * Returns the number of elements explicitly stored for each batch item.
+     *
+     * @return the number of elements explicitly stored for each batch item
+     */
+    size_type get_num_stored_elements_per_item() const noexcept
+    {
+        return col_idxs_.get_num_elems();
+    }
+
+    /**
+     * Returns the number of elements explicitly stored in the matrix.
+     *
+     * @return the number of elements explicitly stored in the matrix
+     */
+    size_type get_num_stored_elements() const noexcept
+    {
+        return values_.get_num_elems();
+    }
+
+    /**
+     * Creates a Csr matrix viewing the given batch item. The view shares the
+     * sparsity pattern with all other batch items.
+     *
+     * @param item  the index of the batch item
+     *
+     * @return a Csr matrix viewing the batch item
+     */
+    std::unique_ptr<unbatch_type> create_view_for_item(size_type item);
+
+    /**
+     * @copydoc BatchCsr::create_view_for_item(size_type)
+     */
+    std::unique_ptr<const unbatch_type> create_const_view_for_item(
+        size_type item) const;
+
+    /**
+     * Reads the batch items from the given matrix data, one entry per item.
+     * All entries need to have the same size and, after sorting, the same
+     * sparsity pattern.
+     *
+     * @param data  the matrix data of the batch items
+     */
+    void read(const std::vector<mat_data>& data);
+
+    /**
+     * Writes the batch items to matrix data, one entry per item.
+     *
+     * @param data  the output matrix data of the batch items
+     */
+    void write(std::vector<mat_data>& data) const;
+
+    /**
+     * Creates a constant (immutable) BatchCsr matrix from a set of constant
+     * arrays.
+     *
+     * @param exec  the executor to create the matrix on
+     * @param num_batch_items  the number of batch items
+     * @param common_size  the dimensions of each batch item
+     * @param values  the value array of all batch items
+     * @param col_idxs  the column index array shared by all batch items
+     * @param row_ptrs  the row pointer array shared by all batch items
+     * @returns A smart pointer to the constant matrix wrapping the input arrays
+     *          (if they reside on the same executor as the matrix) or a copy of
+     *          the arrays on the correct executor.
+     */
+    static std::unique_ptr<const BatchCsr> create_const(
+        std::shared_ptr<const Executor> exec, size_type num_batch_items,
+        const dim<2>& common_size,
+        gko::detail::const_array_view<ValueType>&& values,
+        gko::detail::const_array_view<IndexType>&& col_idxs,
+        gko::detail::const_array_view<IndexType>&& row_ptrs)
+    {
+        // cast const-ness away, but return a const object afterwards,
+        // so we can ensure that no modifications take place.
+        return std::unique_ptr<const BatchCsr>(new BatchCsr{
+            exec, num_batch_items, common_size,
+            gko::detail::array_const_cast(std::move(values)),
+            gko::detail::array_const_cast(std::move(col_idxs)),
+            gko::detail::array_const_cast(std::move(row_ptrs))});
+    }
+
+protected:
+    /**
+     * Creates an uninitialized BatchCsr matrix.
+     *
+     * @param exec  Executor associated to the matrix
+     * @param num_batch_items  the number of batch items
+     * @param common_size  the dimensions of each batch item
+     * @param num_nonzeros_per_item  the number of nonzeros of each batch item
+     */
+    BatchCsr(std::shared_ptr<const Executor> exec,
+             size_type num_batch_items = 0, const dim<2>& common_size = {},
+             size_type num_nonzeros_per_item = 0)
+        : EnableLinOp<BatchCsr>(exec, dim<2>{num_batch_items} * common_size),
+          num_batch_items_{num_batch_items},
+          common_size_{common_size},
+          values_(exec, num_batch_items * num_nonzeros_per_item),
+          col_idxs_(exec, num_nonzeros_per_item),
+          row_ptrs_(exec, common_size[0] + 1)
+    {
+        row_ptrs_.fill(0);
+    }
+
+    /**
+     * Creates a BatchCsr matrix from already allocated (and initialized) row
+     * pointer, column index and value arrays.
+     *
+     * @tparam ValuesArray  type of `values` array
+     * @tparam ColIdxsArray  type of `col_idxs` array
+     * @tparam RowPtrsArray  type of `row_ptrs` array
+     *
+     * @param exec  Executor associated to the matrix
+     * @param num_batch_items  the number of batch items
+     * @param common_size  the dimensions of each batch item
+     * @param values  array of the values of all batch items
+     * @param col_idxs  array of column indexes shared by all batch items
+     * @param row_ptrs  array of row pointers shared by all batch items
+     *
+     * @note If one of `row_ptrs`, `col_idxs` or `values` is not an rvalue, not
+     *       an array of IndexType, IndexType and ValueType, respectively, or
+     *       is on the wrong executor, an internal copy of that array will be
+     *       created, and the original array data will not be used in the
+     *       matrix.
+     */
+    template <typename ValuesArray, typename ColIdxsArray,
+              typename RowPtrsArray>
+    BatchCsr(std::shared_ptr<const Executor> exec, size_type num_batch_items,
+             const dim<2>& common_size, ValuesArray&& values,
+             ColIdxsArray&& col_idxs, RowPtrsArray&& row_ptrs)
+        : EnableLinOp<BatchCsr>(exec, dim<2>{num_batch_items} * common_size),
+          num_batch_items_{num_batch_items},
+          common_size_{common_size},
+          values_{exec, std::forward<ValuesArray>(values)},
+          col_idxs_{exec, std::forward<ColIdxsArray>(col_idxs)},
+          row_ptrs_{exec, std::forward<RowPtrsArray>(row_ptrs)}
+    {
+        GKO_ASSERT_EQ(num_batch_items_ * col_idxs_.get_num_elems(),
+                      values_.get_num_elems());
+        GKO_ASSERT_EQ(common_size_[0] + 1, row_ptrs_.get_num_elems());
+    }
+
+    void apply_impl(const LinOp* b, LinOp* x) const override;
+
+    void apply_impl(const LinOp* alpha, const LinOp* b, const LinOp* beta,
+                    LinOp* x) const override;
+
+private:
+    size_type num_batch_items_;
+    dim<2> common_size_;
+    array<value_type> values_;
+    array<index_type> col_idxs_;
+    array<index_type> row_ptrs_;
+};
+
+
+}  // namespace matrix
+}  // namespace gko
+
+
+#endif  // GKO_PUBLIC_CORE_MATRIX_BATCH_CSR_HPP_
@@ -0,0 +1,295 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2022, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#ifndef GKO_PUBLIC_CORE_MATRIX_BATCH_DENSE_HPP_
+#define GKO_PUBLIC_CORE_MATRIX_BATCH_DENSE_HPP_
+
+
+#include <vector>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/lin_op.hpp>
+#include <ginkgo/core/base/matrix_data.hpp>
+
+
+namespace gko {
+namespace matrix {
+
+
+template <typename ValueType>
+class Dense;
+
+
+/**
+ * BatchDense stores a batch of dense matrices of the same size. Each batch
+ * item is stored row-major without padding, and the items are stored back to
+ * back, i.e. the entry `(row, col)` of item `i` is stored at
+ * `get_values()[(i * rows + row) * cols + col]`.
+ *
+ * As a LinOp, BatchDense represents the block-diagonal matrix formed by its
+ * batch items, see Batched. It is meant for batches of small systems, the
+ * right-hand sides and solutions of batched solvers are regular Dense
+ * matrices.
+ *
+ * @tparam ValueType  precision of matrix elements
+ *
+ * @ingroup batch_dense
+ * @ingroup mat_formats
+ * @ingroup LinOp
+ */
+template <typename ValueType = default_precision>
+class BatchDense : public EnableLinOp<BatchDense<ValueType>>,
+                   public EnableCreateMethod<BatchDense<ValueType>>,
+                   public Batched {
+    friend class EnableCreateMethod<BatchDense>;
+    friend class EnablePolymorphicObject<BatchDense, LinOp>;
+
+public:
+    using value_type = ValueType;
+    using index_type = int64;
+    using mat_data = matrix_data<ValueType, int64>;
+    using mat_data32 = matrix_data<ValueType, int32>;
+    using unbatch_type = Dense<ValueType>;
+
+    size_type get_num_batch_items() const override { return num_batch_items_; }
+
+    dim<2> get_common_size() const override { return common_size_; }
+
+    /**
+     * Returns the values of all batch items.
+     *
+     * @return the values of all batch items.
+     */
+    value_type* get_values() noexcept { return values_.get_data(); }
+
+    /**
+     * @copydoc BatchDense::get_values()
+     *
+     * @note This is the constant version of the function, which can be
+     *       significantly more memory efficient than the non-constant version,
+     *       so always prefer this version.
+     */
+    const value_type* get_const_values() const noexcept
+    {
+        return values_.get_const_data();
+    }
+
+    /**
+     * Returns the values of the given batch item.
+     *
+     * @param item  the index of the batch item
+     *
+     * @return the values of the batch item
+     */
+    value_type* get_values_for_item(size_type item) noexcept
+    {
+        return values_.get_data() + item * get_num_stored_elements_per_item();
+    }
+
+    /**
+     * @copydoc BatchDense::get_values_for_item(size_type)
+     */
+    const value_type* get_const_values_for_item(size_type item) const noexcept
+    {
+        return values_.get_const_data() +
+               item * get_num_stored_elements_per_item();
+    }
+
+    /**
+     * Returns a single element of a batch item.
+     *
+     * @param item  the index of the batch item
+     * @param row  the row of the requested element
+     * @param col  the column of the requested element
+     *
+     * @note  the method has to be called on the same Executor the matrix is
+     *        stored at (e.g. trying to call this method on a GPU matrix from
+     *        the OMP results in a runtime error)
+     */
+    value_type& at(size_type item, size_type row, size_type col) noexcept
+    {
+        return get_values_for_item(item)[row * common_size_[1] + col];
+    }
+
+    /**
+     * @copydoc BatchDense::at(size_type, size_type, size_type)
+     */
+    value_type at(size_type item, size_type row, size_type col) const noexcept
+    {
+        return get_const_values_for_item(item)[row * common_size_[1] + col];
+    }
+
+    /**
+     * Returns the number of elements stored for each batch item.
+     *
+     * @return the number of elements stored for each batch item
+     */
+    size_type get_num_stored_elements_per_item() const noexcept
+    {
+        return common_size_[0] * common_size_[1];
+    }
+
+    /**
+     * Returns the number of elements explicitly stored in the matrix.
+     *
+     * @return the number of elements explicitly stored in the matrix
+     */
+    size_type get_num_stored_elements() const noexcept
+    {
+        return values_.get_num_elems();
+    }
+
+    /**
+     * Creates a Dense matrix viewing the given batch item.
+     *
+     * @param item  the index of the batch item
+     *
+     * @return a Dense matrix viewing the batch item
+     */
+    std::unique_ptr<unbatch_type> create_view_for_item(size_type item);
+
+    /**
+     * @copydoc BatchDense::create_view_for_item(size_type)
+     */
+    std::unique_ptr<const unbatch_type> create_const_view_for_item(
+        size_type item) const;
+
+    /**
+     * Reads the batch items from the given matrix data, one entry per item.
+     * All entries need to have the same size.
+     *
+     * @param data  the matrix data of the batch items
+     */
+    void read(const std::vector<mat_data>& data);
+
+    /**
+     * @copydoc BatchDense::read(const std::vector<mat_data>&)
+     */
+    void read(const std::vector<mat_data32>& data);
+
+    /**
+     * Writes the batch items to matrix data, one entry per item.
+     *
+     * @param data  the output matrix data of the batch items
+     */
+    void write(std::vector<mat_data>& data) const;
+
+    /**
+     * @copydoc BatchDense::write(std::vector<mat_data>&) const
+     */
+    void write(std::vector<mat_data32>& data) const;
+
+    /**
+     * Creates a constant (immutable) BatchDense matrix from a constant array.
+     *
+     * @param exec  the executor to create the matrix on
+     * @param num_batch_items  the number of batch items
+     * @param common_size  the dimensions of each batch item
+     * @param values  the value array of all batch items
+     * @returns A smart pointer to the constant matrix wrapping the input array
+     *          (if it resides on the same executor as the matrix) or a copy of
+     *          the array on the correct executor.
+     */
+    static std::unique_ptr<const BatchDense> create_const(
+        std::shared_ptr<const Executor> exec, size_type num_batch_items,
+        const dim<2>& common_size,
+        gko::detail::const_array_view<ValueType>&& values)
+    {
+        // cast const-ness away, but return a const object afterwards,
+        // so we can ensure that no modifications take place.
+        return std::unique_ptr<const BatchDense>(
+            new BatchDense{exec, num_batch_items, common_size,
+                           gko::detail::array_const_cast(std::move(values))});
+    }
+
+protected:
+    /**
+     * Creates an uninitialized BatchDense matrix.
+     *
+     * @param exec  Executor associated to the matrix
+     * @param num_batch_items  the number of batch items
+     * @param common_size  the dimensions of each batch item
+     */
+    BatchDense(std::shared_ptr<const Executor> exec,
+               size_type num_batch_items = 0, const dim<2>& common_size = {})
+        : EnableLinOp<BatchDense>(exec, dim<2>{num_batch_items} * common_size),
+          num_batch_items_{num_batch_items},
+          common_size_{common_size},
+          values_(exec, num_batch_items * common_size[0] * common_size[1])
+    {}
+
+    /**
+     * Creates a BatchDense matrix from an already allocated (and initialized)
+     * value array.
+     *
+     * @tparam ValuesArray  type of `values` array
+     *
+     * @param exec  Executor associated to the matrix
+     * @param num_batch_items  the number of batch items
+     * @param common_size  the dimensions of each batch item
+     * @param values  array of the values of all batch items
+     *
+     * @note If `values` is not an rvalue, not an array of ValueType, or is on
+     *       the wrong executor, an internal copy will be created, and the
+     *       original array data will not be used in the matrix.
+     */
+    template <typename ValuesArray>
+    BatchDense(std::shared_ptr<const Executor> exec, size_type num_batch_items,
+               const dim<2>& common_size, ValuesArray&& values)
+        : EnableLinOp<BatchDense>(exec, dim<2>{num_batch_items} * common_size),
+          num_batch_items_{num_batch_items},
+          common_size_{common_size},
+          values_{exec, std::forward<ValuesArray>(values)}
+    {
+        GKO_ASSERT_EQ(num_batch_items_ * get_num_stored_elements_per_item(),
+                      values_.get_num_elems());
+    }
+
+    void apply_impl(const LinOp* b, LinOp* x) const override;
+
+    void apply_impl(const LinOp* alpha, const LinOp* b, const LinOp* beta,
+                    LinOp* x) const override;
+
+private:
+    size_type num_batch_items_;
+    dim<2> common_size_;
+    array<value_type> values_;
+};
+
+
+}  // namespace matrix
+}  // namespace gko
+
+
+#endif  // GKO_PUBLIC_CORE_MATRIX_BATCH_DENSE_HPP_
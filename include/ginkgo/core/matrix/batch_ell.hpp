@@ -0,0 +1,317 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2022, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#ifndef GKO_PUBLIC_CORE_MATRIX_BATCH_ELL_HPP_
+#define GKO_PUBLIC_CORE_MATRIX_BATCH_ELL_HPP_
+
+
+#include <vector>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/lin_op.hpp>
+#include <ginkgo/core/base/matrix_data.hpp>
+
+
+namespace gko {
+namespace matrix {
+
+
+template <typename ValueType, typename IndexType>
+class Ell;
+
+
+/**
+ * BatchEll stores a batch of ELL matrices which all share the same sparsity
+ * pattern. The column indices are stored only once, while the values of the
+ * batch items are stored back to back, i.e. the values of item `i` start at
+ * `get_values() + i * get_num_stored_elements_per_item()`. Like in Ell, the
+ * entries are stored column-major with a stride equal to the number of rows,
+ * and padding entries are marked by the column index
+ * invalid_index<IndexType>().
+ *
+ * As a LinOp, BatchEll represents the block-diagonal matrix formed by its
+ * batch items, see Batched. Applying it to a Dense vector with
+ * `get_num_batch_items() * get_common_size()[1]` rows computes all batch
+ * SpMVs at once.
+ *
+ * @tparam ValueType  precision of matrix elements
+ * @tparam IndexType  precision of matrix indexes, only int32 is supported
+ *
+ * @ingroup batch_ell
+ * @ingroup mat_formats
+ * @ingroup LinOp
+ */
+template <typename ValueType = default_precision, typename IndexType = int32>
+class BatchEll : public EnableLinOp<BatchEll<ValueType, IndexType>>,
+                 public EnableCreateMethod<BatchEll<ValueType, IndexType>>,
+                 public Batched {
+    friend class EnableCreateMethod<BatchEll>;
+    friend class EnablePolymorphicObject<BatchEll, LinOp>;
+
+public:
+    using value_type = ValueType;
+    using index_type = IndexType;
+    using mat_data = matrix_data<ValueType, IndexType>;
+    using unbatch_type = Ell<ValueType, IndexType>;
+
+    size_type get_num_batch_items() const override { return num_batch_items_; }
+
+    dim<2> get_common_size() const override { return common_size_; }
+
+    /**
+     * Returns the values of all batch items.
+     *
+     * @return the values of all batch items.
+     */
+    value_type* get_values() noexcept { return values_.get_data(); }
+
+    /**
+     * @copydoc BatchEll::get_values()
+     *
+     * @note This is the constant version of the function, which can be
+     *       significantly more memory efficient than the non-constant version,
+     *       so always prefer this version.
+     */
+    const value_type* get_const_values() const noexcept
+    {
+        return values_.get_const_data();
+    }
+
+    /**
+     * Returns the values of the given batch item.
+     *
+     * @param item  the index of the batch item
+     *
+     * @return the values of the batch item
+     */
+    value_type* get_values_for_item(size_type item) noexcept
+    {
+        return values_.get_data() + item * get_num_stored_elements_per_item();
+    }
+
+    /**
+     * @copydoc BatchEll::get_values_for_item(size_type)
+     */
+    const value_type* get_const_values_for_item(size_type item) const noexcept
+    {
+        return values_.get_const_data() +
+               item * get_num_stored_elements_per_item();
+    }
+
+    /**
+     * Returns the column indices shared by all batch items.
+     *
+     * @return the column indices of the matrix.
+     */
+    index_type* get_col_idxs() noexcept { return col_idxs_.get_data(); }
+
+    /**
+     * @copydoc BatchEll::get_col_idxs()
+     */
+    const index_type* get_const_col_idxs() const noexcept
+    {
+        return col_idxs_.get_const_data();
+    }
+
+    /**
+     * Returns the number of stored elements in each row.
+     *
+     * @return the number of stored elements in each row
+     */
+    size_type get_num_stored_elements_per_row() const noexcept
+    {
+        return num_stored_elements_per_row_;
+    }
+
+    /**
+     * Returns the number of elements explicitly stored for each batch item.
+     *
+     * @return the number of elements explicitly stored for each batch item
+     */
+    size_type get_num_stored_elements_per_item() const noexcept
+    {
+        return col_idxs_.get_num_elems();
+    }
+
+    /**
+     * Returns the number of elements explicitly stored in the matrix.
+     *
+     * @return the number of elements explicitly stored in the matrix
+     */
+    size_type get_num_stored_elements() const noexcept
+    {
+        return values_.get_num_elems();
+    }
+
+    /**
+     * Creates an Ell matrix viewing the given batch item. The view shares the
+     * sparsity pattern with all other batch items.
+     *
+     * @param item  the index of the batch item
+     *
+     * @return an Ell matrix viewing the batch item
+     */
+    std::unique_ptr<unbatch_type> create_view_for_item(size_type item);
+
+    /**
+     * @copydoc BatchEll::create_view_for_item(size_type)
+     */
+    std::unique_ptr<const unbatch_type> create_const_view_for_item(
+        size_type item) const;
+
+    /**
+     * Reads the batch items from the given matrix data, one entry per item.
+     * All entries need to have the same size and, after sorting, the same
+     * sparsity pattern. Rows are padded to the longest row.
+     *
+     * @param data  the matrix data of the batch items
+     */
+    void read(const std::vector<mat_data>& data);
+
+    /**
+     * Writes the batch items to matrix data, one entry per item.
+     *
+     * @param data  the output matrix data of the batch items
+     */
+    void write(std::vector<mat_data>& data) const;
+
+    /**
+     * Creates a constant (immutable) BatchEll matrix from a set of constant
+     * arrays.
+     *
+     * @param exec  the executor to create the matrix on
+     * @param num_batch_items  the number of batch items
+     * @param common_size  the dimensions of each batch item
+     * @param values  the value array of all batch items
+     * @param col_idxs  the column index array shared by all batch items
+     * @param num_stored_elements_per_row  the number of stored elements per
+     *                                     row
+     * @returns A smart pointer to the constant matrix wrapping the input arrays
+     *          (if they reside on the same executor as the matrix) or a copy of
+     *          the arrays on the correct executor.
+     */
+    static std::unique_ptr<const BatchEll> create_const(
+        std::shared_ptr<const Executor> exec, size_type num_batch_items,
+        const dim<2>& common_size,
+        gko::detail::const_array_view<ValueType>&& values,
+        gko::detail::const_array_view<IndexType>&& col_idxs,
+        size_type num_stored_elements_per_row)
+    {
+        // cast const-ness away, but return a const object afterwards,
+        // so we can ensure that no modifications take place.
+        return std::unique_ptr<const BatchEll>(new BatchEll{
+            exec, num_batch_items, common_size,
+            gko::detail::array_const_cast(std::move(values)),
+            gko::detail::array_const_cast(std::move(col_idxs)),
+            num_stored_elements_per_row});
+    }
+
+protected:
+    /**
+     * Creates an uninitialized BatchEll matrix.
+     *
+     * @param exec  Executor associated to the matrix
+     * @param num_batch_items  the number of batch items
+     * @param common_size  the dimensions of each batch item
+     * @param num_stored_elements_per_row  the number of stored elements per
+     *                                     row
+     */
+    BatchEll(std::shared_ptr<const Executor> exec,
+             size_type num_batch_items = 0, const dim<2>& common_size = {},
+             size_type num_stored_elements_per_row = 0)
+        : EnableLinOp<BatchEll>(exec, dim<2>{num_batch_items} * common_size),
+          num_batch_items_{num_batch_items},
+          common_size_{common_size},
+          num_stored_elements_per_row_{num_stored_elements_per_row},
+          values_(exec, num_batch_items * common_size[0] *
+                            num_stored_elements_per_row),
+          col_idxs_(exec, common_size[0] * num_stored_elements_per_row)
+    {}
+
+    /**
+     * Creates a BatchEll matrix from already allocated (and initialized)
+     * column index and value arrays.
+     *
+     * @tparam ValuesArray  type of `values` array
+     * @tparam ColIdxsArray  type of `col_idxs` array
+     *
+     * @param exec  Executor associated to the matrix
+     * @param num_batch_items  the number of batch items
+     * @param common_size  the dimensions of each batch item
+     * @param values  array of the values of all batch items
+     * @param col_idxs  array of column indexes shared by all batch items
+     * @param num_stored_elements_per_row  the number of stored elements per
+     *                                     row
+     *
+     * @note If one of `col_idxs` or `values` is not an rvalue, not an array of
+     *       IndexType and ValueType, respectively, or is on the wrong executor,
+     *       an internal copy of that array will be created, and the original
+     *       array data will not be used in the matrix.
+     */
+    template <typename ValuesArray, typename ColIdxsArray>
+    BatchEll(std::shared_ptr<const Executor> exec, size_type num_batch_items,
+             const dim<2>& common_size, ValuesArray&& values,
+             ColIdxsArray&& col_idxs, size_type num_stored_elements_per_row)
+        : EnableLinOp<BatchEll>(exec, dim<2>{num_batch_items} * common_size),
+          num_batch_items_{num_batch_items},
+          common_size_{common_size},
+          num_stored_elements_per_row_{num_stored_elements_per_row},
+          values_{exec, std::forward<ValuesArray>(values)},
+          col_idxs_{exec, std::forward<ColIdxsArray>(col_idxs)}
+    {
+        GKO_ASSERT_EQ(common_size_[0] * num_stored_elements_per_row_,
+                      col_idxs_.get_num_elems());
+        GKO_ASSERT_EQ(num_batch_items_ * col_idxs_.get_num_elems(),
+                      values_.get_num_elems());
+    }
+
+    void apply_impl(const LinOp* b, LinOp* x) const override;
+
+    void apply_impl(const LinOp* alpha, const LinOp* b, const LinOp* beta,
+                    LinOp* x) const override;
+
+private:
+    size_type num_batch_items_;
+    dim<2> common_size_;
+    size_type num_stored_elements_per_row_;
+    array<value_type> values_;
+    array<index_type> col_idxs_;
+};
+
+
+}  // namespace matrix
+}  // namespace gko
+
+
+#endif  // GKO_PUBLIC_CORE_MATRIX_BATCH_ELL_HPP_
@@ -53,6 +53,9 @@ class Diagonal;
 template <typename ValueType, typename IndexType>
 class Coo;
 
+template <typename ValueType, typename IndexType>
+class DeltaCsr;
+
 template <typename ValueType, typename IndexType>
 class Ell;
 
@@ -65,6 +68,9 @@ class Sellp;
 template <typename ValueType, typename IndexType>
 class SparsityCsr;
 
+template <typename ValueType, typename IndexType>
+class SymmetricCsr;
+
 template <typename ValueType, typename IndexType>
 class Csr;
 
@@ -129,11 +135,13 @@ class Csr : public EnableLinOp<Csr<ValueType, IndexType>>,
             public ConvertibleTo<Csr<next_precision<ValueType>, IndexType>>,
             public ConvertibleTo<Dense<ValueType>>,
             public ConvertibleTo<Coo<ValueType, IndexType>>,
+            public ConvertibleTo<DeltaCsr<ValueType, IndexType>>,
             public ConvertibleTo<Ell<ValueType, IndexType>>,
             public ConvertibleTo<Fbcsr<ValueType, IndexType>>,
             public ConvertibleTo<Hybrid<ValueType, IndexType>>,
             public ConvertibleTo<Sellp<ValueType, IndexType>>,
             public ConvertibleTo<SparsityCsr<ValueType, IndexType>>,
+            public ConvertibleTo<SymmetricCsr<ValueType, IndexType>>,
             public DiagonalExtractable<ValueType>,
             public ReadableFromMatrixData<ValueType, IndexType>,
             public WritableToMatrixData<ValueType, IndexType>,
@@ -145,12 +153,14 @@ class Csr : public EnableLinOp<Csr<ValueType, IndexType>>,
     friend class EnableCreateMethod<Csr>;
     friend class EnablePolymorphicObject<Csr, LinOp>;
     friend class Coo<ValueType, IndexType>;
+    friend class DeltaCsr<ValueType, IndexType>;
     friend class Dense<ValueType>;
     friend class Diagonal<ValueType>;
     friend class Ell<ValueType, IndexType>;
     friend class Hybrid<ValueType, IndexType>;
     friend class Sellp<ValueType, IndexType>;
     friend class SparsityCsr<ValueType, IndexType>;
+    friend class SymmetricCsr<ValueType, IndexType>;
     friend class Fbcsr<ValueType, IndexType>;
     friend class CsrBuilder<ValueType, IndexType>;
     friend class Csr<to_complex<ValueType>, IndexType>;
@@ -384,6 +394,20 @@ public:
             : load_balance(exec->get_num_warps(), exec->get_warp_size(), false)
         {}
 
+        /**
+         * Creates a load_balance strategy with OMP executor.
+         *
+         * @param exec the OMP executor
+         *
+         * @note The OMP kernels partition the nonzeros among the threads on
+         *       the fly, so no srow is stored for this strategy.
+         */
+        load_balance(std::shared_ptr<const OmpExecutor> exec)
+            : load_balance(
+                  exec->get_num_cores() * exec->get_num_threads_per_core(), 0,
+                  false, "omp")
+        {}
+
         /**
          * Creates a load_balance strategy with DPCPP executor.
          *
@@ -543,6 +567,18 @@ public:
         /* Use imbalance strategy when the matrix has more more than 3e8 on
          * Intel hardware */
         const index_type intel_nnz_limit{static_cast<index_type>(3e8)};
+        /* Use imbalance strategy when the maximum number of nonzero per row is
+         * more than 4096 on CPUs using OpenMP */
+        const index_type omp_row_len_limit = 4096;
+        /* Use imbalance strategy only when the matrix has more than 1e5
+         * nonzeros on CPUs using OpenMP */
+        const index_type omp_nnz_limit{static_cast<index_type>(1e5)};
+        /* Use imbalance strategy when the busiest thread of a static row
+         * partition gets more than twice the average number of nonzeros */
+        const index_type omp_imbalance_limit = 2;
+        /* Use merge_path instead of load_balance when the rows have less than
+         * 4 nonzeros on average, since the per-row work is not negligible */
+        const index_type omp_merge_path_row_len_limit = 4;
 
     public:
         /**
@@ -574,6 +610,17 @@ public:
             : automatical(exec->get_num_warps(), exec->get_warp_size(), false)
         {}
 
+        /**
+         * Creates an automatical strategy with OMP executor.
+         *
+         * @param exec the OMP executor
+         */
+        automatical(std::shared_ptr<const OmpExecutor> exec)
+            : automatical(
+                  exec->get_num_cores() * exec->get_num_threads_per_core(), 0,
+                  false, "omp")
+        {}
+
         /**
          * Creates an automatical strategy with Dpcpp executor.
          *
@@ -639,7 +686,9 @@ public:
                 row_ptrs = row_ptrs_host.get_const_data();
             }
             const auto num_rows = mtx_row_ptrs.get_num_elems() - 1;
-            if (row_ptrs[num_rows] > nnz_limit) {
+            if (strategy_name_ == "omp") {
+                this->process_omp(row_ptrs, num_rows);
+            } else if (row_ptrs[num_rows] > nnz_limit) {
                 load_balance actual_strategy(nwarps_, warp_size_,
                                              cuda_strategy_, strategy_name_);
                 if (is_mtx_on_host) {
@@ -697,6 +746,47 @@ public:
         }
 
     private:
+        /*
+         * Chooses the strategy for the OMP kernels: matrices with very long
+         * rows or whose static row partition leaves a thread with much more
+         * than its share of nonzeros are split by nonzeros (merge_path if the
+         * rows are very short, load_balance otherwise), all others use the
+         * classical row-parallel kernel.
+         */
+        void process_omp(const index_type* row_ptrs, size_type num_rows)
+        {
+            const auto nnz = row_ptrs[num_rows];
+            index_type maxnum = 0;
+            for (size_type i = 0; i < num_rows; i++) {
+                maxnum = std::max(maxnum, row_ptrs[i + 1] - row_ptrs[i]);
+            }
+            const auto num_threads =
+                static_cast<size_type>(std::max<int64_t>(nwarps_, 1));
+            const auto rows_per_thread = ceildiv(num_rows, num_threads);
+            index_type max_thread_nnz = 0;
+            for (size_type i = 0; i < num_rows; i += rows_per_thread) {
+                const auto end = std::min(i + rows_per_thread, num_rows);
+                max_thread_nnz =
+                    std::max(max_thread_nnz, row_ptrs[end] - row_ptrs[i]);
+            }
+            const bool is_imbalanced =
+                maxnum > omp_row_len_limit ||
+                (nnz > omp_nnz_limit &&
+                 static_cast<int64_t>(max_thread_nnz) *
+                         static_cast<int64_t>(num_threads) >
+                     static_cast<int64_t>(omp_imbalance_limit) * nnz);
+            if (!is_imbalanced) {
+                max_length_per_row_ = maxnum;
+                this->set_name("classical");
+            } else if (static_cast<int64_t>(nnz) <
+                       static_cast<int64_t>(omp_merge_path_row_len_limit) *
+                           static_cast<int64_t>(num_rows)) {
+                this->set_name("merge_path");
+            } else {
+                this->set_name("load_balance");
+            }
+        }
+
         int64_t nwarps_;
         int warp_size_;
         bool cuda_strategy_;
@@ -719,6 +809,10 @@ public:
 
     void move_to(Coo<ValueType, IndexType>* result) override;
 
+    void convert_to(DeltaCsr<ValueType, IndexType>* result) const override;
+
+    void move_to(DeltaCsr<ValueType, IndexType>* result) override;
+
     void convert_to(Ell<ValueType, IndexType>* result) const override;
 
     void move_to(Ell<ValueType, IndexType>* result) override;
@@ -739,6 +833,10 @@ public:
 
     void move_to(SparsityCsr<ValueType, IndexType>* result) override;
 
+    void convert_to(SymmetricCsr<ValueType, IndexType>* result) const override;
+
+    void move_to(SymmetricCsr<ValueType, IndexType>* result) override;
+
     void read(const mat_data& data) override;
 
     void read(const device_mat_data& data) override;
@@ -1142,6 +1240,7 @@ protected:
         auto cuda_exec = std::dynamic_pointer_cast<const CudaExecutor>(exec);
         auto hip_exec = std::dynamic_pointer_cast<const HipExecutor>(exec);
         auto dpcpp_exec = std::dynamic_pointer_cast<const DpcppExecutor>(exec);
+        auto omp_exec = std::dynamic_pointer_cast<const OmpExecutor>(exec);
         std::shared_ptr<strategy_type> new_strategy;
         if (cuda_exec) {
             new_strategy = std::make_shared<automatical>(cuda_exec);
@@ -1149,6 +1248,8 @@ protected:
             new_strategy = std::make_shared<automatical>(hip_exec);
         } else if (dpcpp_exec) {
             new_strategy = std::make_shared<automatical>(dpcpp_exec);
+        } else if (omp_exec) {
+            new_strategy = std::make_shared<automatical>(omp_exec);
         } else {
             new_strategy = std::make_shared<classical>();
         }
@@ -1176,6 +1277,7 @@ protected:
             auto hip_exec = std::dynamic_pointer_cast<const HipExecutor>(rexec);
             auto dpcpp_exec =
                 std::dynamic_pointer_cast<const DpcppExecutor>(rexec);
+            auto omp_exec = std::dynamic_pointer_cast<const OmpExecutor>(rexec);
             auto lb = dynamic_cast<load_balance*>(strat);
             if (cuda_exec) {
                 if (lb) {
@@ -1204,6 +1306,15 @@ protected:
                     new_strat = std::make_shared<typename CsrType::automatical>(
                         dpcpp_exec);
                 }
+            } else if (omp_exec) {
+                if (lb) {
+                    new_strat =
+                        std::make_shared<typename CsrType::load_balance>(
+                            omp_exec);
+                } else {
+                    new_strat = std::make_shared<typename CsrType::automatical>(
+                        omp_exec);
+                }
             } else {
                 // Try to preserve this executor's configuration
                 auto this_cuda_exec =
@@ -1215,6 +1326,9 @@ protected:
                 auto this_dpcpp_exec =
                     std::dynamic_pointer_cast<const DpcppExecutor>(
                         this->get_executor());
+                auto this_omp_exec =
+                    std::dynamic_pointer_cast<const OmpExecutor>(
+                        this->get_executor());
                 if (this_cuda_exec) {
                     if (lb) {
                         new_strat =
@@ -1245,6 +1359,16 @@ protected:
                             std::make_shared<typename CsrType::automatical>(
                                 this_dpcpp_exec);
                     }
+                } else if (this_omp_exec) {
+                    if (lb) {
+                        new_strat =
+                            std::make_shared<typename CsrType::load_balance>(
+                                this_omp_exec);
+                    } else {
+                        new_strat =
+                            std::make_shared<typename CsrType::automatical>(
+                                this_omp_exec);
+                    }
                 } else {
                     // FIXME: this changes strategies.
                     // We had a load balance or automatical strategy from a non
@@ -1316,6 +1440,9 @@ void strategy_rebuild_helper(Csr<ValueType, IndexType>* result)
         } else if (auto exec = std::dynamic_pointer_cast<const CudaExecutor>(
                        executor)) {
             result->set_strategy(std::make_shared<load_balance>(exec));
+        } else if (auto exec = std::dynamic_pointer_cast<const OmpExecutor>(
+                       executor)) {
+            result->set_strategy(std::make_shared<load_balance>(exec));
         }
     } else if (std::dynamic_pointer_cast<automatical>(strategy)) {
         if (auto exec =
@@ -1324,6 +1451,9 @@ void strategy_rebuild_helper(Csr<ValueType, IndexType>* result)
         } else if (auto exec = std::dynamic_pointer_cast<const CudaExecutor>(
                        executor)) {
             result->set_strategy(std::make_shared<automatical>(exec));
+        } else if (auto exec = std::dynamic_pointer_cast<const OmpExecutor>(
+                       executor)) {
+            result->set_strategy(std::make_shared<automatical>(exec));
         }
     }
 }
@@ -0,0 +1,162 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2022, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#ifndef GKO_PUBLIC_CORE_MATRIX_CSR_SPGEMM_PLAN_HPP_
+#define GKO_PUBLIC_CORE_MATRIX_CSR_SPGEMM_PLAN_HPP_
+
+
+#include <memory>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/dim.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+
+
+namespace gko {
+namespace matrix {
+
+
+/**
+ * CsrSpgemmPlan stores the sparsity pattern of a sparse matrix product
+ * C = A * B, so that the product of matrices with unchanged sparsity patterns
+ * can be recomputed without repeating the symbolic phase and without
+ * reallocating the output.
+ *
+ * Applying a Csr matrix to another Csr matrix computes both the sparsity
+ * pattern and the values of the product, and allocates a new output each
+ * time. In applications like the setup of multigrid hierarchies or time
+ * stepping, the same product is computed over and over with different values,
+ * but the same sparsity patterns. The plan computes the pattern only once,
+ * and compute() then only updates the values of an existing output matrix.
+ *
+ * ```cpp
+ * gko::matrix::CsrSpgemmPlan<double, int> plan{exec, a.get(), b.get()};
+ * auto c = plan.create_product();
+ * while (...) {
+ *     update_values(a.get(), b.get());
+ *     plan.compute(a.get(), b.get(), c.get());
+ * }
+ * ```
+ *
+ * @tparam ValueType  the value type of the matrices
+ * @tparam IndexType  the index type of the matrices
+ *
+ * @ingroup csr
+ */
+template <typename ValueType = default_precision, typename IndexType = int32>
+class CsrSpgemmPlan {
+public:
+    using value_type = ValueType;
+    using index_type = IndexType;
+    using matrix_type = Csr<ValueType, IndexType>;
+
+    /**
+     * Computes the sparsity pattern of the product A * B.
+     *
+     * @param exec  the executor on which the pattern is stored and the
+     *              products are computed
+     * @param a  the left operand A
+     * @param b  the right operand B
+     *
+     * @throws DimensionMismatch  if the inner dimensions of A and B differ
+     */
+    CsrSpgemmPlan(std::shared_ptr<const Executor> exec, const matrix_type* a,
+                  const matrix_type* b);
+
+    /** Returns the executor of the plan. */
+    std::shared_ptr<const Executor> get_executor() const { return exec_; }
+
+    /** Returns the size of the product A * B. */
+    const dim<2>& get_size() const noexcept { return size_; }
+
+    /** Returns the number of stored elements of the product A * B. */
+    size_type get_num_stored_elements() const noexcept
+    {
+        return col_idxs_.get_num_elems();
+    }
+
+    /** Returns the row pointers of the product A * B. */
+    const index_type* get_const_row_ptrs() const noexcept
+    {
+        return row_ptrs_.get_const_data();
+    }
+
+    /** Returns the (sorted) column indices of the product A * B. */
+    const index_type* get_const_col_idxs() const noexcept
+    {
+        return col_idxs_.get_const_data();
+    }
+
+    /**
+     * Creates a new matrix with the sparsity pattern of the product A * B.
+     * Its values are uninitialized until it is passed to compute().
+     *
+     * @return  the output matrix, stored on the executor of the plan.
+     */
+    std::unique_ptr<matrix_type> create_product() const;
+
+    /**
+     * Computes the values of the product A * B, reusing the sparsity pattern
+     * of the output matrix.
+     *
+     * @param a  the left operand A. Its sparsity pattern must be the same as
+     *           (or contained in) the pattern of A used to create the plan.
+     * @param b  the right operand B, same requirements as for `a`
+     * @param c  the output matrix. It must have the sparsity pattern of the
+     *           plan, e.g. by being created using create_product(). Only its
+     *           values are updated.
+     *
+     * @throws DimensionMismatch  if the sizes of A, B and C do not match the
+     *                            plan.
+     * @throws ValueMismatch  if the number of stored elements of C does not
+     *                        match the plan.
+     */
+    void compute(const matrix_type* a, const matrix_type* b,
+                 matrix_type* c) const;
+
+private:
+    std::shared_ptr<const Executor> exec_;
+    dim<2> size_;
+    array<index_type> row_ptrs_;
+    array<index_type> col_idxs_;
+};
+
+
+}  // namespace matrix
+}  // namespace gko
+
+
+#endif  // GKO_PUBLIC_CORE_MATRIX_CSR_SPGEMM_PLAN_HPP_
@@ -0,0 +1,156 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2022, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#ifndef GKO_PUBLIC_CORE_MATRIX_CSR_STREAM_BUILDER_HPP_
+#define GKO_PUBLIC_CORE_MATRIX_CSR_STREAM_BUILDER_HPP_
+
+
+#include <memory>
+#include <vector>
+
+
+#include <ginkgo/core/base/dim.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/matrix_data.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+
+
+namespace gko {
+namespace matrix {
+
+
+/**
+ * CsrStreamBuilder assembles a Csr matrix from a stream of entries that
+ * arrive in batches in row-major order, without ever storing the whole list
+ * of entries.
+ *
+ * Each batch is appended directly to the row pointer, column index and value
+ * arrays of the matrix, so the memory required besides the matrix itself is
+ * only that of the current batch. If the final number of entries is known in
+ * advance, the arrays are allocated only once. Otherwise, they grow
+ * geometrically and are shrunk to their final size in the end.
+ *
+ * The matrix is assembled on the host. If the executor passed to the builder
+ * is not a host executor, the matrix is copied to it at the end.
+ *
+ * ```cpp
+ * gko::matrix::CsrStreamBuilder<double, int> builder{exec, size, nnz};
+ * while (read_next_batch(batch)) {
+ *     builder.append(batch);
+ * }
+ * auto mtx = builder.finalize();
+ * ```
+ *
+ * @tparam ValueType  the value type of the matrix
+ * @tparam IndexType  the index type of the matrix
+ *
+ * @ingroup csr
+ */
+template <typename ValueType = default_precision, typename IndexType = int32>
+class CsrStreamBuilder {
+public:
+    using value_type = ValueType;
+    using index_type = IndexType;
+    using nonzero_type = matrix_data_entry<value_type, index_type>;
+
+    /**
+     * Creates a builder for a matrix of the given size.
+     *
+     * @param exec  the executor on which the matrix will be stored
+     * @param size  the size of the matrix
+     * @param expected_num_nonzeros  the expected number of entries. If it is
+     *                               correct, the matrix arrays are allocated
+     *                               only once.
+     */
+    CsrStreamBuilder(std::shared_ptr<const Executor> exec, const dim<2>& size,
+                     size_type expected_num_nonzeros = 0);
+
+    /**
+     * Appends a batch of entries to the matrix.
+     *
+     * @param entries  the entries to append. They have to be sorted in
+     *                 row-major order, and must not precede any entry of
+     *                 previous batches in this order.
+     * @param num_entries  the number of entries to append
+     *
+     * @throws UnsupportedMatrixProperty  if the entries are not sorted
+     * @throws OutOfBoundsError  if an entry is outside the matrix
+     */
+    void append(const nonzero_type* entries, size_type num_entries);
+
+    /**
+     * Appends a batch of entries to the matrix.
+     *
+     * @param entries  the entries to append, see
+     *                 append(const nonzero_type*, size_type)
+     */
+    void append(const std::vector<nonzero_type>& entries)
+    {
+        this->append(entries.data(), entries.size());
+    }
+
+    /**
+     * Returns the number of entries appended so far.
+     */
+    size_type get_num_stored_elements() const noexcept
+    {
+        return num_nonzeros_;
+    }
+
+    /**
+     * Completes the matrix and returns it. Afterwards, the builder can no
+     * longer be used.
+     *
+     * @return the Csr matrix containing all appended entries, on the
+     *         executor passed to the constructor.
+     */
+    std::unique_ptr<Csr<ValueType, IndexType>> finalize();
+
+private:
+    void reserve(size_type capacity);
+
+    std::shared_ptr<const Executor> exec_;
+    std::unique_ptr<Csr<ValueType, IndexType>> matrix_;
+    size_type capacity_;
+    size_type num_nonzeros_;
+    // the last row whose row pointer is set, and the last appended column
+    size_type row_;
+    IndexType col_;
+};
+
+
+}  // namespace matrix
+}  // namespace gko
+
+
+#endif  // GKO_PUBLIC_CORE_MATRIX_CSR_STREAM_BUILDER_HPP_
@@ -0,0 +1,330 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2022, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#ifndef GKO_PUBLIC_CORE_MATRIX_DELTA_CSR_HPP_
+#define GKO_PUBLIC_CORE_MATRIX_DELTA_CSR_HPP_
+
+
+#include <limits>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/lin_op.hpp>
+#include <ginkgo/core/base/polymorphic_object.hpp>
+
+
+namespace gko {
+namespace matrix {
+
+
+template <typename ValueType, typename IndexType>
+class Csr;
+
+
+template <typename ValueType>
+class Dense;
+
+
+/**
+ * DeltaCsr is a compressed sparse row format whose column indices are stored
+ * as 16-bit differences to the previous column index in the same row.
+ *
+ * The row pointer and value arrays are the same as in the Csr format. For each
+ * row, the column index of its first entry is stored in a base array, and the
+ * column index of every entry is the column index of the previous entry (or
+ * the base) plus the 16-bit delta stored for that entry. Differences that do
+ * not fit into 16 bits are marked by the escape delta, in which case the
+ * full column index is taken from an escape array. The escape pointer array
+ * stores the starting index of each row's entries in the escape array, which
+ * allows each row to be decoded independently.
+ *
+ * For matrices with a small bandwidth within each row, this reduces the
+ * memory traffic for the column indices to two bytes per nonzero. The columns
+ * of each row are stored sorted by column index.
+ *
+ * The delta width is fixed to 16 bits (delta_type), there is no 8-bit
+ * variant. 8-bit deltas would save another byte per nonzero, but the gaps
+ * between the column groups of 2D and 3D discretizations often exceed 255, so
+ * most rows would need escapes.
+ *
+ * @tparam ValueType  precision of matrix elements
+ * @tparam IndexType  precision of matrix indexes
+ *
+ * @ingroup mat_formats
+ * @ingroup LinOp
+ */
+template <typename ValueType = default_precision, typename IndexType = int32>
+class DeltaCsr : public EnableLinOp<DeltaCsr<ValueType, IndexType>>,
+                 public EnableCreateMethod<DeltaCsr<ValueType, IndexType>>,
+                 public ConvertibleTo<Csr<ValueType, IndexType>>,
+                 public ReadableFromMatrixData<ValueType, IndexType>,
+                 public WritableToMatrixData<ValueType, IndexType> {
+    friend class EnableCreateMethod<DeltaCsr>;
+    friend class EnablePolymorphicObject<DeltaCsr, LinOp>;
+    friend class Csr<ValueType, IndexType>;
+
+public:
+    using EnableLinOp<DeltaCsr>::convert_to;
+    using EnableLinOp<DeltaCsr>::move_to;
+    using ReadableFromMatrixData<ValueType, IndexType>::read;
+
+    using value_type = ValueType;
+    using index_type = IndexType;
+    using delta_type = uint16;
+    using mat_data = matrix_data<ValueType, IndexType>;
+    using device_mat_data = device_matrix_data<ValueType, IndexType>;
+
+    /**
+     * The delta marking an entry whose column index is stored in the escape
+     * array.
+     */
+    static constexpr delta_type escape_delta =
+        std::numeric_limits<delta_type>::max();
+
+    void convert_to(Csr<ValueType, IndexType>* result) const override;
+
+    void move_to(Csr<ValueType, IndexType>* result) override;
+
+    void read(const mat_data& data) override;
+
+    void read(const device_mat_data& data) override;
+
+    void read(device_mat_data&& data) override;
+
+    void write(mat_data& data) const override;
+
+    /**
+     * Returns the values of the matrix.
+     *
+     * @return the values of the matrix.
+     */
+    value_type* get_values() noexcept { return values_.get_data(); }
+
+    /**
+     * @copydoc DeltaCsr::get_values()
+     *
+     * @note This is the constant version of the function, which can be
+     *       significantly more memory efficient than the non-constant version,
+     *       so always prefer this version.
+     */
+    const value_type* get_const_values() const noexcept
+    {
+        return values_.get_const_data();
+    }
+
+    /**
+     * Returns the column index deltas of the matrix.
+     *
+     * @return the column index deltas of the matrix.
+     */
+    delta_type* get_col_deltas() noexcept { return col_deltas_.get_data(); }
+
+    /**
+     * @copydoc DeltaCsr::get_col_deltas()
+     *
+     * @note This is the constant version of the function, which can be
+     *       significantly more memory efficient than the non-constant version,
+     *       so always prefer this version.
+     */
+    const delta_type* get_const_col_deltas() const noexcept
+    {
+        return col_deltas_.get_const_data();
+    }
+
+    /**
+     * Returns the column index bases of the rows.
+     *
+     * @return the column index bases of the rows.
+     */
+    index_type* get_col_bases() noexcept { return col_bases_.get_data(); }
+
+    /**
+     * @copydoc DeltaCsr::get_col_bases()
+     *
+     * @note This is the constant version of the function, which can be
+     *       significantly more memory efficient than the non-constant version,
+     *       so always prefer this version.
+     */
+    const index_type* get_const_col_bases() const noexcept
+    {
+        return col_bases_.get_const_data();
+    }
+
+    /**
+     * Returns the row pointers of the matrix.
+     *
+     * @return the row pointers of the matrix.
+     */
+    index_type* get_row_ptrs() noexcept { return row_ptrs_.get_data(); }
+
+    /**
+     * @copydoc DeltaCsr::get_row_ptrs()
+     *
+     * @note This is the constant version of the function, which can be
+     *       significantly more memory efficient than the non-constant version,
+     *       so always prefer this version.
+     */
+    const index_type* get_const_row_ptrs() const noexcept
+    {
+        return row_ptrs_.get_const_data();
+    }
+
+    /**
+     * Returns the escape pointers of the matrix.
+     *
+     * @return the escape pointers of the matrix.
+     */
+    index_type* get_escape_ptrs() noexcept { return escape_ptrs_.get_data(); }
+
+    /**
+     * @copydoc DeltaCsr::get_escape_ptrs()
+     *
+     * @note This is the constant version of the function, which can be
+     *       significantly more memory efficient than the non-constant version,
+     *       so always prefer this version.
+     */
+    const index_type* get_const_escape_ptrs() const noexcept
+    {
+        return escape_ptrs_.get_const_data();
+    }
+
+    /**
+     * Returns the escaped column indices of the matrix.
+     *
+     * @return the escaped column indices of the matrix.
+     */
+    index_type* get_escape_col_idxs() noexcept
+    {
+        return escape_col_idxs_.get_data();
+    }
+
+    /**
+     * @copydoc DeltaCsr::get_escape_col_idxs()
+     *
+     * @note This is the constant version of the function, which can be
+     *       significantly more memory efficient than the non-constant version,
+     *       so always prefer this version.
+     */
+    const index_type* get_const_escape_col_idxs() const noexcept
+    {
+        return escape_col_idxs_.get_const_data();
+    }
+
+    /**
+     * Returns the number of elements explicitly stored in the matrix.
+     *
+     * @return the number of elements explicitly stored in the matrix
+     */
+    size_type get_num_stored_elements() const noexcept
+    {
+        return values_.get_num_elems();
+    }
+
+    /**
+     * Returns the number of column indices stored in the escape array.
+     *
+     * @return the number of column indices stored in the escape array
+     */
+    size_type get_num_escapes() const noexcept
+    {
+        return escape_col_idxs_.get_num_elems();
+    }
+
+    /**
+     * Copy-assigns a DeltaCsr matrix. Preserves executor, copies everything
+     * else.
+     */
+    DeltaCsr& operator=(const DeltaCsr&);
+
+    /**
+     * Move-assigns a DeltaCsr matrix. Preserves executor, moves the data and
+     * leaves the moved-from object in an empty state (0x0 LinOp with unchanged
+     * executor, no nonzeros and valid row and escape pointers).
+     */
+    DeltaCsr& operator=(DeltaCsr&&);
+
+    /**
+     * Copy-constructs a DeltaCsr matrix. Inherits executor and data.
+     */
+    DeltaCsr(const DeltaCsr&);
+
+    /**
+     * Move-constructs a DeltaCsr matrix. Inherits executor, moves the data
+     * and leaves the moved-from object in an empty state (0x0 LinOp with
+     * unchanged executor, no nonzeros and valid row and escape pointers).
+     */
+    DeltaCsr(DeltaCsr&&);
+
+protected:
+    /**
+     * Creates an uninitialized DeltaCsr matrix of the specified size.
+     *
+     * @param exec  Executor associated to the matrix
+     * @param size  size of the matrix
+     * @param num_nonzeros  number of nonzeros
+     * @param num_escapes  number of column indices stored in the escape array
+     */
+    DeltaCsr(std::shared_ptr<const Executor> exec,
+             const dim<2>& size = dim<2>{}, size_type num_nonzeros = {},
+             size_type num_escapes = {})
+        : EnableLinOp<DeltaCsr>(exec, size),
+          values_(exec, num_nonzeros),
+          col_deltas_(exec, num_nonzeros),
+          col_bases_(exec, size[0]),
+          row_ptrs_(exec, size[0] + 1),
+          escape_ptrs_(exec, size[0] + 1),
+          escape_col_idxs_(exec, num_escapes)
+    {
+        row_ptrs_.fill(0);
+        escape_ptrs_.fill(0);
+    }
+
+    void apply_impl(const LinOp* b, LinOp* x) const override;
+
+    void apply_impl(const LinOp* alpha, const LinOp* b, const LinOp* beta,
+                    LinOp* x) const override;
+
+private:
+    array<value_type> values_;
+    array<delta_type> col_deltas_;
+    array<index_type> col_bases_;
+    array<index_type> row_ptrs_;
+    array<index_type> escape_ptrs_;
+    array<index_type> escape_col_idxs_;
+};
+
+
+}  // namespace matrix
+}  // namespace gko
+
+
+#endif  // GKO_PUBLIC_CORE_MATRIX_DELTA_CSR_HPP_
@@ -459,6 +459,58 @@ private:
 };
 
 
+/**
+ * The block structure detected in a scalar sparse matrix, as returned by
+ * detect_block_structure.
+ */
+struct block_structure {
+    /** The block size, or 1 if no block structure was found. */
+    int block_size;
+
+    /**
+     * The ratio between the number of values stored in Fbcsr format with this
+     * block size and the number of stored elements in the original matrix.
+     * A ratio of 1 means that all blocks are completely filled.
+     */
+    double fill_ratio;
+};
+
+
+/**
+ * Detects the natural block size of a Csr matrix.
+ *
+ * Among the block sizes for which specialized Fbcsr kernels are compiled on
+ * the executor of mtx and which divide both matrix dimensions, the largest one
+ * whose fill ratio does not exceed `max_fill_ratio` is chosen. The host
+ * executors (Reference and OpenMP) support more block sizes than the device
+ * executors. The structure is analyzed on the host executor.
+ *
+ * @param mtx  the matrix whose block structure should be detected
+ * @param max_fill_ratio  the maximal accepted ratio of stored values, explicit
+ *                        zeros included, to the stored elements of mtx
+ *
+ * @return the detected block size together with its fill ratio
+ */
+template <typename ValueType, typename IndexType>
+block_structure detect_block_structure(const Csr<ValueType, IndexType>* mtx,
+                                       double max_fill_ratio = 1.0);
+
+
+/**
+ * Converts a Csr matrix to Fbcsr format, using the block size found by
+ * detect_block_structure.
+ *
+ * @param mtx  the matrix to convert
+ * @param max_fill_ratio  the maximal accepted fill ratio, see
+ *                        detect_block_structure
+ *
+ * @return the matrix in Fbcsr format on the executor of mtx
+ */
+template <typename ValueType, typename IndexType>
+std::unique_ptr<Fbcsr<ValueType, IndexType>> convert_to_fbcsr(
+    const Csr<ValueType, IndexType>* mtx, double max_fill_ratio = 1.0);
+
+
 }  // namespace matrix
 }  // namespace gko
 
@@ -44,6 +44,7 @@ namespace matrix {
 
 constexpr int default_slice_size = 64;
 constexpr int default_stride_factor = 1;
+constexpr int default_sorting_window = 1;
 
 
 template <typename ValueType>
@@ -60,6 +61,13 @@ class Csr;
  * This implementation uses the column index value invalid_index<IndexType>()
  * to mark padding entries that are not part of the sparsity pattern.
  *
+ * With a sorting window (sigma) larger than one, the matrix is stored in
+ * SELL-C-sigma layout: within each window of sigma consecutive rows, the rows
+ * are sorted by decreasing length before they are divided into slices, which
+ * reduces the padding for matrices with irregular row lengths. The row
+ * permutation is kept inside the matrix, so all operations still refer to the
+ * original row order.
+ *
  * @tparam ValueType  precision of matrix elements
  * @tparam IndexType  precision of matrix indexes
  *
@@ -217,6 +225,26 @@ public:
      */
     size_type get_stride_factor() const noexcept { return stride_factor_; }
 
+    /**
+     * Returns the sorting window (sigma) of SELL-C-sigma.
+     *
+     * @return the number of consecutive rows that are sorted by their length
+     *         before slicing, 1 if the rows are stored in their original order.
+     */
+    size_type get_sorting_window() const noexcept { return sorting_window_; }
+
+    /**
+     * Returns the row permutation of the matrix, i.e. the original row index
+     * of each stored row.
+     *
+     * @return the row permutation, or nullptr if the rows are stored in their
+     *         original order.
+     */
+    const index_type* get_const_permutation() const noexcept
+    {
+        return permutation_.get_const_data();
+    }
+
     /**
      * Returns the total column number.
      *
@@ -359,13 +387,34 @@ protected:
      */
     Sellp(std::shared_ptr<const Executor> exec, const dim<2>& size,
           size_type slice_size, size_type stride_factor, size_type total_cols)
+        : Sellp(std::move(exec), size, slice_size, stride_factor,
+                default_sorting_window, total_cols)
+    {}
+
+    /**
+     * Creates an uninitialized SELL-C-sigma matrix of the specified size.
+     *
+     * @param exec  Executor associated to the matrix
+     * @param size  size of the matrix
+     * @param slice_size  number of rows in each slice
+     * @param stride_factor  factor for the stride in each slice (strides
+     *                        should be multiples of the stride_factor)
+     * @param sorting_window  number of consecutive rows (sigma) that are
+     *                        sorted by their length when the matrix is filled
+     * @param total_cols   number of the sum of all cols in every slice.
+     */
+    Sellp(std::shared_ptr<const Executor> exec, const dim<2>& size,
+          size_type slice_size, size_type stride_factor,
+          size_type sorting_window, size_type total_cols)
         : EnableLinOp<Sellp>(exec, size),
           values_(exec, slice_size * total_cols),
           col_idxs_(exec, slice_size * total_cols),
           slice_lengths_(exec, ceildiv(size[0], slice_size)),
           slice_sets_(exec, ceildiv(size[0], slice_size) + 1),
+          permutation_(exec),
           slice_size_(slice_size),
-          stride_factor_(stride_factor)
+          stride_factor_(stride_factor),
+          sorting_window_(sorting_window)
     {
         slice_sets_.fill(0);
         slice_lengths_.fill(0);
@@ -387,8 +436,10 @@ private:
     array<index_type> col_idxs_;
     array<size_type> slice_lengths_;
     array<size_type> slice_sets_;
+    array<index_type> permutation_;
     size_type slice_size_;
     size_type stride_factor_;
+    size_type sorting_window_;
 };
 
 
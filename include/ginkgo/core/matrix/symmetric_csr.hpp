@@ -0,0 +1,242 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2022, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#ifndef GKO_PUBLIC_CORE_MATRIX_SYMMETRIC_CSR_HPP_
+#define GKO_PUBLIC_CORE_MATRIX_SYMMETRIC_CSR_HPP_
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/lin_op.hpp>
+#include <ginkgo/core/base/polymorphic_object.hpp>
+
+
+namespace gko {
+namespace matrix {
+
+
+template <typename ValueType, typename IndexType>
+class Csr;
+
+
+template <typename ValueType>
+class Dense;
+
+
+/**
+ * SymmetricCsr is a compressed sparse row format for symmetric matrices (or
+ * Hermitian matrices for complex value types) which only stores the upper
+ * triangle including the diagonal.
+ *
+ * The row pointer, column index and value arrays are the same as in the Csr
+ * format, but only contain the entries with a column index not smaller than
+ * their row index. Each stored off-diagonal entry a_ij also represents the
+ * entry a_ji = conj(a_ij) of the lower triangle. When converting from a Csr
+ * matrix, its lower triangle is ignored, so the conversion is only exact for
+ * symmetric (Hermitian) matrices.
+ *
+ * Compared to the Csr format, this halves the memory traffic of a sparse
+ * matrix-vector product for matrices with few diagonal entries. The columns of
+ * each row are stored sorted by column index.
+ *
+ * @tparam ValueType  precision of matrix elements
+ * @tparam IndexType  precision of matrix indexes
+ *
+ * @ingroup mat_formats
+ * @ingroup LinOp
+ */
+template <typename ValueType = default_precision, typename IndexType = int32>
+class SymmetricCsr
+    : public EnableLinOp<SymmetricCsr<ValueType, IndexType>>,
+      public EnableCreateMethod<SymmetricCsr<ValueType, IndexType>>,
+      public ConvertibleTo<Csr<ValueType, IndexType>>,
+      public ReadableFromMatrixData<ValueType, IndexType>,
+      public WritableToMatrixData<ValueType, IndexType> {
+    friend class EnableCreateMethod<SymmetricCsr>;
+    friend class EnablePolymorphicObject<SymmetricCsr, LinOp>;
+    friend class Csr<ValueType, IndexType>;
+
+public:
+    using EnableLinOp<SymmetricCsr>::convert_to;
+    using EnableLinOp<SymmetricCsr>::move_to;
+    using ReadableFromMatrixData<ValueType, IndexType>::read;
+
+    using value_type = ValueType;
+    using index_type = IndexType;
+    using mat_data = matrix_data<ValueType, IndexType>;
+    using device_mat_data = device_matrix_data<ValueType, IndexType>;
+
+    void convert_to(Csr<ValueType, IndexType>* result) const override;
+
+    void move_to(Csr<ValueType, IndexType>* result) override;
+
+    void read(const mat_data& data) override;
+
+    void read(const device_mat_data& data) override;
+
+    void read(device_mat_data&& data) override;
+
+    void write(mat_data& data) const override;
+
+    /**
+     * Returns the values of the upper triangle.
+     *
+     * @return the values of the upper triangle.
+     */
+    value_type* get_values() noexcept { return values_.get_data(); }
+
+    /**
+     * @copydoc SymmetricCsr::get_values()
+     *
+     * @note This is the constant version of the function, which can be
+     *       significantly more memory efficient than the non-constant version,
+     *       so always prefer this version.
+     */
+    const value_type* get_const_values() const noexcept
+    {
+        return values_.get_const_data();
+    }
+
+    /**
+     * Returns the column indexes of the upper triangle.
+     *
+     * @return the column indexes of the upper triangle.
+     */
+    index_type* get_col_idxs() noexcept { return col_idxs_.get_data(); }
+
+    /**
+     * @copydoc SymmetricCsr::get_col_idxs()
+     *
+     * @note This is the constant version of the function, which can be
+     *       significantly more memory efficient than the non-constant version,
+     *       so always prefer this version.
+     */
+    const index_type* get_const_col_idxs() const noexcept
+    {
+        return col_idxs_.get_const_data();
+    }
+
+    /**
+     * Returns the row pointers of the upper triangle.
+     *
+     * @return the row pointers of the upper triangle.
+     */
+    index_type* get_row_ptrs() noexcept { return row_ptrs_.get_data(); }
+
+    /**
+     * @copydoc SymmetricCsr::get_row_ptrs()
+     *
+     * @note This is the constant version of the function, which can be
+     *       significantly more memory efficient than the non-constant version,
+     *       so always prefer this version.
+     */
+    const index_type* get_const_row_ptrs() const noexcept
+    {
+        return row_ptrs_.get_const_data();
+    }
+
+    /**
+     * Returns the number of elements explicitly stored in the matrix, i.e.
+     * the number of entries in the upper triangle including the diagonal.
+     *
+     * @return the number of elements explicitly stored in the matrix
+     */
+    size_type get_num_stored_elements() const noexcept
+    {
+        return values_.get_num_elems();
+    }
+
+    /**
+     * Copy-assigns a SymmetricCsr matrix. Preserves executor, copies
+     * everything else.
+     */
+    SymmetricCsr& operator=(const SymmetricCsr&);
+
+    /**
+     * Move-assigns a SymmetricCsr matrix. Preserves executor, moves the data
+     * and leaves the moved-from object in an empty state (0x0 LinOp with
+     * unchanged executor, no nonzeros and valid row pointers).
+     */
+    SymmetricCsr& operator=(SymmetricCsr&&);
+
+    /**
+     * Copy-constructs a SymmetricCsr matrix. Inherits executor and data.
+     */
+    SymmetricCsr(const SymmetricCsr&);
+
+    /**
+     * Move-constructs a SymmetricCsr matrix. Inherits executor, moves the data
+     * and leaves the moved-from object in an empty state (0x0 LinOp with
+     * unchanged executor, no nonzeros and valid row pointers).
+     */
+    SymmetricCsr(SymmetricCsr&&);
+
+protected:
+    /**
+     * Creates an uninitialized SymmetricCsr matrix of the specified size.
+     *
+     * @param exec  Executor associated to the matrix
+     * @param size  size of the matrix, which needs to be square
+     * @param num_nonzeros  number of nonzeros in the upper triangle
+     */
+    SymmetricCsr(std::shared_ptr<const Executor> exec,
+                 const dim<2>& size = dim<2>{}, size_type num_nonzeros = {})
+        : EnableLinOp<SymmetricCsr>(exec, size),
+          values_(exec, num_nonzeros),
+          col_idxs_(exec, num_nonzeros),
+          row_ptrs_(exec, size[0] + 1),
+          buffer_(exec)
+    {
+        GKO_ASSERT_IS_SQUARE_MATRIX(size);
+        row_ptrs_.fill(0);
+    }
+
+    void apply_impl(const LinOp* b, LinOp* x) const override;
+
+    void apply_impl(const LinOp* alpha, const LinOp* b, const LinOp* beta,
+                    LinOp* x) const override;
+
+private:
+    array<value_type> values_;
+    array<index_type> col_idxs_;
+    array<index_type> row_ptrs_;
+    // workspace of the SpMV kernels, reused across applications
+    mutable array<char> buffer_;
+};
+
+
+}  // namespace matrix
+}  // namespace gko
+
+
+#endif  // GKO_PUBLIC_CORE_MATRIX_SYMMETRIC_CSR_HPP_
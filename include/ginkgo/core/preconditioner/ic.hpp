@@ -82,6 +82,10 @@ namespace preconditioner {
  * considered the L^H matrix, which helps to avoid the otherwise necessary
  * transposition of L inside the solver. ParIc can be directly used, since it
  * orders the factors in the correct way.
+ * To update the preconditioner for a matrix with new values but an unchanged
+ * sparsity pattern, the factors can be recomputed using ParIc::refactorize,
+ * which reuses the sparsity pattern of the previous factor, and passed to the
+ * factory.
  *
  * @note When providing a gko::Composition, the first matrix must be the lower
  *       matrix ($L$), and the second matrix must be its conjugate-transpose
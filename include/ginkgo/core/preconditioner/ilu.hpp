@@ -81,6 +81,10 @@ namespace preconditioner {
  * used, the first operand will be taken as the L matrix, the second will be
  * considered the U matrix. ParIlu can be directly used, since it orders the
  * factors in the correct way.
+ * To update the preconditioner for a matrix with new values but an unchanged
+ * sparsity pattern, the factors can be recomputed using ParIlu::refactorize
+ * or ParIlut::refactorize, which reuse the sparsity pattern of the previous
+ * factors, and passed to the factory.
  *
  * @note When providing a gko::Composition, the first matrix must be the lower
  *       matrix ($L$), and the second matrix must be the upper matrix ($U$).
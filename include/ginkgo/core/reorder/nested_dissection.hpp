@@ -0,0 +1,155 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2022, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#ifndef GKO_PUBLIC_CORE_REORDER_NESTED_DISSECTION_HPP_
+#define GKO_PUBLIC_CORE_REORDER_NESTED_DISSECTION_HPP_
+
+
+#include <memory>
+
+
+#include <ginkgo/core/base/abstract_factory.hpp>
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/lin_op.hpp>
+#include <ginkgo/core/base/polymorphic_object.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/base/utils.hpp>
+#include <ginkgo/core/matrix/permutation.hpp>
+#include <ginkgo/core/matrix/sparsity_csr.hpp>
+#include <ginkgo/core/reorder/reordering_base.hpp>
+
+
+namespace gko {
+namespace reorder {
+
+
+/**
+ * NestedDissection is a fill-reducing reordering that recursively splits the
+ * graph of the matrix into two parts by a small vertex separator, and orders
+ * the separator after both parts (George: Nested Dissection of a Regular
+ * Finite Element Mesh). Eliminating the vertices of one part then creates no
+ * fill-in in the other part. For matrices from 2D and 3D meshes, this
+ * typically results in less fill-in and a more balanced elimination tree than
+ * Amd, and thus more parallelism in the factorization.
+ *
+ * The separators are computed from the level structure rooted at a
+ * pseudo-peripheral vertex. Subgraphs with at most `leaf_size` vertices are
+ * not dissected further and ordered using approximate minimum degree instead.
+ * On the OpenMP executor, independent subgraphs are ordered in parallel.
+ *
+ * The sparsity pattern of the matrix is assumed to be symmetric. For matrices
+ * with an unsymmetric pattern, the reordering should be computed from the
+ * pattern of A + A^T.
+ *
+ * The reordering is always computed on the host. If the executor of the
+ * factory is a device executor, the resulting permutations are copied to it.
+ *
+ * @tparam ValueType  Type of the values of all matrices used in this class
+ * @tparam IndexType  Type of the indices of all matrices used in this class
+ *
+ * @ingroup reorder
+ */
+template <typename ValueType = default_precision, typename IndexType = int32>
+class NestedDissection
+    : public EnablePolymorphicObject<NestedDissection<ValueType, IndexType>,
+                                     ReorderingBase<IndexType>>,
+      public EnablePolymorphicAssignment<
+          NestedDissection<ValueType, IndexType>> {
+    friend class EnablePolymorphicObject<NestedDissection,
+                                         ReorderingBase<IndexType>>;
+
+public:
+    using SparsityMatrix = matrix::SparsityCsr<ValueType, IndexType>;
+    using PermutationMatrix = matrix::Permutation<IndexType>;
+    using value_type = ValueType;
+    using index_type = IndexType;
+
+    /**
+     * Gets the permutation (permutation matrix, output of the algorithm) of the
+     * linear operator.
+     *
+     * @return the permutation (permutation matrix)
+     */
+    std::shared_ptr<const PermutationMatrix> get_permutation() const
+    {
+        return permutation_;
+    }
+
+    /**
+     * Gets the inverse permutation (permutation matrix, output of the
+     * algorithm) of the linear operator.
+     *
+     * @return the inverse permutation (permutation matrix)
+     */
+    std::shared_ptr<const PermutationMatrix> get_inverse_permutation() const
+    {
+        return inv_permutation_;
+    }
+
+    GKO_CREATE_FACTORY_PARAMETERS(parameters, Factory)
+    {
+        /**
+         * If this parameter is set then an inverse permutation matrix is also
+         * constructed along with the normal permutation matrix.
+         */
+        bool GKO_FACTORY_PARAMETER_SCALAR(construct_inverse_permutation, false);
+
+        /**
+         * The maximum number of vertices of a subgraph that is not dissected
+         * further, but ordered using approximate minimum degree.
+         */
+        size_type GKO_FACTORY_PARAMETER_SCALAR(leaf_size, 64);
+    };
+    GKO_ENABLE_REORDERING_BASE_FACTORY(NestedDissection, parameters, Factory);
+    GKO_ENABLE_BUILD_METHOD(Factory);
+
+protected:
+    explicit NestedDissection(std::shared_ptr<const Executor> exec)
+        : EnablePolymorphicObject<NestedDissection, ReorderingBase<IndexType>>(
+              std::move(exec))
+    {}
+
+    explicit NestedDissection(const Factory* factory,
+                              const ReorderingBaseArgs& args);
+
+private:
+    std::shared_ptr<PermutationMatrix> permutation_;
+    std::shared_ptr<PermutationMatrix> inv_permutation_;
+};
+
+
+}  // namespace reorder
+}  // namespace gko
+
+
+#endif  // GKO_PUBLIC_CORE_REORDER_NESTED_DISSECTION_HPP_
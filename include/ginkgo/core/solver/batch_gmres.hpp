@@ -0,0 +1,131 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2022, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#ifndef GKO_PUBLIC_CORE_SOLVER_BATCH_GMRES_HPP_
+#define GKO_PUBLIC_CORE_SOLVER_BATCH_GMRES_HPP_
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/lin_op.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/solver/batch_solver_base.hpp>
+#include <ginkgo/core/stop/residual_norm.hpp>
+
+
+namespace gko {
+namespace solver {
+
+
+/**
+ * BatchGmres solves a batch of independent linear systems with the restarted
+ * generalized minimal residual method, which is suitable for general systems.
+ * The systems are solved without preconditioning.
+ *
+ * The system matrix needs to be a batch matrix (BatchCsr, BatchEll or
+ * BatchDense). The right-hand sides and solutions are Dense vectors storing
+ * the vectors of all batch items back to back, see Batched. Every system and
+ * right-hand side is stopped independently once its residual norm drops below
+ * the tolerance or the iteration limit is reached. The number of iterations
+ * and final residual norm of each system are reported through the
+ * `batch_solver_completed` logger event, e.g. to log::BatchConvergence.
+ *
+ * @tparam ValueType  precision of the matrix elements
+ *
+ * @ingroup solvers
+ * @ingroup LinOp
+ */
+template <typename ValueType = default_precision>
+class BatchGmres : public EnableBatchSolver<BatchGmres<ValueType>, ValueType> {
+    friend class EnableLinOp<BatchGmres>;
+    friend class EnablePolymorphicObject<BatchGmres, LinOp>;
+
+public:
+    using value_type = ValueType;
+    using real_type = remove_complex<ValueType>;
+
+    GKO_CREATE_FACTORY_PARAMETERS(parameters, Factory)
+    {
+        /**
+         * Maximum number of iterations for each system.
+         */
+        size_type GKO_FACTORY_PARAMETER_SCALAR(max_iterations, 100u);
+
+        /**
+         * Residual norm tolerance, relative to the quantity selected by
+         * tolerance_type.
+         */
+        real_type GKO_FACTORY_PARAMETER_SCALAR(tolerance, 1e-8);
+
+        /**
+         * How the tolerance is interpreted: as an absolute bound on the
+         * residual norm, or relative to the initial residual norm or the norm
+         * of the right-hand side of each system.
+         */
+        stop::mode GKO_FACTORY_PARAMETER_SCALAR(tolerance_type,
+                                                stop::mode::rhs_norm);
+
+        /**
+         * Krylov subspace dimension, i.e. the number of iterations between
+         * restarts.
+         */
+        size_type GKO_FACTORY_PARAMETER_SCALAR(krylov_dim, 30u);
+    };
+    GKO_ENABLE_LIN_OP_FACTORY(BatchGmres, parameters, Factory);
+    GKO_ENABLE_BUILD_METHOD(Factory);
+
+protected:
+    void apply_batch_kernel(
+        const matrix::Dense<ValueType>* b, matrix::Dense<ValueType>* x,
+        array<ValueType>& workspace, array<int32>& num_iterations,
+        matrix::Dense<real_type>* residual_norms) const override;
+
+    explicit BatchGmres(std::shared_ptr<const Executor> exec)
+        : EnableBatchSolver<BatchGmres, ValueType>(std::move(exec))
+    {}
+
+    explicit BatchGmres(const Factory* factory,
+                        std::shared_ptr<const LinOp> system_matrix)
+        : EnableBatchSolver<BatchGmres, ValueType>(factory->get_executor(),
+                                                   std::move(system_matrix)),
+          parameters_{factory->get_parameters()}
+    {}
+};
+
+
+}  // namespace solver
+}  // namespace gko
+
+
+#endif  // GKO_PUBLIC_CORE_SOLVER_BATCH_GMRES_HPP_
@@ -0,0 +1,190 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2022, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#ifndef GKO_PUBLIC_CORE_SOLVER_BATCH_SOLVER_BASE_HPP_
+#define GKO_PUBLIC_CORE_SOLVER_BATCH_SOLVER_BASE_HPP_
+
+
+#include <memory>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/lin_op.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/precision_dispatch.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/base/utils.hpp>
+#include <ginkgo/core/log/logger.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/solver/solver_base.hpp>
+
+
+namespace gko {
+namespace solver {
+
+
+/**
+ * The EnableBatchSolver mixin implements the application of a batched solver,
+ * which only differs between the solvers in the kernel that is run. It solves
+ * the system of every batch item and right-hand side and logs the iteration
+ * counts and residual norms through the `batch_solver_completed` event.
+ *
+ * The kernel workspace, the iteration counts and the residual norms are stored
+ * in the solver and reused across applications. They only grow, so repeatedly
+ * applying the solver to right-hand sides of the same size does not allocate.
+ *
+ * @tparam ConcreteSolver  the batched solver, it needs to implement
+ *                         apply_batch_kernel
+ * @tparam ValueType  precision of the matrix elements
+ *
+ * @ingroup solvers
+ */
+template <typename ConcreteSolver, typename ValueType>
+class EnableBatchSolver : public EnableLinOp<ConcreteSolver>,
+                          public EnableSolverBase<ConcreteSolver> {
+public:
+    using value_type = ValueType;
+    using real_type = remove_complex<ValueType>;
+
+    /**
+     * Return true as iterative solvers use the data in x as an initial guess.
+     *
+     * @return true as iterative solvers use the data in x as an initial guess.
+     */
+    bool apply_uses_initial_guess() const override { return true; }
+
+protected:
+    explicit EnableBatchSolver(std::shared_ptr<const Executor> exec)
+        : EnableLinOp<ConcreteSolver>(exec),
+          workspace_{exec},
+          num_iterations_{exec},
+          residual_norms_{exec}
+    {}
+
+    /**
+     * @throw NotSupported  if the system matrix is not Batched
+     */
+    EnableBatchSolver(std::shared_ptr<const Executor> exec,
+                      std::shared_ptr<const LinOp> system_matrix)
+        : EnableLinOp<ConcreteSolver>(
+              exec, gko::transpose(system_matrix->get_size())),
+          EnableSolverBase<ConcreteSolver>{system_matrix},
+          workspace_{exec},
+          num_iterations_{exec},
+          residual_norms_{exec}
+    {
+        // throws if the system matrix is not a batch matrix
+        as<Batched>(system_matrix.get());
+    }
+
+    /**
+     * Runs the solver kernel on every system of the batch.
+     *
+     * @param b  the right-hand sides of all batch items
+     * @param x  the initial guesses and solutions of all batch items
+     * @param workspace  the kernel workspace, the kernel grows it if necessary
+     * @param num_iterations  the output iteration count of every system
+     * @param residual_norms  the output residual norm of every system, with one
+     *                        row per batch item and one column per right-hand
+     *                        side
+     */
+    virtual void apply_batch_kernel(
+        const matrix::Dense<ValueType>* b, matrix::Dense<ValueType>* x,
+        array<ValueType>& workspace, array<int32>& num_iterations,
+        matrix::Dense<real_type>* residual_norms) const = 0;
+
+    void apply_impl(const LinOp* b, LinOp* x) const override
+    {
+        if (!this->get_system_matrix()) {
+            return;
+        }
+        precision_dispatch_real_complex<ValueType>(
+            [this](auto dense_b, auto dense_x) {
+                this->apply_dense_impl(dense_b, dense_x);
+            },
+            b, x);
+    }
+
+    void apply_impl(const LinOp* alpha, const LinOp* b, const LinOp* beta,
+                    LinOp* x) const override
+    {
+        if (!this->get_system_matrix()) {
+            return;
+        }
+        precision_dispatch_real_complex<ValueType>(
+            [this](auto dense_alpha, auto dense_b, auto dense_beta,
+                   auto dense_x) {
+                auto x_clone = dense_x->clone();
+                this->apply_dense_impl(dense_b, x_clone.get());
+                dense_x->scale(dense_beta);
+                dense_x->add_scaled(dense_alpha, x_clone.get());
+            },
+            alpha, b, beta, x);
+    }
+
+    void apply_dense_impl(const matrix::Dense<ValueType>* b,
+                          matrix::Dense<ValueType>* x) const
+    {
+        auto exec = this->get_executor();
+        const auto num_items = as<Batched>(this->get_system_matrix().get())
+                                   ->get_num_batch_items();
+        const auto num_rhs = b->get_size()[1];
+        const auto num_systems = num_items * num_rhs;
+        if (num_iterations_.get_num_elems() < num_systems) {
+            num_iterations_.resize_and_reset(num_systems);
+            residual_norms_.resize_and_reset(num_systems);
+        }
+        auto num_iterations =
+            make_array_view(exec, num_systems, num_iterations_.get_data());
+        auto residual_norms = matrix::Dense<real_type>::create(
+            exec, dim<2>{num_items, num_rhs},
+            make_array_view(exec, num_systems, residual_norms_.get_data()),
+            num_rhs);
+        this->apply_batch_kernel(b, x, workspace_, num_iterations,
+                                 residual_norms.get());
+        this->template log<log::Logger::batch_solver_completed>(
+            this, &num_iterations, residual_norms.get());
+    }
+
+private:
+    mutable array<ValueType> workspace_;
+    mutable array<int32> num_iterations_;
+    mutable array<real_type> residual_norms_;
+};
+
+
+}  // namespace solver
+}  // namespace gko
+
+
+#endif  // GKO_PUBLIC_CORE_SOLVER_BATCH_SOLVER_BASE_HPP_
@@ -46,6 +46,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ginkgo/core/log/logger.hpp>
 #include <ginkgo/core/matrix/dense.hpp>
 #include <ginkgo/core/matrix/identity.hpp>
+#include <ginkgo/core/solver/gmres.hpp>
 #include <ginkgo/core/solver/solver_base.hpp>
 #include <ginkgo/core/stop/combined.hpp>
 #include <ginkgo/core/stop/criterion.hpp>
@@ -105,8 +106,8 @@ enum class storage_precision {
  *
  * The implementation in Ginkgo makes use of the merged kernel to make the best
  * use of data locality. The inner operations in one iteration of CB-GMRES
- * are merged into 2 separate steps. Classical Gram-Schmidt with
- * reorthogonalization is used.
+ * are merged into 2 separate steps. By default, classical Gram-Schmidt with
+ * conditional reorthogonalization is used.
  *
  * The Krylov basis can be stored in reduced precision (compressed) to reduce
  * memory accesses, while all computations (including Krylov basis operations)
@@ -184,6 +185,14 @@ public:
          * Krylov dimension factory.
          */
         size_type GKO_FACTORY_PARAMETER_SCALAR(krylov_dim, 100u);
+
+        /**
+         * Orthogonalization method used in the Arnoldi process. Only the
+         * classical Gram-Schmidt variants cgs, cgs2 and cgs_conditional are
+         * supported, since the compressed basis is read in fused passes.
+         */
+        gmres::ortho_method GKO_FACTORY_PARAMETER_SCALAR(
+            orthogonalization, gmres::ortho_method::cgs_conditional);
     };
     GKO_ENABLE_LIN_OP_FACTORY(CbGmres, parameters, Factory);
     GKO_ENABLE_BUILD_METHOD(Factory);
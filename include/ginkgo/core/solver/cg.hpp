@@ -65,6 +65,10 @@ namespace solver {
  * use of data locality. The inner operations in one iteration of CG are merged
  * into 2 separate steps.
  *
+ * On host executors, the SpMV with a Csr system matrix using a row-based
+ * strategy is fused with the subsequent dot product. In that case, the system
+ * matrix's apply is not called, so it does not log any apply events.
+ *
  * @tparam ValueType  precision of matrix elements
  *
  * @ingroup solvers
@@ -176,6 +180,8 @@ struct workspace_traits<Cg<ValueType>> {
     constexpr static int one = 8;
     // constant -1.0 scalar
     constexpr static int minus_one = 9;
+    // residual norm scalar
+    constexpr static int residual_norm = 10;
 
     // stopping status array
     constexpr static int stop = 0;
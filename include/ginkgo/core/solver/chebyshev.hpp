@@ -0,0 +1,281 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2022, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#ifndef GKO_PUBLIC_CORE_SOLVER_CHEBYSHEV_HPP_
+#define GKO_PUBLIC_CORE_SOLVER_CHEBYSHEV_HPP_
+
+
+#include <utility>
+#include <vector>
+
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/lin_op.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/matrix/identity.hpp>
+#include <ginkgo/core/solver/solver_base.hpp>
+#include <ginkgo/core/stop/combined.hpp>
+#include <ginkgo/core/stop/criterion.hpp>
+#include <ginkgo/core/stop/iteration.hpp>
+
+
+namespace gko {
+namespace solver {
+
+
+/**
+ * Chebyshev iteration is a polynomial method for systems whose preconditioned
+ * spectrum lies in a known real interval `[lower, upper]`, e.g. symmetric
+ * positive definite systems.
+ *
+ * Each iteration applies the system matrix and the preconditioner once and
+ * updates the solution with coefficients that only depend on the interval
+ * bounds:
+ *
+ * ```
+ * theta = (upper + lower) / 2, delta = (upper - lower) / 2
+ * residual = b - A solution
+ * update = M residual / theta
+ * solution = solution + update
+ * while not converged:
+ *     residual = b - A solution
+ *     alpha = 2 / (2 theta - tau), beta = tau alpha / 2
+ *     update = alpha M residual + beta update
+ *     solution = solution + update
+ *     tau = delta^2 alpha / 2
+ * ```
+ * with `tau = delta^2 / theta` initially. Apart from the stopping criteria,
+ * this needs no inner products, so a fixed number of iterations enforced by
+ * stop::Iteration applies a fixed-degree polynomial in `M A` that only needs
+ * SpMVs and vector updates. This makes Chebyshev a good smoother for
+ * Multigrid.
+ *
+ * Unless the bounds are provided via the `eigenvalue_bounds` factory
+ * parameter, the upper bound is estimated by a few steps of the power
+ * iteration on `M A` during generation, enlarged by `max_eigenvalue_scale`.
+ * The lower bound defaults to `upper / eigenvalue_ratio`, which targets the
+ * upper part of the spectrum as required for smoothing. The estimation uses
+ * non-distributed vectors, so distributed system matrices require the
+ * bounds to be provided.
+ *
+ * @tparam ValueType  precision of matrix elements
+ *
+ * @ingroup solvers
+ * @ingroup LinOp
+ */
+template <typename ValueType = default_precision>
+class Chebyshev
+    : public EnableLinOp<Chebyshev<ValueType>>,
+      public EnablePreconditionedIterativeSolver<ValueType,
+                                                 Chebyshev<ValueType>>,
+      public EnableApplyWithInitialGuess<Chebyshev<ValueType>>,
+      public Transposable {
+    friend class EnableLinOp<Chebyshev>;
+    friend class EnablePolymorphicObject<Chebyshev, LinOp>;
+    friend class EnableApplyWithInitialGuess<Chebyshev>;
+
+public:
+    using value_type = ValueType;
+    using transposed_type = Chebyshev<ValueType>;
+    using eigenvalue_type = remove_complex<ValueType>;
+
+    std::unique_ptr<LinOp> transpose() const override;
+
+    std::unique_ptr<LinOp> conj_transpose() const override;
+
+    /**
+     * Return true as iterative solvers use the data in x as an initial guess.
+     *
+     * @return true as iterative solvers use the data in x as an initial guess.
+     */
+    bool apply_uses_initial_guess() const override
+    {
+        return this->get_default_initial_guess() ==
+               initial_guess_mode::provided;
+    }
+
+    /**
+     * Returns the bounds `(lower, upper)` of the spectrum of the preconditioned
+     * system matrix the Chebyshev polynomial is built for.
+     *
+     * @return the eigenvalue bounds used by this solver
+     */
+    std::pair<eigenvalue_type, eigenvalue_type> get_eigenvalue_bounds() const
+    {
+        return eigenvalue_bounds_;
+    }
+
+    GKO_CREATE_FACTORY_PARAMETERS(parameters, Factory)
+    {
+        /**
+         * Criterion factories.
+         */
+        std::vector<std::shared_ptr<const stop::CriterionFactory>>
+            GKO_FACTORY_PARAMETER_VECTOR(criteria, nullptr);
+
+        /**
+         * Preconditioner factory.
+         */
+        std::shared_ptr<const LinOpFactory> GKO_FACTORY_PARAMETER_SCALAR(
+            preconditioner, nullptr);
+
+        /**
+         * Already generated preconditioner. If one is provided, the factory
+         * `preconditioner` will be ignored.
+         */
+        std::shared_ptr<const LinOp> GKO_FACTORY_PARAMETER_SCALAR(
+            generated_preconditioner, nullptr);
+
+        /**
+         * The bounds `(lower, upper)` of the spectrum of the preconditioned
+         * system matrix. If `upper` is zero, it is estimated during
+         * generation. If `lower` is zero, it is set to
+         * `upper / eigenvalue_ratio`.
+         */
+        std::pair<eigenvalue_type, eigenvalue_type>
+            GKO_FACTORY_PARAMETER_VECTOR(eigenvalue_bounds, eigenvalue_type{},
+                                         eigenvalue_type{});
+
+        /**
+         * The number of power iteration steps used to estimate the largest
+         * eigenvalue.
+         */
+        size_type GKO_FACTORY_PARAMETER_SCALAR(num_power_iterations, 10u);
+
+        /**
+         * The factor the estimated largest eigenvalue is enlarged by to make
+         * up for the underestimation of the power iteration.
+         */
+        eigenvalue_type GKO_FACTORY_PARAMETER_SCALAR(max_eigenvalue_scale,
+                                                     eigenvalue_type{1.1});
+
+        /**
+         * The ratio between the upper and the lower bound if the lower bound
+         * is not provided.
+         */
+        eigenvalue_type GKO_FACTORY_PARAMETER_SCALAR(eigenvalue_ratio,
+                                                     eigenvalue_type{30});
+
+        /**
+         * Default initial guess mode. The available options are under
+         * initial_guess_mode.
+         */
+        initial_guess_mode GKO_FACTORY_PARAMETER_SCALAR(
+            default_initial_guess, initial_guess_mode::provided);
+    };
+    GKO_ENABLE_LIN_OP_FACTORY(Chebyshev, parameters, Factory);
+    GKO_ENABLE_BUILD_METHOD(Factory);
+
+protected:
+    void apply_impl(const LinOp* b, LinOp* x) const override;
+
+    template <typename VectorType>
+    void apply_dense_impl(const VectorType* b, VectorType* x,
+                          initial_guess_mode guess) const;
+
+    void apply_impl(const LinOp* alpha, const LinOp* b, const LinOp* beta,
+                    LinOp* x) const override;
+
+    void apply_with_initial_guess_impl(const LinOp* b, LinOp* x,
+                                       initial_guess_mode guess) const override;
+
+    void apply_with_initial_guess_impl(const LinOp* alpha, const LinOp* b,
+                                       const LinOp* beta, LinOp* x,
+                                       initial_guess_mode guess) const override;
+
+    /**
+     * Computes the eigenvalue bounds from the factory parameters, estimating
+     * the largest eigenvalue by the power iteration if necessary.
+     */
+    std::pair<eigenvalue_type, eigenvalue_type> compute_eigenvalue_bounds()
+        const;
+
+    explicit Chebyshev(std::shared_ptr<const Executor> exec)
+        : EnableLinOp<Chebyshev>(std::move(exec))
+    {}
+
+    explicit Chebyshev(const Factory* factory,
+                       std::shared_ptr<const LinOp> system_matrix)
+        : EnableLinOp<Chebyshev>(factory->get_executor(),
+                                 gko::transpose(system_matrix->get_size())),
+          EnablePreconditionedIterativeSolver<ValueType, Chebyshev<ValueType>>{
+              std::move(system_matrix), factory->get_parameters()},
+          parameters_{factory->get_parameters()}
+    {
+        this->set_default_initial_guess(parameters_.default_initial_guess);
+        eigenvalue_bounds_ = this->compute_eigenvalue_bounds();
+    }
+
+private:
+    std::pair<eigenvalue_type, eigenvalue_type> eigenvalue_bounds_{};
+};
+
+
+template <typename ValueType>
+struct workspace_traits<Chebyshev<ValueType>> {
+    using Solver = Chebyshev<ValueType>;
+    // number of vectors used by this workspace
+    static int num_vectors(const Solver&);
+    // number of arrays used by this workspace
+    static int num_arrays(const Solver&);
+    // array containing the num_vectors names for the workspace vectors
+    static std::vector<std::string> op_names(const Solver&);
+    // array containing the num_arrays names for the workspace vectors
+    static std::vector<std::string> array_names(const Solver&);
+    // array containing all varying scalar vectors (independent of problem size)
+    static std::vector<int> scalars(const Solver&);
+    // array containing all varying vectors (dependent on problem size)
+    static std::vector<int> vectors(const Solver&);
+
+    // residual vector
+    constexpr static int residual = 0;
+    // preconditioned residual vector
+    constexpr static int inner_solution = 1;
+    // solution update vector
+    constexpr static int update_solution = 2;
+    // constant 1.0 scalar
+    constexpr static int one = 3;
+    // constant -1.0 scalar
+    constexpr static int minus_one = 4;
+
+    // stopping status array
+    constexpr static int stop = 0;
+};
+
+
+}  // namespace solver
+}  // namespace gko
+
+
+#endif  // GKO_PUBLIC_CORE_SOLVER_CHEBYSHEV_HPP_
@@ -49,7 +49,10 @@ namespace solver {
  * A direct solver based on a factorization into lower and upper triangular
  * factors (with an optional diagonal scaling).
  * The solver is built from the Factorization returned by the provided
- * LinOpFactory.
+ * LinOpFactory, or directly from a Factorization passed to the factory.
+ * The latter allows reusing the symbolic factorization for matrices with an
+ * unchanged sparsity pattern by passing the result of
+ * factorization::Lu::generate_numeric.
  *
  * @tparam ValueType  the type used to store values of the system matrix
  * @tparam IndexType  the type used to store sparsity pattern indices of the
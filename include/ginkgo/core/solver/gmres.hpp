@@ -57,13 +57,49 @@ namespace solver {
 constexpr size_type default_krylov_dim = 100u;
 
 
+namespace gmres {
+
+
+/**
+ * Describes the orthogonalization method that is used in the Arnoldi process
+ * of Gmres and CbGmres. The methods trade the number of global reductions and
+ * passes over the Krylov basis against the orthogonality of the basis:
+ * - mgs: Modified Gram-Schmidt, one reduction and one pass over a basis
+ *        vector for each Hessenberg entry.
+ * - cgs: Classical Gram-Schmidt, a single fused projection onto all basis
+ *        vectors. It uses the fewest passes, but the basis can lose
+ *        orthogonality.
+ * - cgs2: Classical Gram-Schmidt with one unconditional reorthogonalization.
+ * - cgs_conditional: Classical Gram-Schmidt which reorthogonalizes up to
+ *        two times if the norm of the new vector drops by more than a factor
+ *        of 1/sqrt(2) during the projection.
+ * - dcgs2: Low-synchronization classical Gram-Schmidt with delayed
+ *        reorthogonalization, which needs only one reduction per iteration.
+ *        The reorthogonalization of a basis vector is merged into the
+ *        projection of the next iteration, so the residual norm estimate
+ *        lags one iteration behind.
+ */
+enum class ortho_method { mgs, cgs, cgs2, cgs_conditional, dcgs2 };
+
+
+}  // namespace gmres
+
+
 /**
  * GMRES or the generalized minimal residual method is an iterative type Krylov
  * subspace method which is suitable for nonsymmetric linear systems.
  *
  * The implementation in Ginkgo makes use of the merged kernel to make the best
  * use of data locality. The inner operations in one iteration of GMRES are
- * merged into 2 separate steps. Modified Gram-Schmidt is used.
+ * merged into 2 separate steps. By default, modified Gram-Schmidt is used,
+ * other orthogonalization methods can be chosen with the `orthogonalization`
+ * parameter.
+ *
+ * Optionally, the s-step variant generates `s_step` Krylov basis vectors at
+ * once by repeated application of the preconditioned system matrix and
+ * orthogonalizes them as a block with two passes of block classical
+ * Gram-Schmidt and CholQR. This needs two global reductions per block instead
+ * of one per Hessenberg entry.
  *
  * @tparam ValueType  precision of matrix elements
  *
@@ -132,6 +168,29 @@ public:
          * Krylov dimension factory.
          */
         size_type GKO_FACTORY_PARAMETER_SCALAR(krylov_dim, 0u);
+
+        /**
+         * Number of Krylov basis vectors that are generated and orthogonalized
+         * together (s-step GMRES). The default 1 uses the standard Arnoldi
+         * process.
+         *
+         * The block uses a scaled monomial basis instead of a Newton or
+         * Chebyshev basis, since those need Ritz value or spectral
+         * estimates. Each vector is only scaled by the growth observed in the
+         * previous block. The monomial basis becomes ill-conditioned much
+         * sooner, so the safe range of `s_step` is smaller than with a
+         * Newton basis: values up to about 5 are advisable. A block is
+         * truncated automatically when its vectors become numerically
+         * linearly dependent.
+         */
+        size_type GKO_FACTORY_PARAMETER_SCALAR(s_step, 1u);
+
+        /**
+         * Orthogonalization method used in the Arnoldi process. The s-step
+         * variant always uses its block orthogonalization instead.
+         */
+        gmres::ortho_method GKO_FACTORY_PARAMETER_SCALAR(
+            orthogonalization, gmres::ortho_method::mgs);
     };
     GKO_ENABLE_LIN_OP_FACTORY(Gmres, parameters, Factory);
     GKO_ENABLE_BUILD_METHOD(Factory);
@@ -208,6 +267,28 @@ struct workspace_traits<Gmres<ValueType>> {
     constexpr static int minus_one = 12;
     // temporary norm vector of next_krylov to copy into hessenberg matrix
     constexpr static int next_krylov_norm_tmp = 13;
+    // inner products of the Krylov bases with the s-step block
+    constexpr static int block_dot = 14;
+    // Gram-Schmidt coefficients of the s-step block
+    constexpr static int block_coeffs = 15;
+    // inverse Cholesky factor of the s-step block
+    constexpr static int block_triangular = 16;
+    // scaling factors of the s-step basis
+    constexpr static int basis_scale = 17;
+    // host copy of the Hessenberg matrix before the Givens rotations
+    constexpr static int host_hessenberg = 18;
+    // host copy of the block inner products
+    constexpr static int host_block_dot = 19;
+    // host projection coefficients of the block orthogonalization
+    constexpr static int host_block_proj = 20;
+    // host Gram-Schmidt coefficients of the block update
+    constexpr static int host_block_coeffs = 21;
+    // host per-rhs scaling factors
+    constexpr static int host_scale = 22;
+    // host Cholesky factors of both s-step Gram-Schmidt passes
+    constexpr static int host_block_factor = 23;
+    // host inverse Cholesky factor of the s-step block
+    constexpr static int host_block_triangular = 24;
 
     // stopping status array
     constexpr static int stop = 0;
@@ -215,6 +296,8 @@ struct workspace_traits<Gmres<ValueType>> {
     constexpr static int tmp = 1;
     // reduction tmp array
     constexpr static int final_iter_nums = 2;
+    // host copy of the stopping status array
+    constexpr static int host_stop = 3;
 };
 
 
@@ -0,0 +1,231 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2022, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#ifndef GKO_PUBLIC_CORE_SOLVER_PIPE_BICGSTAB_HPP_
+#define GKO_PUBLIC_CORE_SOLVER_PIPE_BICGSTAB_HPP_
+
+
+#include <vector>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/lin_op.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/log/logger.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/matrix/identity.hpp>
+#include <ginkgo/core/solver/solver_base.hpp>
+#include <ginkgo/core/stop/combined.hpp>
+#include <ginkgo/core/stop/criterion.hpp>
+
+
+namespace gko {
+namespace solver {
+
+
+/**
+ * Pipelined BiCGSTAB is a communication-hiding variant of BiCGSTAB, following
+ * Cools and Vanroose.
+ *
+ * The method uses additional recurrences for the products of the
+ * preconditioner and the system matrix with the search directions. This
+ * allows to group the inner products of an iteration into two reductions,
+ * which only depend on vectors that are known before the preconditioner and
+ * system matrix applications of the respective half-step. Both reductions are
+ * non-blocking and overlap with these applications. For distributed vectors,
+ * this hides the latency of the global reductions at the cost of additional
+ * vector updates and storage.
+ *
+ * The implicit residual norm passed to the stopping criteria is the norm of
+ * the recursively updated residual, which is computed as part of the second
+ * reduction.
+ *
+ * As all vectors are updated by recurrences, rounding errors accumulate faster
+ * than in BiCGSTAB, and the attainable accuracy is lower. Stopping criteria
+ * should not request a reduction close to machine precision.
+ *
+ * @tparam ValueType precision of the elements of the system matrix.
+ *
+ * @ingroup solvers
+ * @ingroup LinOp
+ */
+template <typename ValueType = default_precision>
+class PipeBicgstab
+    : public EnableLinOp<PipeBicgstab<ValueType>>,
+      public EnablePreconditionedIterativeSolver<ValueType,
+                                                 PipeBicgstab<ValueType>>,
+      public Transposable {
+    friend class EnableLinOp<PipeBicgstab>;
+    friend class EnablePolymorphicObject<PipeBicgstab, LinOp>;
+
+public:
+    using value_type = ValueType;
+    using transposed_type = PipeBicgstab<ValueType>;
+
+    std::unique_ptr<LinOp> transpose() const override;
+
+    std::unique_ptr<LinOp> conj_transpose() const override;
+
+    /**
+     * Return true as iterative solvers use the data in x as an initial guess.
+     *
+     * @return true as iterative solvers use the data in x as an initial guess.
+     */
+    bool apply_uses_initial_guess() const override { return true; }
+
+    GKO_CREATE_FACTORY_PARAMETERS(parameters, Factory)
+    {
+        /**
+         * Criterion factories.
+         */
+        std::vector<std::shared_ptr<const stop::CriterionFactory>>
+            GKO_FACTORY_PARAMETER_VECTOR(criteria, nullptr);
+
+        /**
+         * Preconditioner factory.
+         */
+        std::shared_ptr<const LinOpFactory> GKO_FACTORY_PARAMETER_SCALAR(
+            preconditioner, nullptr);
+
+        /**
+         * Already generated preconditioner. If one is provided, the factory
+         * `preconditioner` will be ignored.
+         */
+        std::shared_ptr<const LinOp> GKO_FACTORY_PARAMETER_SCALAR(
+            generated_preconditioner, nullptr);
+    };
+    GKO_ENABLE_LIN_OP_FACTORY(PipeBicgstab, parameters, Factory);
+    GKO_ENABLE_BUILD_METHOD(Factory);
+
+protected:
+    void apply_impl(const LinOp* b, LinOp* x) const override;
+
+    template <typename VectorType>
+    void apply_dense_impl(const VectorType* b, VectorType* x) const;
+
+    void apply_impl(const LinOp* alpha, const LinOp* b, const LinOp* beta,
+                    LinOp* x) const override;
+
+    explicit PipeBicgstab(std::shared_ptr<const Executor> exec)
+        : EnableLinOp<PipeBicgstab>(std::move(exec))
+    {}
+
+    explicit PipeBicgstab(const Factory* factory,
+                          std::shared_ptr<const LinOp> system_matrix)
+        : EnableLinOp<PipeBicgstab>(factory->get_executor(),
+                                    gko::transpose(system_matrix->get_size())),
+          EnablePreconditionedIterativeSolver<ValueType,
+                                              PipeBicgstab<ValueType>>{
+              std::move(system_matrix), factory->get_parameters()},
+          parameters_{factory->get_parameters()}
+    {}
+};
+
+
+template <typename ValueType>
+struct workspace_traits<PipeBicgstab<ValueType>> {
+    using Solver = PipeBicgstab<ValueType>;
+    // number of vectors used by this workspace
+    static int num_vectors(const Solver&);
+    // number of arrays used by this workspace
+    static int num_arrays(const Solver&);
+    // array containing the num_vectors names for the workspace vectors
+    static std::vector<std::string> op_names(const Solver&);
+    // array containing the num_arrays names for the workspace vectors
+    static std::vector<std::string> array_names(const Solver&);
+    // array containing all varying scalar vectors (independent of problem size)
+    static std::vector<int> scalars(const Solver&);
+    // array containing all varying vectors (dependent on problem size)
+    static std::vector<int> vectors(const Solver&);
+
+    // residual vector
+    constexpr static int r = 0;
+    // shadow residual vector
+    constexpr static int rr = 1;
+    // preconditioned residual vector
+    constexpr static int pr = 2;
+    // system matrix applied to pr
+    constexpr static int w = 3;
+    // preconditioner applied to w
+    constexpr static int pw = 4;
+    // system matrix applied to pw
+    constexpr static int t = 5;
+    // preconditioned search direction
+    constexpr static int p = 6;
+    // system matrix applied to p
+    constexpr static int s = 7;
+    // preconditioner applied to s
+    constexpr static int ps = 8;
+    // system matrix applied to ps
+    constexpr static int z = 9;
+    // preconditioner applied to z
+    constexpr static int pz = 10;
+    // intermediate residual vector
+    constexpr static int q = 11;
+    // preconditioned intermediate residual vector
+    constexpr static int pq = 12;
+    // system matrix applied to pq
+    constexpr static int y = 13;
+    // system matrix applied to pz
+    constexpr static int v = 14;
+    // (y, q) and (y, y) scalars, stored contiguously
+    constexpr static int omega_dots = 15;
+    // (rr, r), (rr, w), (rr, s), (rr, z) and (r, r) scalars, stored
+    // contiguously
+    constexpr static int rho_dots = 16;
+    // previous rho scalar
+    constexpr static int prev_rho = 17;
+    // alpha scalar
+    constexpr static int alpha = 18;
+    // beta scalar
+    constexpr static int beta = 19;
+    // omega scalar
+    constexpr static int omega = 20;
+    // constant 1.0 scalar
+    constexpr static int one = 21;
+    // constant -1.0 scalar
+    constexpr static int minus_one = 22;
+
+    // stopping status array
+    constexpr static int stop = 0;
+    // reduction tmp array
+    constexpr static int tmp = 1;
+};
+
+
+}  // namespace solver
+}  // namespace gko
+
+
+#endif  // GKO_PUBLIC_CORE_SOLVER_PIPE_BICGSTAB_HPP_
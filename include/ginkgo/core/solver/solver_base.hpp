@@ -475,6 +475,31 @@ protected:
         return workspace_.template init_or_get_array<ValueType>(array_id);
     }
 
+    template <typename LinOpType>
+    LinOpType* create_host_workspace_op(int vector_id, gko::dim<2> size) const
+    {
+        return workspace_.template create_or_get_op<LinOpType>(
+            vector_id,
+            [&] {
+                return LinOpType::create(
+                    this->workspace_.get_executor()->get_master(), size);
+            },
+            typeid(LinOpType), size, size[1]);
+    }
+
+    template <typename ValueType>
+    array<ValueType>& create_host_workspace_array(int array_id,
+                                                  size_type size) const
+    {
+        auto& result =
+            workspace_.template init_or_get_array<ValueType>(array_id);
+        result.set_executor(workspace_.get_executor()->get_master());
+        if (result.get_num_elems() != size) {
+            result.resize_and_reset(size);
+        }
+        return result;
+    }
+
 private:
     mutable detail::workspace workspace_;
 
@@ -126,7 +126,9 @@ public:
          * Select the implementation which is supposed to be used for
          * the triangular solver. This only matters for the Cuda
          * executor where the choice is between the Ginkgo (syncfree) and the
-         * cuSPARSE (sparselib) implementation. Default is sparselib.
+         * cuSPARSE (sparselib) implementation, and for the OpenMP executor
+         * where the choice is between a busy-waiting (syncfree) and a
+         * level-scheduled (sparselib) implementation. Default is sparselib.
          */
         trisolve_algorithm GKO_FACTORY_PARAMETER_SCALAR(
             algorithm, trisolve_algorithm::sparselib);
@@ -276,7 +278,9 @@ public:
          * Select the implementation which is supposed to be used for
          * the triangular solver. This only matters for the Cuda
          * executor where the choice is between the Ginkgo (syncfree) and the
-         * cuSPARSE (sparselib) implementation. Default is sparselib.
+         * cuSPARSE (sparselib) implementation, and for the OpenMP executor
+         * where the choice is between a busy-waiting (syncfree) and a
+         * level-scheduled (sparselib) implementation. Default is sparselib.
          */
         trisolve_algorithm GKO_FACTORY_PARAMETER_SCALAR(
             algorithm, trisolve_algorithm::sparselib);
@@ -34,7 +34,12 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 
 #include <algorithm>
+#include <array>
 #include <memory>
+#include <numeric>
+
+
+#include <omp.h>
 
 
 #include <ginkgo/core/matrix/csr.hpp>
@@ -93,6 +98,12 @@ void initialize(std::shared_ptr<const DefaultExecutor> exec,
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_LU_INITIALIZE);
 
 
+/**
+ * The maximum number of rows of a supernode that are eliminated together.
+ */
+constexpr int max_supernode_size = 32;
+
+
 template <typename ValueType, typename IndexType>
 void factorize(std::shared_ptr<const DefaultExecutor> exec,
                const IndexType* lookup_offsets, const int64* lookup_descs,
@@ -104,29 +115,125 @@ void factorize(std::shared_ptr<const DefaultExecutor> exec,
     const auto row_ptrs = factors->get_const_row_ptrs();
     const auto cols = factors->get_const_col_idxs();
     const auto vals = factors->get_values();
-    // TODO parallelize
+    // detect supernodes: rows r and r + 1 belong to the same supernode if the
+    // upper triangular part of row r consists of column r + 1 followed by the
+    // upper triangular part of row r + 1. Then every suffix of a supernode is
+    // a supernode as well, and supernode_last[r] is the last row of the
+    // supernode containing r.
+    array<IndexType> supernode_last_array{exec, num_rows};
+    const auto supernode_last = supernode_last_array.get_data();
+#pragma omp parallel for
     for (size_type row = 0; row < num_rows; row++) {
+        supernode_last[row] = row;
+        if (row + 1 < num_rows) {
+            const auto begin = diag_idxs[row] + 1;
+            const auto end = row_ptrs[row + 1];
+            const auto next_begin = diag_idxs[row + 1] + 1;
+            const auto next_end = row_ptrs[row + 2];
+            if (begin < end && cols[begin] == row + 1 &&
+                end - begin == next_end - next_begin + 1 &&
+                std::equal(cols + begin + 1, cols + end, cols + next_begin)) {
+                supernode_last[row] = row + 1;
+            }
+        }
+    }
+    for (auto row = static_cast<int64>(num_rows) - 2; row >= 0; row--) {
+        if (supernode_last[row] != row) {
+            supernode_last[row] = supernode_last[row + 1];
+        }
+    }
+    const auto factorize_row = [&](size_type row) {
+        std::array<ValueType, max_supernode_size> scales;
         const auto row_begin = row_ptrs[row];
         const auto row_diag = diag_idxs[row];
         matrix::csr::device_sparsity_lookup<IndexType> lookup{
             row_ptrs, cols, lookup_offsets, lookup_storage, lookup_descs, row};
-        for (auto lower_nz = row_begin; lower_nz < row_diag; lower_nz++) {
+        auto lower_nz = row_begin;
+        while (lower_nz < row_diag) {
             const auto dep = cols[lower_nz];
-            const auto dep_diag_idx = diag_idxs[dep];
-            const auto dep_diag = vals[dep_diag_idx];
-            const auto dep_end = row_ptrs[dep + 1];
-            const auto scale = vals[lower_nz] / dep_diag;
-            vals[lower_nz] = scale;
-            for (auto dep_nz = dep_diag_idx + 1; dep_nz < dep_end; dep_nz++) {
-                const auto col = cols[dep_nz];
-                const auto val = vals[dep_nz];
-                const auto nz = row_begin + lookup.lookup_unsafe(col);
-                vals[nz] -= scale * val;
+            // eliminate with the longest part of a supernode at once that
+            // consists only of dependencies of this row
+            const auto max_size = std::min<IndexType>(
+                {supernode_last[dep] - dep + 1,
+                 static_cast<IndexType>(max_supernode_size),
+                 row_diag - lower_nz});
+            IndexType size = 1;
+            while (size < max_size && cols[lower_nz + size] == dep + size) {
+                size++;
+            }
+            // the dependencies among the supernode rows form a dense triangle
+            for (IndexType i = 0; i < size; i++) {
+                auto val = vals[lower_nz + i];
+                for (IndexType j = 0; j < i; j++) {
+                    val -= scales[j] * vals[diag_idxs[dep + j] + (i - j)];
+                }
+                scales[i] = val / vals[diag_idxs[dep + i]];
+                vals[lower_nz + i] = scales[i];
             }
+            // all supernode rows share the remaining columns, so they are
+            // applied as a dense block with a single lookup per column
+            const auto last_diag = diag_idxs[dep + size - 1];
+            const auto num_trailing = row_ptrs[dep + size] - (last_diag + 1);
+            for (IndexType k = 0; k < num_trailing; k++) {
+                const auto col = cols[last_diag + 1 + k];
+                auto sum = zero<ValueType>();
+                for (IndexType i = 0; i < size; i++) {
+                    sum +=
+                        scales[i] * vals[diag_idxs[dep + i] + (size - i) + k];
+                }
+                vals[row_begin + lookup.lookup_unsafe(col)] -= sum;
+            }
+            lower_nz += size;
+        }
+    };
+    // a row only depends on the rows given by the lower triangular part of
+    // its factor pattern, so the rows are grouped into levels of this
+    // dependency graph, and all rows of a level can be factorized in parallel.
+    tmp_storage.resize_and_reset(num_rows);
+    const auto levels = tmp_storage.get_data();
+    int num_levels{};
+    for (size_type row = 0; row < num_rows; row++) {
+        int level{};
+        for (auto nz = row_ptrs[row]; nz < diag_idxs[row]; nz++) {
+            level = std::max(level, levels[cols[nz]] + 1);
+        }
+        levels[row] = level;
+        num_levels = std::max(num_levels, level + 1);
+    }
+    const auto num_threads = omp_get_max_threads();
+    if (num_threads == 1 || num_rows < 2 * static_cast<size_type>(num_levels)) {
+        for (size_type row = 0; row < num_rows; row++) {
+            factorize_row(row);
+        }
+        return;
+    }
+    array<IndexType> level_ptr_array{exec,
+                                     static_cast<size_type>(num_levels) + 1};
+    array<IndexType> level_row_array{exec, num_rows};
+    const auto level_ptrs = level_ptr_array.get_data();
+    const auto level_rows = level_row_array.get_data();
+    std::fill_n(level_ptrs, num_levels + 1, 0);
+    for (size_type row = 0; row < num_rows; row++) {
+        level_ptrs[levels[row] + 1]++;
+    }
+    std::partial_sum(level_ptrs, level_ptrs + num_levels + 1, level_ptrs);
+    for (size_type row = 0; row < num_rows; row++) {
+        level_rows[level_ptrs[levels[row]]++] = row;
+    }
+    for (auto level = num_levels; level > 0; level--) {
+        level_ptrs[level] = level_ptrs[level - 1];
+    }
+    level_ptrs[0] = 0;
+#pragma omp parallel
+    for (int level = 0; level < num_levels; level++) {
+#pragma omp for schedule(dynamic, 16)
+        for (auto i = level_ptrs[level]; i < level_ptrs[level + 1]; i++) {
+            factorize_row(level_rows[i]);
         }
     }
 }
 
+
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_LU_FACTORIZE);
 
 
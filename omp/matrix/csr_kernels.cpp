@@ -34,6 +34,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 
 #include <algorithm>
+#include <array>
 #include <limits>
 #include <numeric>
 #include <utility>
@@ -72,29 +73,294 @@ namespace omp {
 namespace csr {
 
 
-template <typename ValueType, typename IndexType>
-void spmv(std::shared_ptr<const OmpExecutor> exec,
-          const matrix::Csr<ValueType, IndexType>* a,
-          const matrix::Dense<ValueType>* b, matrix::Dense<ValueType>* c)
+namespace {
+
+
+/**
+ * @internal
+ *
+ * Computes the starting point (row, nonzero) of the work assigned to a thread.
+ *
+ * With `merge_rows`, the merged list of row ends and nonzeros is split into
+ * equally sized chunks (Merrill and Garland: Merge-Based Parallel Sparse
+ * Matrix-Vector Multiplication), otherwise only the nonzeros are split evenly.
+ * In both cases, the thread starts in the returned row, which it may share with
+ * the previous thread(s), and `row_ptrs[row] <= nz <= row_ptrs[row + 1]`.
+ * Empty rows at a chunk boundary belong to the earlier thread, so the first
+ * thread always starts in row 0 to also cover leading empty rows.
+ */
+template <bool merge_rows, typename IndexType>
+void find_thread_start(const IndexType* row_ptrs, int64 num_rows, int tid,
+                       int num_threads, IndexType& row, IndexType& nz)
+{
+    const int64 nnz = row_ptrs[num_rows];
+    if (merge_rows) {
+        const auto total = num_rows + nnz;
+        const auto diagonal =
+            std::min(ceildiv(total, num_threads) * tid, total);
+        auto lo = std::max(diagonal - nnz, int64{});
+        auto hi = std::min(diagonal, num_rows);
+        while (lo < hi) {
+            const auto mid = lo + (hi - lo) / 2;
+            if (row_ptrs[mid + 1] <= diagonal - mid - 1) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        row = static_cast<IndexType>(lo);
+        nz = static_cast<IndexType>(diagonal - lo);
+    } else {
+        nz = static_cast<IndexType>((nnz / num_threads) * tid +
+                                    std::min<int64>(tid, nnz % num_threads));
+        row = static_cast<IndexType>(
+            std::upper_bound(row_ptrs + 1, row_ptrs + num_rows + 1, nz) -
+            (row_ptrs + 1));
+        if (tid == 0) {
+            row = 0;
+        }
+    }
+}
+
+
+/**
+ * @internal
+ *
+ * Computes c = alpha * a * b + beta * c (or c = a * b if beta is nullptr)
+ * with an equal amount of work per thread, independently of the row lengths.
+ * Each thread finalizes the rows that end inside its chunk, the partial sum of
+ * the row it ends in is stored as a carry-out value and added to that row in a
+ * sequential fixup step.
+ */
+template <bool merge_rows, typename ValueType, typename IndexType>
+void load_balanced_spmv(std::shared_ptr<const OmpExecutor> exec,
+                        const matrix::Csr<ValueType, IndexType>* a,
+                        const matrix::Dense<ValueType>* b,
+                        matrix::Dense<ValueType>* c,
+                        const matrix::Dense<ValueType>* alpha = nullptr,
+                        const matrix::Dense<ValueType>* beta = nullptr)
+{
+    auto row_ptrs = a->get_const_row_ptrs();
+    auto col_idxs = a->get_const_col_idxs();
+    auto vals = a->get_const_values();
+    const auto num_rows = static_cast<int64>(a->get_size()[0]);
+    const auto num_rhs = c->get_size()[1];
+    const auto valpha = alpha ? alpha->at(0, 0) : one<ValueType>();
+    const auto vbeta = beta ? beta->at(0, 0) : zero<ValueType>();
+    const auto max_threads = omp_get_max_threads();
+    array<IndexType> carry_rows_array{exec,
+                                      static_cast<size_type>(max_threads)};
+    array<ValueType> carry_vals_array{exec, max_threads * num_rhs};
+    auto carry_rows = carry_rows_array.get_data();
+    auto carry_vals = carry_vals_array.get_data();
+    int num_threads = 1;
+
+#pragma omp parallel
+    {
+        const auto tid = omp_get_thread_num();
+        const auto nthreads = omp_get_num_threads();
+        if (tid == 0) {
+            num_threads = nthreads;
+        }
+        IndexType row{};
+        IndexType nz{};
+        IndexType row_end{};
+        IndexType nz_end{};
+        find_thread_start<merge_rows>(row_ptrs, num_rows, tid, nthreads, row,
+                                      nz);
+        find_thread_start<merge_rows>(row_ptrs, num_rows, tid + 1, nthreads,
+                                      row_end, nz_end);
+        for (; row < row_end; ++row) {
+            for (size_type j = 0; j < num_rhs; ++j) {
+                c->at(row, j) =
+                    beta ? vbeta * c->at(row, j) : zero<ValueType>();
+            }
+            for (; nz < row_ptrs[row + 1]; ++nz) {
+                const auto val = valpha * vals[nz];
+                const auto col = col_idxs[nz];
+                for (size_type j = 0; j < num_rhs; ++j) {
+                    c->at(row, j) += val * b->at(col, j);
+                }
+            }
+        }
+        const auto local_carry = carry_vals + tid * num_rhs;
+        for (size_type j = 0; j < num_rhs; ++j) {
+            local_carry[j] = zero<ValueType>();
+        }
+        for (; nz < nz_end; ++nz) {
+            const auto val = vals[nz];
+            const auto col = col_idxs[nz];
+            for (size_type j = 0; j < num_rhs; ++j) {
+                local_carry[j] += val * b->at(col, j);
+            }
+        }
+        carry_rows[tid] = row_end;
+    }
+
+    for (int tid = 0; tid < num_threads; ++tid) {
+        const auto row = carry_rows[tid];
+        if (row < num_rows) {
+            for (size_type j = 0; j < num_rhs; ++j) {
+                c->at(row, j) += valpha * carry_vals[tid * num_rhs + j];
+            }
+        }
+    }
+}
+
+
+template <int num_rhs, typename MatrixValueType, typename InputValueType,
+          typename OutputValueType, typename IndexType, typename OutFn>
+void spmv_small_rhs(std::shared_ptr<const OmpExecutor> exec,
+                    const matrix::Csr<MatrixValueType, IndexType>* a,
+                    const matrix::Dense<InputValueType>* b,
+                    matrix::Dense<OutputValueType>* c, OutFn out)
+{
+    using arithmetic_type =
+        highest_precision<InputValueType, OutputValueType, MatrixValueType>;
+    GKO_ASSERT(b->get_size()[1] == num_rhs);
+    auto row_ptrs = a->get_const_row_ptrs();
+    auto col_idxs = a->get_const_col_idxs();
+    auto vals = a->get_const_values();
+    auto b_vals = b->get_const_values();
+    const auto b_stride = b->get_stride();
+
+#pragma omp parallel for
+    for (size_type row = 0; row < a->get_size()[0]; row++) {
+        std::array<arithmetic_type, num_rhs> partial_sum;
+        partial_sum.fill(zero<arithmetic_type>());
+        for (auto k = row_ptrs[row]; k < row_ptrs[row + 1]; k++) {
+            const auto val = static_cast<arithmetic_type>(vals[k]);
+            const auto b_row = b_vals + col_idxs[k] * b_stride;
+#pragma unroll
+            for (size_type j = 0; j < num_rhs; j++) {
+                partial_sum[j] += val * static_cast<arithmetic_type>(b_row[j]);
+            }
+        }
+#pragma unroll
+        for (size_type j = 0; j < num_rhs; j++) {
+            [&] {
+                c->at(row, j) = static_cast<OutputValueType>(
+                    out(row, j, partial_sum[j]));
+            }();
+        }
+    }
+}
+
+
+template <int block_size, typename MatrixValueType, typename InputValueType,
+          typename OutputValueType, typename IndexType, typename OutFn>
+void spmv_blocked(std::shared_ptr<const OmpExecutor> exec,
+                  const matrix::Csr<MatrixValueType, IndexType>* a,
+                  const matrix::Dense<InputValueType>* b,
+                  matrix::Dense<OutputValueType>* c, OutFn out)
 {
+    using arithmetic_type =
+        highest_precision<InputValueType, OutputValueType, MatrixValueType>;
+    GKO_ASSERT(b->get_size()[1] > block_size);
     auto row_ptrs = a->get_const_row_ptrs();
     auto col_idxs = a->get_const_col_idxs();
     auto vals = a->get_const_values();
+    auto b_vals = b->get_const_values();
+    const auto b_stride = b->get_stride();
+    const auto num_rhs = b->get_size()[1];
+    const auto rounded_rhs = num_rhs / block_size * block_size;
 
 #pragma omp parallel for
-    for (size_type row = 0; row < a->get_size()[0]; ++row) {
-        for (size_type j = 0; j < c->get_size()[1]; ++j) {
-            c->at(row, j) = zero<ValueType>();
+    for (size_type row = 0; row < a->get_size()[0]; row++) {
+        std::array<arithmetic_type, block_size> partial_sum;
+        for (size_type rhs_base = 0; rhs_base < rounded_rhs;
+             rhs_base += block_size) {
+            partial_sum.fill(zero<arithmetic_type>());
+            for (auto k = row_ptrs[row]; k < row_ptrs[row + 1]; k++) {
+                const auto val = static_cast<arithmetic_type>(vals[k]);
+                const auto b_row = b_vals + col_idxs[k] * b_stride + rhs_base;
+#pragma unroll
+                for (size_type j = 0; j < block_size; j++) {
+                    partial_sum[j] +=
+                        val * static_cast<arithmetic_type>(b_row[j]);
+                }
+            }
+#pragma unroll
+            for (size_type j = 0; j < block_size; j++) {
+                const auto col = j + rhs_base;
+                [&] {
+                    c->at(row, col) = static_cast<OutputValueType>(
+                        out(row, col, partial_sum[j]));
+                }();
+            }
         }
-        for (size_type k = row_ptrs[row];
-             k < static_cast<size_type>(row_ptrs[row + 1]); ++k) {
-            auto val = vals[k];
-            auto col = col_idxs[k];
-            for (size_type j = 0; j < c->get_size()[1]; ++j) {
-                c->at(row, j) += val * b->at(col, j);
+        partial_sum.fill(zero<arithmetic_type>());
+        for (auto k = row_ptrs[row]; k < row_ptrs[row + 1]; k++) {
+            const auto val = static_cast<arithmetic_type>(vals[k]);
+            const auto b_row = b_vals + col_idxs[k] * b_stride;
+            for (size_type j = rounded_rhs; j < num_rhs; j++) {
+                partial_sum[j - rounded_rhs] +=
+                    val * static_cast<arithmetic_type>(b_row[j]);
             }
         }
+        for (size_type j = rounded_rhs; j < num_rhs; j++) {
+            [&] {
+                c->at(row, j) = static_cast<OutputValueType>(
+                    out(row, j, partial_sum[j - rounded_rhs]));
+            }();
+        }
+    }
+}
+
+
+template <typename MatrixValueType, typename InputValueType,
+          typename OutputValueType, typename IndexType, typename OutFn>
+void spmv_dispatch_rhs(std::shared_ptr<const OmpExecutor> exec,
+                       const matrix::Csr<MatrixValueType, IndexType>* a,
+                       const matrix::Dense<InputValueType>* b,
+                       matrix::Dense<OutputValueType>* c, OutFn out)
+{
+    const auto num_rhs = b->get_size()[1];
+    if (num_rhs == 1) {
+        spmv_small_rhs<1>(exec, a, b, c, out);
+        return;
+    }
+    if (num_rhs == 2) {
+        spmv_small_rhs<2>(exec, a, b, c, out);
+        return;
+    }
+    if (num_rhs == 3) {
+        spmv_small_rhs<3>(exec, a, b, c, out);
+        return;
+    }
+    if (num_rhs == 4) {
+        spmv_small_rhs<4>(exec, a, b, c, out);
+        return;
+    }
+    if (num_rhs < 16) {
+        spmv_blocked<4>(exec, a, b, c, out);
+        return;
+    }
+    spmv_blocked<8>(exec, a, b, c, out);
+}
+
+
+}  // namespace
+
+
+template <typename ValueType, typename IndexType>
+void spmv(std::shared_ptr<const OmpExecutor> exec,
+          const matrix::Csr<ValueType, IndexType>* a,
+          const matrix::Dense<ValueType>* b, matrix::Dense<ValueType>* c)
+{
+    const auto strategy = a->get_strategy()->get_name();
+    if (strategy == "merge_path") {
+        load_balanced_spmv<true>(exec, a, b, c);
+        return;
+    } else if (strategy == "load_balance") {
+        load_balanced_spmv<false>(exec, a, b, c);
+        return;
     }
+    if (c->get_size()[1] == 0) {
+        return;
+    }
+    auto out = [](auto, auto, auto value) { return value; };
+    spmv_dispatch_rhs(exec, a, b, c, out);
 }
 
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_CSR_SPMV_KERNEL);
@@ -108,32 +374,74 @@ void advanced_spmv(std::shared_ptr<const OmpExecutor> exec,
                    const matrix::Dense<ValueType>* beta,
                    matrix::Dense<ValueType>* c)
 {
-    auto row_ptrs = a->get_const_row_ptrs();
-    auto col_idxs = a->get_const_col_idxs();
-    auto vals = a->get_const_values();
-    auto valpha = alpha->at(0, 0);
-    auto vbeta = beta->at(0, 0);
-
-#pragma omp parallel for
-    for (size_type row = 0; row < a->get_size()[0]; ++row) {
-        for (size_type j = 0; j < c->get_size()[1]; ++j) {
-            c->at(row, j) *= vbeta;
-        }
-        for (size_type k = row_ptrs[row];
-             k < static_cast<size_type>(row_ptrs[row + 1]); ++k) {
-            auto val = vals[k];
-            auto col = col_idxs[k];
-            for (size_type j = 0; j < c->get_size()[1]; ++j) {
-                c->at(row, j) += valpha * val * b->at(col, j);
-            }
-        }
+    const auto strategy = a->get_strategy()->get_name();
+    if (strategy == "merge_path") {
+        load_balanced_spmv<true>(exec, a, b, c, alpha, beta);
+        return;
+    } else if (strategy == "load_balance") {
+        load_balanced_spmv<false>(exec, a, b, c, alpha, beta);
+        return;
+    }
+    if (c->get_size()[1] == 0) {
+        return;
     }
+    const auto valpha = alpha->at(0, 0);
+    const auto vbeta = beta->at(0, 0);
+    auto out = [&](auto row, auto col, auto value) {
+        return valpha * value + vbeta * c->at(row, col);
+    };
+    spmv_dispatch_rhs(exec, a, b, c, out);
 }
 
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
     GKO_DECLARE_CSR_ADVANCED_SPMV_KERNEL);
 
 
+template <typename ValueType, typename IndexType>
+void mixed_spmv(std::shared_ptr<const OmpExecutor> exec,
+                const matrix::Csr<ValueType, IndexType>* a,
+                const matrix::Dense<next_precision<ValueType>>* b,
+                matrix::Dense<next_precision<ValueType>>* c)
+{
+    // the load-balancing strategies are not specialized for mixed precision,
+    // so all strategies use the row-parallel kernels here
+    if (c->get_size()[1] == 0) {
+        return;
+    }
+    auto out = [](auto, auto, auto value) { return value; };
+    spmv_dispatch_rhs(exec, a, b, c, out);
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_CSR_MIXED_SPMV_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void advanced_mixed_spmv(std::shared_ptr<const OmpExecutor> exec,
+                         const matrix::Dense<next_precision<ValueType>>* alpha,
+                         const matrix::Csr<ValueType, IndexType>* a,
+                         const matrix::Dense<next_precision<ValueType>>* b,
+                         const matrix::Dense<next_precision<ValueType>>* beta,
+                         matrix::Dense<next_precision<ValueType>>* c)
+{
+    using arithmetic_type =
+        highest_precision<ValueType, next_precision<ValueType>>;
+    if (c->get_size()[1] == 0) {
+        return;
+    }
+    const auto valpha = static_cast<arithmetic_type>(alpha->at(0, 0));
+    const auto vbeta = static_cast<arithmetic_type>(beta->at(0, 0));
+    auto out = [&](auto row, auto col, auto value) {
+        return valpha * value +
+               vbeta * static_cast<arithmetic_type>(c->at(row, col));
+    };
+    spmv_dispatch_rhs(exec, a, b, c, out);
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_CSR_ADVANCED_MIXED_SPMV_KERNEL);
+
+
 namespace {
 
 
@@ -322,6 +630,182 @@ auto spgemm_multiway_merge(size_type row,
 }
 
 
+/**
+ * @internal
+ *
+ * Output rows with at least this many non-zeros are computed using a dense
+ * accumulator instead of the heap-based multiway merge: for long rows, the
+ * logarithmic cost of every heap operation exceeds the cost of scattering
+ * all products into a dense row and sorting the output columns.
+ */
+constexpr int spgemm_dense_threshold = 32;
+
+
+/**
+ * @internal
+ *
+ * The dense accumulator stores one row of B per thread, so it is only used if
+ * B has at most this many columns. Wider products always use the heap-based
+ * multiway merge.
+ */
+constexpr size_type spgemm_dense_max_cols = size_type{1} << 18;
+
+
+/**
+ * @internal
+ *
+ * Returns the number of products contributing to a single row of A * B, which
+ * is an upper bound for the number of non-zeros in the output row.
+ */
+template <typename ValueType, typename IndexType>
+IndexType spgemm_num_products(size_type row,
+                              const matrix::Csr<ValueType, IndexType>* a,
+                              const matrix::Csr<ValueType, IndexType>* b)
+{
+    auto a_row_ptrs = a->get_const_row_ptrs();
+    auto a_cols = a->get_const_col_idxs();
+    auto b_row_ptrs = b->get_const_row_ptrs();
+    IndexType num_products{};
+    for (auto a_nz = a_row_ptrs[row]; a_nz < a_row_ptrs[row + 1]; ++a_nz) {
+        auto b_row = a_cols[a_nz];
+        num_products += b_row_ptrs[b_row + 1] - b_row_ptrs[b_row];
+    }
+    return num_products;
+}
+
+
+/**
+ * @internal
+ *
+ * Counts the number of output non-zeros in a single row of A * B using a dense
+ * marker array.
+ *
+ * @param row  The row for which to count the non-zeros
+ * @param a  The input matrix A
+ * @param b  The input matrix B
+ * @param marker  An array with one entry per column of B. Every entry must be
+ *                different from `row` before the call, it stores the last row
+ *                in which the corresponding column occurred afterwards.
+ * @return the number of distinct columns in the output row
+ */
+template <typename ValueType, typename IndexType>
+IndexType spgemm_dense_count(size_type row,
+                             const matrix::Csr<ValueType, IndexType>* a,
+                             const matrix::Csr<ValueType, IndexType>* b,
+                             IndexType* marker)
+{
+    auto a_row_ptrs = a->get_const_row_ptrs();
+    auto a_cols = a->get_const_col_idxs();
+    auto b_row_ptrs = b->get_const_row_ptrs();
+    auto b_cols = b->get_const_col_idxs();
+    const auto irow = static_cast<IndexType>(row);
+    IndexType nnz{};
+    for (auto a_nz = a_row_ptrs[row]; a_nz < a_row_ptrs[row + 1]; ++a_nz) {
+        auto b_row = a_cols[a_nz];
+        for (auto b_nz = b_row_ptrs[b_row]; b_nz < b_row_ptrs[b_row + 1];
+             ++b_nz) {
+            auto col = b_cols[b_nz];
+            if (marker[col] != irow) {
+                marker[col] = irow;
+                nnz++;
+            }
+        }
+    }
+    return nnz;
+}
+
+
+/**
+ * @internal
+ *
+ * Computes a single row of A * B by scattering all products into a dense
+ * accumulator.
+ *
+ * @param row  The row for which to compute the SpGEMM
+ * @param a  The input matrix A
+ * @param b  The input matrix B
+ * @param marker  see spgemm_dense_count
+ * @param accumulator  An array with one entry per column of B
+ * @param out_cols  The output column indices of the row, they will be sorted.
+ * @param out_vals  The output values of the row
+ */
+template <typename ValueType, typename IndexType>
+void spgemm_dense_accumulate(size_type row,
+                             const matrix::Csr<ValueType, IndexType>* a,
+                             const matrix::Csr<ValueType, IndexType>* b,
+                             IndexType* marker, ValueType* accumulator,
+                             IndexType* out_cols, ValueType* out_vals)
+{
+    auto a_row_ptrs = a->get_const_row_ptrs();
+    auto a_cols = a->get_const_col_idxs();
+    auto a_vals = a->get_const_values();
+    auto b_row_ptrs = b->get_const_row_ptrs();
+    auto b_cols = b->get_const_col_idxs();
+    auto b_vals = b->get_const_values();
+    const auto irow = static_cast<IndexType>(row);
+    IndexType nnz{};
+    for (auto a_nz = a_row_ptrs[row]; a_nz < a_row_ptrs[row + 1]; ++a_nz) {
+        auto b_row = a_cols[a_nz];
+        auto a_val = a_vals[a_nz];
+        for (auto b_nz = b_row_ptrs[b_row]; b_nz < b_row_ptrs[b_row + 1];
+             ++b_nz) {
+            auto col = b_cols[b_nz];
+            if (marker[col] != irow) {
+                marker[col] = irow;
+                accumulator[col] = zero<ValueType>();
+                out_cols[nnz] = col;
+                nnz++;
+            }
+            accumulator[col] += a_val * b_vals[b_nz];
+        }
+    }
+    std::sort(out_cols, out_cols + nnz);
+    for (IndexType i = 0; i < nnz; ++i) {
+        out_vals[i] = accumulator[out_cols[i]];
+    }
+}
+
+
+/**
+ * @internal
+ *
+ * Computes the column indices of a single row of A * B using a dense marker
+ * array.
+ *
+ * @param row  The row for which to compute the sparsity pattern
+ * @param a  The input matrix A
+ * @param b  The input matrix B
+ * @param marker  see spgemm_dense_count
+ * @param out_cols  The output column indices of the row, they will be sorted.
+ */
+template <typename ValueType, typename IndexType>
+void spgemm_dense_pattern(size_type row,
+                          const matrix::Csr<ValueType, IndexType>* a,
+                          const matrix::Csr<ValueType, IndexType>* b,
+                          IndexType* marker, IndexType* out_cols)
+{
+    auto a_row_ptrs = a->get_const_row_ptrs();
+    auto a_cols = a->get_const_col_idxs();
+    auto b_row_ptrs = b->get_const_row_ptrs();
+    auto b_cols = b->get_const_col_idxs();
+    const auto irow = static_cast<IndexType>(row);
+    IndexType nnz{};
+    for (auto a_nz = a_row_ptrs[row]; a_nz < a_row_ptrs[row + 1]; ++a_nz) {
+        auto b_row = a_cols[a_nz];
+        for (auto b_nz = b_row_ptrs[b_row]; b_nz < b_row_ptrs[b_row + 1];
+             ++b_nz) {
+            auto col = b_cols[b_nz];
+            if (marker[col] != irow) {
+                marker[col] = irow;
+                out_cols[nnz] = col;
+                nnz++;
+            }
+        }
+    }
+    std::sort(out_cols, out_cols + nnz);
+}
+
+
 }  // namespace
 
 
@@ -332,7 +816,27 @@ void spgemm(std::shared_ptr<const OmpExecutor> exec,
             matrix::Csr<ValueType, IndexType>* c)
 {
     auto num_rows = a->get_size()[0];
+    auto num_cols = b->get_size()[1];
     auto c_row_ptrs = c->get_row_ptrs();
+    const auto use_dense = num_cols <= spgemm_dense_max_cols;
+
+    // the symbolic phase only knows an upper bound for the output row length
+    bool has_long_rows = false;
+    if (use_dense) {
+#pragma omp parallel for reduction(|| : has_long_rows)
+        for (size_type row = 0; row < num_rows; ++row) {
+            has_long_rows =
+                has_long_rows ||
+                spgemm_num_products(row, a, b) >= spgemm_dense_threshold;
+        }
+    }
+    // long rows use a dense accumulator of one row per thread
+    const auto workspace_size =
+        has_long_rows ? num_cols * omp_get_max_threads() : size_type{};
+    array<IndexType> marker_array(exec, workspace_size);
+    components::fill_array(exec, marker_array.get_data(), workspace_size,
+                           invalid_index<IndexType>());
+    auto marker = marker_array.get_data();
 
     array<col_heap_element<ValueType, IndexType>> col_heap_array(
         exec, a->get_num_stored_elements());
@@ -342,6 +846,12 @@ void spgemm(std::shared_ptr<const OmpExecutor> exec,
     // first sweep: count nnz for each row
 #pragma omp parallel for
     for (size_type a_row = 0; a_row < num_rows; ++a_row) {
+        if (has_long_rows &&
+            spgemm_num_products(a_row, a, b) >= spgemm_dense_threshold) {
+            c_row_ptrs[a_row] = spgemm_dense_count(
+                a_row, a, b, marker + num_cols * omp_get_thread_num());
+            continue;
+        }
         c_row_ptrs[a_row] = spgemm_multiway_merge(
             a_row, a, b, col_heap, [](size_type) { return IndexType{}; },
             [](ValueType, IndexType, IndexType&) {},
@@ -350,6 +860,28 @@ void spgemm(std::shared_ptr<const OmpExecutor> exec,
 
     col_heap_array.clear();
 
+    // the numeric phase decides based on the exact output row length, which
+    // never exceeds the number of products, so the workspace suffices
+    array<bool> dense_row_array(exec, has_long_rows ? num_rows : 0);
+    auto dense_row = dense_row_array.get_data();
+    if (has_long_rows) {
+        has_long_rows = false;
+#pragma omp parallel for reduction(|| : has_long_rows)
+        for (size_type row = 0; row < num_rows; ++row) {
+            dense_row[row] = c_row_ptrs[row] >= spgemm_dense_threshold;
+            has_long_rows = has_long_rows || dense_row[row];
+        }
+    }
+    if (!has_long_rows) {
+        marker_array.clear();
+    }
+    marker = marker_array.get_data();
+    // the marker may contain rows from the first sweep
+    components::fill_array(exec, marker, marker_array.get_num_elems(),
+                           invalid_index<IndexType>());
+    array<ValueType> accumulator_array(exec, marker_array.get_num_elems());
+    auto accumulator = accumulator_array.get_data();
+
     array<val_heap_element<ValueType, IndexType>> heap_array(
         exec, a->get_num_stored_elements());
 
@@ -370,6 +902,14 @@ void spgemm(std::shared_ptr<const OmpExecutor> exec,
 
 #pragma omp parallel for
     for (size_type a_row = 0; a_row < num_rows; ++a_row) {
+        if (has_long_rows && dense_row[a_row]) {
+            const auto offset = num_cols * omp_get_thread_num();
+            spgemm_dense_accumulate(a_row, a, b, marker + offset,
+                                    accumulator + offset,
+                                    c_col_idxs + c_row_ptrs[a_row],
+                                    c_vals + c_row_ptrs[a_row]);
+            continue;
+        }
         spgemm_multiway_merge(
             a_row, a, b, heap,
             [&](size_type row) {
@@ -389,6 +929,85 @@ void spgemm(std::shared_ptr<const OmpExecutor> exec,
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_CSR_SPGEMM_KERNEL);
 
 
+template <typename ValueType, typename IndexType>
+void spgemm_symbolic(std::shared_ptr<const OmpExecutor> exec,
+                     const matrix::Csr<ValueType, IndexType>* a,
+                     const matrix::Csr<ValueType, IndexType>* b,
+                     IndexType* c_row_ptrs, array<IndexType>& c_col_idxs_array)
+{
+    auto num_rows = a->get_size()[0];
+    auto num_cols = b->get_size()[1];
+    const auto use_dense = num_cols <= spgemm_dense_max_cols;
+
+    // rows with many products use a dense marker of one row per thread
+    bool has_long_rows = false;
+    if (use_dense) {
+#pragma omp parallel for reduction(|| : has_long_rows)
+        for (size_type row = 0; row < num_rows; ++row) {
+            has_long_rows =
+                has_long_rows ||
+                spgemm_num_products(row, a, b) >= spgemm_dense_threshold;
+        }
+    }
+    const auto workspace_size =
+        has_long_rows ? num_cols * omp_get_max_threads() : size_type{};
+    array<IndexType> marker_array(exec, workspace_size);
+    components::fill_array(exec, marker_array.get_data(), workspace_size,
+                           invalid_index<IndexType>());
+    auto marker = marker_array.get_data();
+
+    array<col_heap_element<ValueType, IndexType>> col_heap_array(
+        exec, a->get_num_stored_elements());
+
+    auto col_heap = col_heap_array.get_data();
+
+    // first sweep: count nnz for each row
+#pragma omp parallel for
+    for (size_type a_row = 0; a_row < num_rows; ++a_row) {
+        if (has_long_rows &&
+            spgemm_num_products(a_row, a, b) >= spgemm_dense_threshold) {
+            c_row_ptrs[a_row] = spgemm_dense_count(
+                a_row, a, b, marker + num_cols * omp_get_thread_num());
+            continue;
+        }
+        c_row_ptrs[a_row] = spgemm_multiway_merge(
+            a_row, a, b, col_heap, [](size_type) { return IndexType{}; },
+            [](ValueType, IndexType, IndexType&) {},
+            [](IndexType, IndexType& nnz) { nnz++; });
+    }
+
+    // build row pointers
+    components::prefix_sum(exec, c_row_ptrs, num_rows + 1);
+
+    // the marker may contain rows from the first sweep
+    components::fill_array(exec, marker, workspace_size,
+                           invalid_index<IndexType>());
+    c_col_idxs_array.resize_and_reset(c_row_ptrs[num_rows]);
+    auto c_col_idxs = c_col_idxs_array.get_data();
+
+    // second sweep: store the column indices, using the same path as the
+    // first sweep for every row
+#pragma omp parallel for
+    for (size_type a_row = 0; a_row < num_rows; ++a_row) {
+        if (has_long_rows &&
+            spgemm_num_products(a_row, a, b) >= spgemm_dense_threshold) {
+            spgemm_dense_pattern(a_row, a, b,
+                                 marker + num_cols * omp_get_thread_num(),
+                                 c_col_idxs + c_row_ptrs[a_row]);
+            continue;
+        }
+        spgemm_multiway_merge(
+            a_row, a, b, col_heap,
+            [&](size_type row) { return c_row_ptrs[row]; },
+            [](ValueType, IndexType, IndexType&) {},
+            [&](IndexType col, IndexType& nz) { c_col_idxs[nz++] = col; });
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_CSR_SPGEMM_SYMBOLIC_KERNEL);
+
+
 template <typename ValueType, typename IndexType>
 void advanced_spgemm(std::shared_ptr<const OmpExecutor> exec,
                      const matrix::Dense<ValueType>* alpha,
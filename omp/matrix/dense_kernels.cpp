@@ -34,6 +34,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 
 #include <algorithm>
+#include <array>
+#include <complex>
+#include <limits>
 
 
 #include <omp.h>
@@ -54,9 +57,15 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "accessor/block_col_major.hpp"
 #include "accessor/range.hpp"
+#include "core/base/allocator.hpp"
 #include "core/components/prefix_sum_kernels.hpp"
 
 
+#if GKO_HAVE_CBLAS
+#include <cblas.h>
+#endif  // GKO_HAVE_CBLAS
+
+
 namespace gko {
 namespace kernels {
 namespace omp {
@@ -109,6 +118,280 @@ GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(
     GKO_DECLARE_DENSE_COMPUTE_NORM2_DISPATCH_KERNEL);
 
 
+namespace {
+
+
+/**
+ * The number of rows and columns of the register block computed by the GEMM
+ * micro-kernel.
+ */
+constexpr int gemm_block_rows = 4;
+constexpr int gemm_block_cols = 8;
+
+/**
+ * The number of rows of A and B that form a cache-resident panel in the
+ * blocked GEMM.
+ */
+constexpr size_type gemm_panel_rows = 64;
+constexpr size_type gemm_panel_inner = 256;
+
+
+#if GKO_HAVE_CBLAS
+
+
+template <typename ValueType>
+bool is_blas_compatible(const matrix::Dense<ValueType>* a,
+                        const matrix::Dense<ValueType>* b,
+                        const matrix::Dense<ValueType>* c)
+{
+    constexpr auto max_size =
+        static_cast<size_type>(std::numeric_limits<int>::max());
+    return c->get_size()[0] <= max_size && c->get_size()[1] <= max_size &&
+           a->get_size()[1] <= max_size && a->get_stride() <= max_size &&
+           b->get_stride() <= max_size && c->get_stride() <= max_size;
+}
+
+
+bool blas_gemm(float alpha, const matrix::Dense<float>* a,
+               const matrix::Dense<float>* b, matrix::Dense<float>* c)
+{
+    if (!is_blas_compatible(a, b, c)) {
+        return false;
+    }
+    cblas_sgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, c->get_size()[0],
+                c->get_size()[1], a->get_size()[1], alpha,
+                a->get_const_values(), a->get_stride(), b->get_const_values(),
+                b->get_stride(), 1.0f, c->get_values(), c->get_stride());
+    return true;
+}
+
+
+bool blas_gemm(double alpha, const matrix::Dense<double>* a,
+               const matrix::Dense<double>* b, matrix::Dense<double>* c)
+{
+    if (!is_blas_compatible(a, b, c)) {
+        return false;
+    }
+    cblas_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, c->get_size()[0],
+                c->get_size()[1], a->get_size()[1], alpha,
+                a->get_const_values(), a->get_stride(), b->get_const_values(),
+                b->get_stride(), 1.0, c->get_values(), c->get_stride());
+    return true;
+}
+
+
+bool blas_gemm(std::complex<float> alpha,
+               const matrix::Dense<std::complex<float>>* a,
+               const matrix::Dense<std::complex<float>>* b,
+               matrix::Dense<std::complex<float>>* c)
+{
+    if (!is_blas_compatible(a, b, c)) {
+        return false;
+    }
+    const auto beta = one<std::complex<float>>();
+    cblas_cgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, c->get_size()[0],
+                c->get_size()[1], a->get_size()[1], &alpha,
+                a->get_const_values(), a->get_stride(), b->get_const_values(),
+                b->get_stride(), &beta, c->get_values(), c->get_stride());
+    return true;
+}
+
+
+bool blas_gemm(std::complex<double> alpha,
+               const matrix::Dense<std::complex<double>>* a,
+               const matrix::Dense<std::complex<double>>* b,
+               matrix::Dense<std::complex<double>>* c)
+{
+    if (!is_blas_compatible(a, b, c)) {
+        return false;
+    }
+    const auto beta = one<std::complex<double>>();
+    cblas_zgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, c->get_size()[0],
+                c->get_size()[1], a->get_size()[1], &alpha,
+                a->get_const_values(), a->get_stride(), b->get_const_values(),
+                b->get_stride(), &beta, c->get_values(), c->get_stride());
+    return true;
+}
+
+
+#endif  // GKO_HAVE_CBLAS
+
+
+/**
+ * @internal
+ *
+ * Fallback for value types without BLAS support.
+ */
+template <typename ValueType>
+bool blas_gemm(ValueType, const matrix::Dense<ValueType>*,
+               const matrix::Dense<ValueType>*, matrix::Dense<ValueType>*)
+{
+    return false;
+}
+
+
+/**
+ * @internal
+ *
+ * Computes a block_rows x gemm_block_cols block of C += alpha * A * B, with B
+ * packed row-wise into gemm_block_cols wide rows. Only the first num_cols
+ * columns of the block are written back.
+ */
+template <int block_rows, typename ValueType>
+void gemm_micro_kernel(ValueType alpha, const ValueType* a, size_type a_stride,
+                       size_type inner_size, const ValueType* packed_b,
+                       ValueType* c, size_type c_stride, int num_cols)
+{
+    std::array<std::array<ValueType, gemm_block_cols>, block_rows> acc{};
+    for (size_type inner = 0; inner < inner_size; inner++) {
+        const auto b_row = packed_b + inner * gemm_block_cols;
+        for (int row = 0; row < block_rows; row++) {
+            const auto a_val = a[row * a_stride + inner];
+            for (int col = 0; col < gemm_block_cols; col++) {
+                acc[row][col] += a_val * b_row[col];
+            }
+        }
+    }
+    for (int row = 0; row < block_rows; row++) {
+        for (int col = 0; col < num_cols; col++) {
+            c[row * c_stride + col] += alpha * acc[row][col];
+        }
+    }
+}
+
+
+/**
+ * @internal
+ *
+ * Computes C += alpha * A * B for tall-skinny products where B fits into the
+ * cache and C has at most gemm_block_cols columns.
+ */
+template <typename ValueType>
+void narrow_gemm(ValueType alpha, const matrix::Dense<ValueType>* a,
+                 const matrix::Dense<ValueType>* b, matrix::Dense<ValueType>* c)
+{
+    const auto num_cols = c->get_size()[1];
+#pragma omp parallel for
+    for (size_type row = 0; row < c->get_size()[0]; ++row) {
+        std::array<ValueType, gemm_block_cols> acc{};
+        for (size_type inner = 0; inner < a->get_size()[1]; ++inner) {
+            const auto a_val = a->at(row, inner);
+            for (size_type col = 0; col < num_cols; ++col) {
+                acc[col] += a_val * b->at(inner, col);
+            }
+        }
+        for (size_type col = 0; col < num_cols; ++col) {
+            c->at(row, col) += alpha * acc[col];
+        }
+    }
+}
+
+
+/**
+ * @internal
+ *
+ * Computes C += alpha * A * B block by block along the inner dimension. Each
+ * block of gemm_panel_inner rows of B is packed once into gemm_block_cols wide
+ * column blocks shared by all threads, which then update their panels of
+ * gemm_panel_rows rows of C using the register-blocked micro-kernel.
+ */
+template <typename ValueType>
+void blocked_gemm(std::shared_ptr<const DefaultExecutor> exec,
+                  ValueType alpha, const matrix::Dense<ValueType>* a,
+                  const matrix::Dense<ValueType>* b,
+                  matrix::Dense<ValueType>* c)
+{
+    const auto num_rows = c->get_size()[0];
+    const auto num_cols = c->get_size()[1];
+    const auto inner_size = a->get_size()[1];
+    const auto a_stride = a->get_stride();
+    const auto c_stride = c->get_stride();
+    const auto num_panels = ceildiv(num_rows, gemm_panel_rows);
+    const auto num_col_blocks = ceildiv(num_cols, gemm_block_cols);
+    const auto packed_block_size = gemm_panel_inner * gemm_block_cols;
+    vector<ValueType> packed_b(num_col_blocks * packed_block_size, {exec});
+    const auto packed = packed_b.data();
+#pragma omp parallel
+    for (size_type inner_begin = 0; inner_begin < inner_size;
+         inner_begin += gemm_panel_inner) {
+        const auto local_inner =
+            std::min(gemm_panel_inner, inner_size - inner_begin);
+        // the implicit barriers make sure the packed blocks are complete
+        // before and unused after the panel updates
+#pragma omp for
+        for (size_type col_block = 0; col_block < num_col_blocks;
+             ++col_block) {
+            const auto col_begin = col_block * gemm_block_cols;
+            const auto block = packed + col_block * packed_block_size;
+            for (size_type inner = 0; inner < local_inner; ++inner) {
+                for (int col = 0; col < gemm_block_cols; ++col) {
+                    block[inner * gemm_block_cols + col] =
+                        col_begin + col < num_cols
+                            ? b->at(inner_begin + inner, col_begin + col)
+                            : zero<ValueType>();
+                }
+            }
+        }
+#pragma omp for
+        for (size_type panel = 0; panel < num_panels; ++panel) {
+            const auto row_begin = panel * gemm_panel_rows;
+            const auto row_end =
+                std::min(row_begin + gemm_panel_rows, num_rows);
+            const auto a_block = a->get_const_values() + inner_begin;
+            for (size_type col_block = 0; col_block < num_col_blocks;
+                 ++col_block) {
+                const auto col_begin = col_block * gemm_block_cols;
+                const auto local_cols = static_cast<int>(
+                    std::min(static_cast<size_type>(gemm_block_cols),
+                             num_cols - col_begin));
+                const auto block = packed + col_block * packed_block_size;
+                const auto c_block = c->get_values() + col_begin;
+                auto row = row_begin;
+                for (; row + gemm_block_rows <= row_end;
+                     row += gemm_block_rows) {
+                    gemm_micro_kernel<gemm_block_rows>(
+                        alpha, a_block + row * a_stride, a_stride,
+                        local_inner, block, c_block + row * c_stride,
+                        c_stride, local_cols);
+                }
+                for (; row < row_end; ++row) {
+                    gemm_micro_kernel<1>(alpha, a_block + row * a_stride,
+                                         a_stride, local_inner, block,
+                                         c_block + row * c_stride, c_stride,
+                                         local_cols);
+                }
+            }
+        }
+    }
+}
+
+
+/**
+ * @internal
+ *
+ * Computes C += alpha * A * B, using BLAS if it is available.
+ */
+template <typename ValueType>
+void gemm(std::shared_ptr<const DefaultExecutor> exec, ValueType alpha,
+          const matrix::Dense<ValueType>* a, const matrix::Dense<ValueType>* b,
+          matrix::Dense<ValueType>* c)
+{
+    if (c->get_size()[0] == 0 || c->get_size()[1] == 0 ||
+        a->get_size()[1] == 0 || blas_gemm(alpha, a, b, c)) {
+        return;
+    }
+    if (c->get_size()[1] <= gemm_block_cols &&
+        a->get_size()[1] <= gemm_panel_inner) {
+        narrow_gemm(alpha, a, b, c);
+    } else {
+        blocked_gemm(exec, alpha, a, b, c);
+    }
+}
+
+
+}  // namespace
+
+
 template <typename ValueType>
 void simple_apply(std::shared_ptr<const DefaultExecutor> exec,
                   const matrix::Dense<ValueType>* a,
@@ -122,14 +405,7 @@ void simple_apply(std::shared_ptr<const DefaultExecutor> exec,
         }
     }
 
-#pragma omp parallel for
-    for (size_type row = 0; row < c->get_size()[0]; ++row) {
-        for (size_type inner = 0; inner < a->get_size()[1]; ++inner) {
-            for (size_type col = 0; col < c->get_size()[1]; ++col) {
-                c->at(row, col) += a->at(row, inner) * b->at(inner, col);
-            }
-        }
-    }
+    gemm(exec, one<ValueType>(), a, b, c);
 }
 
 GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_DENSE_SIMPLE_APPLY_KERNEL);
@@ -157,15 +433,7 @@ void apply(std::shared_ptr<const DefaultExecutor> exec,
         }
     }
 
-#pragma omp parallel for
-    for (size_type row = 0; row < c->get_size()[0]; ++row) {
-        for (size_type inner = 0; inner < a->get_size()[1]; ++inner) {
-            for (size_type col = 0; col < c->get_size()[1]; ++col) {
-                c->at(row, col) +=
-                    alpha->at(0, 0) * a->at(row, inner) * b->at(inner, col);
-            }
-        }
-    }
+    gemm(exec, alpha->at(0, 0), a, b, c);
 }
 
 GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_DENSE_APPLY_KERNEL);
@@ -69,6 +69,82 @@ namespace omp {
 namespace fbcsr {
 
 
+namespace {
+
+
+/**
+ * The block sizes with a specialized SpMV kernel. They include the host-only
+ * block sizes in addition to fixedblock::compiled_kernels.
+ */
+using spmv_block_sizes = fixedblock::host_kernels;
+
+
+/**
+ * Computes c = alpha * a * b + beta * c for a block size known at compile
+ * time, such that the per-block products can be kept in registers and the
+ * column-major block columns vectorized. Without alpha and beta, it computes
+ * c = a * b.
+ */
+template <int block_size, typename ValueType, typename IndexType>
+void spmv_fixed_block(syn::value_list<int, block_size>,
+                      const matrix::Fbcsr<ValueType, IndexType>* const a,
+                      const matrix::Dense<ValueType>* const b,
+                      matrix::Dense<ValueType>* const c,
+                      const matrix::Dense<ValueType>* const alpha = nullptr,
+                      const matrix::Dense<ValueType>* const beta = nullptr)
+{
+    constexpr int bs = block_size;
+    constexpr int bs2 = bs * bs;
+    const auto nvecs = b->get_size()[1];
+    const IndexType nbrows = a->get_num_block_rows();
+    const auto row_ptrs = a->get_const_row_ptrs();
+    const auto col_idxs = a->get_const_col_idxs();
+    const auto values = a->get_const_values();
+    const auto b_vals = b->get_const_values();
+    const auto b_stride = b->get_stride();
+    const auto valpha = alpha ? alpha->at(0, 0) : one<ValueType>();
+    const auto vbeta = beta ? beta->at(0, 0) : zero<ValueType>();
+
+#pragma omp parallel for
+    for (IndexType ibrow = 0; ibrow < nbrows; ++ibrow) {
+        for (size_type j = 0; j < nvecs; ++j) {
+            ValueType partial[bs]{};
+            for (auto inz = row_ptrs[ibrow]; inz < row_ptrs[ibrow + 1];
+                 ++inz) {
+                const auto block = values + inz * bs2;
+                const auto b_block = b_vals + col_idxs[inz] * bs * b_stride + j;
+                for (int jb = 0; jb < bs; ++jb) {
+                    const auto b_val = b_block[jb * b_stride];
+#pragma omp simd
+                    for (int ib = 0; ib < bs; ++ib) {
+                        partial[ib] += block[jb * bs + ib] * b_val;
+                    }
+                }
+            }
+            for (int ib = 0; ib < bs; ++ib) {
+                const auto row = ibrow * bs + ib;
+                c->at(row, j) = beta ? vbeta * c->at(row, j) +
+                                           valpha * partial[ib]
+                                     : valpha * partial[ib];
+            }
+        }
+    }
+}
+
+GKO_ENABLE_IMPLEMENTATION_SELECTION(select_spmv_fixed_block,
+                                    spmv_fixed_block);
+
+
+bool has_fixed_block_kernel(int bs)
+{
+    constexpr auto compiled = syn::as_array(spmv_block_sizes());
+    return std::find(compiled.begin(), compiled.end(), bs) != compiled.end();
+}
+
+
+}  // namespace
+
+
 template <typename ValueType, typename IndexType>
 void spmv(std::shared_ptr<const OmpExecutor> exec,
           const matrix::Fbcsr<ValueType, IndexType>* const a,
@@ -76,6 +152,13 @@ void spmv(std::shared_ptr<const OmpExecutor> exec,
           matrix::Dense<ValueType>* const c)
 {
     const int bs = a->get_block_size();
+    if (has_fixed_block_kernel(bs)) {
+        select_spmv_fixed_block(
+            spmv_block_sizes(),
+            [bs](int compiled_block_size) { return bs == compiled_block_size; },
+            syn::value_list<int>(), syn::type_list<>(), a, b, c);
+        return;
+    }
     const auto nvecs = static_cast<IndexType>(b->get_size()[1]);
     const IndexType nbrows = a->get_num_block_rows();
     const size_type nbnz = a->get_num_stored_blocks();
@@ -119,6 +202,13 @@ void advanced_spmv(std::shared_ptr<const OmpExecutor> exec,
                    matrix::Dense<ValueType>* const c)
 {
     const int bs = a->get_block_size();
+    if (has_fixed_block_kernel(bs)) {
+        select_spmv_fixed_block(
+            spmv_block_sizes(),
+            [bs](int compiled_block_size) { return bs == compiled_block_size; },
+            syn::value_list<int>(), syn::type_list<>(), a, b, c, alpha, beta);
+        return;
+    }
     const auto nvecs = static_cast<IndexType>(b->get_size()[1]);
     const IndexType nbrows = a->get_num_block_rows();
     const size_type nbnz = a->get_num_stored_blocks();
@@ -456,7 +546,7 @@ void sort_by_column_index(const std::shared_ptr<const OmpExecutor> exec,
 {
     const int bs = to_sort->get_block_size();
     select_sort_col_idx(
-        fixedblock::compiled_kernels(),
+        fixedblock::host_kernels(),
         [bs](int compiled_block_size) { return bs == compiled_block_size; },
         syn::value_list<int>(), syn::type_list<>(), to_sort);
 }
@@ -53,39 +53,50 @@ namespace omp {
 namespace sellp {
 
 
-template <int num_rhs, typename ValueType, typename IndexType, typename OutFn>
+template <int num_rhs, typename MatrixValueType, typename InputValueType,
+          typename OutputValueType, typename IndexType, typename OutFn>
 void spmv_small_rhs(std::shared_ptr<const OmpExecutor> exec,
-                    const matrix::Sellp<ValueType, IndexType>* a,
-                    const matrix::Dense<ValueType>* b,
-                    matrix::Dense<ValueType>* c, OutFn out)
+                    const matrix::Sellp<MatrixValueType, IndexType>* a,
+                    const matrix::Dense<InputValueType>* b,
+                    matrix::Dense<OutputValueType>* c, OutFn out)
 {
+    using arithmetic_type =
+        highest_precision<InputValueType, OutputValueType, MatrixValueType>;
     GKO_ASSERT(b->get_size()[1] == num_rhs);
     auto slice_lengths = a->get_const_slice_lengths();
     auto slice_sets = a->get_const_slice_sets();
     auto slice_size = a->get_slice_size();
     auto slice_num = ceildiv(a->get_size()[0] + slice_size - 1, slice_size);
+    // SELL-C-sigma matrices store their rows in permuted order
+    const auto perm = a->get_const_permutation();
 #pragma omp parallel for collapse(2)
     for (size_type slice = 0; slice < slice_num; slice++) {
         for (size_type row = 0; row < slice_size; row++) {
             size_type global_row = slice * slice_size + row;
             if (global_row < a->get_size()[0]) {
-                std::array<ValueType, num_rhs> partial_sum;
-                partial_sum.fill(zero<ValueType>());
+                const auto out_row =
+                    perm ? static_cast<size_type>(perm[global_row])
+                         : global_row;
+                std::array<arithmetic_type, num_rhs> partial_sum;
+                partial_sum.fill(zero<arithmetic_type>());
                 for (size_type i = 0; i < slice_lengths[slice]; i++) {
-                    auto val = a->val_at(row, slice_sets[slice], i);
+                    auto val = static_cast<arithmetic_type>(
+                        a->val_at(row, slice_sets[slice], i));
                     auto col = a->col_at(row, slice_sets[slice], i);
                     if (col != invalid_index<IndexType>()) {
 #pragma unroll
                         for (size_type j = 0; j < num_rhs; j++) {
-                            partial_sum[j] += val * b->at(col, j);
+                            partial_sum[j] +=
+                                val *
+                                static_cast<arithmetic_type>(b->at(col, j));
                         }
                     }
                 }
 #pragma unroll
                 for (size_type j = 0; j < num_rhs; j++) {
                     [&] {
-                        c->at(global_row, j) =
-                            out(global_row, j, partial_sum[j]);
+                        c->at(out_row, j) = static_cast<OutputValueType>(
+                            out(out_row, j, partial_sum[j]));
                     }();
                 }
             }
@@ -94,17 +105,21 @@ void spmv_small_rhs(std::shared_ptr<const OmpExecutor> exec,
 }
 
 
-template <int block_size, typename ValueType, typename IndexType,
-          typename OutFn>
+template <int block_size, typename MatrixValueType, typename InputValueType,
+          typename OutputValueType, typename IndexType, typename OutFn>
 void spmv_blocked(std::shared_ptr<const OmpExecutor> exec,
-                  const matrix::Sellp<ValueType, IndexType>* a,
-                  const matrix::Dense<ValueType>* b,
-                  matrix::Dense<ValueType>* c, OutFn out)
+                  const matrix::Sellp<MatrixValueType, IndexType>* a,
+                  const matrix::Dense<InputValueType>* b,
+                  matrix::Dense<OutputValueType>* c, OutFn out)
 {
+    using arithmetic_type =
+        highest_precision<InputValueType, OutputValueType, MatrixValueType>;
     auto slice_lengths = a->get_const_slice_lengths();
     auto slice_sets = a->get_const_slice_sets();
     auto slice_size = a->get_slice_size();
     auto slice_num = ceildiv(a->get_size()[0] + slice_size - 1, slice_size);
+    // SELL-C-sigma matrices store their rows in permuted order
+    const auto perm = a->get_const_permutation();
     const auto num_rhs = b->get_size()[1];
     const auto rounded_rhs = num_rhs / block_size * block_size;
 #pragma omp parallel for collapse(2)
@@ -112,43 +127,52 @@ void spmv_blocked(std::shared_ptr<const OmpExecutor> exec,
         for (size_type row = 0; row < slice_size; row++) {
             size_type global_row = slice * slice_size + row;
             if (global_row < a->get_size()[0]) {
-                std::array<ValueType, block_size> partial_sum;
+                const auto out_row =
+                    perm ? static_cast<size_type>(perm[global_row])
+                         : global_row;
+                std::array<arithmetic_type, block_size> partial_sum;
                 for (size_type rhs_base = 0; rhs_base < rounded_rhs;
                      rhs_base += block_size) {
-                    partial_sum.fill(zero<ValueType>());
+                    partial_sum.fill(zero<arithmetic_type>());
                     for (size_type i = 0; i < slice_lengths[slice]; i++) {
-                        auto val = a->val_at(row, slice_sets[slice], i);
+                        auto val = static_cast<arithmetic_type>(
+                            a->val_at(row, slice_sets[slice], i));
                         auto col = a->col_at(row, slice_sets[slice], i);
                         if (col != invalid_index<IndexType>()) {
 #pragma unroll
                             for (size_type j = 0; j < block_size; j++) {
                                 partial_sum[j] +=
-                                    val * b->at(col, j + rhs_base);
+                                    val * static_cast<arithmetic_type>(
+                                              b->at(col, j + rhs_base));
                             }
                         }
                     }
 #pragma unroll
                     for (size_type j = 0; j < block_size; j++) {
                         [&] {
-                            c->at(global_row, j + rhs_base) =
-                                out(global_row, j + rhs_base, partial_sum[j]);
+                            c->at(out_row, j + rhs_base) =
+                                static_cast<OutputValueType>(out(
+                                    out_row, j + rhs_base, partial_sum[j]));
                         }();
                     }
                 }
-                partial_sum.fill(zero<ValueType>());
+                partial_sum.fill(zero<arithmetic_type>());
                 for (size_type i = 0; i < slice_lengths[slice]; i++) {
-                    auto val = a->val_at(row, slice_sets[slice], i);
+                    auto val = static_cast<arithmetic_type>(
+                        a->val_at(row, slice_sets[slice], i));
                     auto col = a->col_at(row, slice_sets[slice], i);
                     if (col != invalid_index<IndexType>()) {
                         for (size_type j = rounded_rhs; j < num_rhs; j++) {
-                            partial_sum[j - rounded_rhs] += val * b->at(col, j);
+                            partial_sum[j - rounded_rhs] +=
+                                val *
+                                static_cast<arithmetic_type>(b->at(col, j));
                         }
                     }
                 }
                 for (size_type j = rounded_rhs; j < num_rhs; j++) {
                     [&] {
-                        c->at(global_row, j) =
-                            out(global_row, j, partial_sum[j - rounded_rhs]);
+                        c->at(out_row, j) = static_cast<OutputValueType>(
+                            out(out_row, j, partial_sum[j - rounded_rhs]));
                     }();
                 }
             }
@@ -157,16 +181,14 @@ void spmv_blocked(std::shared_ptr<const OmpExecutor> exec,
 }
 
 
-template <typename ValueType, typename IndexType>
-void spmv(std::shared_ptr<const OmpExecutor> exec,
-          const matrix::Sellp<ValueType, IndexType>* a,
-          const matrix::Dense<ValueType>* b, matrix::Dense<ValueType>* c)
+template <typename MatrixValueType, typename InputValueType,
+          typename OutputValueType, typename IndexType, typename OutFn>
+void spmv_dispatch_rhs(std::shared_ptr<const OmpExecutor> exec,
+                       const matrix::Sellp<MatrixValueType, IndexType>* a,
+                       const matrix::Dense<InputValueType>* b,
+                       matrix::Dense<OutputValueType>* c, OutFn out)
 {
     const auto num_rhs = b->get_size()[1];
-    if (num_rhs <= 0) {
-        return;
-    }
-    auto out = [](auto, auto, auto value) { return value; };
     if (num_rhs == 1) {
         spmv_small_rhs<1>(exec, a, b, c, out);
         return;
@@ -186,6 +208,20 @@ void spmv(std::shared_ptr<const OmpExecutor> exec,
     spmv_blocked<4>(exec, a, b, c, out);
 }
 
+
+template <typename ValueType, typename IndexType>
+void spmv(std::shared_ptr<const OmpExecutor> exec,
+          const matrix::Sellp<ValueType, IndexType>* a,
+          const matrix::Dense<ValueType>* b, matrix::Dense<ValueType>* c)
+{
+    const auto num_rhs = b->get_size()[1];
+    if (num_rhs <= 0) {
+        return;
+    }
+    auto out = [](auto, auto, auto value) { return value; };
+    spmv_dispatch_rhs(exec, a, b, c, out);
+}
+
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_SELLP_SPMV_KERNEL);
 
 
@@ -206,27 +242,56 @@ void advanced_spmv(std::shared_ptr<const OmpExecutor> exec,
     auto out = [&](auto i, auto j, auto value) {
         return alpha_val * value + beta_val * c->at(i, j);
     };
-    if (num_rhs == 1) {
-        spmv_small_rhs<1>(exec, a, b, c, out);
-        return;
-    }
-    if (num_rhs == 2) {
-        spmv_small_rhs<2>(exec, a, b, c, out);
-        return;
-    }
-    if (num_rhs == 3) {
-        spmv_small_rhs<3>(exec, a, b, c, out);
+    spmv_dispatch_rhs(exec, a, b, c, out);
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SELLP_ADVANCED_SPMV_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void mixed_spmv(std::shared_ptr<const OmpExecutor> exec,
+                const matrix::Sellp<ValueType, IndexType>* a,
+                const matrix::Dense<next_precision<ValueType>>* b,
+                matrix::Dense<next_precision<ValueType>>* c)
+{
+    const auto num_rhs = b->get_size()[1];
+    if (num_rhs <= 0) {
         return;
     }
-    if (num_rhs == 4) {
-        spmv_small_rhs<4>(exec, a, b, c, out);
+    auto out = [](auto, auto, auto value) { return value; };
+    spmv_dispatch_rhs(exec, a, b, c, out);
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SELLP_MIXED_SPMV_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void advanced_mixed_spmv(std::shared_ptr<const OmpExecutor> exec,
+                         const matrix::Dense<next_precision<ValueType>>* alpha,
+                         const matrix::Sellp<ValueType, IndexType>* a,
+                         const matrix::Dense<next_precision<ValueType>>* b,
+                         const matrix::Dense<next_precision<ValueType>>* beta,
+                         matrix::Dense<next_precision<ValueType>>* c)
+{
+    using arithmetic_type =
+        highest_precision<ValueType, next_precision<ValueType>>;
+    const auto num_rhs = b->get_size()[1];
+    if (num_rhs <= 0) {
         return;
     }
-    spmv_blocked<4>(exec, a, b, c, out);
+    const auto alpha_val = static_cast<arithmetic_type>(alpha->at(0, 0));
+    const auto beta_val = static_cast<arithmetic_type>(beta->at(0, 0));
+    auto out = [&](auto i, auto j, auto value) {
+        return alpha_val * value +
+               beta_val * static_cast<arithmetic_type>(c->at(i, j));
+    };
+    spmv_dispatch_rhs(exec, a, b, c, out);
 }
 
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
-    GKO_DECLARE_SELLP_ADVANCED_SPMV_KERNEL);
+    GKO_DECLARE_SELLP_ADVANCED_MIXED_SPMV_KERNEL);
 
 
 }  // namespace sellp
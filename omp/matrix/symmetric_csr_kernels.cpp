@@ -0,0 +1,362 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2022, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include "core/matrix/symmetric_csr_kernels.hpp"
+
+
+#include <algorithm>
+
+
+#include <omp.h>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+
+#include "omp/components/atomic.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace omp {
+/**
+ * @brief The symmetric compressed sparse row matrix format namespace.
+ * @ref SymmetricCsr
+ * @ingroup symmetric_csr
+ */
+namespace symmetric_csr {
+namespace {
+
+
+/**
+ * Computes c = init(c) + scale * A * b by splitting the rows into
+ * nonzero-balanced chunks. Each chunk accumulates the products of its stored
+ * upper triangle into its own rows of c and scatters the mirrored lower
+ * triangle products either into its own rows or, for rows of later chunks,
+ * into a private partial result. The partial result of a chunk only covers the
+ * rows between the end of the chunk and the largest column it stores. The
+ * partial results are added to the rows they belong to in a second pass, so no
+ * two threads ever write to the same entry.
+ */
+template <typename ValueType, typename IndexType, typename InitFn>
+void spmv_impl(std::shared_ptr<const OmpExecutor> exec,
+               const matrix::SymmetricCsr<ValueType, IndexType>* a,
+               const matrix::Dense<ValueType>* b, matrix::Dense<ValueType>* c,
+               ValueType scale, InitFn init, array<char>& buffer)
+{
+    const auto row_ptrs = a->get_const_row_ptrs();
+    const auto col_idxs = a->get_const_col_idxs();
+    const auto vals = a->get_const_values();
+    const auto num_rows = a->get_size()[0];
+    const auto num_rhs = c->get_size()[1];
+    if (num_rows == 0 || num_rhs == 0) {
+        return;
+    }
+    const auto num_chunks = static_cast<size_type>(omp_get_max_threads());
+    const auto nnz = static_cast<size_type>(row_ptrs[num_rows]);
+    // the buffer stores the chunk bounds, followed by the partial results
+    const auto index_size = 3 * num_chunks + 2;
+    const auto partial_offset =
+        static_cast<size_type>(
+            ceildiv(index_size * sizeof(size_type), sizeof(ValueType))) *
+        sizeof(ValueType);
+    if (buffer.get_num_elems() < partial_offset) {
+        buffer.resize_and_reset(partial_offset);
+    }
+    auto chunk_begins = reinterpret_cast<size_type*>(buffer.get_data());
+    auto partial_ends = chunk_begins + num_chunks + 1;
+    auto partial_ptrs = partial_ends + num_chunks;
+    for (size_type chunk = 0; chunk <= num_chunks; ++chunk) {
+        const auto target_nz =
+            static_cast<IndexType>(nnz * chunk / num_chunks);
+        chunk_begins[chunk] = static_cast<size_type>(
+            std::lower_bound(row_ptrs, row_ptrs + num_rows, target_nz) -
+            row_ptrs);
+    }
+    chunk_begins[num_chunks] = num_rows;
+    // the columns need not be sorted, so all entries are searched for the
+    // largest column
+#pragma omp parallel for schedule(static, 1)
+    for (size_type chunk = 0; chunk < num_chunks; ++chunk) {
+        const auto end = chunk_begins[chunk + 1];
+        auto partial_end = end;
+        for (auto k = row_ptrs[chunk_begins[chunk]]; k < row_ptrs[end]; ++k) {
+            partial_end =
+                std::max(partial_end, static_cast<size_type>(col_idxs[k]) + 1);
+        }
+        partial_ends[chunk] = partial_end;
+    }
+    partial_ptrs[0] = 0;
+    for (size_type chunk = 0; chunk < num_chunks; ++chunk) {
+        partial_ptrs[chunk + 1] =
+            partial_ptrs[chunk] +
+            (partial_ends[chunk] - chunk_begins[chunk + 1]) * num_rhs;
+    }
+    const auto buffer_size =
+        partial_offset + partial_ptrs[num_chunks] * sizeof(ValueType);
+    if (buffer.get_num_elems() < buffer_size) {
+        // keep the chunk bounds when growing the buffer
+        array<char> grown{exec, buffer_size};
+        std::copy_n(buffer.get_const_data(), partial_offset, grown.get_data());
+        buffer = std::move(grown);
+        chunk_begins = reinterpret_cast<size_type*>(buffer.get_data());
+        partial_ends = chunk_begins + num_chunks + 1;
+        partial_ptrs = partial_ends + num_chunks;
+    }
+    const auto partial =
+        reinterpret_cast<ValueType*>(buffer.get_data() + partial_offset);
+
+#pragma omp parallel for schedule(static, 1)
+    for (size_type chunk = 0; chunk < num_chunks; ++chunk) {
+        const auto begin = chunk_begins[chunk];
+        const auto end = chunk_begins[chunk + 1];
+        const auto chunk_partial = partial + partial_ptrs[chunk];
+        std::fill(chunk_partial, partial + partial_ptrs[chunk + 1],
+                  zero<ValueType>());
+        for (auto row = begin; row < end; ++row) {
+            for (size_type j = 0; j < num_rhs; ++j) {
+                c->at(row, j) = init(row, j);
+            }
+        }
+        for (auto row = begin; row < end; ++row) {
+            for (auto k = row_ptrs[row]; k < row_ptrs[row + 1]; ++k) {
+                const auto val = vals[k];
+                const auto col = static_cast<size_type>(col_idxs[k]);
+                for (size_type j = 0; j < num_rhs; ++j) {
+                    c->at(row, j) += scale * val * b->at(col, j);
+                }
+                if (col == row) {
+                    continue;
+                }
+                const auto mirrored_val = conj(val);
+                if (col < end) {
+                    for (size_type j = 0; j < num_rhs; ++j) {
+                        c->at(col, j) += scale * mirrored_val * b->at(row, j);
+                    }
+                } else {
+                    const auto col_partial =
+                        chunk_partial + (col - end) * num_rhs;
+                    for (size_type j = 0; j < num_rhs; ++j) {
+                        col_partial[j] += mirrored_val * b->at(row, j);
+                    }
+                }
+            }
+        }
+    }
+
+#pragma omp parallel for schedule(static, 1)
+    for (size_type chunk = 0; chunk < num_chunks; ++chunk) {
+        const auto begin = chunk_begins[chunk];
+        const auto end = chunk_begins[chunk + 1];
+        // only the chunks before this one scatter into its rows
+        for (size_type other = 0; other < chunk; ++other) {
+            const auto other_begin = chunk_begins[other + 1];
+            const auto other_partial = partial + partial_ptrs[other];
+            const auto overlap_end = std::min(end, partial_ends[other]);
+            for (auto row = std::max(begin, other_begin); row < overlap_end;
+                 ++row) {
+                const auto row_partial =
+                    other_partial + (row - other_begin) * num_rhs;
+                for (size_type j = 0; j < num_rhs; ++j) {
+                    c->at(row, j) += scale * row_partial[j];
+                }
+            }
+        }
+    }
+}
+
+
+}  // namespace
+
+
+template <typename ValueType, typename IndexType>
+void spmv(std::shared_ptr<const OmpExecutor> exec,
+          const matrix::SymmetricCsr<ValueType, IndexType>* a,
+          const matrix::Dense<ValueType>* b, matrix::Dense<ValueType>* c,
+          array<char>& buffer)
+{
+    spmv_impl(
+        exec, a, b, c, one<ValueType>(),
+        [](auto, auto) { return zero<ValueType>(); }, buffer);
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SYMMETRIC_CSR_SPMV_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void advanced_spmv(std::shared_ptr<const OmpExecutor> exec,
+                   const matrix::Dense<ValueType>* alpha,
+                   const matrix::SymmetricCsr<ValueType, IndexType>* a,
+                   const matrix::Dense<ValueType>* b,
+                   const matrix::Dense<ValueType>* beta,
+                   matrix::Dense<ValueType>* c, array<char>& buffer)
+{
+    const auto vbeta = beta->at(0, 0);
+    spmv_impl(
+        exec, a, b, c, alpha->at(0, 0),
+        [&](auto row, auto col) { return vbeta * c->at(row, col); }, buffer);
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SYMMETRIC_CSR_ADVANCED_SPMV_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void count_upper_nonzeros(std::shared_ptr<const OmpExecutor> exec,
+                          const matrix::Csr<ValueType, IndexType>* source,
+                          IndexType* row_nnz)
+{
+    const auto row_ptrs = source->get_const_row_ptrs();
+    const auto col_idxs = source->get_const_col_idxs();
+#pragma omp parallel for
+    for (size_type row = 0; row < source->get_size()[0]; ++row) {
+        IndexType count{};
+        for (auto k = row_ptrs[row]; k < row_ptrs[row + 1]; ++k) {
+            count += static_cast<size_type>(col_idxs[k]) >= row;
+        }
+        row_nnz[row] = count;
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SYMMETRIC_CSR_COUNT_UPPER_NNZ_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void convert_from_csr(std::shared_ptr<const OmpExecutor> exec,
+                      const matrix::Csr<ValueType, IndexType>* source,
+                      matrix::SymmetricCsr<ValueType, IndexType>* result)
+{
+    const auto in_row_ptrs = source->get_const_row_ptrs();
+    const auto in_col_idxs = source->get_const_col_idxs();
+    const auto in_vals = source->get_const_values();
+    const auto out_row_ptrs = result->get_const_row_ptrs();
+    auto out_col_idxs = result->get_col_idxs();
+    auto out_vals = result->get_values();
+#pragma omp parallel for
+    for (size_type row = 0; row < source->get_size()[0]; ++row) {
+        auto out_nz = out_row_ptrs[row];
+        for (auto k = in_row_ptrs[row]; k < in_row_ptrs[row + 1]; ++k) {
+            if (static_cast<size_type>(in_col_idxs[k]) >= row) {
+                out_col_idxs[out_nz] = in_col_idxs[k];
+                out_vals[out_nz] = in_vals[k];
+                out_nz++;
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SYMMETRIC_CSR_CONVERT_FROM_CSR_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void count_csr_nonzeros(
+    std::shared_ptr<const OmpExecutor> exec,
+    const matrix::SymmetricCsr<ValueType, IndexType>* source,
+    IndexType* row_nnz)
+{
+    const auto row_ptrs = source->get_const_row_ptrs();
+    const auto col_idxs = source->get_const_col_idxs();
+    const auto num_rows = source->get_size()[0];
+#pragma omp parallel for
+    for (size_type row = 0; row < num_rows; ++row) {
+        row_nnz[row] = row_ptrs[row + 1] - row_ptrs[row];
+    }
+#pragma omp parallel for
+    for (size_type row = 0; row < num_rows; ++row) {
+        for (auto k = row_ptrs[row]; k < row_ptrs[row + 1]; ++k) {
+            const auto col = static_cast<size_type>(col_idxs[k]);
+            if (col != row) {
+                atomic_add(row_nnz[col], IndexType{1});
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SYMMETRIC_CSR_COUNT_CSR_NNZ_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void convert_to_csr(std::shared_ptr<const OmpExecutor> exec,
+                    const matrix::SymmetricCsr<ValueType, IndexType>* source,
+                    matrix::Csr<ValueType, IndexType>* result)
+{
+    const auto in_row_ptrs = source->get_const_row_ptrs();
+    const auto in_col_idxs = source->get_const_col_idxs();
+    const auto in_vals = source->get_const_values();
+    const auto out_row_ptrs = result->get_const_row_ptrs();
+    auto out_col_idxs = result->get_col_idxs();
+    auto out_vals = result->get_values();
+    const auto num_rows = source->get_size()[0];
+    // the upper triangle of each row is stored after its lower triangle
+#pragma omp parallel for
+    for (size_type row = 0; row < num_rows; ++row) {
+        auto out_nz = out_row_ptrs[row + 1] -
+                      (in_row_ptrs[row + 1] - in_row_ptrs[row]);
+        for (auto k = in_row_ptrs[row]; k < in_row_ptrs[row + 1]; ++k) {
+            out_col_idxs[out_nz] = in_col_idxs[k];
+            out_vals[out_nz] = in_vals[k];
+            out_nz++;
+        }
+    }
+    // the mirrored lower triangle needs to be ordered by the row it is
+    // mirrored from, so it is filled sequentially
+    array<IndexType> lower_nz{exec, out_row_ptrs, out_row_ptrs + num_rows};
+    auto next_lower_nz = lower_nz.get_data();
+    for (size_type row = 0; row < num_rows; ++row) {
+        for (auto k = in_row_ptrs[row]; k < in_row_ptrs[row + 1]; ++k) {
+            const auto col = in_col_idxs[k];
+            if (static_cast<size_type>(col) != row) {
+                const auto out_nz = next_lower_nz[col]++;
+                out_col_idxs[out_nz] = static_cast<IndexType>(row);
+                out_vals[out_nz] = conj(in_vals[k]);
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SYMMETRIC_CSR_CONVERT_TO_CSR_KERNEL);
+
+
+}  // namespace symmetric_csr
+}  // namespace omp
+}  // namespace kernels
+}  // namespace gko
@@ -35,6 +35,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <algorithm>
 #include <memory>
+#include <utility>
 
 
 #include <omp.h>
@@ -45,7 +46,10 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ginkgo/core/multigrid/pgm.hpp>
 
 
+#include "core/base/allocator.hpp"
 #include "core/base/iterator_factory.hpp"
+#include "core/components/prefix_sum_kernels.hpp"
+#include "core/matrix/csr_builder.hpp"
 
 
 namespace gko {
@@ -121,6 +125,106 @@ GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
     GKO_DECLARE_PGM_COMPUTE_COARSE_COO);
 
 
+template <typename ValueType, typename IndexType>
+void compute_coarse_csr(std::shared_ptr<const DefaultExecutor> exec,
+                        const matrix::Csr<ValueType, IndexType>* fine,
+                        const array<IndexType>& agg,
+                        matrix::Csr<ValueType, IndexType>* coarse)
+{
+    using entry = std::pair<IndexType, ValueType>;
+    const auto num_fine_rows = fine->get_size()[0];
+    const auto num_agg = coarse->get_size()[0];
+    const auto fine_row_ptrs = fine->get_const_row_ptrs();
+    const auto fine_col_idxs = fine->get_const_col_idxs();
+    const auto fine_vals = fine->get_const_values();
+    const auto agg_vals = agg.get_const_data();
+    auto coarse_row_ptrs = coarse->get_row_ptrs();
+    // group the fine rows by aggregate with a stable counting sort, such that
+    // every coarse entry sums its contributions in the fine storage order
+    array<IndexType> agg_ptrs_array(exec, num_agg + 1);
+    array<IndexType> agg_rows_array(exec, num_fine_rows);
+    auto agg_ptrs = agg_ptrs_array.get_data();
+    auto agg_rows = agg_rows_array.get_data();
+    std::fill_n(agg_ptrs, num_agg + 1, zero<IndexType>());
+    for (size_type row = 0; row < num_fine_rows; row++) {
+        agg_ptrs[agg_vals[row]]++;
+    }
+    components::prefix_sum(exec, agg_ptrs, num_agg + 1);
+    for (size_type row = 0; row < num_fine_rows; row++) {
+        agg_rows[agg_ptrs[agg_vals[row]]++] = row;
+    }
+    std::copy_backward(agg_ptrs, agg_ptrs + num_agg, agg_ptrs + num_agg + 1);
+    agg_ptrs[0] = 0;
+    // collects the coarse row of an aggregate into entries, sorted by column
+    // and with duplicate columns summed up
+    auto accumulate_row = [&](size_type coarse_row, vector<entry>& entries) {
+        entries.clear();
+        for (auto i = agg_ptrs[coarse_row]; i < agg_ptrs[coarse_row + 1];
+             i++) {
+            const auto fine_row = agg_rows[i];
+            for (auto nz = fine_row_ptrs[fine_row];
+                 nz < fine_row_ptrs[fine_row + 1]; nz++) {
+                entries.emplace_back(agg_vals[fine_col_idxs[nz]],
+                                     fine_vals[nz]);
+            }
+        }
+        std::stable_sort(
+            entries.begin(), entries.end(),
+            [](const entry& a, const entry& b) { return a.first < b.first; });
+        size_type out = 0;
+        for (size_type i = 0; i < entries.size(); i++) {
+            if (out > 0 && entries[out - 1].first == entries[i].first) {
+                entries[out - 1].second += entries[i].second;
+            } else {
+                entries[out++] = entries[i];
+            }
+        }
+        entries.resize(out);
+    };
+
+    // first sweep: count nnz for each coarse row
+#pragma omp parallel
+    {
+        vector<entry> entries(exec);
+#pragma omp for schedule(dynamic, 64)
+        for (size_type row = 0; row < num_agg; row++) {
+            accumulate_row(row, entries);
+            coarse_row_ptrs[row] = entries.size();
+        }
+    }
+
+    // build row pointers
+    components::prefix_sum(exec, coarse_row_ptrs, num_agg + 1);
+
+    // second sweep: write the accumulated coarse rows
+    const auto coarse_nnz = coarse_row_ptrs[num_agg];
+    matrix::CsrBuilder<ValueType, IndexType> builder{coarse};
+    auto& coarse_col_idxs_array = builder.get_col_idx_array();
+    auto& coarse_vals_array = builder.get_value_array();
+    coarse_col_idxs_array.resize_and_reset(coarse_nnz);
+    coarse_vals_array.resize_and_reset(coarse_nnz);
+    auto coarse_col_idxs = coarse_col_idxs_array.get_data();
+    auto coarse_vals = coarse_vals_array.get_data();
+#pragma omp parallel
+    {
+        vector<entry> entries(exec);
+#pragma omp for schedule(dynamic, 64)
+        for (size_type row = 0; row < num_agg; row++) {
+            accumulate_row(row, entries);
+            auto out = coarse_row_ptrs[row];
+            for (const auto& e : entries) {
+                coarse_col_idxs[out] = e.first;
+                coarse_vals[out] = e.second;
+                out++;
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_PGM_COMPUTE_COARSE_CSR);
+
+
 }  // namespace pgm
 }  // namespace omp
 }  // namespace kernels
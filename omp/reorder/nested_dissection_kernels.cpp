@@ -0,0 +1,92 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2022, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include "core/reorder/nested_dissection_kernels.hpp"
+
+
+#include <memory>
+
+
+#include <omp.h>
+
+
+#include <ginkgo/core/base/types.hpp>
+
+
+#include "core/reorder/graph_ordering.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace omp {
+/**
+ * @brief The nested dissection reordering namespace.
+ *
+ * @ingroup reorder
+ */
+namespace nested_dissection {
+
+
+template <typename IndexType>
+void get_permutation(std::shared_ptr<const OmpExecutor> exec,
+                     IndexType num_vertices, const IndexType* row_ptrs,
+                     const IndexType* col_idxs, IndexType leaf_size,
+                     IndexType* permutation, IndexType* inv_permutation)
+{
+    // the two parts of every dissection step are ordered in parallel tasks
+#pragma omp parallel
+#pragma omp single
+    gko::reorder::detail::nested_dissection_order(
+        exec, num_vertices, row_ptrs, col_idxs, leaf_size, permutation,
+        [](auto first, auto second) {
+#pragma omp task untied
+            first();
+            second();
+#pragma omp taskwait
+        });
+    if (inv_permutation) {
+#pragma omp parallel for
+        for (IndexType i = 0; i < num_vertices; i++) {
+            inv_permutation[permutation[i]] = i;
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(
+    GKO_DECLARE_NESTED_DISSECTION_GET_PERMUTATION_KERNEL);
+
+
+}  // namespace nested_dissection
+}  // namespace omp
+}  // namespace kernels
+}  // namespace gko
@@ -0,0 +1,100 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2022, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include "core/solver/batch_cg_kernels.hpp"
+
+
+#include <omp.h>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/math.hpp>
+
+
+#include "core/matrix/batch_struct.hpp"
+#include "core/solver/batch_cg_host_kernels.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace omp {
+/**
+ * @brief The batched CG solver namespace.
+ *
+ * @ingroup batch_cg
+ */
+namespace batch_cg {
+
+
+template <typename ValueType, typename BatchMatrixType>
+void apply(std::shared_ptr<const OmpExecutor> exec,
+           const BatchMatrixType* system_matrix,
+           const matrix::Dense<ValueType>* b, matrix::Dense<ValueType>* x,
+           size_type max_iterations, remove_complex<ValueType> tolerance,
+           stop::mode tolerance_type, array<int32>* num_iterations,
+           matrix::Dense<remove_complex<ValueType>>* residual_norms,
+           array<ValueType>& workspace)
+{
+    const auto num_rows = system_matrix->get_common_size()[0];
+    const auto num_rhs = b->get_size()[1];
+    const auto num_systems = system_matrix->get_num_batch_items() * num_rhs;
+    const auto workspace_size = host::batch_cg::workspace_size(num_rows);
+    // every thread gets its own slice of the workspace, which is only grown
+    // if the solver's workspace is too small
+    const auto total_workspace_size = workspace_size * omp_get_max_threads();
+    if (workspace.get_num_elems() < total_workspace_size) {
+        workspace.resize_and_reset(total_workspace_size);
+    }
+#pragma omp parallel
+    {
+        const auto local_workspace =
+            workspace.get_data() + omp_get_thread_num() * workspace_size;
+#pragma omp for schedule(dynamic)
+        for (size_type system = 0; system < num_systems; system++) {
+            const auto item = system / num_rhs;
+            const auto rhs = system % num_rhs;
+            num_iterations->get_data()[system] = host::batch_cg::solve(
+                host::extract_batch_item(system_matrix, item), b, x, item, rhs,
+                local_workspace, max_iterations, tolerance, tolerance_type,
+                residual_norms->at(item, rhs));
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_BATCH_MATRIX_TYPE(GKO_DECLARE_BATCH_CG_APPLY_KERNEL);
+
+
+}  // namespace batch_cg
+}  // namespace omp
+}  // namespace kernels
+}  // namespace gko
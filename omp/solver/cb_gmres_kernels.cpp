@@ -65,12 +65,19 @@ void finish_arnoldi_CGS(matrix::Dense<ValueType>* next_krylov_basis,
                         matrix::Dense<ValueType>* hessenberg_iter,
                         matrix::Dense<ValueType>* buffer_iter,
                         matrix::Dense<remove_complex<ValueType>>* arnoldi_norm,
-                        size_type iter, const stopping_status* stop_status)
+                        size_type iter, const stopping_status* stop_status,
+                        solver::gmres::ortho_method ortho)
 {
     using rc_vtype = remove_complex<ValueType>;
     constexpr bool has_scalar =
         gko::cb_gmres::detail::has_3d_scaled_accessor<Accessor3d>::value;
     const rc_vtype eta = 1.0 / sqrt(2.0);
+    // cgs2 always reorthogonalizes once, cgs_conditional up to two times if
+    // the norm dropped by more than eta
+    const bool always_reorth = ortho == solver::gmres::ortho_method::cgs2;
+    const size_type max_reorth = ortho == solver::gmres::ortho_method::cgs
+                                     ? 0
+                                     : (always_reorth ? 1 : 2);
 #pragma omp declare reduction(add:ValueType : omp_out = omp_out + omp_in)
 #pragma omp declare reduction(addnc:rc_vtype : omp_out = omp_out + omp_in)
 #pragma omp declare reduction(infnc:rc_vtype \
@@ -125,9 +132,11 @@ void finish_arnoldi_CGS(matrix::Dense<ValueType>* next_krylov_basis,
             arnoldi_norm->at(2, i) = inf;
         }
 
-        for (size_type l = 1;
-             (arnoldi_norm->at(1, i)) < (arnoldi_norm->at(0, i)) && l < 3;
-             l++) {
+        for (size_type l = 0; l < max_reorth; l++) {
+            if (!always_reorth &&
+                !(arnoldi_norm->at(1, i) < arnoldi_norm->at(0, i))) {
+                break;
+            }
             arnoldi_norm->at(0, i) = eta * arnoldi_norm->at(1, i);
             // nrmP = nrmN
 #pragma omp parallel for
@@ -148,11 +157,13 @@ void finish_arnoldi_CGS(matrix::Dense<ValueType>* next_krylov_basis,
                 for (size_type j = 0; j < next_krylov_basis->get_size()[0];
                      ++j) {
                     next_krylov_basis->at(j, i) -=
-                        buffer_iter->at(k, i) * conj(krylov_bases(k, j, i));
+                        buffer_iter->at(k, i) * krylov_bases(k, j, i);
                 }
+                hessenberg_iter->at(k, i) += buffer_iter->at(k, i);
             }
             // for i in 1:iter
-            //     next_krylov_basis  -= buffer(iter, i) * krylov_bases(:, i)
+            //     next_krylov_basis   -= buffer(iter, i) * krylov_bases(:, i)
+            //     hessenberg(iter, i) += buffer(iter, i)
             // end
             nrm = zero<rc_vtype>();
             inf = zero<rc_vtype>();
@@ -432,7 +443,7 @@ void arnoldi(std::shared_ptr<const OmpExecutor> exec,
              matrix::Dense<remove_complex<ValueType>>* arnoldi_norm,
              size_type iter, array<size_type>* final_iter_nums,
              const array<stopping_status>* stop_status, array<stopping_status>*,
-             array<size_type>*)
+             array<size_type>*, solver::gmres::ortho_method ortho)
 {
 #pragma omp parallel for
     for (size_type i = 0; i < final_iter_nums->get_num_elems(); ++i) {
@@ -442,7 +453,7 @@ void arnoldi(std::shared_ptr<const OmpExecutor> exec,
     }
     finish_arnoldi_CGS(next_krylov_basis, krylov_bases, hessenberg_iter,
                        buffer_iter, arnoldi_norm, iter,
-                       stop_status->get_const_data());
+                       stop_status->get_const_data(), ortho);
     givens_rotation(givens_sin, givens_cos, hessenberg_iter, iter,
                     stop_status->get_const_data());
     calculate_next_residual_norm(givens_sin, givens_cos, residual_norm,
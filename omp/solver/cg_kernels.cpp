@@ -0,0 +1,235 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2022, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#include "core/solver/cg_kernels.hpp"
+
+
+#include <algorithm>
+#include <array>
+#include <utility>
+
+
+#include <omp.h>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/memory.hpp>
+#include <ginkgo/core/base/types.hpp>
+
+
+namespace gko {
+namespace kernels {
+namespace omp {
+/**
+ * @brief The CG solver namespace.
+ *
+ * @ingroup cg
+ */
+namespace cg {
+
+
+// The remaining CG kernels are shared with the device executors in
+// common/unified/solver/cg_kernels.cpp. The kernels below fuse the vector
+// updates with the subsequent reductions, so each vector is streamed once.
+
+
+namespace {
+
+
+// the number of right-hand sides whose partial sums are kept in registers
+constexpr size_type local_cols = 4;
+
+
+/**
+ * Returns the per-thread storage for num_cols partial sums, with each thread's
+ * slot padded to a full cache line.
+ *
+ * @return the pointer to the storage and the stride between threads
+ */
+template <typename ValueType>
+std::pair<ValueType*, size_type> get_thread_partial_sums(size_type num_cols,
+                                                         array<char>& tmp)
+{
+    constexpr auto cache_line = AlignedCpuAllocator::cache_line_alignment;
+    const auto num_threads = static_cast<size_type>(omp_get_max_threads());
+    const auto slot_bytes =
+        static_cast<size_type>(
+            ceildiv(num_cols * sizeof(ValueType), cache_line)) *
+        cache_line;
+    const auto required_storage = slot_bytes * num_threads;
+    if (tmp.get_num_elems() < required_storage) {
+        tmp.resize_and_reset(required_storage);
+    }
+    // the team may be smaller than the maximum number of threads
+    const auto partial_sums = reinterpret_cast<ValueType*>(tmp.get_data());
+    const auto stride = slot_bytes / sizeof(ValueType);
+    std::fill_n(partial_sums, stride * num_threads, zero<ValueType>());
+    return {partial_sums, stride};
+}
+
+
+/**
+ * Adds up the partial sums of all threads for each right-hand side.
+ */
+template <typename ValueType, typename Callback>
+void reduce_thread_partial_sums(const ValueType* partial_sums, size_type stride,
+                                size_type num_cols, Callback finalize)
+{
+    const auto num_threads = static_cast<size_type>(omp_get_max_threads());
+    for (size_type j = 0; j < num_cols; ++j) {
+        auto sum = zero<ValueType>();
+        for (size_type thread = 0; thread < num_threads; ++thread) {
+            sum += partial_sums[thread * stride + j];
+        }
+        finalize(j, sum);
+    }
+}
+
+
+}  // namespace
+
+
+template <typename ValueType>
+void step_2_norm(std::shared_ptr<const DefaultExecutor> exec,
+                 matrix::Dense<ValueType>* x, matrix::Dense<ValueType>* r,
+                 const matrix::Dense<ValueType>* p,
+                 const matrix::Dense<ValueType>* q,
+                 const matrix::Dense<ValueType>* beta,
+                 const matrix::Dense<ValueType>* rho,
+                 matrix::Dense<ValueType>* next_rho,
+                 matrix::Dense<remove_complex<ValueType>>* residual_norm,
+                 const array<stopping_status>* stop_status,
+                 array<char>& tmp)
+{
+    const auto num_rows = x->get_size()[0];
+    const auto num_cols = x->get_size()[1];
+    const auto stop = stop_status->get_const_data();
+    const auto partial = get_thread_partial_sums<ValueType>(num_cols, tmp);
+    const auto partial_sums = partial.first;
+    const auto stride = partial.second;
+#pragma omp parallel
+    {
+        const auto thread_sums = partial_sums + omp_get_thread_num() * stride;
+        for (size_type base_col = 0; base_col < num_cols;
+             base_col += local_cols) {
+            const auto block_cols = std::min(local_cols, num_cols - base_col);
+            std::array<ValueType, local_cols> alpha{};
+            std::array<bool, local_cols> update{};
+            for (size_type j = 0; j < block_cols; ++j) {
+                const auto col = base_col + j;
+                update[j] =
+                    !stop[col].has_stopped() && is_nonzero(beta->at(col));
+                alpha[j] = update[j] ? rho->at(col) / beta->at(col)
+                                     : zero<ValueType>();
+            }
+            std::array<ValueType, local_cols> local_sums{};
+#pragma omp for
+            for (size_type i = 0; i < num_rows; ++i) {
+                for (size_type j = 0; j < block_cols; ++j) {
+                    const auto col = base_col + j;
+                    auto r_value = r->at(i, col);
+                    if (update[j]) {
+                        x->at(i, col) += alpha[j] * p->at(i, col);
+                        r_value -= alpha[j] * q->at(i, col);
+                        r->at(i, col) = r_value;
+                    }
+                    local_sums[j] += conj(r_value) * r_value;
+                }
+            }
+            std::copy_n(local_sums.begin(), block_cols, thread_sums + base_col);
+        }
+    }
+    reduce_thread_partial_sums(partial_sums, stride, num_cols,
+                               [&](size_type j, ValueType sum) {
+                                   next_rho->at(j) = sum;
+                                   residual_norm->at(j) = sqrt(abs(sum));
+                               });
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_CG_STEP_2_NORM_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void spmv_conj_dot(std::shared_ptr<const DefaultExecutor> exec,
+                   const matrix::Csr<ValueType, IndexType>* a,
+                   const matrix::Dense<ValueType>* p,
+                   matrix::Dense<ValueType>* q, matrix::Dense<ValueType>* beta,
+                   array<char>& tmp)
+{
+    const auto row_ptrs = a->get_const_row_ptrs();
+    const auto col_idxs = a->get_const_col_idxs();
+    const auto vals = a->get_const_values();
+    const auto num_rows = q->get_size()[0];
+    const auto num_cols = q->get_size()[1];
+    const auto partial = get_thread_partial_sums<ValueType>(num_cols, tmp);
+    const auto partial_sums = partial.first;
+    const auto stride = partial.second;
+#pragma omp parallel
+    {
+        const auto thread_sums = partial_sums + omp_get_thread_num() * stride;
+        for (size_type base_col = 0; base_col < num_cols;
+             base_col += local_cols) {
+            const auto block_cols = std::min(local_cols, num_cols - base_col);
+            std::array<ValueType, local_cols> local_sums{};
+#pragma omp for
+            for (size_type row = 0; row < num_rows; ++row) {
+                std::array<ValueType, local_cols> row_sums{};
+                for (auto k = row_ptrs[row]; k < row_ptrs[row + 1]; ++k) {
+                    const auto val = vals[k];
+                    const auto col = col_idxs[k];
+                    for (size_type j = 0; j < block_cols; ++j) {
+                        row_sums[j] += val * p->at(col, base_col + j);
+                    }
+                }
+                for (size_type j = 0; j < block_cols; ++j) {
+                    q->at(row, base_col + j) = row_sums[j];
+                    local_sums[j] +=
+                        conj(p->at(row, base_col + j)) * row_sums[j];
+                }
+            }
+            std::copy_n(local_sums.begin(), block_cols, thread_sums + base_col);
+        }
+    }
+    reduce_thread_partial_sums(
+        partial_sums, stride, num_cols,
+        [&](size_type j, ValueType sum) { beta->at(j) = sum; });
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_CG_SPMV_CONJ_DOT_KERNEL);
+
+
+}  // namespace cg
+}  // namespace omp
+}  // namespace kernels
+}  // namespace gko
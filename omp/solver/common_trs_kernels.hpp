@@ -0,0 +1,309 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2022, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#ifndef GKO_OMP_SOLVER_COMMON_TRS_KERNELS_HPP_
+#define GKO_OMP_SOLVER_COMMON_TRS_KERNELS_HPP_
+
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+
+
+#include <omp.h>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/solver/triangular.hpp>
+
+
+namespace gko {
+namespace solver {
+
+
+struct SolveStruct {
+    virtual ~SolveStruct() = default;
+};
+
+
+}  // namespace solver
+
+
+namespace kernels {
+namespace omp {
+namespace {
+
+
+/**
+ * Stores the level schedule of a triangular matrix: the rows are grouped into
+ * levels such that every row only depends on rows from previous levels.
+ * The rows of level `i` are `level_rows[level_ptrs[i]:level_ptrs[i + 1]]`.
+ */
+template <typename IndexType>
+struct OmpSolveStruct : gko::solver::SolveStruct {
+    array<IndexType> level_ptrs;
+    array<IndexType> level_rows;
+
+    OmpSolveStruct(std::shared_ptr<const OmpExecutor> exec, size_type num_rows)
+        : level_ptrs{exec}, level_rows{exec, num_rows}
+    {}
+
+    size_type get_num_levels() const
+    {
+        return level_ptrs.get_num_elems() - 1;
+    }
+};
+
+
+template <bool is_upper, typename IndexType>
+bool is_dependency(IndexType row, IndexType col)
+{
+    return is_upper ? col > row : col < row;
+}
+
+
+/**
+ * Computes row `row` of the right-hand sides [rhs_begin, rhs_end) of x, which
+ * requires all rows it depends on to be computed already.
+ */
+template <bool is_upper, typename ValueType, typename IndexType>
+void solve_row(const matrix::Csr<ValueType, IndexType>* matrix, bool unit_diag,
+               IndexType row, size_type rhs_begin, size_type rhs_end,
+               const matrix::Dense<ValueType>* b, matrix::Dense<ValueType>* x)
+{
+    const auto row_ptrs = matrix->get_const_row_ptrs();
+    const auto col_idxs = matrix->get_const_col_idxs();
+    const auto vals = matrix->get_const_values();
+    auto diag = one<ValueType>();
+    for (auto j = rhs_begin; j < rhs_end; ++j) {
+        x->at(row, j) = b->at(row, j);
+    }
+    for (auto k = row_ptrs[row]; k < row_ptrs[row + 1]; ++k) {
+        const auto col = col_idxs[k];
+        if (is_dependency<is_upper>(row, col)) {
+            for (auto j = rhs_begin; j < rhs_end; ++j) {
+                x->at(row, j) -= vals[k] * x->at(col, j);
+            }
+        }
+        if (col == row) {
+            diag = vals[k];
+        }
+    }
+    if (!unit_diag) {
+        for (auto j = rhs_begin; j < rhs_end; ++j) {
+            x->at(row, j) /= diag;
+        }
+    }
+}
+
+
+/**
+ * Builds the level schedule for trisolve_algorithm::sparselib, the syncfree
+ * algorithm resolves the dependencies on the fly and needs no analysis.
+ */
+template <bool is_upper, typename ValueType, typename IndexType>
+void generate_kernel(std::shared_ptr<const OmpExecutor> exec,
+                     const matrix::Csr<ValueType, IndexType>* matrix,
+                     std::shared_ptr<solver::SolveStruct>& solve_struct,
+                     const solver::trisolve_algorithm algorithm)
+{
+    if (algorithm != solver::trisolve_algorithm::sparselib) {
+        solve_struct.reset();
+        return;
+    }
+    const auto num_rows = static_cast<IndexType>(matrix->get_size()[0]);
+    const auto row_ptrs = matrix->get_const_row_ptrs();
+    const auto col_idxs = matrix->get_const_col_idxs();
+    array<IndexType> level_array{exec, static_cast<size_type>(num_rows)};
+    auto levels = level_array.get_data();
+    IndexType num_levels{};
+    for (IndexType i = 0; i < num_rows; ++i) {
+        const auto row = is_upper ? num_rows - 1 - i : i;
+        IndexType level{};
+        for (auto k = row_ptrs[row]; k < row_ptrs[row + 1]; ++k) {
+            const auto col = col_idxs[k];
+            if (is_dependency<is_upper>(row, col)) {
+                level = std::max(level, levels[col] + 1);
+            }
+        }
+        levels[row] = level;
+        num_levels = std::max(num_levels, level + 1);
+    }
+    auto result = std::make_shared<OmpSolveStruct<IndexType>>(
+        exec, static_cast<size_type>(num_rows));
+    result->level_ptrs.resize_and_reset(num_levels + 1);
+    auto level_ptrs = result->level_ptrs.get_data();
+    auto level_rows = result->level_rows.get_data();
+    // counting sort of the rows by level, keeping the order of elimination
+    std::fill_n(level_ptrs, num_levels + 1, zero<IndexType>());
+    for (IndexType row = 0; row < num_rows; ++row) {
+        level_ptrs[levels[row] + 1]++;
+    }
+    std::partial_sum(level_ptrs, level_ptrs + num_levels + 1, level_ptrs);
+    for (IndexType i = 0; i < num_rows; ++i) {
+        const auto row = is_upper ? num_rows - 1 - i : i;
+        level_rows[level_ptrs[levels[row]]++] = row;
+    }
+    // the scatter shifted each level pointer to the start of the next level
+    std::copy_backward(level_ptrs, level_ptrs + num_levels,
+                       level_ptrs + num_levels + 1);
+    level_ptrs[0] = 0;
+    solve_struct = std::move(result);
+}
+
+
+/**
+ * Solves the triangular system by sweeping over the rows in elimination order,
+ * with the right-hand sides distributed among the threads.
+ */
+template <bool is_upper, typename ValueType, typename IndexType>
+void solve_sequential(const matrix::Csr<ValueType, IndexType>* matrix,
+                      bool unit_diag, const matrix::Dense<ValueType>* b,
+                      matrix::Dense<ValueType>* x)
+{
+    const auto num_rows = static_cast<IndexType>(matrix->get_size()[0]);
+#pragma omp parallel for
+    for (size_type j = 0; j < b->get_size()[1]; ++j) {
+        for (IndexType i = 0; i < num_rows; ++i) {
+            const auto row = is_upper ? num_rows - 1 - i : i;
+            solve_row<is_upper>(matrix, unit_diag, row, j, j + 1, b, x);
+        }
+    }
+}
+
+
+/**
+ * Solves the triangular system level by level, with the rows of a level
+ * distributed among the threads. If an average level contains less rows than
+ * there are right-hand sides (or only a single row), the right-hand sides
+ * provide more parallelism, so they are distributed instead.
+ */
+template <bool is_upper, typename ValueType, typename IndexType>
+void solve_level_scheduled(const matrix::Csr<ValueType, IndexType>* matrix,
+                           const OmpSolveStruct<IndexType>* solve_struct,
+                           bool unit_diag, const matrix::Dense<ValueType>* b,
+                           matrix::Dense<ValueType>* x)
+{
+    const auto num_rows = matrix->get_size()[0];
+    const auto num_rhs = b->get_size()[1];
+    const auto num_levels = solve_struct->get_num_levels();
+    if (num_levels == 0 ||
+        num_rows / num_levels < std::max<size_type>(num_rhs, 2)) {
+        solve_sequential<is_upper>(matrix, unit_diag, b, x);
+        return;
+    }
+    const auto level_ptrs = solve_struct->level_ptrs.get_const_data();
+    const auto level_rows = solve_struct->level_rows.get_const_data();
+#pragma omp parallel
+    for (size_type level = 0; level < num_levels; ++level) {
+#pragma omp for
+        for (IndexType i = level_ptrs[level]; i < level_ptrs[level + 1]; ++i) {
+            solve_row<is_upper>(matrix, unit_diag, level_rows[i], 0, num_rhs,
+                                b, x);
+        }
+    }
+}
+
+
+/**
+ * Solves the triangular system with the rows distributed cyclically among the
+ * threads. Every thread processes its rows in elimination order and
+ * busy-waits for the completion flag of each dependency of a row, so the
+ * thread handling the first unfinished row can always make progress.
+ */
+template <bool is_upper, typename ValueType, typename IndexType>
+void solve_syncfree(std::shared_ptr<const OmpExecutor> exec,
+                    const matrix::Csr<ValueType, IndexType>* matrix,
+                    bool unit_diag, const matrix::Dense<ValueType>* b,
+                    matrix::Dense<ValueType>* x)
+{
+    const auto num_rows = static_cast<IndexType>(matrix->get_size()[0]);
+    const auto row_ptrs = matrix->get_const_row_ptrs();
+    const auto col_idxs = matrix->get_const_col_idxs();
+    array<int32> ready_array{exec, static_cast<size_type>(num_rows)};
+    auto ready = ready_array.get_data();
+    std::fill_n(ready, num_rows, int32{});
+#pragma omp parallel for schedule(static, 1)
+    for (IndexType i = 0; i < num_rows; ++i) {
+        const auto row = is_upper ? num_rows - 1 - i : i;
+        for (auto k = row_ptrs[row]; k < row_ptrs[row + 1]; ++k) {
+            const auto col = col_idxs[k];
+            if (is_dependency<is_upper>(row, col)) {
+                int32 is_ready{};
+                do {
+#pragma omp atomic read
+                    is_ready = ready[col];
+                } while (!is_ready);
+            }
+        }
+#pragma omp flush
+        solve_row<is_upper>(matrix, unit_diag, row, 0, b->get_size()[1], b,
+                            x);
+#pragma omp flush
+#pragma omp atomic write
+        ready[row] = 1;
+    }
+}
+
+
+template <bool is_upper, typename ValueType, typename IndexType>
+void solve_kernel(std::shared_ptr<const OmpExecutor> exec,
+                  const matrix::Csr<ValueType, IndexType>* matrix,
+                  const solver::SolveStruct* solve_struct, bool unit_diag,
+                  const solver::trisolve_algorithm algorithm,
+                  const matrix::Dense<ValueType>* b,
+                  matrix::Dense<ValueType>* x)
+{
+    if (algorithm == solver::trisolve_algorithm::syncfree) {
+        solve_syncfree<is_upper>(exec, matrix, unit_diag, b, x);
+    } else if (auto omp_struct =
+                   dynamic_cast<const OmpSolveStruct<IndexType>*>(
+                       solve_struct)) {
+        solve_level_scheduled<is_upper>(matrix, omp_struct, unit_diag, b, x);
+    } else {
+        solve_sequential<is_upper>(matrix, unit_diag, b, x);
+    }
+}
+
+
+}  // namespace
+}  // namespace omp
+}  // namespace kernels
+}  // namespace gko
+
+
+#endif  // GKO_OMP_SOLVER_COMMON_TRS_KERNELS_HPP_
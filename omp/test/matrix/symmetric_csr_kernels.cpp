@@ -0,0 +1,301 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2022, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include <ginkgo/core/matrix/symmetric_csr.hpp>
+
+
+#include <algorithm>
+#include <random>
+
+
+#include <gtest/gtest.h>
+#include <omp.h>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+
+#include "core/matrix/symmetric_csr_kernels.hpp"
+#include "core/test/utils.hpp"
+#include "core/test/utils/matrix_generator.hpp"
+
+
+namespace {
+
+
+class SymmetricCsr : public ::testing::Test {
+protected:
+    using value_type = double;
+    using index_type = int;
+    using Csr = gko::matrix::Csr<value_type, index_type>;
+    using Mtx = gko::matrix::SymmetricCsr<value_type, index_type>;
+    using Vec = gko::matrix::Dense<value_type>;
+
+    SymmetricCsr() : rand_engine(42) {}
+
+    void SetUp()
+    {
+        ref = gko::ReferenceExecutor::create();
+        omp = gko::OmpExecutor::create();
+    }
+
+    void TearDown()
+    {
+        if (omp != nullptr) {
+            ASSERT_NO_THROW(omp->synchronize());
+        }
+    }
+
+    template <typename MtxType>
+    std::unique_ptr<MtxType> gen_mtx(int num_rows, int num_cols,
+                                     int min_nnz_row, int max_nnz_row)
+    {
+        return gko::test::generate_random_matrix<MtxType>(
+            num_rows, num_cols,
+            std::uniform_int_distribution<>(min_nnz_row, max_nnz_row),
+            std::normal_distribution<>(-1.0, 1.0), rand_engine, ref);
+    }
+
+    void set_up_apply_data(int num_vectors = 1)
+    {
+        // the lower triangle of the random matrix is simply ignored
+        csr = gen_mtx<Csr>(num_rows, num_rows, 0, 50);
+        mtx = Mtx::create(ref);
+        csr->convert_to(mtx.get());
+        dmtx = gko::clone(omp, mtx);
+        expected = gen_mtx<Vec>(num_rows, num_vectors, num_vectors,
+                                num_vectors);
+        y = gen_mtx<Vec>(num_rows, num_vectors, num_vectors, num_vectors);
+        alpha = gko::initialize<Vec>({2.0}, ref);
+        beta = gko::initialize<Vec>({-1.0}, ref);
+        dresult = gko::clone(omp, expected);
+        dy = gko::clone(omp, y);
+        dalpha = gko::clone(omp, alpha);
+        dbeta = gko::clone(omp, beta);
+    }
+
+    std::shared_ptr<const gko::ReferenceExecutor> ref;
+    std::shared_ptr<const gko::OmpExecutor> omp;
+
+    const int num_rows = 1234;
+    std::default_random_engine rand_engine;
+
+    std::unique_ptr<Csr> csr;
+    std::unique_ptr<Mtx> mtx;
+    std::unique_ptr<Vec> expected;
+    std::unique_ptr<Vec> y;
+    std::unique_ptr<Vec> alpha;
+    std::unique_ptr<Vec> beta;
+
+    std::unique_ptr<Mtx> dmtx;
+    std::unique_ptr<Vec> dresult;
+    std::unique_ptr<Vec> dy;
+    std::unique_ptr<Vec> dalpha;
+    std::unique_ptr<Vec> dbeta;
+};
+
+
+TEST_F(SymmetricCsr, ConvertFromCsrIsEquivalentToRef)
+{
+    set_up_apply_data();
+    auto dcsr = gko::clone(omp, csr);
+    auto result = Mtx::create(omp);
+
+    dcsr->convert_to(result.get());
+
+    ASSERT_EQ(result->get_num_stored_elements(),
+              mtx->get_num_stored_elements());
+    GKO_ASSERT_ARRAY_EQ(
+        gko::array<index_type>::const_view(ref, num_rows + 1,
+                                           mtx->get_const_row_ptrs()),
+        gko::array<index_type>::const_view(omp, num_rows + 1,
+                                           result->get_const_row_ptrs()));
+    GKO_ASSERT_ARRAY_EQ(
+        gko::array<index_type>::const_view(ref, mtx->get_num_stored_elements(),
+                                           mtx->get_const_col_idxs()),
+        gko::array<index_type>::const_view(
+            omp, result->get_num_stored_elements(),
+            result->get_const_col_idxs()));
+    GKO_ASSERT_ARRAY_EQ(
+        gko::array<value_type>::const_view(ref, mtx->get_num_stored_elements(),
+                                           mtx->get_const_values()),
+        gko::array<value_type>::const_view(
+            omp, result->get_num_stored_elements(),
+            result->get_const_values()));
+}
+
+
+TEST_F(SymmetricCsr, ConvertToCsrIsEquivalentToRef)
+{
+    set_up_apply_data();
+    auto expected_csr = Csr::create(ref);
+    auto result = Csr::create(omp);
+
+    mtx->convert_to(expected_csr.get());
+    dmtx->convert_to(result.get());
+
+    GKO_ASSERT_MTX_NEAR(result, expected_csr, 0.0);
+    ASSERT_TRUE(result->is_sorted_by_column_index());
+}
+
+
+TEST_F(SymmetricCsr, SimpleApplyIsEquivalentToRef)
+{
+    set_up_apply_data();
+
+    mtx->apply(y.get(), expected.get());
+    dmtx->apply(dy.get(), dresult.get());
+
+    GKO_ASSERT_MTX_NEAR(dresult, expected, r<value_type>::value);
+}
+
+
+TEST_F(SymmetricCsr, AdvancedApplyIsEquivalentToRef)
+{
+    set_up_apply_data();
+
+    mtx->apply(alpha.get(), y.get(), beta.get(), expected.get());
+    dmtx->apply(dalpha.get(), dy.get(), dbeta.get(), dresult.get());
+
+    GKO_ASSERT_MTX_NEAR(dresult, expected, r<value_type>::value);
+}
+
+
+TEST_F(SymmetricCsr, SimpleApplyToDenseMatrixIsEquivalentToRef)
+{
+    set_up_apply_data(3);
+
+    mtx->apply(y.get(), expected.get());
+    dmtx->apply(dy.get(), dresult.get());
+
+    GKO_ASSERT_MTX_NEAR(dresult, expected, r<value_type>::value);
+}
+
+
+TEST_F(SymmetricCsr, AdvancedApplyToDenseMatrixIsEquivalentToRef)
+{
+    set_up_apply_data(3);
+
+    mtx->apply(alpha.get(), y.get(), beta.get(), expected.get());
+    dmtx->apply(dalpha.get(), dy.get(), dbeta.get(), dresult.get());
+
+    GKO_ASSERT_MTX_NEAR(dresult, expected, r<value_type>::value);
+}
+
+
+TEST_F(SymmetricCsr, ApplyToManyVectorsIsEquivalentToRef)
+{
+    set_up_apply_data(33);
+
+    mtx->apply(alpha.get(), y.get(), beta.get(), expected.get());
+    dmtx->apply(dalpha.get(), dy.get(), dbeta.get(), dresult.get());
+
+    GKO_ASSERT_MTX_NEAR(dresult, expected, r<value_type>::value);
+}
+
+
+TEST_F(SymmetricCsr, ApplyWithDifferentThreadCountsIsEquivalentToRef)
+{
+    set_up_apply_data(3);
+    auto simple_expected = expected->clone();
+    mtx->apply(y.get(), simple_expected.get());
+    mtx->apply(alpha.get(), y.get(), beta.get(), expected.get());
+    const auto max_threads = omp_get_max_threads();
+
+    // the workspace of dmtx is reused and resized between the applications
+    for (int num_threads : {1, 2, 3, 7, 16, 4}) {
+        SCOPED_TRACE(num_threads);
+        omp_set_num_threads(num_threads);
+        auto simple_result = gko::clone(omp, dresult);
+        auto result = gko::clone(omp, dresult);
+
+        dmtx->apply(dy.get(), simple_result.get());
+        dmtx->apply(dalpha.get(), dy.get(), dbeta.get(), result.get());
+
+        GKO_ASSERT_MTX_NEAR(simple_result, simple_expected,
+                            r<value_type>::value);
+        GKO_ASSERT_MTX_NEAR(result, expected, r<value_type>::value);
+    }
+    omp_set_num_threads(max_threads);
+}
+
+
+TEST_F(SymmetricCsr, ApplyWithUnsortedColumnsIsEquivalentToRef)
+{
+    set_up_apply_data(3);
+    mtx->apply(y.get(), expected.get());
+    const auto row_ptrs = mtx->get_const_row_ptrs();
+    for (int row = 0; row < num_rows; ++row) {
+        std::reverse(mtx->get_col_idxs() + row_ptrs[row],
+                     mtx->get_col_idxs() + row_ptrs[row + 1]);
+        std::reverse(mtx->get_values() + row_ptrs[row],
+                     mtx->get_values() + row_ptrs[row + 1]);
+    }
+    dmtx = gko::clone(omp, mtx);
+
+    dmtx->apply(dy.get(), dresult.get());
+
+    GKO_ASSERT_MTX_NEAR(dresult, expected, r<value_type>::value);
+}
+
+
+TEST_F(SymmetricCsr, ApplyMatchesCsrOnSymmetricBandedMatrix)
+{
+    gko::matrix_data<value_type, index_type> data{gko::dim<2>(1000, 1000)};
+    for (int row = 0; row < 1000; ++row) {
+        for (int col = std::max(row - 3, 0); col < std::min(row + 4, 1000);
+             ++col) {
+            data.nonzeros.emplace_back(row, col,
+                                       std::min(row, col) + 0.5 * (row + col));
+        }
+    }
+    auto band_csr = Csr::create(omp);
+    band_csr->read(data);
+    auto band_mtx = Mtx::create(omp);
+    band_csr->convert_to(band_mtx.get());
+    auto b = gen_mtx<Vec>(1000, 1, 1, 1);
+    auto db = gko::clone(omp, b);
+    auto x = Vec::create(omp, gko::dim<2>{1000, 1});
+    auto expected_x = Vec::create(omp, gko::dim<2>{1000, 1});
+
+    band_mtx->apply(db.get(), x.get());
+    band_csr->apply(db.get(), expected_x.get());
+
+    ASSERT_EQ(band_mtx->get_num_stored_elements(), 4 * 1000 - 6);
+    GKO_ASSERT_MTX_NEAR(x, expected_x, r<value_type>::value);
+}
+
+
+}  // namespace
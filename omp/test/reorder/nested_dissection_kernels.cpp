@@ -0,0 +1,103 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2022, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include <ginkgo/core/reorder/nested_dissection.hpp>
+
+
+#include <fstream>
+#include <memory>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/permutation.hpp>
+
+
+#include "core/test/utils.hpp"
+#include "core/test/utils/assertions.hpp"
+#include "matrices/config.hpp"
+
+
+namespace {
+
+
+class NestedDissection : public ::testing::Test {
+protected:
+    using v_type = double;
+    using i_type = int;
+    using CsrMtx = gko::matrix::Csr<v_type, i_type>;
+    using reorder_type = gko::reorder::NestedDissection<v_type, i_type>;
+
+    NestedDissection()
+        : ref(gko::ReferenceExecutor::create()),
+          omp(gko::OmpExecutor::create()),
+          o_1138_bus_mtx(gko::read<CsrMtx>(
+              std::ifstream(gko::matrices::location_1138_bus_mtx, std::ios::in),
+              ref)),
+          d_1138_bus_mtx(gko::read<CsrMtx>(
+              std::ifstream(gko::matrices::location_1138_bus_mtx, std::ios::in),
+              omp))
+    {}
+
+    std::shared_ptr<gko::ReferenceExecutor> ref;
+    std::shared_ptr<gko::OmpExecutor> omp;
+    std::shared_ptr<CsrMtx> o_1138_bus_mtx;
+    std::shared_ptr<CsrMtx> d_1138_bus_mtx;
+};
+
+
+TEST_F(NestedDissection, OmpPermutationIsEquivalentToRef)
+{
+    auto factory = reorder_type::build()
+                       .with_construct_inverse_permutation(true)
+                       .with_leaf_size(16u);
+
+    auto o_nd = factory.on(ref)->generate(o_1138_bus_mtx);
+    auto d_nd = factory.on(omp)->generate(d_1138_bus_mtx);
+
+    GKO_ASSERT_ARRAY_EQ(d_nd->get_permutation_array(),
+                        o_nd->get_permutation_array());
+    auto o_inv = o_nd->get_inverse_permutation();
+    auto d_inv = d_nd->get_inverse_permutation();
+    GKO_ASSERT_ARRAY_EQ(
+        gko::make_const_array_view(omp, d_inv->get_size()[0],
+                                   d_inv->get_const_permutation()),
+        gko::make_const_array_view(ref, o_inv->get_size()[0],
+                                   o_inv->get_const_permutation()));
+}
+
+
+}  // namespace
@@ -0,0 +1,132 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2022, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include "core/matrix/batch_ell_kernels.hpp"
+
+
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+
+namespace gko {
+namespace kernels {
+namespace reference {
+/**
+ * @brief The BatchEll matrix format namespace.
+ * @ref BatchEll
+ * @ingroup batch_ell
+ */
+namespace batch_ell {
+
+
+template <typename ValueType>
+void spmv(std::shared_ptr<const ReferenceExecutor> exec,
+          const matrix::BatchEll<ValueType, int32>* a,
+          const matrix::Dense<ValueType>* b, matrix::Dense<ValueType>* c)
+{
+    const auto col_idxs = a->get_const_col_idxs();
+    const auto num_rows = a->get_common_size()[0];
+    const auto num_cols = a->get_common_size()[1];
+    const auto num_stored_elements_per_row =
+        a->get_num_stored_elements_per_row();
+
+    for (size_type item = 0; item < a->get_num_batch_items(); ++item) {
+        const auto vals = a->get_const_values_for_item(item);
+        for (size_type row = 0; row < num_rows; ++row) {
+            const auto out_row = item * num_rows + row;
+            for (size_type j = 0; j < c->get_size()[1]; ++j) {
+                c->at(out_row, j) = zero<ValueType>();
+            }
+            for (size_type i = 0; i < num_stored_elements_per_row; ++i) {
+                const auto col = col_idxs[row + i * num_rows];
+                if (col == invalid_index<int32>()) {
+                    continue;
+                }
+                const auto val = vals[row + i * num_rows];
+                const auto in_row = item * num_cols + col;
+                for (size_type j = 0; j < c->get_size()[1]; ++j) {
+                    c->at(out_row, j) += val * b->at(in_row, j);
+                }
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_BATCH_ELL_SPMV_KERNEL);
+
+
+template <typename ValueType>
+void advanced_spmv(std::shared_ptr<const ReferenceExecutor> exec,
+                   const matrix::Dense<ValueType>* alpha,
+                   const matrix::BatchEll<ValueType, int32>* a,
+                   const matrix::Dense<ValueType>* b,
+                   const matrix::Dense<ValueType>* beta,
+                   matrix::Dense<ValueType>* c)
+{
+    const auto col_idxs = a->get_const_col_idxs();
+    const auto num_rows = a->get_common_size()[0];
+    const auto num_cols = a->get_common_size()[1];
+    const auto num_stored_elements_per_row =
+        a->get_num_stored_elements_per_row();
+    const auto valpha = alpha->at(0, 0);
+    const auto vbeta = beta->at(0, 0);
+
+    for (size_type item = 0; item < a->get_num_batch_items(); ++item) {
+        const auto vals = a->get_const_values_for_item(item);
+        for (size_type row = 0; row < num_rows; ++row) {
+            const auto out_row = item * num_rows + row;
+            for (size_type j = 0; j < c->get_size()[1]; ++j) {
+                c->at(out_row, j) *= vbeta;
+            }
+            for (size_type i = 0; i < num_stored_elements_per_row; ++i) {
+                const auto col = col_idxs[row + i * num_rows];
+                if (col == invalid_index<int32>()) {
+                    continue;
+                }
+                const auto val = vals[row + i * num_rows];
+                const auto in_row = item * num_cols + col;
+                for (size_type j = 0; j < c->get_size()[1]; ++j) {
+                    c->at(out_row, j) += valpha * val * b->at(in_row, j);
+                }
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_BATCH_ELL_ADVANCED_SPMV_KERNEL);
+
+
+}  // namespace batch_ell
+}  // namespace reference
+}  // namespace kernels
+}  // namespace gko
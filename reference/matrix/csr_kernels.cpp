@@ -131,6 +131,68 @@ GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
     GKO_DECLARE_CSR_ADVANCED_SPMV_KERNEL);
 
 
+template <typename ValueType, typename IndexType>
+void mixed_spmv(std::shared_ptr<const ReferenceExecutor> exec,
+                const matrix::Csr<ValueType, IndexType>* a,
+                const matrix::Dense<next_precision<ValueType>>* b,
+                matrix::Dense<next_precision<ValueType>>* c)
+{
+    using vector_type = next_precision<ValueType>;
+    using arithmetic_type = highest_precision<ValueType, vector_type>;
+    auto row_ptrs = a->get_const_row_ptrs();
+    auto col_idxs = a->get_const_col_idxs();
+    auto vals = a->get_const_values();
+
+    for (size_type row = 0; row < a->get_size()[0]; ++row) {
+        for (size_type j = 0; j < c->get_size()[1]; ++j) {
+            arithmetic_type result{};
+            for (auto k = row_ptrs[row]; k < row_ptrs[row + 1]; ++k) {
+                result += static_cast<arithmetic_type>(vals[k]) *
+                          static_cast<arithmetic_type>(b->at(col_idxs[k], j));
+            }
+            c->at(row, j) = static_cast<vector_type>(result);
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_CSR_MIXED_SPMV_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void advanced_mixed_spmv(std::shared_ptr<const ReferenceExecutor> exec,
+                         const matrix::Dense<next_precision<ValueType>>* alpha,
+                         const matrix::Csr<ValueType, IndexType>* a,
+                         const matrix::Dense<next_precision<ValueType>>* b,
+                         const matrix::Dense<next_precision<ValueType>>* beta,
+                         matrix::Dense<next_precision<ValueType>>* c)
+{
+    using vector_type = next_precision<ValueType>;
+    using arithmetic_type = highest_precision<ValueType, vector_type>;
+    auto row_ptrs = a->get_const_row_ptrs();
+    auto col_idxs = a->get_const_col_idxs();
+    auto vals = a->get_const_values();
+    const auto valpha = static_cast<arithmetic_type>(alpha->at(0, 0));
+    const auto vbeta = static_cast<arithmetic_type>(beta->at(0, 0));
+
+    for (size_type row = 0; row < a->get_size()[0]; ++row) {
+        for (size_type j = 0; j < c->get_size()[1]; ++j) {
+            arithmetic_type result{};
+            for (auto k = row_ptrs[row]; k < row_ptrs[row + 1]; ++k) {
+                result += static_cast<arithmetic_type>(vals[k]) *
+                          static_cast<arithmetic_type>(b->at(col_idxs[k], j));
+            }
+            c->at(row, j) = static_cast<vector_type>(
+                valpha * result +
+                vbeta * static_cast<arithmetic_type>(c->at(row, j)));
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_CSR_ADVANCED_MIXED_SPMV_KERNEL);
+
+
 template <typename ValueType, typename IndexType>
 void spgemm_insert_row(unordered_set<IndexType>& cols,
                        const matrix::Csr<ValueType, IndexType>* c,
@@ -310,6 +372,69 @@ GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
     GKO_DECLARE_CSR_ADVANCED_SPGEMM_KERNEL);
 
 
+template <typename ValueType, typename IndexType>
+void spgemm_numeric(std::shared_ptr<const ReferenceExecutor> exec,
+                    const matrix::Csr<ValueType, IndexType>* a,
+                    const matrix::Csr<ValueType, IndexType>* b,
+                    matrix::Csr<ValueType, IndexType>* c)
+{
+    auto num_rows = c->get_size()[0];
+    auto c_row_ptrs = c->get_const_row_ptrs();
+    auto c_col_idxs = c->get_const_col_idxs();
+    auto c_vals = c->get_values();
+
+    map<IndexType, ValueType> local_row_nzs(exec);
+    for (size_type row = 0; row < num_rows; ++row) {
+        local_row_nzs.clear();
+        spgemm_accumulate_row2(local_row_nzs, a, b, one<ValueType>(), row);
+        // store only the entries contained in the output pattern
+        for (auto c_nz = c_row_ptrs[row]; c_nz < c_row_ptrs[row + 1]; ++c_nz) {
+            auto it = local_row_nzs.find(c_col_idxs[c_nz]);
+            c_vals[c_nz] =
+                it != local_row_nzs.end() ? it->second : zero<ValueType>();
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_CSR_SPGEMM_NUMERIC_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void spgemm_symbolic(std::shared_ptr<const ReferenceExecutor> exec,
+                     const matrix::Csr<ValueType, IndexType>* a,
+                     const matrix::Csr<ValueType, IndexType>* b,
+                     IndexType* c_row_ptrs, array<IndexType>& c_col_idxs_array)
+{
+    auto num_rows = a->get_size()[0];
+
+    // first sweep: count nnz for each row
+    unordered_set<IndexType> local_col_idxs(exec);
+    for (size_type a_row = 0; a_row < num_rows; ++a_row) {
+        local_col_idxs.clear();
+        spgemm_insert_row2(local_col_idxs, a, b, a_row);
+        c_row_ptrs[a_row] = static_cast<IndexType>(local_col_idxs.size());
+    }
+
+    // build row pointers
+    components::prefix_sum(exec, c_row_ptrs, num_rows + 1);
+
+    // second sweep: store the sorted column indices
+    c_col_idxs_array.resize_and_reset(c_row_ptrs[num_rows]);
+    auto c_col_idxs = c_col_idxs_array.get_data();
+    for (size_type a_row = 0; a_row < num_rows; ++a_row) {
+        local_col_idxs.clear();
+        spgemm_insert_row2(local_col_idxs, a, b, a_row);
+        const auto row_begin = c_col_idxs + c_row_ptrs[a_row];
+        std::copy(local_col_idxs.begin(), local_col_idxs.end(), row_begin);
+        std::sort(row_begin, c_col_idxs + c_row_ptrs[a_row + 1]);
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_CSR_SPGEMM_SYMBOLIC_KERNEL);
+
+
 template <typename ValueType, typename IndexType>
 void spgeam(std::shared_ptr<const ReferenceExecutor> exec,
             const matrix::Dense<ValueType>* alpha,
@@ -0,0 +1,219 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2022, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#include "core/matrix/delta_csr_kernels.hpp"
+
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+
+namespace gko {
+namespace kernels {
+namespace reference {
+/**
+ * @brief The delta-encoded compressed sparse row matrix format namespace.
+ * @ref DeltaCsr
+ * @ingroup delta_csr
+ */
+namespace delta_csr {
+
+
+template <typename ValueType, typename IndexType>
+void spmv(std::shared_ptr<const ReferenceExecutor> exec,
+          const matrix::DeltaCsr<ValueType, IndexType>* a,
+          const matrix::Dense<ValueType>* b, matrix::Dense<ValueType>* c)
+{
+    using matrix_type = matrix::DeltaCsr<ValueType, IndexType>;
+    const auto row_ptrs = a->get_const_row_ptrs();
+    const auto vals = a->get_const_values();
+    const auto col_deltas = a->get_const_col_deltas();
+    const auto col_bases = a->get_const_col_bases();
+    const auto escape_ptrs = a->get_const_escape_ptrs();
+    const auto escape_col_idxs = a->get_const_escape_col_idxs();
+
+    for (size_type row = 0; row < a->get_size()[0]; ++row) {
+        for (size_type j = 0; j < c->get_size()[1]; ++j) {
+            c->at(row, j) = zero<ValueType>();
+        }
+        auto col = col_bases[row];
+        auto escape = escape_ptrs[row];
+        for (auto k = row_ptrs[row]; k < row_ptrs[row + 1]; ++k) {
+            const auto delta = col_deltas[k];
+            col = delta == matrix_type::escape_delta ? escape_col_idxs[escape++]
+                                                     : col + delta;
+            const auto val = vals[k];
+            for (size_type j = 0; j < c->get_size()[1]; ++j) {
+                c->at(row, j) += val * b->at(col, j);
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_DELTA_CSR_SPMV_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void advanced_spmv(std::shared_ptr<const ReferenceExecutor> exec,
+                   const matrix::Dense<ValueType>* alpha,
+                   const matrix::DeltaCsr<ValueType, IndexType>* a,
+                   const matrix::Dense<ValueType>* b,
+                   const matrix::Dense<ValueType>* beta,
+                   matrix::Dense<ValueType>* c)
+{
+    using matrix_type = matrix::DeltaCsr<ValueType, IndexType>;
+    const auto row_ptrs = a->get_const_row_ptrs();
+    const auto vals = a->get_const_values();
+    const auto col_deltas = a->get_const_col_deltas();
+    const auto col_bases = a->get_const_col_bases();
+    const auto escape_ptrs = a->get_const_escape_ptrs();
+    const auto escape_col_idxs = a->get_const_escape_col_idxs();
+    const auto valpha = alpha->at(0, 0);
+    const auto vbeta = beta->at(0, 0);
+
+    for (size_type row = 0; row < a->get_size()[0]; ++row) {
+        for (size_type j = 0; j < c->get_size()[1]; ++j) {
+            c->at(row, j) *= vbeta;
+        }
+        auto col = col_bases[row];
+        auto escape = escape_ptrs[row];
+        for (auto k = row_ptrs[row]; k < row_ptrs[row + 1]; ++k) {
+            const auto delta = col_deltas[k];
+            col = delta == matrix_type::escape_delta ? escape_col_idxs[escape++]
+                                                     : col + delta;
+            const auto val = valpha * vals[k];
+            for (size_type j = 0; j < c->get_size()[1]; ++j) {
+                c->at(row, j) += val * b->at(col, j);
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_DELTA_CSR_ADVANCED_SPMV_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void count_escapes(std::shared_ptr<const ReferenceExecutor> exec,
+                   const matrix::Csr<ValueType, IndexType>* source,
+                   IndexType* escape_counts)
+{
+    using matrix_type = matrix::DeltaCsr<ValueType, IndexType>;
+    const auto row_ptrs = source->get_const_row_ptrs();
+    const auto col_idxs = source->get_const_col_idxs();
+    for (size_type row = 0; row < source->get_size()[0]; ++row) {
+        IndexType count{};
+        for (auto k = row_ptrs[row] + 1; k < row_ptrs[row + 1]; ++k) {
+            if (col_idxs[k] - col_idxs[k - 1] >= matrix_type::escape_delta) {
+                count++;
+            }
+        }
+        escape_counts[row] = count;
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_DELTA_CSR_COUNT_ESCAPES_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void convert_from_csr(std::shared_ptr<const ReferenceExecutor> exec,
+                      const matrix::Csr<ValueType, IndexType>* source,
+                      matrix::DeltaCsr<ValueType, IndexType>* result)
+{
+    using matrix_type = matrix::DeltaCsr<ValueType, IndexType>;
+    using delta_type = typename matrix_type::delta_type;
+    const auto row_ptrs = source->get_const_row_ptrs();
+    const auto col_idxs = source->get_const_col_idxs();
+    auto col_deltas = result->get_col_deltas();
+    auto col_bases = result->get_col_bases();
+    const auto escape_ptrs = result->get_const_escape_ptrs();
+    auto escape_col_idxs = result->get_escape_col_idxs();
+    for (size_type row = 0; row < source->get_size()[0]; ++row) {
+        const auto begin = row_ptrs[row];
+        const auto end = row_ptrs[row + 1];
+        auto prev_col = begin < end ? col_idxs[begin] : zero<IndexType>();
+        auto escape = escape_ptrs[row];
+        col_bases[row] = prev_col;
+        for (auto k = begin; k < end; ++k) {
+            const auto col = col_idxs[k];
+            const auto delta = col - prev_col;
+            if (delta >= matrix_type::escape_delta) {
+                col_deltas[k] = matrix_type::escape_delta;
+                escape_col_idxs[escape++] = col;
+            } else {
+                col_deltas[k] = static_cast<delta_type>(delta);
+            }
+            prev_col = col;
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_DELTA_CSR_CONVERT_FROM_CSR_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void convert_to_csr(std::shared_ptr<const ReferenceExecutor> exec,
+                    const matrix::DeltaCsr<ValueType, IndexType>* source,
+                    matrix::Csr<ValueType, IndexType>* result)
+{
+    using matrix_type = matrix::DeltaCsr<ValueType, IndexType>;
+    const auto row_ptrs = source->get_const_row_ptrs();
+    const auto col_deltas = source->get_const_col_deltas();
+    const auto col_bases = source->get_const_col_bases();
+    const auto escape_ptrs = source->get_const_escape_ptrs();
+    const auto escape_col_idxs = source->get_const_escape_col_idxs();
+    auto col_idxs = result->get_col_idxs();
+    for (size_type row = 0; row < source->get_size()[0]; ++row) {
+        auto col = col_bases[row];
+        auto escape = escape_ptrs[row];
+        for (auto k = row_ptrs[row]; k < row_ptrs[row + 1]; ++k) {
+            const auto delta = col_deltas[k];
+            col = delta == matrix_type::escape_delta ? escape_col_idxs[escape++]
+                                                     : col + delta;
+            col_idxs[k] = col;
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_DELTA_CSR_CONVERT_TO_CSR_KERNEL);
+
+
+}  // namespace delta_csr
+}  // namespace reference
+}  // namespace kernels
+}  // namespace gko
@@ -477,7 +477,7 @@ void sort_by_column_index(const std::shared_ptr<const ReferenceExecutor> exec,
 {
     const int bs = to_sort->get_block_size();
     select_sort_col_idx(
-        fixedblock::compiled_kernels(),
+        fixedblock::host_kernels(),
         [bs](int compiled_block_size) { return bs == compiled_block_size; },
         syn::value_list<int>(), syn::type_list<>(), to_sort);
 }
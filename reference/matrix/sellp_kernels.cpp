@@ -63,21 +63,24 @@ void spmv(std::shared_ptr<const ReferenceExecutor> exec,
     auto slice_sets = a->get_const_slice_sets();
     auto slice_size = a->get_slice_size();
     auto slice_num = ceildiv(a->get_size()[0] + slice_size - 1, slice_size);
+    const auto perm = a->get_const_permutation();
     for (size_type slice = 0; slice < slice_num; slice++) {
         for (size_type row = 0; row < slice_size; row++) {
             size_type global_row = slice * slice_size + row;
             if (global_row >= a->get_size()[0]) {
                 break;
             }
+            const auto out_row =
+                perm ? static_cast<size_type>(perm[global_row]) : global_row;
             for (size_type j = 0; j < c->get_size()[1]; j++) {
-                c->at(global_row, j) = zero<ValueType>();
+                c->at(out_row, j) = zero<ValueType>();
             }
             for (size_type i = 0; i < slice_lengths[slice]; i++) {
                 auto val = a->val_at(row, slice_sets[slice], i);
                 auto col = a->col_at(row, slice_sets[slice], i);
                 if (col != invalid_index<IndexType>()) {
                     for (size_type j = 0; j < c->get_size()[1]; j++) {
-                        c->at(global_row, j) += val * b->at(col, j);
+                        c->at(out_row, j) += val * b->at(col, j);
                     }
                 }
             }
@@ -104,21 +107,24 @@ void advanced_spmv(std::shared_ptr<const ReferenceExecutor> exec,
     auto slice_num = ceildiv(a->get_size()[0] + slice_size - 1, slice_size);
     auto valpha = alpha->at(0, 0);
     auto vbeta = beta->at(0, 0);
+    const auto perm = a->get_const_permutation();
     for (size_type slice = 0; slice < slice_num; slice++) {
         for (size_type row = 0; row < slice_size; row++) {
             size_type global_row = slice * slice_size + row;
             if (global_row >= a->get_size()[0]) {
                 break;
             }
+            const auto out_row =
+                perm ? static_cast<size_type>(perm[global_row]) : global_row;
             for (size_type j = 0; j < c->get_size()[1]; j++) {
-                c->at(global_row, j) *= vbeta;
+                c->at(out_row, j) *= vbeta;
             }
             for (size_type i = 0; i < slice_lengths[slice]; i++) {
                 auto val = a->val_at(row, slice_sets[slice], i);
                 auto col = a->col_at(row, slice_sets[slice], i);
                 if (col != invalid_index<IndexType>()) {
                     for (size_type j = 0; j < c->get_size()[1]; j++) {
-                        c->at(global_row, j) += valpha * val * b->at(col, j);
+                        c->at(out_row, j) += valpha * val * b->at(col, j);
                     }
                 }
             }
@@ -130,6 +136,94 @@ GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
     GKO_DECLARE_SELLP_ADVANCED_SPMV_KERNEL);
 
 
+template <typename ValueType, typename IndexType>
+void mixed_spmv(std::shared_ptr<const ReferenceExecutor> exec,
+                const matrix::Sellp<ValueType, IndexType>* a,
+                const matrix::Dense<next_precision<ValueType>>* b,
+                matrix::Dense<next_precision<ValueType>>* c)
+{
+    using vector_type = next_precision<ValueType>;
+    using arithmetic_type = highest_precision<ValueType, vector_type>;
+    auto slice_lengths = a->get_const_slice_lengths();
+    auto slice_sets = a->get_const_slice_sets();
+    auto slice_size = a->get_slice_size();
+    auto slice_num = ceildiv(a->get_size()[0] + slice_size - 1, slice_size);
+    const auto perm = a->get_const_permutation();
+    for (size_type slice = 0; slice < slice_num; slice++) {
+        for (size_type row = 0; row < slice_size; row++) {
+            size_type global_row = slice * slice_size + row;
+            if (global_row >= a->get_size()[0]) {
+                break;
+            }
+            const auto out_row =
+                perm ? static_cast<size_type>(perm[global_row]) : global_row;
+            for (size_type j = 0; j < c->get_size()[1]; j++) {
+                arithmetic_type result{};
+                for (size_type i = 0; i < slice_lengths[slice]; i++) {
+                    auto val = a->val_at(row, slice_sets[slice], i);
+                    auto col = a->col_at(row, slice_sets[slice], i);
+                    if (col != invalid_index<IndexType>()) {
+                        result += static_cast<arithmetic_type>(val) *
+                                  static_cast<arithmetic_type>(b->at(col, j));
+                    }
+                }
+                c->at(out_row, j) = static_cast<vector_type>(result);
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SELLP_MIXED_SPMV_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void advanced_mixed_spmv(std::shared_ptr<const ReferenceExecutor> exec,
+                         const matrix::Dense<next_precision<ValueType>>* alpha,
+                         const matrix::Sellp<ValueType, IndexType>* a,
+                         const matrix::Dense<next_precision<ValueType>>* b,
+                         const matrix::Dense<next_precision<ValueType>>* beta,
+                         matrix::Dense<next_precision<ValueType>>* c)
+{
+    using vector_type = next_precision<ValueType>;
+    using arithmetic_type = highest_precision<ValueType, vector_type>;
+    auto slice_lengths = a->get_const_slice_lengths();
+    auto slice_sets = a->get_const_slice_sets();
+    auto slice_size = a->get_slice_size();
+    auto slice_num = ceildiv(a->get_size()[0] + slice_size - 1, slice_size);
+    const auto valpha = static_cast<arithmetic_type>(alpha->at(0, 0));
+    const auto vbeta = static_cast<arithmetic_type>(beta->at(0, 0));
+    const auto perm = a->get_const_permutation();
+    for (size_type slice = 0; slice < slice_num; slice++) {
+        for (size_type row = 0; row < slice_size; row++) {
+            size_type global_row = slice * slice_size + row;
+            if (global_row >= a->get_size()[0]) {
+                break;
+            }
+            const auto out_row =
+                perm ? static_cast<size_type>(perm[global_row]) : global_row;
+            for (size_type j = 0; j < c->get_size()[1]; j++) {
+                arithmetic_type result{};
+                for (size_type i = 0; i < slice_lengths[slice]; i++) {
+                    auto val = a->val_at(row, slice_sets[slice], i);
+                    auto col = a->col_at(row, slice_sets[slice], i);
+                    if (col != invalid_index<IndexType>()) {
+                        result += static_cast<arithmetic_type>(val) *
+                                  static_cast<arithmetic_type>(b->at(col, j));
+                    }
+                }
+                c->at(out_row, j) = static_cast<vector_type>(
+                    valpha * result +
+                    vbeta * static_cast<arithmetic_type>(c->at(out_row, j)));
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SELLP_ADVANCED_MIXED_SPMV_KERNEL);
+
+
 template <typename IndexType>
 void compute_slice_sets(std::shared_ptr<const DefaultExecutor> exec,
                         const array<IndexType>& row_ptrs, size_type slice_size,
@@ -0,0 +1,245 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2022, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include "core/matrix/symmetric_csr_kernels.hpp"
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+
+namespace gko {
+namespace kernels {
+namespace reference {
+/**
+ * @brief The symmetric compressed sparse row matrix format namespace.
+ * @ref SymmetricCsr
+ * @ingroup symmetric_csr
+ */
+namespace symmetric_csr {
+
+
+template <typename ValueType, typename IndexType>
+void spmv(std::shared_ptr<const ReferenceExecutor> exec,
+          const matrix::SymmetricCsr<ValueType, IndexType>* a,
+          const matrix::Dense<ValueType>* b, matrix::Dense<ValueType>* c,
+          array<char>&)
+{
+    const auto row_ptrs = a->get_const_row_ptrs();
+    const auto col_idxs = a->get_const_col_idxs();
+    const auto vals = a->get_const_values();
+
+    for (size_type row = 0; row < a->get_size()[0]; ++row) {
+        for (size_type j = 0; j < c->get_size()[1]; ++j) {
+            c->at(row, j) = zero<ValueType>();
+        }
+    }
+    for (size_type row = 0; row < a->get_size()[0]; ++row) {
+        for (auto k = row_ptrs[row]; k < row_ptrs[row + 1]; ++k) {
+            const auto val = vals[k];
+            const auto col = static_cast<size_type>(col_idxs[k]);
+            for (size_type j = 0; j < c->get_size()[1]; ++j) {
+                c->at(row, j) += val * b->at(col, j);
+            }
+            if (col != row) {
+                for (size_type j = 0; j < c->get_size()[1]; ++j) {
+                    c->at(col, j) += conj(val) * b->at(row, j);
+                }
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SYMMETRIC_CSR_SPMV_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void advanced_spmv(std::shared_ptr<const ReferenceExecutor> exec,
+                   const matrix::Dense<ValueType>* alpha,
+                   const matrix::SymmetricCsr<ValueType, IndexType>* a,
+                   const matrix::Dense<ValueType>* b,
+                   const matrix::Dense<ValueType>* beta,
+                   matrix::Dense<ValueType>* c, array<char>&)
+{
+    const auto row_ptrs = a->get_const_row_ptrs();
+    const auto col_idxs = a->get_const_col_idxs();
+    const auto vals = a->get_const_values();
+    const auto valpha = alpha->at(0, 0);
+    const auto vbeta = beta->at(0, 0);
+
+    for (size_type row = 0; row < a->get_size()[0]; ++row) {
+        for (size_type j = 0; j < c->get_size()[1]; ++j) {
+            c->at(row, j) *= vbeta;
+        }
+    }
+    for (size_type row = 0; row < a->get_size()[0]; ++row) {
+        for (auto k = row_ptrs[row]; k < row_ptrs[row + 1]; ++k) {
+            const auto val = vals[k];
+            const auto col = static_cast<size_type>(col_idxs[k]);
+            for (size_type j = 0; j < c->get_size()[1]; ++j) {
+                c->at(row, j) += valpha * val * b->at(col, j);
+            }
+            if (col != row) {
+                for (size_type j = 0; j < c->get_size()[1]; ++j) {
+                    c->at(col, j) += valpha * conj(val) * b->at(row, j);
+                }
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SYMMETRIC_CSR_ADVANCED_SPMV_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void count_upper_nonzeros(std::shared_ptr<const ReferenceExecutor> exec,
+                          const matrix::Csr<ValueType, IndexType>* source,
+                          IndexType* row_nnz)
+{
+    const auto row_ptrs = source->get_const_row_ptrs();
+    const auto col_idxs = source->get_const_col_idxs();
+    for (size_type row = 0; row < source->get_size()[0]; ++row) {
+        row_nnz[row] = 0;
+        for (auto k = row_ptrs[row]; k < row_ptrs[row + 1]; ++k) {
+            row_nnz[row] += static_cast<size_type>(col_idxs[k]) >= row;
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SYMMETRIC_CSR_COUNT_UPPER_NNZ_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void convert_from_csr(std::shared_ptr<const ReferenceExecutor> exec,
+                      const matrix::Csr<ValueType, IndexType>* source,
+                      matrix::SymmetricCsr<ValueType, IndexType>* result)
+{
+    const auto in_row_ptrs = source->get_const_row_ptrs();
+    const auto in_col_idxs = source->get_const_col_idxs();
+    const auto in_vals = source->get_const_values();
+    const auto out_row_ptrs = result->get_const_row_ptrs();
+    auto out_col_idxs = result->get_col_idxs();
+    auto out_vals = result->get_values();
+    for (size_type row = 0; row < source->get_size()[0]; ++row) {
+        auto out_nz = out_row_ptrs[row];
+        for (auto k = in_row_ptrs[row]; k < in_row_ptrs[row + 1]; ++k) {
+            if (static_cast<size_type>(in_col_idxs[k]) >= row) {
+                out_col_idxs[out_nz] = in_col_idxs[k];
+                out_vals[out_nz] = in_vals[k];
+                out_nz++;
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SYMMETRIC_CSR_CONVERT_FROM_CSR_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void count_csr_nonzeros(
+    std::shared_ptr<const ReferenceExecutor> exec,
+    const matrix::SymmetricCsr<ValueType, IndexType>* source,
+    IndexType* row_nnz)
+{
+    const auto row_ptrs = source->get_const_row_ptrs();
+    const auto col_idxs = source->get_const_col_idxs();
+    const auto num_rows = source->get_size()[0];
+    for (size_type row = 0; row < num_rows; ++row) {
+        row_nnz[row] = row_ptrs[row + 1] - row_ptrs[row];
+    }
+    for (size_type row = 0; row < num_rows; ++row) {
+        for (auto k = row_ptrs[row]; k < row_ptrs[row + 1]; ++k) {
+            const auto col = static_cast<size_type>(col_idxs[k]);
+            if (col != row) {
+                row_nnz[col]++;
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SYMMETRIC_CSR_COUNT_CSR_NNZ_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void convert_to_csr(std::shared_ptr<const ReferenceExecutor> exec,
+                    const matrix::SymmetricCsr<ValueType, IndexType>* source,
+                    matrix::Csr<ValueType, IndexType>* result)
+{
+    const auto in_row_ptrs = source->get_const_row_ptrs();
+    const auto in_col_idxs = source->get_const_col_idxs();
+    const auto in_vals = source->get_const_values();
+    const auto out_row_ptrs = result->get_const_row_ptrs();
+    auto out_col_idxs = result->get_col_idxs();
+    auto out_vals = result->get_values();
+    const auto num_rows = source->get_size()[0];
+    // the lower triangle entries of each row come first, ordered by the row
+    // they are mirrored from
+    array<IndexType> lower_nz{exec, out_row_ptrs, out_row_ptrs + num_rows};
+    auto next_lower_nz = lower_nz.get_data();
+    for (size_type row = 0; row < num_rows; ++row) {
+        for (auto k = in_row_ptrs[row]; k < in_row_ptrs[row + 1]; ++k) {
+            const auto col = in_col_idxs[k];
+            if (static_cast<size_type>(col) != row) {
+                const auto out_nz = next_lower_nz[col]++;
+                out_col_idxs[out_nz] = static_cast<IndexType>(row);
+                out_vals[out_nz] = conj(in_vals[k]);
+            }
+        }
+    }
+    for (size_type row = 0; row < num_rows; ++row) {
+        auto out_nz = out_row_ptrs[row + 1] -
+                      (in_row_ptrs[row + 1] - in_row_ptrs[row]);
+        for (auto k = in_row_ptrs[row]; k < in_row_ptrs[row + 1]; ++k) {
+            out_col_idxs[out_nz] = in_col_idxs[k];
+            out_vals[out_nz] = in_vals[k];
+            out_nz++;
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SYMMETRIC_CSR_CONVERT_TO_CSR_KERNEL);
+
+
+}  // namespace symmetric_csr
+}  // namespace reference
+}  // namespace kernels
+}  // namespace gko
@@ -348,6 +348,52 @@ GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
     GKO_DECLARE_PGM_COMPUTE_COARSE_COO);
 
 
+template <typename ValueType, typename IndexType>
+void compute_coarse_csr(std::shared_ptr<const DefaultExecutor> exec,
+                        const matrix::Csr<ValueType, IndexType>* fine,
+                        const array<IndexType>& agg,
+                        matrix::Csr<ValueType, IndexType>* coarse)
+{
+    const auto num_fine_rows = fine->get_size()[0];
+    const auto num_agg = coarse->get_size()[0];
+    const auto fine_row_ptrs = fine->get_const_row_ptrs();
+    const auto fine_col_idxs = fine->get_const_col_idxs();
+    const auto fine_vals = fine->get_const_values();
+    const auto agg_vals = agg.get_const_data();
+    auto coarse_row_ptrs = coarse->get_row_ptrs();
+    vector<map<IndexType, ValueType>> coarse_rows(
+        num_agg, map<IndexType, ValueType>(exec), exec);
+    for (size_type row = 0; row < num_fine_rows; row++) {
+        auto& coarse_row = coarse_rows[agg_vals[row]];
+        for (auto nz = fine_row_ptrs[row]; nz < fine_row_ptrs[row + 1]; nz++) {
+            coarse_row[agg_vals[fine_col_idxs[nz]]] += fine_vals[nz];
+        }
+    }
+    for (size_type row = 0; row < num_agg; row++) {
+        coarse_row_ptrs[row] = coarse_rows[row].size();
+    }
+    components::prefix_sum(exec, coarse_row_ptrs, num_agg + 1);
+    matrix::CsrBuilder<ValueType, IndexType> builder{coarse};
+    auto& coarse_col_idxs_array = builder.get_col_idx_array();
+    auto& coarse_vals_array = builder.get_value_array();
+    coarse_col_idxs_array.resize_and_reset(coarse_row_ptrs[num_agg]);
+    coarse_vals_array.resize_and_reset(coarse_row_ptrs[num_agg]);
+    auto coarse_col_idxs = coarse_col_idxs_array.get_data();
+    auto coarse_vals = coarse_vals_array.get_data();
+    for (size_type row = 0; row < num_agg; row++) {
+        auto out = coarse_row_ptrs[row];
+        for (const auto& entry : coarse_rows[row]) {
+            coarse_col_idxs[out] = entry.first;
+            coarse_vals[out] = entry.second;
+            out++;
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_PGM_COMPUTE_COARSE_CSR);
+
+
 }  // namespace pgm
 }  // namespace reference
 }  // namespace kernels
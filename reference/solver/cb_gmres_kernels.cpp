@@ -64,7 +64,8 @@ void finish_arnoldi_CGS(matrix::Dense<ValueType>* next_krylov_basis,
                         matrix::Dense<ValueType>* hessenberg_iter,
                         matrix::Dense<ValueType>* buffer_iter,
                         matrix::Dense<remove_complex<ValueType>>* arnoldi_norm,
-                        size_type iter, const stopping_status* stop_status)
+                        size_type iter, const stopping_status* stop_status,
+                        solver::gmres::ortho_method ortho)
 {
     static_assert(
         std::is_same<ValueType,
@@ -74,6 +75,12 @@ void finish_arnoldi_CGS(matrix::Dense<ValueType>* next_krylov_basis,
         gko::cb_gmres::detail::has_3d_scaled_accessor<Accessor3d>::value;
     using rc_vtype = remove_complex<ValueType>;
     const rc_vtype eta = 1.0 / sqrt(2.0);
+    // cgs2 always reorthogonalizes once, cgs_conditional up to two times if
+    // the norm dropped by more than eta
+    const bool always_reorth = ortho == solver::gmres::ortho_method::cgs2;
+    const size_type max_reorth = ortho == solver::gmres::ortho_method::cgs
+                                     ? 0
+                                     : (always_reorth ? 1 : 2);
 
     for (size_type i = 0; i < next_krylov_basis->get_size()[1]; ++i) {
         arnoldi_norm->at(0, i) = zero<rc_vtype>();
@@ -119,9 +126,11 @@ void finish_arnoldi_CGS(matrix::Dense<ValueType>* next_krylov_basis,
         }
         arnoldi_norm->at(1, i) = sqrt(arnoldi_norm->at(1, i));
 
-        for (size_type l = 1;
-             (arnoldi_norm->at(1, i)) < (arnoldi_norm->at(0, i)) && l < 3;
-             l++) {
+        for (size_type l = 0; l < max_reorth; l++) {
+            if (!always_reorth &&
+                !(arnoldi_norm->at(1, i) < arnoldi_norm->at(0, i))) {
+                break;
+            }
             arnoldi_norm->at(0, i) = eta * arnoldi_norm->at(1, i);
             for (size_type k = 0; k < iter + 1; ++k) {
                 buffer_iter->at(k, i) = zero<ValueType>();
@@ -138,7 +147,7 @@ void finish_arnoldi_CGS(matrix::Dense<ValueType>* next_krylov_basis,
                 for (size_type j = 0; j < next_krylov_basis->get_size()[0];
                      ++j) {
                     next_krylov_basis->at(j, i) -=
-                        buffer_iter->at(k, i) * conj(krylov_bases(k, j, i));
+                        buffer_iter->at(k, i) * krylov_bases(k, j, i);
                 }
                 hessenberg_iter->at(k, i) += buffer_iter->at(k, i);
             }
@@ -147,14 +156,19 @@ void finish_arnoldi_CGS(matrix::Dense<ValueType>* next_krylov_basis,
             //     hessenberg(iter, i) += buffer(iter, i)
             // end
             arnoldi_norm->at(1, i) = zero<rc_vtype>();
-            arnoldi_norm->at(2, i) = zero<rc_vtype>();
+            if (has_scalar) {
+                arnoldi_norm->at(2, i) = zero<rc_vtype>();
+            }
             for (size_type j = 0; j < next_krylov_basis->get_size()[0]; ++j) {
                 arnoldi_norm->at(1, i) +=
                     squared_norm(next_krylov_basis->at(j, i));
-                arnoldi_norm->at(2, i) =
-                    (arnoldi_norm->at(2, i) >= abs(next_krylov_basis->at(j, i)))
-                        ? arnoldi_norm->at(2, i)
-                        : abs(next_krylov_basis->at(j, i));
+                if (has_scalar) {
+                    arnoldi_norm->at(2, i) =
+                        (arnoldi_norm->at(2, i) >=
+                         abs(next_krylov_basis->at(j, i)))
+                            ? arnoldi_norm->at(2, i)
+                            : abs(next_krylov_basis->at(j, i));
+                }
             }
             arnoldi_norm->at(1, i) = sqrt(arnoldi_norm->at(1, i));
             // nrmN = norm(next_krylov_basis)
@@ -409,7 +423,7 @@ void arnoldi(std::shared_ptr<const ReferenceExecutor> exec,
              matrix::Dense<remove_complex<ValueType>>* arnoldi_norm,
              size_type iter, array<size_type>* final_iter_nums,
              const array<stopping_status>* stop_status, array<stopping_status>*,
-             array<size_type>*)
+             array<size_type>*, solver::gmres::ortho_method ortho)
 {
     static_assert(
         std::is_same<ValueType,
@@ -422,7 +436,7 @@ void arnoldi(std::shared_ptr<const ReferenceExecutor> exec,
     }
     finish_arnoldi_CGS(next_krylov_basis, krylov_bases, hessenberg_iter,
                        buffer_iter, arnoldi_norm, iter,
-                       stop_status->get_const_data());
+                       stop_status->get_const_data(), ortho);
     givens_rotation(givens_sin, givens_cos, hessenberg_iter, iter,
                     stop_status->get_const_data());
     calculate_next_residual_norm(givens_sin, givens_cos, residual_norm,
@@ -125,6 +125,69 @@ void step_2(std::shared_ptr<const ReferenceExecutor> exec,
 GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_CG_STEP_2_KERNEL);
 
 
+template <typename ValueType>
+void step_2_norm(std::shared_ptr<const ReferenceExecutor> exec,
+                 matrix::Dense<ValueType>* x, matrix::Dense<ValueType>* r,
+                 const matrix::Dense<ValueType>* p,
+                 const matrix::Dense<ValueType>* q,
+                 const matrix::Dense<ValueType>* beta,
+                 const matrix::Dense<ValueType>* rho,
+                 matrix::Dense<ValueType>* next_rho,
+                 matrix::Dense<remove_complex<ValueType>>* residual_norm,
+                 const array<stopping_status>* stop_status,
+                 array<char>& tmp)
+{
+    for (size_type j = 0; j < x->get_size()[1]; ++j) {
+        next_rho->at(j) = zero<ValueType>();
+    }
+    for (size_type i = 0; i < x->get_size()[0]; ++i) {
+        for (size_type j = 0; j < x->get_size()[1]; ++j) {
+            if (!stop_status->get_const_data()[j].has_stopped() &&
+                is_nonzero(beta->at(j))) {
+                auto alpha = rho->at(j) / beta->at(j);
+                x->at(i, j) += alpha * p->at(i, j);
+                r->at(i, j) -= alpha * q->at(i, j);
+            }
+            next_rho->at(j) += conj(r->at(i, j)) * r->at(i, j);
+        }
+    }
+    for (size_type j = 0; j < x->get_size()[1]; ++j) {
+        residual_norm->at(j) = sqrt(abs(next_rho->at(j)));
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_CG_STEP_2_NORM_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void spmv_conj_dot(std::shared_ptr<const ReferenceExecutor> exec,
+                   const matrix::Csr<ValueType, IndexType>* a,
+                   const matrix::Dense<ValueType>* p,
+                   matrix::Dense<ValueType>* q, matrix::Dense<ValueType>* beta,
+                   array<char>& tmp)
+{
+    const auto row_ptrs = a->get_const_row_ptrs();
+    const auto col_idxs = a->get_const_col_idxs();
+    const auto vals = a->get_const_values();
+    for (size_type j = 0; j < q->get_size()[1]; ++j) {
+        beta->at(j) = zero<ValueType>();
+    }
+    for (size_type row = 0; row < q->get_size()[0]; ++row) {
+        for (size_type j = 0; j < q->get_size()[1]; ++j) {
+            auto sum = zero<ValueType>();
+            for (auto k = row_ptrs[row]; k < row_ptrs[row + 1]; ++k) {
+                sum += vals[k] * p->at(col_idxs[k], j);
+            }
+            q->at(row, j) = sum;
+            beta->at(j) += conj(p->at(row, j)) * sum;
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_CG_SPMV_CONJ_DOT_KERNEL);
+
+
 }  // namespace cg
 }  // namespace reference
 }  // namespace kernels
@@ -101,6 +101,68 @@ void multi_axpy(std::shared_ptr<const ReferenceExecutor> exec,
 GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_GMRES_MULTI_AXPY_KERNEL);
 
 
+template <typename ValueType>
+void multi_dot(std::shared_ptr<const ReferenceExecutor> exec,
+               const matrix::Dense<ValueType>* krylov_bases,
+               const matrix::Dense<ValueType>* block,
+               matrix::Dense<ValueType>* result, array<char>& tmp)
+{
+    const auto num_rhs = block->get_size()[1];
+    const auto num_bases = result->get_size()[0];
+    const auto block_size = result->get_size()[1] / num_rhs;
+    const auto num_rows = block->get_size()[0] / block_size;
+    for (size_type i = 0; i < num_bases; ++i) {
+        for (size_type k = 0; k < block_size; ++k) {
+            for (size_type rhs = 0; rhs < num_rhs; ++rhs) {
+                auto value = zero<ValueType>();
+                for (size_type row = 0; row < num_rows; ++row) {
+                    value +=
+                        conj(krylov_bases->at(i * num_rows + row, rhs)) *
+                        block->at(k * num_rows + row, rhs);
+                }
+                result->at(i, k * num_rhs + rhs) = value;
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_GMRES_MULTI_DOT_KERNEL);
+
+
+template <typename ValueType>
+void multi_update(std::shared_ptr<const ReferenceExecutor> exec,
+                  const matrix::Dense<ValueType>* krylov_bases,
+                  const matrix::Dense<ValueType>* coeffs,
+                  const matrix::Dense<ValueType>* triangular,
+                  matrix::Dense<ValueType>* block)
+{
+    const auto num_rhs = block->get_size()[1];
+    const auto num_bases = coeffs->get_size()[0];
+    const auto block_size = triangular->get_size()[0];
+    const auto num_rows = block->get_size()[0] / block_size;
+    for (size_type row = 0; row < num_rows; ++row) {
+        for (size_type rhs = 0; rhs < num_rhs; ++rhs) {
+            // triangular is upper triangular, so going backwards allows
+            // updating the block in-place
+            for (auto k = block_size; k-- > 0;) {
+                auto value = zero<ValueType>();
+                for (size_type l = 0; l <= k; ++l) {
+                    value += block->at(l * num_rows + row, rhs) *
+                             triangular->at(l, k * num_rhs + rhs);
+                }
+                for (size_type i = 0; i < num_bases; ++i) {
+                    value -= krylov_bases->at(i * num_rows + row, rhs) *
+                             coeffs->at(i, k * num_rhs + rhs);
+                }
+                block->at(k * num_rows + row, rhs) = value;
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_GMRES_MULTI_UPDATE_KERNEL);
+
+
 }  // namespace gmres
 }  // namespace reference
 }  // namespace kernels
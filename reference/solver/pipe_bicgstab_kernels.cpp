@@ -0,0 +1,208 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2022, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include "core/solver/pipe_bicgstab_kernels.hpp"
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/types.hpp>
+
+
+namespace gko {
+namespace kernels {
+namespace reference {
+/**
+ * @brief The pipelined BICGSTAB solver namespace.
+ *
+ * @ingroup pipe_bicgstab
+ */
+namespace pipe_bicgstab {
+
+
+template <typename ValueType>
+void initialize(std::shared_ptr<const ReferenceExecutor> exec,
+                const matrix::Dense<ValueType>* b, matrix::Dense<ValueType>* r,
+                matrix::Dense<ValueType>* p, matrix::Dense<ValueType>* s,
+                matrix::Dense<ValueType>* ps, matrix::Dense<ValueType>* z,
+                matrix::Dense<ValueType>* pz, matrix::Dense<ValueType>* v,
+                matrix::Dense<ValueType>* prev_rho,
+                matrix::Dense<ValueType>* alpha,
+                matrix::Dense<ValueType>* beta,
+                matrix::Dense<ValueType>* omega,
+                array<stopping_status>* stop_status)
+{
+    for (size_type j = 0; j < b->get_size()[1]; ++j) {
+        prev_rho->at(j) = beta->at(j) = zero<ValueType>();
+        alpha->at(j) = omega->at(j) = one<ValueType>();
+        stop_status->get_data()[j].reset();
+    }
+    for (size_type i = 0; i < b->get_size()[0]; ++i) {
+        for (size_type j = 0; j < b->get_size()[1]; ++j) {
+            r->at(i, j) = b->at(i, j);
+            p->at(i, j) = s->at(i, j) = ps->at(i, j) = z->at(i, j) =
+                pz->at(i, j) = v->at(i, j) = zero<ValueType>();
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(
+    GKO_DECLARE_PIPE_BICGSTAB_INITIALIZE_KERNEL);
+
+
+template <typename ValueType>
+void step_1(std::shared_ptr<const ReferenceExecutor> exec,
+            const matrix::Dense<ValueType>* r,
+            const matrix::Dense<ValueType>* pr,
+            const matrix::Dense<ValueType>* w,
+            const matrix::Dense<ValueType>* pw,
+            const matrix::Dense<ValueType>* t, matrix::Dense<ValueType>* p,
+            matrix::Dense<ValueType>* s, matrix::Dense<ValueType>* ps,
+            matrix::Dense<ValueType>* z, const matrix::Dense<ValueType>* pz,
+            const matrix::Dense<ValueType>* v, matrix::Dense<ValueType>* q,
+            matrix::Dense<ValueType>* pq, matrix::Dense<ValueType>* y,
+            const matrix::Dense<ValueType>* alpha,
+            const matrix::Dense<ValueType>* beta,
+            const matrix::Dense<ValueType>* omega,
+            const array<stopping_status>* stop_status)
+{
+    for (size_type i = 0; i < r->get_size()[0]; ++i) {
+        for (size_type j = 0; j < r->get_size()[1]; ++j) {
+            if (stop_status->get_const_data()[j].has_stopped()) {
+                continue;
+            }
+            p->at(i, j) =
+                pr->at(i, j) +
+                beta->at(j) * (p->at(i, j) - omega->at(j) * ps->at(i, j));
+            s->at(i, j) =
+                w->at(i, j) +
+                beta->at(j) * (s->at(i, j) - omega->at(j) * z->at(i, j));
+            ps->at(i, j) =
+                pw->at(i, j) +
+                beta->at(j) * (ps->at(i, j) - omega->at(j) * pz->at(i, j));
+            z->at(i, j) =
+                t->at(i, j) +
+                beta->at(j) * (z->at(i, j) - omega->at(j) * v->at(i, j));
+            q->at(i, j) = r->at(i, j) - alpha->at(j) * s->at(i, j);
+            pq->at(i, j) = pr->at(i, j) - alpha->at(j) * ps->at(i, j);
+            y->at(i, j) = w->at(i, j) - alpha->at(j) * z->at(i, j);
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_PIPE_BICGSTAB_STEP_1_KERNEL);
+
+
+template <typename ValueType>
+void step_2(std::shared_ptr<const ReferenceExecutor> exec,
+            matrix::Dense<ValueType>* x, matrix::Dense<ValueType>* r,
+            matrix::Dense<ValueType>* pr, matrix::Dense<ValueType>* w,
+            const matrix::Dense<ValueType>* pw,
+            const matrix::Dense<ValueType>* t,
+            const matrix::Dense<ValueType>* p,
+            const matrix::Dense<ValueType>* q,
+            const matrix::Dense<ValueType>* pq,
+            const matrix::Dense<ValueType>* y,
+            const matrix::Dense<ValueType>* pz,
+            const matrix::Dense<ValueType>* v,
+            const matrix::Dense<ValueType>* qy,
+            const matrix::Dense<ValueType>* yy,
+            const matrix::Dense<ValueType>* alpha,
+            matrix::Dense<ValueType>* omega,
+            const array<stopping_status>* stop_status)
+{
+    for (size_type j = 0; j < x->get_size()[1]; ++j) {
+        if (stop_status->get_const_data()[j].has_stopped()) {
+            continue;
+        }
+        omega->at(j) = is_zero(yy->at(j)) ? zero<ValueType>()
+                                          : qy->at(j) / yy->at(j);
+    }
+    for (size_type i = 0; i < x->get_size()[0]; ++i) {
+        for (size_type j = 0; j < x->get_size()[1]; ++j) {
+            if (stop_status->get_const_data()[j].has_stopped()) {
+                continue;
+            }
+            x->at(i, j) +=
+                alpha->at(j) * p->at(i, j) + omega->at(j) * pq->at(i, j);
+            r->at(i, j) = q->at(i, j) - omega->at(j) * y->at(i, j);
+            pr->at(i, j) =
+                pq->at(i, j) -
+                omega->at(j) * (pw->at(i, j) - alpha->at(j) * pz->at(i, j));
+            w->at(i, j) =
+                y->at(i, j) -
+                omega->at(j) * (t->at(i, j) - alpha->at(j) * v->at(i, j));
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_PIPE_BICGSTAB_STEP_2_KERNEL);
+
+
+template <typename ValueType>
+void step_3(std::shared_ptr<const ReferenceExecutor> exec,
+            const matrix::Dense<ValueType>* rho,
+            const matrix::Dense<ValueType>* rw,
+            const matrix::Dense<ValueType>* rs,
+            const matrix::Dense<ValueType>* rz,
+            matrix::Dense<ValueType>* prev_rho, matrix::Dense<ValueType>* alpha,
+            matrix::Dense<ValueType>* beta,
+            const matrix::Dense<ValueType>* omega,
+            const array<stopping_status>* stop_status)
+{
+    for (size_type j = 0; j < rho->get_size()[1]; ++j) {
+        if (stop_status->get_const_data()[j].has_stopped()) {
+            continue;
+        }
+        if (is_zero(prev_rho->at(j)) || is_zero(omega->at(j))) {
+            beta->at(j) = zero<ValueType>();
+        } else {
+            beta->at(j) = rho->at(j) / prev_rho->at(j) * alpha->at(j) /
+                          omega->at(j);
+        }
+        const auto denom =
+            rw->at(j) + beta->at(j) * (rs->at(j) - omega->at(j) * rz->at(j));
+        alpha->at(j) =
+            is_zero(denom) ? zero<ValueType>() : rho->at(j) / denom;
+        prev_rho->at(j) = rho->at(j);
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_PIPE_BICGSTAB_STEP_3_KERNEL);
+
+
+}  // namespace pipe_bicgstab
+}  // namespace reference
+}  // namespace kernels
+}  // namespace gko
@@ -36,6 +36,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <algorithm>
 #include <fstream>
 #include <memory>
+#include <vector>
 
 
 #include <gtest/gtest.h>
@@ -44,7 +45,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ginkgo/core/base/array.hpp>
 #include <ginkgo/core/base/types.hpp>
 #include <ginkgo/core/factorization/factorization.hpp>
+#include <ginkgo/core/matrix/coo.hpp>
 #include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
 #include <ginkgo/core/matrix/sparsity_csr.hpp>
 
 
@@ -98,6 +101,52 @@ protected:
             row_descs.get_data(), storage.get_data());
     }
 
+    // independent chains coupled by a few trailing rows, so the factor has
+    // many rows per level and one level per chain row and coupling row
+    std::shared_ptr<matrix_type> gen_multilevel_mtx()
+    {
+        const index_type num_chains = 8;
+        const index_type chain_length = 40;
+        const index_type num_coupling = 8;
+        const auto first_coupling = num_chains * chain_length;
+        const auto size = first_coupling + num_coupling;
+        gko::matrix_data<value_type, index_type> data{gko::dim<2>(size, size)};
+        std::vector<double> diag(size, 1.0);
+        const auto add_pair = [&](index_type row, index_type col) {
+            data.nonzeros.emplace_back(row, col, -1.0);
+            data.nonzeros.emplace_back(col, row, -0.5);
+            diag[row] += 1.0;
+            diag[col] += 0.5;
+        };
+        for (index_type chain = 0; chain < num_chains; chain++) {
+            for (index_type i = 0; i < chain_length; i++) {
+                const auto row = chain * chain_length + i;
+                for (index_type offset : {1, 2}) {
+                    if (i + offset < chain_length) {
+                        add_pair(row, row + offset);
+                    }
+                }
+                if (i % 5 == 0) {
+                    for (index_type c = 0; c < num_coupling; c++) {
+                        add_pair(row, first_coupling + c);
+                    }
+                }
+            }
+        }
+        for (index_type c = 0; c < num_coupling; c++) {
+            for (index_type c2 = c + 1; c2 < num_coupling; c2++) {
+                add_pair(first_coupling + c, first_coupling + c2);
+            }
+        }
+        for (index_type row = 0; row < size; row++) {
+            data.nonzeros.emplace_back(row, row, diag[row]);
+        }
+        data.ensure_row_major_order();
+        auto result = gko::share(matrix_type::create(ref));
+        result->read(data);
+        return result;
+    }
+
     std::shared_ptr<const gko::ReferenceExecutor> ref;
     gko::size_type num_rows;
     std::shared_ptr<matrix_type> mtx;
@@ -259,3 +308,85 @@ TYPED_TEST(Lu, FactorizeAmdWorks)
     ASSERT_EQ(lu->get_upper_factor(), nullptr);
     ASSERT_EQ(lu->get_diagonal(), nullptr);
 }
+
+
+TYPED_TEST(Lu, FactorizeWithReusedSymbolicWorks)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    this->setup(gko::matrices::location_ani1_mtx,
+                gko::matrices::location_ani1_lu_mtx);
+    auto factory =
+        gko::experimental::factorization::Lu<value_type, index_type>::build()
+            .with_symmetric_sparsity(true)
+            .on(this->ref);
+    auto scaled = gko::share(this->mtx->clone());
+    scaled->scale(
+        gko::initialize<gko::matrix::Dense<value_type>>({2.0}, this->ref)
+            .get());
+
+    auto symbolic = factory->generate_symbolic(this->mtx);
+    auto lu = factory->generate_numeric(symbolic.get(), this->mtx);
+    auto scaled_lu = factory->generate_numeric(symbolic.get(), scaled);
+
+    GKO_ASSERT_MTX_EQ_SPARSITY(symbolic->get_pattern(), this->mtx_lu);
+    GKO_ASSERT_MTX_NEAR(lu->get_combined(), this->mtx_lu, r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(scaled_lu->get_combined(),
+                        factory->generate(scaled)->get_combined(), 0.0);
+    ASSERT_EQ(scaled_lu->get_storage_type(),
+              gko::experimental::factorization::storage_type::combined_lu);
+}
+
+
+TYPED_TEST(Lu, FactorizeNonCsrMatrixWorks)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    this->setup(gko::matrices::location_ani1_mtx,
+                gko::matrices::location_ani1_lu_mtx);
+    auto factory =
+        gko::experimental::factorization::Lu<value_type, index_type>::build()
+            .with_symmetric_sparsity(true)
+            .on(this->ref);
+    auto coo = gko::share(
+        gko::matrix::Coo<value_type, index_type>::create(this->ref));
+    coo->copy_from(this->mtx.get());
+
+    auto symbolic = factory->generate_symbolic(coo);
+    auto lu = factory->generate_numeric(symbolic.get(), coo);
+
+    GKO_ASSERT_MTX_EQ_SPARSITY(symbolic->get_pattern(), this->mtx_lu);
+    GKO_ASSERT_MTX_NEAR(lu->get_combined(), this->mtx_lu, r<value_type>::value);
+}
+
+
+TYPED_TEST(Lu, FactorizeMultiLevelMatrixWorks)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    using dense_type = gko::matrix::Dense<value_type>;
+    auto mtx = this->gen_multilevel_mtx();
+    const auto size = mtx->get_size()[0];
+    auto factory =
+        gko::experimental::factorization::Lu<value_type, index_type>::build()
+            .with_symmetric_sparsity(true)
+            .on(this->ref);
+
+    auto lu = factory->generate(mtx);
+
+    auto combined = dense_type::create(this->ref);
+    combined->copy_from(lu->get_combined().get());
+    auto product = dense_type::create(this->ref, gko::dim<2>{size, size});
+    for (gko::size_type row = 0; row < size; row++) {
+        for (gko::size_type col = 0; col < size; col++) {
+            // L has an implicit unit diagonal
+            auto sum =
+                row <= col ? combined->at(row, col) : gko::zero<value_type>();
+            for (gko::size_type k = 0; k < std::min(row, col + 1); k++) {
+                sum += combined->at(row, k) * combined->at(k, col);
+            }
+            product->at(row, col) = sum;
+        }
+    }
+    GKO_ASSERT_MTX_NEAR(product, mtx, r<value_type>::value);
+}
@@ -278,4 +278,26 @@ TYPED_TEST(ParIc, GenerateGeneral)
 }
 
 
+TYPED_TEST(ParIc, RefactorizeKeepsPattern)
+{
+    using factorization_type = typename TestFixture::factorization_type;
+    using Csr = typename TestFixture::Csr;
+    using Dense = typename TestFixture::Dense;
+    auto fact =
+        factorization_type::build().on(this->exec)->generate(this->mtx_system);
+    auto scaled = gko::share(this->mtx_system->clone());
+    scaled->scale(gko::initialize<Dense>({4.0}, this->exec).get());
+    auto expected_l = fact->get_l_factor()->clone();
+    expected_l->scale(gko::initialize<Dense>({2.0}, this->exec).get());
+
+    auto refactorized = fact->refactorize(scaled);
+
+    GKO_ASSERT_MTX_EQ_SPARSITY(refactorized->get_l_factor(),
+                               fact->get_l_factor());
+    GKO_ASSERT_MTX_NEAR(refactorized->get_l_factor(), expected_l, this->tol);
+    GKO_ASSERT_MTX_NEAR(refactorized->get_lt_factor(),
+                        gko::as<Csr>(expected_l->conj_transpose()), this->tol);
+}
+
+
 }  // namespace
@@ -751,4 +751,28 @@ TYPED_TEST(ParIlu, GenerateForReverseCsrSmall)
 }
 
 
+TYPED_TEST(ParIlu, RefactorizeKeepsPattern)
+{
+    using value_type = typename TestFixture::value_type;
+    using Dense = typename TestFixture::Dense;
+    auto two = gko::initialize<Dense>({2.0}, this->exec);
+    auto factors = this->ilu_factory_skip->generate(this->mtx_big);
+    auto scaled = gko::share(this->mtx_big->clone());
+    scaled->scale(two.get());
+    auto expected_u = factors->get_u_factor()->clone();
+    expected_u->scale(two.get());
+
+    auto refactorized = factors->refactorize(scaled);
+
+    GKO_ASSERT_MTX_EQ_SPARSITY(refactorized->get_l_factor(),
+                               factors->get_l_factor());
+    GKO_ASSERT_MTX_EQ_SPARSITY(refactorized->get_u_factor(),
+                               factors->get_u_factor());
+    GKO_ASSERT_MTX_NEAR(refactorized->get_l_factor(), factors->get_l_factor(),
+                        r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(refactorized->get_u_factor(), expected_u,
+                        r<value_type>::value);
+}
+
+
 }  // namespace
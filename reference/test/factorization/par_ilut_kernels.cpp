@@ -672,4 +672,31 @@ TYPED_TEST(ParIlut, GenerateWithApproxLargeLimit)
 }
 
 
+TYPED_TEST(ParIlut, RefactorizeKeepsPattern)
+{
+    using factorization_type = typename TestFixture::factorization_type;
+    using Dense = typename TestFixture::Dense;
+    auto two = gko::initialize<Dense>({2.0}, this->exec);
+    auto fact = factorization_type::build()
+                    .with_approximate_select(false)
+                    .with_fill_in_limit(0.75)
+                    .on(this->exec)
+                    ->generate(this->mtx_system);
+    auto scaled = gko::share(this->mtx_system->clone());
+    scaled->scale(two.get());
+    auto expected_u = fact->get_u_factor()->clone();
+    expected_u->scale(two.get());
+
+    auto refactorized = fact->refactorize(scaled);
+
+    GKO_ASSERT_MTX_EQ_SPARSITY(refactorized->get_l_factor(),
+                               fact->get_l_factor());
+    GKO_ASSERT_MTX_EQ_SPARSITY(refactorized->get_u_factor(),
+                               fact->get_u_factor());
+    GKO_ASSERT_MTX_NEAR(refactorized->get_l_factor(), fact->get_l_factor(),
+                        this->tol);
+    GKO_ASSERT_MTX_NEAR(refactorized->get_u_factor(), expected_u, this->tol);
+}
+
+
 }  // namespace
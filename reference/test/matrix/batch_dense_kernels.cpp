@@ -0,0 +1,163 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2022, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include <ginkgo/core/matrix/batch_dense.hpp>
+
+
+#include <memory>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/exception.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename T>
+class BatchDense : public ::testing::Test {
+protected:
+    using value_type = T;
+    using Mtx = gko::matrix::BatchDense<value_type>;
+    using Vec = gko::matrix::Dense<value_type>;
+    using mat_data = gko::matrix_data<value_type, gko::int64>;
+
+    BatchDense()
+        : exec(gko::ReferenceExecutor::create()),
+          mtx(Mtx::create(exec)),
+          b(gko::initialize<Vec>({I<T>{1.0, -2.0}, I<T>{2.0, 0.5},
+                                  I<T>{-1.0, 1.0}, I<T>{3.0, 1.0},
+                                  I<T>{0.0, -1.0}, I<T>{1.0, 2.0}},
+                                 exec)),
+          alpha(gko::initialize<Vec>({-1.0}, exec)),
+          beta(gko::initialize<Vec>({2.0}, exec))
+    {
+        // clang-format off
+        mtx->read({mat_data{{2.0, -1.0, 0.0},
+                            {-1.0, 3.0, -1.0},
+                            {0.0, -1.0, 2.0}},
+                   mat_data{{4.0, 1.0, 0.0},
+                            {1.0, 5.0, 2.0},
+                            {0.0, 2.0, 6.0}}});
+        // clang-format on
+    }
+
+    std::shared_ptr<const gko::ReferenceExecutor> exec;
+    std::unique_ptr<Mtx> mtx;
+    std::unique_ptr<Vec> b;
+    std::unique_ptr<Vec> alpha;
+    std::unique_ptr<Vec> beta;
+};
+
+TYPED_TEST_SUITE(BatchDense, gko::test::ValueTypes, TypenameNameGenerator);
+
+
+TYPED_TEST(BatchDense, AppliesToDenseVector)
+{
+    using Vec = typename TestFixture::Vec;
+    using T = typename TestFixture::value_type;
+    auto x = Vec::create(this->exec, gko::dim<2>{6, 2});
+
+    this->mtx->apply(this->b.get(), x.get());
+
+    // clang-format off
+    GKO_ASSERT_MTX_NEAR(x, l({{0.0, -4.5},
+                              {6.0, 2.5},
+                              {-4.0, 1.5},
+                              {12.0, 3.0},
+                              {5.0, 0.0},
+                              {6.0, 10.0}}), 0.0);
+    // clang-format on
+}
+
+
+TYPED_TEST(BatchDense, AppliesLinearCombinationToDenseVector)
+{
+    using Vec = typename TestFixture::Vec;
+    using T = typename TestFixture::value_type;
+    auto x = gko::initialize<Vec>({I<T>{1.0, 0.0}, I<T>{0.0, 1.0},
+                                   I<T>{1.0, 1.0}, I<T>{-1.0, 0.0},
+                                   I<T>{2.0, 1.0}, I<T>{0.0, 0.0}},
+                                  this->exec);
+
+    this->mtx->apply(this->alpha.get(), this->b.get(), this->beta.get(),
+                     x.get());
+
+    // clang-format off
+    GKO_ASSERT_MTX_NEAR(x, l({{2.0, 4.5},
+                              {-6.0, -0.5},
+                              {6.0, 0.5},
+                              {-14.0, -3.0},
+                              {-1.0, 2.0},
+                              {-6.0, -10.0}}), 0.0);
+    // clang-format on
+}
+
+
+TYPED_TEST(BatchDense, IsEquivalentToUnbatchedApply)
+{
+    using Vec = typename TestFixture::Vec;
+    auto x = Vec::create(this->exec, gko::dim<2>{6, 2});
+    auto expected = Vec::create(this->exec, gko::dim<2>{6, 2});
+
+    this->mtx->apply(this->b.get(), x.get());
+    for (gko::size_type item = 0; item < 2; item++) {
+        auto rows = gko::span{item * 3, (item + 1) * 3};
+        auto item_b = this->b->create_submatrix(rows, gko::span{0, 2});
+        auto item_x = expected->create_submatrix(rows, gko::span{0, 2});
+        this->mtx->create_const_view_for_item(item)->apply(item_b.get(),
+                                                            item_x.get());
+    }
+
+    GKO_ASSERT_MTX_NEAR(x, expected, 0.0);
+}
+
+
+TYPED_TEST(BatchDense, ApplyFailsOnWrongSize)
+{
+    using Vec = typename TestFixture::Vec;
+    auto b = Vec::create(this->exec, gko::dim<2>{3, 2});
+    auto x = Vec::create(this->exec, gko::dim<2>{6, 2});
+
+    ASSERT_THROW(this->mtx->apply(b.get(), x.get()), gko::DimensionMismatch);
+}
+
+
+}  // namespace
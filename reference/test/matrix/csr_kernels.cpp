@@ -34,6 +34,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 
 #include <algorithm>
+#include <cmath>
 
 
 #include <gtest/gtest.h>
@@ -44,6 +45,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ginkgo/core/base/executor.hpp>
 #include <ginkgo/core/base/math.hpp>
 #include <ginkgo/core/matrix/coo.hpp>
+#include <ginkgo/core/matrix/csr_spgemm_plan.hpp>
 #include <ginkgo/core/matrix/dense.hpp>
 #include <ginkgo/core/matrix/diagonal.hpp>
 #include <ginkgo/core/matrix/ell.hpp>
@@ -432,6 +434,39 @@ TYPED_TEST(Csr, AppliesLinearCombinationToMixedDenseVector)
 }
 
 
+TYPED_TEST(Csr, AppliesToMixedDenseVectorInVectorPrecision)
+{
+    using MixedVec = typename TestFixture::MixedVec;
+    using MixedT = typename MixedVec::value_type;
+    auto x = gko::initialize<MixedVec>({2.0, 1.0, 4.0}, this->exec);
+    // only representable if the vector has the higher precision
+    x->at(1) = static_cast<MixedT>(1.0 + std::ldexp(1.0, -40));
+    auto y = MixedVec::create(this->exec, gko::dim<2>{2, 1});
+
+    this->mtx->apply(x.get(), y.get());
+
+    EXPECT_EQ(y->at(0), MixedT{10.0} + MixedT{3.0} * x->at(1));
+    EXPECT_EQ(y->at(1), MixedT{5.0} * x->at(1));
+}
+
+
+TYPED_TEST(Csr, AppliesLinearCombinationToMixedDenseVectorInVectorPrecision)
+{
+    using MixedVec = typename TestFixture::MixedVec;
+    using MixedT = typename MixedVec::value_type;
+    auto alpha = gko::initialize<MixedVec>({-1.0}, this->exec);
+    auto beta = gko::initialize<MixedVec>({2.0}, this->exec);
+    auto x = gko::initialize<MixedVec>({2.0, 1.0, 4.0}, this->exec);
+    x->at(1) = static_cast<MixedT>(1.0 + std::ldexp(1.0, -40));
+    auto y = gko::initialize<MixedVec>({1.0, 2.0}, this->exec);
+
+    this->mtx->apply(alpha.get(), x.get(), beta.get(), y.get());
+
+    EXPECT_EQ(y->at(0), MixedT{-8.0} - MixedT{3.0} * x->at(1));
+    EXPECT_EQ(y->at(1), MixedT{4.0} - MixedT{5.0} * x->at(1));
+}
+
+
 TYPED_TEST(Csr, AppliesLinearCombinationToDenseMatrix)
 {
     using Vec = typename TestFixture::Vec;
@@ -483,6 +518,78 @@ TYPED_TEST(Csr, AppliesToCsrMatrix)
 }
 
 
+TYPED_TEST(Csr, SpgemmSymbolicComputesSortedPattern)
+{
+    using index_type = typename TestFixture::index_type;
+    gko::array<index_type> row_ptrs{this->exec, 3};
+    gko::array<index_type> col_idxs{this->exec};
+
+    gko::kernels::reference::csr::spgemm_symbolic(
+        this->exec, this->mtx.get(), this->mtx3_unsorted.get(),
+        row_ptrs.get_data(), col_idxs);
+
+    GKO_ASSERT_ARRAY_EQ(row_ptrs, I<index_type>({0, 3, 6}));
+    GKO_ASSERT_ARRAY_EQ(col_idxs, I<index_type>({0, 1, 2, 0, 1, 2}));
+}
+
+
+TYPED_TEST(Csr, SpgemmPlanComputesProduct)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    gko::matrix::CsrSpgemmPlan<value_type, index_type> plan{
+        this->exec, this->mtx.get(), this->mtx3_sorted.get()};
+    auto product = plan.create_product();
+
+    plan.compute(this->mtx.get(), this->mtx3_sorted.get(), product.get());
+
+    this->mtx->apply(this->mtx3_sorted.get(), this->mtx2.get());
+    ASSERT_EQ(plan.get_size(), gko::dim<2>(2, 3));
+    ASSERT_EQ(plan.get_num_stored_elements(), 6);
+    GKO_ASSERT_MTX_EQ_SPARSITY(product, this->mtx2);
+    GKO_ASSERT_MTX_NEAR(product, this->mtx2, 0.0);
+}
+
+
+TYPED_TEST(Csr, SpgemmPlanRecomputesValuesWithSamePattern)
+{
+    using Vec = typename TestFixture::Vec;
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    gko::matrix::CsrSpgemmPlan<value_type, index_type> plan{
+        this->exec, this->mtx.get(), this->mtx3_sorted.get()};
+    auto product = plan.create_product();
+    plan.compute(this->mtx.get(), this->mtx3_sorted.get(), product.get());
+    const auto col_idxs = product->get_const_col_idxs();
+    this->mtx->scale(gko::initialize<Vec>({2.0}, this->exec).get());
+
+    plan.compute(this->mtx.get(), this->mtx3_sorted.get(), product.get());
+
+    this->mtx->apply(this->mtx3_sorted.get(), this->mtx2.get());
+    ASSERT_EQ(product->get_const_col_idxs(), col_idxs);
+    GKO_ASSERT_MTX_NEAR(product, this->mtx2, 0.0);
+}
+
+
+TYPED_TEST(Csr, SpgemmPlanThrowsOnMismatchingOperands)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    gko::matrix::CsrSpgemmPlan<value_type, index_type> plan{
+        this->exec, this->mtx.get(), this->mtx3_sorted.get()};
+    auto product = plan.create_product();
+    auto empty = Mtx::create(this->exec, gko::dim<2>{2, 3});
+
+    ASSERT_THROW(plan.compute(this->mtx3_sorted.get(), this->mtx3_sorted.get(),
+                              product.get()),
+                 gko::DimensionMismatch);
+    ASSERT_THROW(plan.compute(this->mtx.get(), this->mtx3_sorted.get(),
+                              empty.get()),
+                 gko::ValueMismatch);
+}
+
+
 TYPED_TEST(Csr, AppliesLinearCombinationToCsrMatrix)
 {
     using Vec = typename TestFixture::Vec;
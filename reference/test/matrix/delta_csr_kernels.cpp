@@ -0,0 +1,285 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2022, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#include <ginkgo/core/matrix/delta_csr.hpp>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/exception.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+
+#include "core/matrix/delta_csr_kernels.hpp"
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename ValueIndexType>
+class DeltaCsr : public ::testing::Test {
+protected:
+    using value_type =
+        typename std::tuple_element<0, decltype(ValueIndexType())>::type;
+    using index_type =
+        typename std::tuple_element<1, decltype(ValueIndexType())>::type;
+    using Csr = gko::matrix::Csr<value_type, index_type>;
+    using Mtx = gko::matrix::DeltaCsr<value_type, index_type>;
+    using Vec = gko::matrix::Dense<value_type>;
+    using delta_type = typename Mtx::delta_type;
+
+    DeltaCsr()
+        : exec(gko::ReferenceExecutor::create()),
+          csr(Csr::create(exec, gko::dim<2>{3, 70002}, 4)),
+          mtx(Mtx::create(exec))
+    {
+        /*
+         * 1   3   0 ... 0   2
+         * 0   5   0 ... 0   0
+         * 0   0   0 ... 0   0
+         */
+        auto v = csr->get_values();
+        auto c = csr->get_col_idxs();
+        auto r = csr->get_row_ptrs();
+        r[0] = 0;
+        r[1] = 3;
+        r[2] = 4;
+        r[3] = 4;
+        c[0] = 0;
+        c[1] = 1;
+        c[2] = 70001;
+        c[3] = 1;
+        v[0] = 1.0;
+        v[1] = 3.0;
+        v[2] = 2.0;
+        v[3] = 5.0;
+        csr->convert_to(mtx.get());
+    }
+
+    std::unique_ptr<Vec> create_rhs(gko::size_type num_rhs)
+    {
+        auto b = Vec::create(exec, gko::dim<2>{70002, num_rhs});
+        b->fill(gko::zero<value_type>());
+        for (gko::size_type j = 0; j < num_rhs; ++j) {
+            b->at(0, j) = 1.0 + j;
+            b->at(1, j) = 2.0;
+            b->at(70001, j) = 3.0 - j;
+        }
+        return b;
+    }
+
+    void assert_equal_to_original_mtx(const Mtx* m)
+    {
+        auto v = m->get_const_values();
+        auto d = m->get_const_col_deltas();
+        auto b = m->get_const_col_bases();
+        auto r = m->get_const_row_ptrs();
+        auto er = m->get_const_escape_ptrs();
+        auto ec = m->get_const_escape_col_idxs();
+        ASSERT_EQ(m->get_size(), gko::dim<2>(3, 70002));
+        ASSERT_EQ(m->get_num_stored_elements(), 4);
+        ASSERT_EQ(m->get_num_escapes(), 1);
+        EXPECT_EQ(r[0], 0);
+        EXPECT_EQ(r[1], 3);
+        EXPECT_EQ(r[2], 4);
+        EXPECT_EQ(r[3], 4);
+        EXPECT_EQ(b[0], 0);
+        EXPECT_EQ(b[1], 1);
+        EXPECT_EQ(b[2], 0);
+        EXPECT_EQ(d[0], delta_type{0});
+        EXPECT_EQ(d[1], delta_type{1});
+        EXPECT_EQ(d[2], delta_type{Mtx::escape_delta});
+        EXPECT_EQ(d[3], delta_type{0});
+        EXPECT_EQ(er[0], 0);
+        EXPECT_EQ(er[1], 1);
+        EXPECT_EQ(er[2], 1);
+        EXPECT_EQ(er[3], 1);
+        EXPECT_EQ(ec[0], 70001);
+        EXPECT_EQ(v[0], value_type{1.0});
+        EXPECT_EQ(v[1], value_type{3.0});
+        EXPECT_EQ(v[2], value_type{2.0});
+        EXPECT_EQ(v[3], value_type{5.0});
+    }
+
+    std::shared_ptr<const gko::ReferenceExecutor> exec;
+    std::unique_ptr<Csr> csr;
+    std::unique_ptr<Mtx> mtx;
+};
+
+TYPED_TEST_SUITE(DeltaCsr, gko::test::ValueIndexTypes,
+                 PairTypenameNameGenerator);
+
+
+TYPED_TEST(DeltaCsr, ConvertsFromCsr)
+{
+    this->assert_equal_to_original_mtx(this->mtx.get());
+}
+
+
+TYPED_TEST(DeltaCsr, ConvertsFromUnsortedCsr)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto unsorted = this->csr->clone();
+    std::swap(unsorted->get_col_idxs()[0], unsorted->get_col_idxs()[2]);
+    std::swap(unsorted->get_values()[0], unsorted->get_values()[2]);
+    auto m = Mtx::create(this->exec);
+
+    unsorted->convert_to(m.get());
+
+    this->assert_equal_to_original_mtx(m.get());
+}
+
+
+TYPED_TEST(DeltaCsr, MovesFromCsr)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto m = Mtx::create(this->exec);
+
+    this->csr->move_to(m.get());
+
+    this->assert_equal_to_original_mtx(m.get());
+}
+
+
+TYPED_TEST(DeltaCsr, EscapesDeltasThatDoNotFitIntoSixteenBits)
+{
+    using Csr = typename TestFixture::Csr;
+    using Mtx = typename TestFixture::Mtx;
+    using delta_type = typename TestFixture::delta_type;
+    auto csr = Csr::create(this->exec);
+    csr->read({{2, 65536},
+               {{0, 0, 1.0}, {0, 65534, 2.0}, {1, 0, 3.0}, {1, 65535, 4.0}}});
+    auto m = Mtx::create(this->exec);
+
+    csr->convert_to(m.get());
+
+    ASSERT_EQ(m->get_num_escapes(), 1);
+    EXPECT_EQ(m->get_const_col_deltas()[1], delta_type{65534});
+    EXPECT_EQ(m->get_const_col_deltas()[3], delta_type{Mtx::escape_delta});
+    EXPECT_EQ(m->get_const_escape_ptrs()[1], 0);
+    EXPECT_EQ(m->get_const_escape_col_idxs()[0], 65535);
+}
+
+
+TYPED_TEST(DeltaCsr, ConvertsToCsr)
+{
+    using Csr = typename TestFixture::Csr;
+    auto result = Csr::create(this->exec);
+
+    this->mtx->convert_to(result.get());
+
+    GKO_ASSERT_MTX_NEAR(result, this->csr, 0.0);
+}
+
+
+TYPED_TEST(DeltaCsr, MovesToCsr)
+{
+    using Csr = typename TestFixture::Csr;
+    auto result = Csr::create(this->exec);
+
+    this->mtx->move_to(result.get());
+
+    GKO_ASSERT_MTX_NEAR(result, this->csr, 0.0);
+}
+
+
+TYPED_TEST(DeltaCsr, AppliesToDenseVector)
+{
+    using Vec = typename TestFixture::Vec;
+    using T = typename TestFixture::value_type;
+    auto b = this->create_rhs(1);
+    auto x = Vec::create(this->exec, gko::dim<2>{3, 1});
+
+    this->mtx->apply(b.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, l<T>({13.0, 10.0, 0.0}), 0.0);
+}
+
+
+TYPED_TEST(DeltaCsr, AppliesToDenseMatrix)
+{
+    using Vec = typename TestFixture::Vec;
+    using T = typename TestFixture::value_type;
+    auto b = this->create_rhs(2);
+    auto x = Vec::create(this->exec, gko::dim<2>{3, 2});
+
+    this->mtx->apply(b.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, l<T>({{13.0, 12.0}, {10.0, 10.0}, {0.0, 0.0}}),
+                        0.0);
+}
+
+
+TYPED_TEST(DeltaCsr, AppliesLinearCombinationToDenseVector)
+{
+    using Vec = typename TestFixture::Vec;
+    using T = typename TestFixture::value_type;
+    auto alpha = gko::initialize<Vec>({-1.0}, this->exec);
+    auto beta = gko::initialize<Vec>({2.0}, this->exec);
+    auto b = this->create_rhs(1);
+    auto x = gko::initialize<Vec>({1.0, 2.0, 3.0}, this->exec);
+
+    this->mtx->apply(alpha.get(), b.get(), beta.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, l<T>({-11.0, -6.0, 6.0}), 0.0);
+}
+
+
+TYPED_TEST(DeltaCsr, AppliesLikeCsr)
+{
+    using Vec = typename TestFixture::Vec;
+    auto b = this->create_rhs(3);
+    auto x = Vec::create(this->exec, gko::dim<2>{3, 3});
+    auto expected = Vec::create(this->exec, gko::dim<2>{3, 3});
+
+    this->mtx->apply(b.get(), x.get());
+    this->csr->apply(b.get(), expected.get());
+
+    GKO_ASSERT_MTX_NEAR(x, expected, 0.0);
+}
+
+
+TYPED_TEST(DeltaCsr, ApplyFailsOnWrongInnerDimension)
+{
+    using Vec = typename TestFixture::Vec;
+    auto b = Vec::create(this->exec, gko::dim<2>{3, 1});
+    auto x = Vec::create(this->exec, gko::dim<2>{3, 1});
+
+    ASSERT_THROW(this->mtx->apply(b.get(), x.get()), gko::DimensionMismatch);
+}
+
+
+}  // namespace
@@ -637,6 +637,106 @@ TYPED_TEST(Fbcsr, OutplaceAbsolute)
 }
 
 
+template <typename CsrType>
+std::unique_ptr<CsrType> get_block_diagonal_csr(
+    std::shared_ptr<const gko::Executor> exec, int block_size, int num_blocks)
+{
+    using value_type = typename CsrType::value_type;
+    using index_type = typename CsrType::index_type;
+    const auto size = static_cast<gko::size_type>(block_size * num_blocks);
+    gko::matrix_data<value_type, index_type> data{gko::dim<2>{size, size}};
+    for (int block = 0; block < num_blocks; block++) {
+        for (int i = 0; i < block_size; i++) {
+            for (int j = 0; j < block_size; j++) {
+                data.nonzeros.emplace_back(block * block_size + i,
+                                           block * block_size + j,
+                                           static_cast<value_type>(1 + i + j));
+            }
+        }
+    }
+    auto mtx = CsrType::create(exec);
+    mtx->read(data);
+    return mtx;
+}
+
+
+TYPED_TEST(Fbcsr, DetectsBlockStructure)
+{
+    using Csr = typename TestFixture::Csr;
+    auto csr = get_block_diagonal_csr<Csr>(this->exec, 3, 6);
+
+    auto structure = gko::matrix::detect_block_structure(csr.get());
+
+    ASSERT_EQ(structure.block_size, 3);
+    ASSERT_EQ(structure.fill_ratio, 1.0);
+}
+
+
+TYPED_TEST(Fbcsr, DetectsLargerBlockStructureWithinFillRatio)
+{
+    using Csr = typename TestFixture::Csr;
+    auto csr = get_block_diagonal_csr<Csr>(this->exec, 3, 6);
+
+    auto structure = gko::matrix::detect_block_structure(csr.get(), 2.0);
+
+    ASSERT_EQ(structure.block_size, 6);
+    ASSERT_EQ(structure.fill_ratio, 2.0);
+}
+
+
+TYPED_TEST(Fbcsr, DetectsMissingBlockStructure)
+{
+    using Csr = typename TestFixture::Csr;
+    auto csr = gko::initialize<Csr>({{1.0, 2.0, 0.0, 0.0},
+                                     {0.0, 3.0, 0.0, 4.0},
+                                     {5.0, 0.0, 6.0, 0.0},
+                                     {0.0, 0.0, 0.0, 7.0}},
+                                    this->exec);
+
+    auto structure = gko::matrix::detect_block_structure(csr.get());
+
+    ASSERT_EQ(structure.block_size, 1);
+    ASSERT_EQ(structure.fill_ratio, 1.0);
+}
+
+
+TYPED_TEST(Fbcsr, ConvertsFromCsrWithDetectedBlockSize)
+{
+    using Csr = typename TestFixture::Csr;
+    auto csr = get_block_diagonal_csr<Csr>(this->exec, 6, 3);
+
+    auto fbcsr = gko::matrix::convert_to_fbcsr(csr.get());
+
+    ASSERT_EQ(fbcsr->get_block_size(), 6);
+    ASSERT_EQ(fbcsr->get_num_stored_blocks(), 3);
+    GKO_ASSERT_MTX_NEAR(fbcsr, csr, 0.0);
+}
+
+
+TYPED_TEST(Fbcsr, SortsByColumnIndexWithHostOnlyBlockSize)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    constexpr int bs = 6;
+    auto mtx = Mtx::create(this->exec, gko::dim<2>{bs, 2 * bs}, 2 * bs * bs,
+                           bs);
+    mtx->get_row_ptrs()[0] = 0;
+    mtx->get_row_ptrs()[1] = 2;
+    mtx->get_col_idxs()[0] = 1;
+    mtx->get_col_idxs()[1] = 0;
+    std::fill_n(mtx->get_values(), bs * bs, value_type{1.0});
+    std::fill_n(mtx->get_values() + bs * bs, bs * bs, value_type{2.0});
+
+    mtx->sort_by_column_index();
+
+    ASSERT_TRUE(mtx->is_sorted_by_column_index());
+    ASSERT_EQ(mtx->get_const_col_idxs()[0], 0);
+    ASSERT_EQ(mtx->get_const_col_idxs()[1], 1);
+    ASSERT_EQ(mtx->get_const_values()[0], value_type{2.0});
+    ASSERT_EQ(mtx->get_const_values()[bs * bs], value_type{1.0});
+}
+
+
 template <typename ValueIndexType>
 class FbcsrComplex : public ::testing::Test {
 protected:
@@ -33,6 +33,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ginkgo/core/matrix/sellp.hpp>
 
 
+#include <cmath>
+
+
 #include <gtest/gtest.h>
 
 
@@ -65,7 +68,8 @@ protected:
     Sellp()
         : exec(gko::ReferenceExecutor::create()),
           mtx1(Mtx::create(exec)),
-          mtx2(Mtx::create(exec))
+          mtx2(Mtx::create(exec)),
+          mtx3(Mtx::create(exec))
     {
         // clang-format off
         mtx1 = gko::initialize<Mtx>({{1.0, 3.0, 2.0},
@@ -73,12 +77,18 @@ protected:
         mtx2 = gko::initialize<Mtx>({{1.0, 3.0, 2.0},
                                      {0.0, 5.0, 0.0}}, exec,
                                      gko::dim<2>{}, 2, 2, 0);
+        mtx3 = gko::initialize<Mtx>({{0.0, 5.0, 0.0},
+                                     {1.0, 3.0, 2.0},
+                                     {0.0, 0.0, 4.0},
+                                     {2.0, 0.0, 1.0}}, exec,
+                                     gko::dim<2>{}, 2, 1, 4, 0);
         // clang-format on
     }
 
     std::shared_ptr<const gko::ReferenceExecutor> exec;
     std::unique_ptr<Mtx> mtx1;
     std::unique_ptr<Mtx> mtx2;
+    std::unique_ptr<Mtx> mtx3;
 };
 
 TYPED_TEST_SUITE(Sellp, gko::test::ValueIndexTypes, PairTypenameNameGenerator);
@@ -160,6 +170,39 @@ TYPED_TEST(Sellp, AppliesLinearCombinationToMixedDenseVector)
 }
 
 
+TYPED_TEST(Sellp, AppliesToMixedDenseVectorInVectorPrecision)
+{
+    using value_type = gko::next_precision<typename TestFixture::value_type>;
+    using Vec = gko::matrix::Dense<value_type>;
+    auto x = gko::initialize<Vec>({2.0, 1.0, 4.0}, this->exec);
+    // only representable if the vector has the higher precision
+    x->at(1) = static_cast<value_type>(1.0 + std::ldexp(1.0, -40));
+    auto y = Vec::create(this->exec, gko::dim<2>{2, 1});
+
+    this->mtx1->apply(x.get(), y.get());
+
+    EXPECT_EQ(y->at(0), value_type{10.0} + value_type{3.0} * x->at(1));
+    EXPECT_EQ(y->at(1), value_type{5.0} * x->at(1));
+}
+
+
+TYPED_TEST(Sellp, AppliesLinearCombinationToMixedDenseVectorInVectorPrecision)
+{
+    using value_type = gko::next_precision<typename TestFixture::value_type>;
+    using Vec = gko::matrix::Dense<value_type>;
+    auto alpha = gko::initialize<Vec>({-1.0}, this->exec);
+    auto beta = gko::initialize<Vec>({2.0}, this->exec);
+    auto x = gko::initialize<Vec>({2.0, 1.0, 4.0}, this->exec);
+    x->at(1) = static_cast<value_type>(1.0 + std::ldexp(1.0, -40));
+    auto y = gko::initialize<Vec>({1.0, 2.0}, this->exec);
+
+    this->mtx1->apply(alpha.get(), x.get(), beta.get(), y.get());
+
+    EXPECT_EQ(y->at(0), value_type{-8.0} - value_type{3.0} * x->at(1));
+    EXPECT_EQ(y->at(1), value_type{4.0} - value_type{5.0} * x->at(1));
+}
+
+
 TYPED_TEST(Sellp, AppliesLinearCombinationToDenseMatrix)
 {
     using Vec = typename TestFixture::Vec;
@@ -632,6 +675,130 @@ TYPED_TEST(Sellp, ExtractsDiagonalWithSliceSizeAndStrideFactor)
 }
 
 
+TYPED_TEST(Sellp, SortsRowsWithinSortingWindow)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Csr = typename TestFixture::Csr;
+    auto csr_mtx = Csr::create(this->exec);
+    this->mtx3->convert_to(csr_mtx.get());
+    auto unsorted = Mtx::create(this->exec, gko::dim<2>{}, 2, 1, 0);
+    csr_mtx->convert_to(unsorted.get());
+    auto perm = this->mtx3->get_const_permutation();
+
+    ASSERT_EQ(perm[0], 1);
+    ASSERT_EQ(perm[1], 3);
+    ASSERT_EQ(perm[2], 0);
+    ASSERT_EQ(perm[3], 2);
+    ASSERT_EQ(this->mtx3->get_total_cols(), 4);
+    ASSERT_EQ(unsorted->get_total_cols(), 5);
+}
+
+
+TYPED_TEST(Sellp, AppliesWithSortingWindowToDenseVector)
+{
+    using Vec = typename TestFixture::Vec;
+    auto x = gko::initialize<Vec>({2.0, 1.0, 4.0}, this->exec);
+    auto y = Vec::create(this->exec, gko::dim<2>{4, 1});
+
+    this->mtx3->apply(x.get(), y.get());
+
+    GKO_ASSERT_MTX_NEAR(y, l({5.0, 13.0, 16.0, 8.0}), 0.0);
+}
+
+
+TYPED_TEST(Sellp, AppliesLinearCombinationWithSortingWindowToDenseMatrix)
+{
+    using Vec = typename TestFixture::Vec;
+    using T = typename TestFixture::value_type;
+    auto alpha = gko::initialize<Vec>({-1.0}, this->exec);
+    auto beta = gko::initialize<Vec>({2.0}, this->exec);
+    // clang-format off
+    auto x = gko::initialize<Vec>(
+        {I<T>{2.0, 3.0},
+         I<T>{1.0, -1.0},
+         I<T>{4.0, 2.0}}, this->exec);
+    auto y = gko::initialize<Vec>(
+        {I<T>{1.0, 2.0},
+         I<T>{3.0, 4.0},
+         I<T>{5.0, 6.0},
+         I<T>{7.0, 8.0}}, this->exec);
+    // clang-format on
+
+    this->mtx3->apply(alpha.get(), x.get(), beta.get(), y.get());
+
+    // clang-format off
+    GKO_ASSERT_MTX_NEAR(y,
+                        l({{-3.0, 9.0},
+                           {-7.0, 4.0},
+                           {-6.0, 4.0},
+                           {6.0, 8.0}}), 0.0);
+    // clang-format on
+}
+
+
+TYPED_TEST(Sellp, ConvertsWithSortingWindowToDense)
+{
+    using Vec = typename TestFixture::Vec;
+    auto dense_mtx = Vec::create(this->exec);
+
+    this->mtx3->convert_to(dense_mtx.get());
+
+    // clang-format off
+    GKO_ASSERT_MTX_NEAR(dense_mtx,
+                        l({{0.0, 5.0, 0.0},
+                           {1.0, 3.0, 2.0},
+                           {0.0, 0.0, 4.0},
+                           {2.0, 0.0, 1.0}}), 0.0);
+    // clang-format on
+}
+
+
+TYPED_TEST(Sellp, ConvertsWithSortingWindowToCsr)
+{
+    using Csr = typename TestFixture::Csr;
+    auto csr_mtx = Csr::create(this->exec);
+
+    this->mtx3->convert_to(csr_mtx.get());
+
+    // clang-format off
+    GKO_ASSERT_MTX_NEAR(csr_mtx,
+                        l({{0.0, 5.0, 0.0},
+                           {1.0, 3.0, 2.0},
+                           {0.0, 0.0, 4.0},
+                           {2.0, 0.0, 1.0}}), 0.0);
+    // clang-format on
+    ASSERT_EQ(csr_mtx->get_num_stored_elements(), 7);
+}
+
+
+TYPED_TEST(Sellp, ConvertsWithSortingWindowFromCsr)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Csr = typename TestFixture::Csr;
+    auto csr_mtx = Csr::create(this->exec);
+    this->mtx3->convert_to(csr_mtx.get());
+    auto sellp_mtx = Mtx::create(this->exec, gko::dim<2>{}, 2, 1, 4, 0);
+
+    csr_mtx->convert_to(sellp_mtx.get());
+
+    GKO_ASSERT_MTX_NEAR(sellp_mtx, this->mtx3, 0.0);
+    ASSERT_EQ(sellp_mtx->get_total_cols(), 4);
+}
+
+
+TYPED_TEST(Sellp, ExtractsDiagonalWithSortingWindow)
+{
+    using T = typename TestFixture::value_type;
+    auto diag = this->mtx3->extract_diagonal();
+
+    ASSERT_EQ(diag->get_size()[0], 3);
+    ASSERT_EQ(diag->get_size()[1], 3);
+    ASSERT_EQ(diag->get_values()[0], T{0.});
+    ASSERT_EQ(diag->get_values()[1], T{3.});
+    ASSERT_EQ(diag->get_values()[2], T{4.});
+}
+
+
 TYPED_TEST(Sellp, InplaceAbsolute)
 {
     using Mtx = typename TestFixture::Mtx;
@@ -0,0 +1,353 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2022, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include <ginkgo/core/matrix/symmetric_csr.hpp>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/exception.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+
+#include "core/matrix/symmetric_csr_kernels.hpp"
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename ValueIndexType>
+class SymmetricCsr : public ::testing::Test {
+protected:
+    using value_type =
+        typename std::tuple_element<0, decltype(ValueIndexType())>::type;
+    using index_type =
+        typename std::tuple_element<1, decltype(ValueIndexType())>::type;
+    using Csr = gko::matrix::Csr<value_type, index_type>;
+    using Mtx = gko::matrix::SymmetricCsr<value_type, index_type>;
+    using Vec = gko::matrix::Dense<value_type>;
+
+    SymmetricCsr()
+        : exec(gko::ReferenceExecutor::create()),
+          csr(Csr::create(exec)),
+          mtx(Mtx::create(exec))
+    {
+        /*
+         * 4   1   0   2
+         * 1   3   0   0
+         * 0   0   0   5
+         * 2   0   5   6
+         */
+        csr->read({{4, 4},
+                   {{0, 0, 4.0},
+                    {0, 1, 1.0},
+                    {0, 3, 2.0},
+                    {1, 0, 1.0},
+                    {1, 1, 3.0},
+                    {2, 3, 5.0},
+                    {3, 0, 2.0},
+                    {3, 2, 5.0},
+                    {3, 3, 6.0}}});
+        csr->convert_to(mtx.get());
+    }
+
+    std::unique_ptr<Vec> create_rhs(gko::size_type num_rhs)
+    {
+        auto b = Vec::create(exec, gko::dim<2>{4, num_rhs});
+        for (gko::size_type j = 0; j < num_rhs; ++j) {
+            b->at(0, j) = 1.0;
+            b->at(1, j) = 2.0 - 3.0 * j;
+            b->at(2, j) = 3.0 - j;
+            b->at(3, j) = 4.0 - 4.0 * j;
+        }
+        return b;
+    }
+
+    void assert_equal_to_original_mtx(const Mtx* m)
+    {
+        auto v = m->get_const_values();
+        auto c = m->get_const_col_idxs();
+        auto r = m->get_const_row_ptrs();
+        ASSERT_EQ(m->get_size(), gko::dim<2>(4, 4));
+        ASSERT_EQ(m->get_num_stored_elements(), 6);
+        EXPECT_EQ(r[0], 0);
+        EXPECT_EQ(r[1], 3);
+        EXPECT_EQ(r[2], 4);
+        EXPECT_EQ(r[3], 5);
+        EXPECT_EQ(r[4], 6);
+        EXPECT_EQ(c[0], 0);
+        EXPECT_EQ(c[1], 1);
+        EXPECT_EQ(c[2], 3);
+        EXPECT_EQ(c[3], 1);
+        EXPECT_EQ(c[4], 3);
+        EXPECT_EQ(c[5], 3);
+        EXPECT_EQ(v[0], value_type{4.0});
+        EXPECT_EQ(v[1], value_type{1.0});
+        EXPECT_EQ(v[2], value_type{2.0});
+        EXPECT_EQ(v[3], value_type{3.0});
+        EXPECT_EQ(v[4], value_type{5.0});
+        EXPECT_EQ(v[5], value_type{6.0});
+    }
+
+    std::shared_ptr<const gko::ReferenceExecutor> exec;
+    std::unique_ptr<Csr> csr;
+    std::unique_ptr<Mtx> mtx;
+};
+
+TYPED_TEST_SUITE(SymmetricCsr, gko::test::ValueIndexTypes,
+                 PairTypenameNameGenerator);
+
+
+TYPED_TEST(SymmetricCsr, ConvertsFromCsr)
+{
+    this->assert_equal_to_original_mtx(this->mtx.get());
+}
+
+
+TYPED_TEST(SymmetricCsr, ConvertsFromUnsortedCsr)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto unsorted = this->csr->clone();
+    std::swap(unsorted->get_col_idxs()[0], unsorted->get_col_idxs()[2]);
+    std::swap(unsorted->get_values()[0], unsorted->get_values()[2]);
+    auto m = Mtx::create(this->exec);
+
+    unsorted->convert_to(m.get());
+
+    this->assert_equal_to_original_mtx(m.get());
+}
+
+
+TYPED_TEST(SymmetricCsr, IgnoresLowerTriangleOnConversion)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto modified = this->csr->clone();
+    // entries (1, 0) and (3, 2) are below the diagonal
+    modified->get_values()[3] = 7.0;
+    modified->get_values()[7] = 8.0;
+    auto m = Mtx::create(this->exec);
+
+    modified->convert_to(m.get());
+
+    this->assert_equal_to_original_mtx(m.get());
+}
+
+
+TYPED_TEST(SymmetricCsr, MovesFromCsr)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto m = Mtx::create(this->exec);
+
+    this->csr->move_to(m.get());
+
+    this->assert_equal_to_original_mtx(m.get());
+}
+
+
+TYPED_TEST(SymmetricCsr, ConvertFromRectangularCsrFails)
+{
+    using Csr = typename TestFixture::Csr;
+    using Mtx = typename TestFixture::Mtx;
+    auto csr = Csr::create(this->exec, gko::dim<2>{2, 3});
+    auto m = Mtx::create(this->exec);
+
+    ASSERT_THROW(csr->convert_to(m.get()), gko::DimensionMismatch);
+}
+
+
+TYPED_TEST(SymmetricCsr, ConvertsToCsr)
+{
+    using Csr = typename TestFixture::Csr;
+    auto result = Csr::create(this->exec);
+
+    this->mtx->convert_to(result.get());
+
+    GKO_ASSERT_MTX_NEAR(result, this->csr, 0.0);
+    ASSERT_EQ(result->get_num_stored_elements(), 9);
+    ASSERT_TRUE(result->is_sorted_by_column_index());
+}
+
+
+TYPED_TEST(SymmetricCsr, MovesToCsr)
+{
+    using Csr = typename TestFixture::Csr;
+    auto result = Csr::create(this->exec);
+
+    this->mtx->move_to(result.get());
+
+    GKO_ASSERT_MTX_NEAR(result, this->csr, 0.0);
+}
+
+
+TYPED_TEST(SymmetricCsr, AppliesToDenseVector)
+{
+    using Vec = typename TestFixture::Vec;
+    using T = typename TestFixture::value_type;
+    auto b = this->create_rhs(1);
+    auto x = Vec::create(this->exec, gko::dim<2>{4, 1});
+
+    this->mtx->apply(b.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, l<T>({14.0, 7.0, 20.0, 41.0}), 0.0);
+}
+
+
+TYPED_TEST(SymmetricCsr, AppliesToDenseMatrix)
+{
+    using Vec = typename TestFixture::Vec;
+    using T = typename TestFixture::value_type;
+    auto b = this->create_rhs(2);
+    auto x = Vec::create(this->exec, gko::dim<2>{4, 2});
+
+    this->mtx->apply(b.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(
+        x, l<T>({{14.0, 3.0}, {7.0, -2.0}, {20.0, 0.0}, {41.0, 12.0}}), 0.0);
+}
+
+
+TYPED_TEST(SymmetricCsr, AppliesLinearCombinationToDenseVector)
+{
+    using Vec = typename TestFixture::Vec;
+    using T = typename TestFixture::value_type;
+    auto alpha = gko::initialize<Vec>({-1.0}, this->exec);
+    auto beta = gko::initialize<Vec>({2.0}, this->exec);
+    auto b = this->create_rhs(1);
+    auto x = gko::initialize<Vec>({1.0, 2.0, 3.0, 4.0}, this->exec);
+
+    this->mtx->apply(alpha.get(), b.get(), beta.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, l<T>({-12.0, -3.0, -14.0, -33.0}), 0.0);
+}
+
+
+TYPED_TEST(SymmetricCsr, AppliesLikeCsr)
+{
+    using Vec = typename TestFixture::Vec;
+    auto b = this->create_rhs(3);
+    auto x = Vec::create(this->exec, gko::dim<2>{4, 3});
+    auto expected = Vec::create(this->exec, gko::dim<2>{4, 3});
+
+    this->mtx->apply(b.get(), x.get());
+    this->csr->apply(b.get(), expected.get());
+
+    GKO_ASSERT_MTX_NEAR(x, expected, 0.0);
+}
+
+
+TYPED_TEST(SymmetricCsr, ApplyFailsOnWrongInnerDimension)
+{
+    using Vec = typename TestFixture::Vec;
+    auto b = Vec::create(this->exec, gko::dim<2>{3, 1});
+    auto x = Vec::create(this->exec, gko::dim<2>{4, 1});
+
+    ASSERT_THROW(this->mtx->apply(b.get(), x.get()), gko::DimensionMismatch);
+}
+
+
+template <typename ValueIndexType>
+class SymmetricCsrComplex : public ::testing::Test {
+protected:
+    using value_type =
+        typename std::tuple_element<0, decltype(ValueIndexType())>::type;
+    using index_type =
+        typename std::tuple_element<1, decltype(ValueIndexType())>::type;
+    using Csr = gko::matrix::Csr<value_type, index_type>;
+    using Mtx = gko::matrix::SymmetricCsr<value_type, index_type>;
+    using Vec = gko::matrix::Dense<value_type>;
+
+    SymmetricCsrComplex()
+        : exec(gko::ReferenceExecutor::create()),
+          csr(Csr::create(exec)),
+          mtx(Mtx::create(exec))
+    {
+        /*
+         *  2     1+i   0
+         *  1-i   3     2i
+         *  0    -2i    1
+         */
+        csr->read({{3, 3},
+                   {{0, 0, value_type{2.0, 0.0}},
+                    {0, 1, value_type{1.0, 1.0}},
+                    {1, 0, value_type{1.0, -1.0}},
+                    {1, 1, value_type{3.0, 0.0}},
+                    {1, 2, value_type{0.0, 2.0}},
+                    {2, 1, value_type{0.0, -2.0}},
+                    {2, 2, value_type{1.0, 0.0}}}});
+        csr->convert_to(mtx.get());
+    }
+
+    std::shared_ptr<const gko::ReferenceExecutor> exec;
+    std::unique_ptr<Csr> csr;
+    std::unique_ptr<Mtx> mtx;
+};
+
+TYPED_TEST_SUITE(SymmetricCsrComplex, gko::test::ComplexValueIndexTypes,
+                 PairTypenameNameGenerator);
+
+
+TYPED_TEST(SymmetricCsrComplex, ConvertsHermitianToCsr)
+{
+    using Csr = typename TestFixture::Csr;
+    auto result = Csr::create(this->exec);
+
+    this->mtx->convert_to(result.get());
+
+    ASSERT_EQ(this->mtx->get_num_stored_elements(), 5);
+    GKO_ASSERT_MTX_NEAR(result, this->csr, 0.0);
+}
+
+
+TYPED_TEST(SymmetricCsrComplex, AppliesHermitianLikeCsr)
+{
+    using Vec = typename TestFixture::Vec;
+    using T = typename TestFixture::value_type;
+    auto b = gko::initialize<Vec>(
+        {{T{1.0, 0.0}, T{0.0, 1.0}}, {T{2.0, -1.0}, T{1.0, 0.0}},
+         {T{0.0, 3.0}, T{-1.0, 2.0}}},
+        this->exec);
+    auto x = Vec::create(this->exec, gko::dim<2>{3, 2});
+    auto expected = Vec::create(this->exec, gko::dim<2>{3, 2});
+
+    this->mtx->apply(b.get(), x.get());
+    this->csr->apply(b.get(), expected.get());
+
+    GKO_ASSERT_MTX_NEAR(x, expected, 0.0);
+}
+
+
+}  // namespace
@@ -507,6 +507,36 @@ TYPED_TEST(Pgm, AssignToExistAgg)
 }
 
 
+TYPED_TEST(Pgm, ComputeCoarseCsr)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto coarse = Mtx::create(this->exec, gko::dim<2>{2, 2});
+
+    gko::kernels::reference::pgm::compute_coarse_csr(
+        this->exec, this->mtx.get(), this->agg, coarse.get());
+
+    this->assert_same_matrices(coarse.get(), this->coarse.get());
+}
+
+
+TYPED_TEST(Pgm, ComputeCoarseCsrOnUnsortedMatrix)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto mtx_values = {-3, -3, 5, -3, -2, -1, 5, -3, -1, 5, 5, -3, -2, -2, 5};
+    auto mtx_col_idxs = {1, 2, 0, 0, 3, 4, 1, 0, 4, 2, 1, 3, 1, 2, 4};
+    auto mtx_row_ptrs = {0, 3, 7, 10, 12, 15};
+    auto matrix =
+        Mtx::create(this->exec, gko::dim<2>{5, 5}, std::move(mtx_values),
+                    std::move(mtx_col_idxs), std::move(mtx_row_ptrs));
+    auto coarse = Mtx::create(this->exec, gko::dim<2>{2, 2});
+
+    gko::kernels::reference::pgm::compute_coarse_csr(
+        this->exec, matrix.get(), this->agg, coarse.get());
+
+    this->assert_same_matrices(coarse.get(), this->coarse.get());
+}
+
+
 TYPED_TEST(Pgm, GenerateMgLevel)
 {
     using value_type = typename TestFixture::value_type;
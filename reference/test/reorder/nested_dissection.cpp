@@ -0,0 +1,230 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2022, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include <ginkgo/core/reorder/nested_dissection.hpp>
+
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/permutation.hpp>
+
+
+#include "core/factorization/symbolic.hpp"
+#include "core/test/utils.hpp"
+#include "core/test/utils/assertions.hpp"
+
+
+namespace {
+
+
+template <typename ValueIndexType>
+class NestedDissection : public ::testing::Test {
+protected:
+    using v_type =
+        typename std::tuple_element<0, decltype(ValueIndexType())>::type;
+    using i_type =
+        typename std::tuple_element<1, decltype(ValueIndexType())>::type;
+    using reorder_type = gko::reorder::NestedDissection<v_type, i_type>;
+    using CsrMtx = gko::matrix::Csr<v_type, i_type>;
+
+    NestedDissection()
+        : exec(gko::ReferenceExecutor::create()),
+          nd_factory(reorder_type::build()
+                         .with_construct_inverse_permutation(true)
+                         .with_leaf_size(8u)
+                         .on(exec)),
+          // clang-format off
+          star_mtx(gko::initialize<CsrMtx>(
+              {{1.0, 1.0, 1.0, 1.0},
+               {1.0, 1.0, 0.0, 0.0},
+               {1.0, 0.0, 1.0, 0.0},
+               {1.0, 0.0, 0.0, 1.0}}, exec)),
+          // clang-format on
+          grid_mtx(gko::share(CsrMtx::create(exec)))
+    {
+        // 5-point stencil on a 10 x 10 grid
+        const int n = 10;
+        gko::matrix_data<v_type, i_type> data{gko::dim<2>(n * n, n * n)};
+        for (int i = 0; i < n; i++) {
+            for (int j = 0; j < n; j++) {
+                const auto row = i * n + j;
+                data.nonzeros.emplace_back(row, row, 4.0);
+                if (i > 0) {
+                    data.nonzeros.emplace_back(row, row - n, -1.0);
+                }
+                if (j > 0) {
+                    data.nonzeros.emplace_back(row, row - 1, -1.0);
+                }
+                if (j < n - 1) {
+                    data.nonzeros.emplace_back(row, row + 1, -1.0);
+                }
+                if (i < n - 1) {
+                    data.nonzeros.emplace_back(row, row + n, -1.0);
+                }
+            }
+        }
+        grid_mtx->read(data);
+    }
+
+    void assert_is_permutation(const reorder_type* reorder, gko::size_type size)
+    {
+        auto perm = reorder->get_permutation()->get_const_permutation();
+        auto inv_perm =
+            reorder->get_inverse_permutation()->get_const_permutation();
+        std::vector<i_type> sorted(perm, perm + size);
+        std::sort(sorted.begin(), sorted.end());
+        for (gko::size_type i = 0; i < size; i++) {
+            ASSERT_EQ(sorted[i], static_cast<i_type>(i));
+            ASSERT_EQ(inv_perm[perm[i]], static_cast<i_type>(i));
+        }
+    }
+
+    gko::size_type fill_in(const CsrMtx* mtx)
+    {
+        return gko::factorization::symbolic_cholesky(mtx)
+            ->get_num_stored_elements();
+    }
+
+    std::shared_ptr<const gko::Executor> exec;
+    std::unique_ptr<typename reorder_type::Factory> nd_factory;
+    std::shared_ptr<CsrMtx> star_mtx;
+    std::shared_ptr<CsrMtx> grid_mtx;
+};
+
+TYPED_TEST_SUITE(NestedDissection, gko::test::ValueIndexTypes,
+                 PairTypenameNameGenerator);
+
+
+TYPED_TEST(NestedDissection, OrdersSeparatorLast)
+{
+    using reorder_type = typename TestFixture::reorder_type;
+    using CsrMtx = typename TestFixture::CsrMtx;
+    using v_type = typename TestFixture::v_type;
+    using i_type = typename TestFixture::i_type;
+    // path graph 0 - 1 - ... - 6
+    gko::matrix_data<v_type, i_type> data{gko::dim<2>(7, 7)};
+    for (int i = 0; i < 7; i++) {
+        data.nonzeros.emplace_back(i, i, 2.0);
+        if (i > 0) {
+            data.nonzeros.emplace_back(i, i - 1, -1.0);
+            data.nonzeros.emplace_back(i - 1, i, -1.0);
+        }
+    }
+    data.ensure_row_major_order();
+    auto path = gko::share(CsrMtx::create(this->exec));
+    path->read(data);
+    auto factory = reorder_type::build()
+                       .with_construct_inverse_permutation(true)
+                       .with_leaf_size(1u)
+                       .on(this->exec);
+
+    auto nd = factory->generate(path);
+
+    this->assert_is_permutation(nd.get(), 7);
+    auto perm = nd->get_permutation()->get_const_permutation();
+    // the middle vertex separates the path, then the middle of both halves
+    ASSERT_EQ(perm[6], 3);
+    ASSERT_EQ(std::max(perm[2], perm[5]), 5);
+    ASSERT_EQ(std::min(perm[2], perm[5]), 1);
+}
+
+
+TYPED_TEST(NestedDissection, OrdersComponentsIndependently)
+{
+    using reorder_type = typename TestFixture::reorder_type;
+    using CsrMtx = typename TestFixture::CsrMtx;
+    // clang-format off
+    auto mtx = gko::share(gko::initialize<CsrMtx>(
+        {{1.0, 0.0, 0.0},
+         {0.0, 1.0, 0.0},
+         {0.0, 0.0, 1.0}}, this->exec));
+    // clang-format on
+    auto factory = reorder_type::build()
+                       .with_construct_inverse_permutation(true)
+                       .with_leaf_size(1u)
+                       .on(this->exec);
+
+    auto nd = factory->generate(mtx);
+
+    this->assert_is_permutation(nd.get(), 3);
+    auto perm = nd->get_permutation()->get_const_permutation();
+    ASSERT_EQ(perm[0], 0);
+    ASSERT_EQ(perm[1], 1);
+    ASSERT_EQ(perm[2], 2);
+}
+
+
+TYPED_TEST(NestedDissection, ReducesFillIn)
+{
+    using CsrMtx = typename TestFixture::CsrMtx;
+    auto nd = this->nd_factory->generate(this->grid_mtx);
+    auto perm = nd->get_permutation_array();
+
+    auto permuted = gko::as<CsrMtx>(this->grid_mtx->permute(&perm));
+
+    this->assert_is_permutation(nd.get(), 100);
+    ASSERT_LT(this->fill_in(permuted.get()),
+              this->fill_in(this->grid_mtx.get()) * 4 / 5);
+}
+
+
+TYPED_TEST(NestedDissection, HandlesEmptyMatrix)
+{
+    using CsrMtx = typename TestFixture::CsrMtx;
+
+    auto nd = this->nd_factory->generate(CsrMtx::create(this->exec));
+
+    ASSERT_EQ(nd->get_permutation()->get_size(), gko::dim<2>{});
+}
+
+
+TYPED_TEST(NestedDissection, CanBeCleared)
+{
+    auto nd = this->nd_factory->generate(this->star_mtx);
+
+    nd->clear();
+
+    ASSERT_EQ(nd->get_permutation(), nullptr);
+    ASSERT_EQ(nd->get_inverse_permutation(), nullptr);
+}
+
+
+}  // namespace
@@ -44,6 +44,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ginkgo/core/matrix/csr.hpp>
 #include <ginkgo/core/matrix/dense.hpp>
 #include <ginkgo/core/matrix/diagonal.hpp>
+#include <ginkgo/core/reorder/amd.hpp>
+#include <ginkgo/core/reorder/nested_dissection.hpp>
 #include <ginkgo/core/reorder/rcm.hpp>
 #include <ginkgo/core/solver/bicgstab.hpp>
 #include <ginkgo/core/solver/cg.hpp>
@@ -455,6 +457,46 @@ TYPED_TEST(ScaledReordered, SolvesSingleRhsWithRcmReordering)
 }
 
 
+TYPED_TEST(ScaledReordered, SolvesSingleRhsWithAmdReordering)
+{
+    using SR = typename TestFixture::SR;
+    using Amd = gko::reorder::Amd<typename TestFixture::value_type,
+                                  typename TestFixture::index_type>;
+    auto scaled_reordered_fact =
+        SR::build()
+            .with_reordering(Amd::build().on(this->exec))
+            .with_inner_operator(this->solver_factory)
+            .on(this->exec);
+    auto scaled_reordered = scaled_reordered_fact->generate(this->rcm_mtx);
+    auto res = this->b->clone();
+
+    scaled_reordered->apply(this->b.get(), res.get());
+
+    GKO_ASSERT_MTX_NEAR(res, this->x, 15 * this->tol);
+}
+
+
+TYPED_TEST(ScaledReordered, SolvesSingleRhsWithNestedDissectionReordering)
+{
+    using SR = typename TestFixture::SR;
+    using NestedDissection =
+        gko::reorder::NestedDissection<typename TestFixture::value_type,
+                                       typename TestFixture::index_type>;
+    auto scaled_reordered_fact =
+        SR::build()
+            .with_reordering(
+                NestedDissection::build().with_leaf_size(2u).on(this->exec))
+            .with_inner_operator(this->solver_factory)
+            .on(this->exec);
+    auto scaled_reordered = scaled_reordered_fact->generate(this->rcm_mtx);
+    auto res = this->b->clone();
+
+    scaled_reordered->apply(this->b.get(), res.get());
+
+    GKO_ASSERT_MTX_NEAR(res, this->x, 15 * this->tol);
+}
+
+
 TYPED_TEST(ScaledReordered, SolvesSingleRhsWithScalingAndRcmReordering)
 {
     using SR = typename TestFixture::SR;
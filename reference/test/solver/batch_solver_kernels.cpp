@@ -0,0 +1,340 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2022, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/log/batch_convergence.hpp>
+#include <ginkgo/core/matrix/batch_csr.hpp>
+#include <ginkgo/core/matrix/batch_dense.hpp>
+#include <ginkgo/core/matrix/batch_ell.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/solver/batch_bicgstab.hpp>
+#include <ginkgo/core/solver/batch_cg.hpp>
+#include <ginkgo/core/solver/batch_gmres.hpp>
+
+
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename SolverType>
+class BatchSolver : public ::testing::Test {
+protected:
+    using Solver = SolverType;
+    using value_type = typename Solver::value_type;
+    using real_type = gko::remove_complex<value_type>;
+    using Csr = gko::matrix::BatchCsr<value_type>;
+    using Ell = gko::matrix::BatchEll<value_type>;
+    using BatchDense = gko::matrix::BatchDense<value_type>;
+    using Vec = gko::matrix::Dense<value_type>;
+    using mat_data = gko::matrix_data<value_type, gko::int32>;
+
+    BatchSolver()
+        : exec(gko::ReferenceExecutor::create()),
+          data{gen_data()},
+          mtx(Csr::create(exec)),
+          x_exact(gko::initialize<Vec>(
+              {I<value_type>{1.0, -1.0}, I<value_type>{2.0, 0.5},
+               I<value_type>{-1.0, 1.0}, I<value_type>{0.5, 3.0},
+               I<value_type>{-2.0, 1.0}, I<value_type>{1.0, 0.0},
+               I<value_type>{3.0, 1.0}, I<value_type>{0.0, -2.0},
+               I<value_type>{-1.0, 2.0}},
+              exec)),
+          b(Vec::create(exec, gko::dim<2>{9, 2})),
+          logger(gko::log::BatchConvergence<value_type>::create()),
+          factory(Solver::build()
+                      .with_max_iterations(50u)
+                      .with_tolerance(r<value_type>::value)
+                      .on(exec))
+    {
+        mtx->read(data);
+        mtx->apply(x_exact.get(), b.get());
+    }
+
+    /**
+     * Returns three tridiagonal systems, the second one is a multiple of the
+     * identity stored with the same pattern as the others. CG gets symmetric
+     * positive definite systems, the other solvers non-symmetric ones.
+     */
+    static std::vector<mat_data> gen_data()
+    {
+        const auto symmetric =
+            std::is_same<Solver, gko::solver::BatchCg<value_type>>::value;
+        const mat_data scaled_identity{{3, 3},
+                                       {{0, 0, 2.0},
+                                        {0, 1, 0.0},
+                                        {1, 0, 0.0},
+                                        {1, 1, 2.0},
+                                        {1, 2, 0.0},
+                                        {2, 1, 0.0},
+                                        {2, 2, 2.0}}};
+        if (symmetric) {
+            return {
+                mat_data{{4.0, 1.0, 0.0}, {1.0, 4.0, 1.0}, {0.0, 1.0, 4.0}},
+                scaled_identity,
+                mat_data{
+                    {3.0, -1.0, 0.0}, {-1.0, 3.0, -1.0}, {0.0, -1.0, 3.0}}};
+        }
+        return {mat_data{{4.0, 1.0, 0.0}, {2.0, 5.0, 1.0}, {0.0, -1.0, 3.0}},
+                scaled_identity,
+                mat_data{{3.0, -1.0, 0.0}, {0.5, 3.0, -1.0}, {0.0, 2.0, 3.0}}};
+    }
+
+    std::unique_ptr<Vec> solve(std::shared_ptr<const gko::LinOp> system)
+    {
+        auto x = Vec::create(exec, gko::dim<2>{9, 2});
+        x->fill(gko::zero<value_type>());
+        auto solver = factory->generate(system);
+        solver->add_logger(logger);
+        solver->apply(b.get(), x.get());
+        return x;
+    }
+
+    std::shared_ptr<const gko::ReferenceExecutor> exec;
+    std::vector<mat_data> data;
+    std::shared_ptr<Csr> mtx;
+    std::unique_ptr<Vec> x_exact;
+    std::unique_ptr<Vec> b;
+    std::shared_ptr<gko::log::BatchConvergence<value_type>> logger;
+    std::unique_ptr<typename Solver::Factory> factory;
+};
+
+using BatchSolverTypes = ::testing::Types<
+    gko::solver::BatchCg<float>, gko::solver::BatchCg<double>,
+    gko::solver::BatchCg<std::complex<float>>,
+    gko::solver::BatchCg<std::complex<double>>,
+    gko::solver::BatchBicgstab<float>, gko::solver::BatchBicgstab<double>,
+    gko::solver::BatchBicgstab<std::complex<float>>,
+    gko::solver::BatchBicgstab<std::complex<double>>,
+    gko::solver::BatchGmres<float>, gko::solver::BatchGmres<double>,
+    gko::solver::BatchGmres<std::complex<float>>,
+    gko::solver::BatchGmres<std::complex<double>>>;
+
+TYPED_TEST_SUITE(BatchSolver, BatchSolverTypes, TypenameNameGenerator);
+
+
+TYPED_TEST(BatchSolver, SolvesBatchCsrSystems)
+{
+    using value_type = typename TestFixture::value_type;
+
+    auto x = this->solve(this->mtx);
+
+    GKO_ASSERT_MTX_NEAR(x, this->x_exact, r<value_type>::value * 1e2);
+}
+
+
+TYPED_TEST(BatchSolver, SolvesBatchEllSystems)
+{
+    using value_type = typename TestFixture::value_type;
+    using Ell = typename TestFixture::Ell;
+    auto mtx = gko::share(Ell::create(this->exec));
+    mtx->read(this->data);
+
+    auto x = this->solve(mtx);
+
+    GKO_ASSERT_MTX_NEAR(x, this->x_exact, r<value_type>::value * 1e2);
+}
+
+
+TYPED_TEST(BatchSolver, SolvesBatchDenseSystems)
+{
+    using value_type = typename TestFixture::value_type;
+    using BatchDense = typename TestFixture::BatchDense;
+    auto mtx = gko::share(BatchDense::create(this->exec));
+    mtx->read(this->data);
+
+    auto x = this->solve(mtx);
+
+    GKO_ASSERT_MTX_NEAR(x, this->x_exact, r<value_type>::value * 1e2);
+}
+
+
+TYPED_TEST(BatchSolver, LogsIterationsAndResidualNormsPerSystem)
+{
+    using value_type = typename TestFixture::value_type;
+
+    this->solve(this->mtx);
+
+    const auto& num_iterations = this->logger->get_num_iterations();
+    const auto residual_norms = this->logger->get_residual_norms();
+    ASSERT_EQ(num_iterations.get_num_elems(), 6);
+    ASSERT_EQ(residual_norms->get_size(), gko::dim<2>(3, 2));
+    // the scaled identity converges in a single iteration
+    ASSERT_EQ(num_iterations.get_const_data()[2], 1);
+    ASSERT_EQ(num_iterations.get_const_data()[3], 1);
+    for (gko::size_type system = 0; system < 6; system++) {
+        ASSERT_GT(num_iterations.get_const_data()[system], 0);
+        ASSERT_LE(num_iterations.get_const_data()[system], 50);
+        ASSERT_LE(residual_norms->at(system / 2, system % 2),
+                  r<value_type>::value * 1e2);
+    }
+}
+
+
+TYPED_TEST(BatchSolver, ReusesBuffersForFewerRightHandSides)
+{
+    using value_type = typename TestFixture::value_type;
+    using Vec = typename TestFixture::Vec;
+    auto solver = this->factory->generate(this->mtx);
+    solver->add_logger(this->logger);
+    auto x = Vec::create(this->exec, gko::dim<2>{9, 2});
+    x->fill(gko::zero<value_type>());
+    solver->apply(this->b.get(), x.get());
+    auto b = this->b->create_submatrix(gko::span{0, 9}, gko::span{1, 2});
+    auto x_exact =
+        this->x_exact->create_submatrix(gko::span{0, 9}, gko::span{1, 2});
+    auto x_single = Vec::create(this->exec, gko::dim<2>{9, 1});
+    x_single->fill(gko::zero<value_type>());
+
+    solver->apply(b.get(), x_single.get());
+
+    ASSERT_EQ(this->logger->get_num_iterations().get_num_elems(), 3);
+    ASSERT_EQ(this->logger->get_residual_norms()->get_size(),
+              gko::dim<2>(3, 1));
+    GKO_ASSERT_MTX_NEAR(x_single, x_exact, r<value_type>::value * 1e2);
+}
+
+
+TYPED_TEST(BatchSolver, StopsAtMaxIterations)
+{
+    using Solver = typename TestFixture::Solver;
+    using Vec = typename TestFixture::Vec;
+    auto x = Vec::create(this->exec, gko::dim<2>{9, 2});
+    x->fill(gko::zero<typename TestFixture::value_type>());
+    auto solver =
+        Solver::build().with_max_iterations(1u).on(this->exec)->generate(
+            this->mtx);
+    solver->add_logger(this->logger);
+
+    solver->apply(this->b.get(), x.get());
+
+    const auto& num_iterations = this->logger->get_num_iterations();
+    for (gko::size_type system = 0; system < 6; system++) {
+        ASSERT_EQ(num_iterations.get_const_data()[system], 1);
+    }
+}
+
+
+TYPED_TEST(BatchSolver, UsesInitialGuess)
+{
+    using value_type = typename TestFixture::value_type;
+    auto x = this->x_exact->clone();
+    auto solver = this->factory->generate(this->mtx);
+    solver->add_logger(this->logger);
+
+    solver->apply(this->b.get(), x.get());
+
+    const auto& num_iterations = this->logger->get_num_iterations();
+    for (gko::size_type system = 0; system < 6; system++) {
+        ASSERT_EQ(num_iterations.get_const_data()[system], 0);
+    }
+    GKO_ASSERT_MTX_NEAR(x, this->x_exact, 0.0);
+}
+
+
+TYPED_TEST(BatchSolver, SolvesWithAbsoluteTolerance)
+{
+    using value_type = typename TestFixture::value_type;
+    using Solver = typename TestFixture::Solver;
+    using Vec = typename TestFixture::Vec;
+    auto x = Vec::create(this->exec, gko::dim<2>{9, 2});
+    x->fill(gko::zero<value_type>());
+    auto solver = Solver::build()
+                      .with_tolerance(r<value_type>::value * 10)
+                      .with_tolerance_type(gko::stop::mode::absolute)
+                      .on(this->exec)
+                      ->generate(this->mtx);
+
+    solver->apply(this->b.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, this->x_exact, r<value_type>::value * 1e2);
+}
+
+
+TYPED_TEST(BatchSolver, SolvesAdvancedApply)
+{
+    using value_type = typename TestFixture::value_type;
+    using Vec = typename TestFixture::Vec;
+    auto alpha = gko::initialize<Vec>({2.0}, this->exec);
+    auto beta = gko::initialize<Vec>({-1.0}, this->exec);
+    auto x = Vec::create(this->exec, gko::dim<2>{9, 2});
+    x->fill(gko::one<value_type>());
+    auto expected = this->x_exact->clone();
+    expected->scale(alpha.get());
+    expected->add_scaled(beta.get(), x.get());
+    auto solver = this->factory->generate(this->mtx);
+
+    solver->apply(alpha.get(), this->b.get(), beta.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, expected, r<value_type>::value * 1e2);
+}
+
+
+template <typename T>
+class BatchGmres : public BatchSolver<gko::solver::BatchGmres<T>> {};
+
+TYPED_TEST_SUITE(BatchGmres, gko::test::ValueTypes, TypenameNameGenerator);
+
+
+TYPED_TEST(BatchGmres, SolvesWithRestarts)
+{
+    using value_type = typename TestFixture::value_type;
+    using Solver = typename TestFixture::Solver;
+    using Vec = typename TestFixture::Vec;
+    auto x = Vec::create(this->exec, gko::dim<2>{9, 2});
+    x->fill(gko::zero<value_type>());
+    auto solver = Solver::build()
+                      .with_krylov_dim(1u)
+                      .with_max_iterations(200u)
+                      .with_tolerance(r<value_type>::value)
+                      .on(this->exec)
+                      ->generate(this->mtx);
+    solver->add_logger(this->logger);
+
+    solver->apply(this->b.get(), x.get());
+
+    ASSERT_GT(this->logger->get_num_iterations().get_const_data()[0], 3);
+    GKO_ASSERT_MTX_NEAR(x, this->x_exact, r<value_type>::value * 1e2);
+}
+
+
+}  // namespace
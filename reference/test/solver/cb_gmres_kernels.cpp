@@ -201,6 +201,23 @@ TYPED_TEST(CbGmres, SolvesStencilSystem)
 }
 
 
+TYPED_TEST(CbGmres, SolvesStencilSystemWithCgs)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto parameters = this->cb_gmres_factory->get_parameters();
+    auto solver =
+        parameters.with_orthogonalization(gko::solver::gmres::ortho_method::cgs)
+            .on(this->exec)
+            ->generate(this->mtx);
+    auto b = gko::initialize<Mtx>({13.0, 7.0, 1.0}, this->exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0}, this->exec);
+
+    solver->apply(b.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, l({1.0, 3.0, 2.0}), this->assert_precision());
+}
+
+
 TYPED_TEST(CbGmres, SolvesStencilSystemMixed)
 {
     using value_type = gko::next_precision<typename TestFixture::value_type>;
@@ -431,6 +448,27 @@ TYPED_TEST(CbGmres, SolvesBigDenseSystem1)
 }
 
 
+TYPED_TEST(CbGmres, SolvesBigDenseSystem1WithCgs2)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto parameters = this->cb_gmres_factory_big->get_parameters();
+    auto solver =
+        parameters
+            .with_orthogonalization(gko::solver::gmres::ortho_method::cgs2)
+            .on(this->exec)
+            ->generate(this->mtx_big);
+    auto b = gko::initialize<Mtx>(
+        {72748.36, 297469.88, 347229.24, 36290.66, 82958.82, -80192.15},
+        this->exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0, 0.0, 0.0, 0.0}, this->exec);
+
+    solver->apply(b.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, l({52.7, 85.4, 134.2, -250.0, -16.8, 35.3}),
+                        this->assert_precision());
+}
+
+
 TYPED_TEST(CbGmres, SolvesBigDenseSystem2)
 {
     using Mtx = typename TestFixture::Mtx;
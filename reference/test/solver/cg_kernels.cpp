@@ -38,6 +38,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <ginkgo/core/base/exception.hpp>
 #include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/log/record.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
 #include <ginkgo/core/matrix/dense.hpp>
 #include <ginkgo/core/stop/combined.hpp>
 #include <ginkgo/core/stop/iteration.hpp>
@@ -233,6 +235,57 @@ TYPED_TEST(Cg, KernelStep2)
 }
 
 
+TYPED_TEST(Cg, KernelStep2Norm)
+{
+    using value_type = typename TestFixture::value_type;
+    using NormVector = gko::matrix::Dense<gko::remove_complex<value_type>>;
+    auto residual_norm = NormVector::create(this->exec, gko::dim<2>{1, 2});
+    gko::array<char> tmp{this->exec};
+    this->small_x->fill(-2);
+    this->small_p->fill(3);
+    this->small_r->fill(4);
+    this->small_q->fill(-5);
+    this->small_rho->at(0) = 2;
+    this->small_rho->at(1) = 3;
+    this->small_beta->at(0) = 8;
+    this->small_beta->at(1) = 3;
+    this->small_stop.get_data()[1] = this->stopped;
+
+    gko::kernels::reference::cg::step_2_norm(
+        this->exec, this->small_x.get(), this->small_r.get(),
+        this->small_p.get(), this->small_q.get(), this->small_beta.get(),
+        this->small_rho.get(), this->small_prev_rho.get(), residual_norm.get(),
+        &this->small_stop, tmp);
+
+    GKO_ASSERT_MTX_NEAR(this->small_x, l({{-1.25, -2.0}, {-1.25, -2.0}}), 0);
+    GKO_ASSERT_MTX_NEAR(this->small_r, l({{5.25, 4.0}, {5.25, 4.0}}), 0);
+    GKO_ASSERT_MTX_NEAR(this->small_prev_rho, l({{55.125, 32.0}}), 0);
+    GKO_ASSERT_MTX_NEAR(residual_norm,
+                        l({{std::sqrt(55.125), std::sqrt(32.0)}}),
+                        r<value_type>::value);
+}
+
+
+TYPED_TEST(Cg, KernelSpmvConjDot)
+{
+    using value_type = typename TestFixture::value_type;
+    using Mtx = typename TestFixture::Mtx;
+    using Csr = gko::matrix::Csr<value_type, gko::int32>;
+    auto a = gko::initialize<Csr>(
+        {I<value_type>{1.0, 2.0}, I<value_type>{3.0, 4.0}}, this->exec);
+    auto p = gko::initialize<Mtx>(
+        {I<value_type>{1.0, 2.0}, I<value_type>{3.0, -1.0}}, this->exec);
+    gko::array<char> tmp{this->exec};
+
+    gko::kernels::reference::cg::spmv_conj_dot(
+        this->exec, a.get(), p.get(), this->small_q.get(),
+        this->small_beta.get(), tmp);
+
+    GKO_ASSERT_MTX_NEAR(this->small_q, l({{7.0, 0.0}, {15.0, 2.0}}), 0);
+    GKO_ASSERT_MTX_NEAR(this->small_beta, l({{52.0, -2.0}}), 0);
+}
+
+
 TYPED_TEST(Cg, KernelStep2DivByZero)
 {
     this->small_x->fill(-2);
@@ -266,6 +319,55 @@ TYPED_TEST(Cg, SolvesStencilSystem)
 }
 
 
+TYPED_TEST(Cg, SolvesStencilSystemInCsrFormat)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    using Csr = gko::matrix::Csr<value_type, gko::int64>;
+    auto csr_mtx = gko::share(Csr::create(this->exec));
+    this->mtx->convert_to(csr_mtx.get());
+    auto solver = this->cg_factory->generate(csr_mtx);
+    auto b = gko::initialize<Mtx>({-1.0, 3.0, 1.0}, this->exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0}, this->exec);
+
+    solver->apply(b.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, l({1.0, 3.0, 2.0}), r<value_type>::value);
+}
+
+
+TYPED_TEST(Cg, FusesSpmvOnlyForRowBasedCsrStrategy)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    using Csr = gko::matrix::Csr<value_type, gko::int32>;
+    auto classical_mtx = gko::share(
+        Csr::create(this->exec, std::make_shared<typename Csr::classical>()));
+    auto load_balance_mtx = gko::share(Csr::create(
+        this->exec, std::make_shared<typename Csr::load_balance>()));
+    this->mtx->convert_to(classical_mtx.get());
+    this->mtx->convert_to(load_balance_mtx.get());
+    auto classical_record = gko::share(gko::log::Record::create(
+        gko::log::Logger::linop_apply_started_mask));
+    auto load_balance_record = gko::share(gko::log::Record::create(
+        gko::log::Logger::linop_apply_started_mask));
+    classical_mtx->add_logger(classical_record);
+    load_balance_mtx->add_logger(load_balance_record);
+    auto b = gko::initialize<Mtx>({-1.0, 3.0, 1.0}, this->exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0}, this->exec);
+    auto x2 = x->clone();
+
+    this->cg_factory->generate(classical_mtx)->apply(b.get(), x.get());
+    this->cg_factory->generate(load_balance_mtx)->apply(b.get(), x2.get());
+
+    // the fused kernel replaces the apply of the system matrix
+    ASSERT_EQ(classical_record->get().linop_apply_started.size(), 0);
+    ASSERT_GT(load_balance_record->get().linop_apply_started.size(), 0);
+    GKO_ASSERT_MTX_NEAR(x, l({1.0, 3.0, 2.0}), r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(x2, l({1.0, 3.0, 2.0}), r<value_type>::value);
+}
+
+
 TYPED_TEST(Cg, SolvesStencilSystemMixed)
 {
     using value_type = gko::next_precision<typename TestFixture::value_type>;
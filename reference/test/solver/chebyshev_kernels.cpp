@@ -0,0 +1,349 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2022, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+
+#include <ginkgo/core/solver/chebyshev.hpp>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/multigrid/pgm.hpp>
+#include <ginkgo/core/preconditioner/jacobi.hpp>
+#include <ginkgo/core/solver/cg.hpp>
+#include <ginkgo/core/solver/multigrid.hpp>
+#include <ginkgo/core/stop/iteration.hpp>
+#include <ginkgo/core/stop/residual_norm.hpp>
+
+
+#include "core/solver/chebyshev_kernels.hpp"
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename T>
+class Chebyshev : public ::testing::Test {
+protected:
+    using value_type = T;
+    using Mtx = gko::matrix::Dense<value_type>;
+    using Solver = gko::solver::Chebyshev<value_type>;
+    Chebyshev()
+        : exec(gko::ReferenceExecutor::create()),
+          mtx(gko::initialize<Mtx>(
+              {{2, -1.0, 0.0}, {-1.0, 2, -1.0}, {0.0, -1.0, 2}}, exec)),
+          // Eigenvalues of mtx are 2 - sqrt(2), 2 and 2 + sqrt(2)
+          chebyshev_factory(
+              Solver::build()
+                  .with_criteria(
+                      gko::stop::Iteration::build().with_max_iters(100u).on(
+                          exec),
+                      gko::stop::ResidualNorm<value_type>::build()
+                          .with_reduction_factor(r<value_type>::value)
+                          .on(exec))
+                  .with_eigenvalue_bounds(
+                      std::make_pair(gko::remove_complex<value_type>{0.5},
+                                     gko::remove_complex<value_type>{3.5}))
+                  .on(exec))
+    {}
+
+    std::shared_ptr<const gko::ReferenceExecutor> exec;
+    std::shared_ptr<Mtx> mtx;
+    std::unique_ptr<typename Solver::Factory> chebyshev_factory;
+};
+
+TYPED_TEST_SUITE(Chebyshev, gko::test::ValueTypes, TypenameNameGenerator);
+
+
+TYPED_TEST(Chebyshev, KernelInitUpdate)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    auto inner_sol = gko::initialize<Mtx>(
+        {I<value_type>{1.0, 2.0}, I<value_type>{-2.0, 4.0}}, this->exec);
+    auto update_sol = gko::initialize<Mtx>(
+        {I<value_type>{0.0, 5.0}, I<value_type>{0.0, 5.0}}, this->exec);
+    auto x = gko::initialize<Mtx>(
+        {I<value_type>{1.0, 1.0}, I<value_type>{2.0, 2.0}}, this->exec);
+    auto stop = gko::array<gko::stopping_status>(this->exec, 2);
+    stop.get_data()[0].reset();
+    stop.get_data()[1].reset();
+    stop.get_data()[1].stop(1);
+
+    gko::kernels::reference::chebyshev::init_update(
+        this->exec, value_type{0.5}, inner_sol.get(), update_sol.get(),
+        x.get(), &stop);
+
+    GKO_ASSERT_MTX_NEAR(update_sol, l({{0.5, 5.0}, {-1.0, 5.0}}), 0.0);
+    GKO_ASSERT_MTX_NEAR(x, l({{1.5, 1.0}, {1.0, 2.0}}), 0.0);
+}
+
+
+TYPED_TEST(Chebyshev, KernelUpdate)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    auto inner_sol = gko::initialize<Mtx>(
+        {I<value_type>{1.0, 2.0}, I<value_type>{-2.0, 4.0}}, this->exec);
+    auto update_sol = gko::initialize<Mtx>(
+        {I<value_type>{2.0, 5.0}, I<value_type>{4.0, 5.0}}, this->exec);
+    auto x = gko::initialize<Mtx>(
+        {I<value_type>{1.0, 1.0}, I<value_type>{2.0, 2.0}}, this->exec);
+    auto stop = gko::array<gko::stopping_status>(this->exec, 2);
+    stop.get_data()[0].reset();
+    stop.get_data()[1].reset();
+    stop.get_data()[1].stop(1);
+
+    gko::kernels::reference::chebyshev::update(
+        this->exec, value_type{0.5}, value_type{0.25}, inner_sol.get(),
+        update_sol.get(), x.get(), &stop);
+
+    GKO_ASSERT_MTX_NEAR(update_sol, l({{1.0, 5.0}, {0.0, 5.0}}), 0.0);
+    GKO_ASSERT_MTX_NEAR(x, l({{2.0, 1.0}, {2.0, 2.0}}), 0.0);
+}
+
+
+TYPED_TEST(Chebyshev, SolvesStencilSystem)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    auto solver = this->chebyshev_factory->generate(this->mtx);
+    auto b = gko::initialize<Mtx>({-1.0, 3.0, 1.0}, this->exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0}, this->exec);
+
+    solver->apply(b.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, l({1.0, 3.0, 2.0}), r<value_type>::value * 1e1);
+}
+
+
+TYPED_TEST(Chebyshev, SolvesStencilSystemWithEstimatedBounds)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Solver = typename TestFixture::Solver;
+    using value_type = typename TestFixture::value_type;
+    auto solver =
+        Solver::build()
+            .with_criteria(
+                gko::stop::Iteration::build().with_max_iters(200u).on(
+                    this->exec),
+                gko::stop::ResidualNorm<value_type>::build()
+                    .with_reduction_factor(r<value_type>::value)
+                    .on(this->exec))
+            .on(this->exec)
+            ->generate(this->mtx);
+    auto b = gko::initialize<Mtx>({-1.0, 3.0, 1.0}, this->exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0}, this->exec);
+
+    solver->apply(b.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, l({1.0, 3.0, 2.0}), r<value_type>::value * 1e1);
+}
+
+
+TYPED_TEST(Chebyshev, SolvesMultipleStencilSystems)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    auto solver = this->chebyshev_factory->generate(this->mtx);
+    auto b = gko::initialize<Mtx>(
+        {I<value_type>{-1.0, 1.0}, I<value_type>{3.0, 0.0},
+         I<value_type>{1.0, 1.0}},
+        this->exec);
+    auto x = gko::initialize<Mtx>(
+        {I<value_type>{0.0, 0.0}, I<value_type>{0.0, 0.0},
+         I<value_type>{0.0, 0.0}},
+        this->exec);
+
+    solver->apply(b.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, l({{1.0, 1.0}, {3.0, 1.0}, {2.0, 1.0}}),
+                        r<value_type>::value * 1e1);
+}
+
+
+TYPED_TEST(Chebyshev, SolvesStencilSystemUsingAdvancedApply)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    auto solver = this->chebyshev_factory->generate(this->mtx);
+    auto alpha = gko::initialize<Mtx>({2.0}, this->exec);
+    auto beta = gko::initialize<Mtx>({-1.0}, this->exec);
+    auto b = gko::initialize<Mtx>({-1.0, 3.0, 1.0}, this->exec);
+    auto x = gko::initialize<Mtx>({0.5, 1.0, 2.0}, this->exec);
+
+    solver->apply(alpha.get(), b.get(), beta.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, l({1.5, 5.0, 2.0}), r<value_type>::value * 1e1);
+}
+
+
+TYPED_TEST(Chebyshev, SolvesStencilSystemWithJacobi)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Solver = typename TestFixture::Solver;
+    using value_type = typename TestFixture::value_type;
+    using rc_value_type = gko::remove_complex<value_type>;
+    // the Jacobi preconditioned operator has eigenvalues in [0.29, 1.71]
+    auto solver =
+        Solver::build()
+            .with_criteria(
+                gko::stop::Iteration::build().with_max_iters(100u).on(
+                    this->exec),
+                gko::stop::ResidualNorm<value_type>::build()
+                    .with_reduction_factor(r<value_type>::value)
+                    .on(this->exec))
+            .with_preconditioner(
+                gko::preconditioner::Jacobi<value_type>::build()
+                    .with_max_block_size(1u)
+                    .on(this->exec))
+            .with_eigenvalue_bounds(
+                std::make_pair(rc_value_type{0.25}, rc_value_type{1.75}))
+            .on(this->exec)
+            ->generate(this->mtx);
+    auto b = gko::initialize<Mtx>({-1.0, 3.0, 1.0}, this->exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0}, this->exec);
+
+    solver->apply(b.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, l({1.0, 3.0, 2.0}), r<value_type>::value * 1e1);
+}
+
+
+TYPED_TEST(Chebyshev, SolvesStencilSystemWithZeroInitialGuess)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    using Solver = typename TestFixture::Solver;
+    using rc_value_type = gko::remove_complex<value_type>;
+    auto solver =
+        Solver::build()
+            .with_criteria(
+                gko::stop::Iteration::build().with_max_iters(100u).on(
+                    this->exec),
+                gko::stop::ResidualNorm<value_type>::build()
+                    .with_reduction_factor(r<value_type>::value)
+                    .on(this->exec))
+            .with_eigenvalue_bounds(
+                std::make_pair(rc_value_type{0.5}, rc_value_type{3.5}))
+            .with_default_initial_guess(gko::solver::initial_guess_mode::zero)
+            .on(this->exec)
+            ->generate(this->mtx);
+    auto b = gko::initialize<Mtx>({-1.0, 3.0, 1.0}, this->exec);
+    auto x = gko::initialize<Mtx>({5.0, -7.0, 3.0}, this->exec);
+
+    solver->apply(b.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, l({1.0, 3.0, 2.0}), r<value_type>::value * 1e1);
+}
+
+
+TYPED_TEST(Chebyshev, SingleIterationScalesResidualByCenter)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Solver = typename TestFixture::Solver;
+    using value_type = typename TestFixture::value_type;
+    using rc_value_type = gko::remove_complex<value_type>;
+    auto solver =
+        Solver::build()
+            .with_criteria(
+                gko::stop::Iteration::build().with_max_iters(1u).on(
+                    this->exec))
+            .with_eigenvalue_bounds(
+                std::make_pair(rc_value_type{1.0}, rc_value_type{3.0}))
+            .on(this->exec)
+            ->generate(this->mtx);
+    auto b = gko::initialize<Mtx>({-1.0, 3.0, 1.0}, this->exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0}, this->exec);
+
+    solver->apply(b.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, l({-0.5, 1.5, 0.5}), r<value_type>::value);
+}
+
+
+TYPED_TEST(Chebyshev, CanBeUsedAsMultigridSmoother)
+{
+    using value_type = typename TestFixture::value_type;
+    using Csr = gko::matrix::Csr<value_type, gko::int32>;
+    using Mtx = typename TestFixture::Mtx;
+    using Solver = typename TestFixture::Solver;
+    auto csr = gko::share(Csr::create(this->exec));
+    this->mtx->convert_to(csr.get());
+    auto smoother = gko::share(
+        Solver::build()
+            .with_criteria(
+                gko::stop::Iteration::build().with_max_iters(2u).on(
+                    this->exec))
+            .with_preconditioner(
+                gko::preconditioner::Jacobi<value_type>::build()
+                    .with_max_block_size(1u)
+                    .on(this->exec))
+            .on(this->exec));
+    auto solver =
+        gko::solver::Multigrid::build()
+            .with_mg_level(gko::multigrid::Pgm<value_type, gko::int32>::build()
+                               .with_max_iterations(2u)
+                               .with_max_unassigned_ratio(0.1)
+                               .on(this->exec))
+            .with_pre_smoother(smoother)
+            .with_post_uses_pre(true)
+            .with_coarsest_solver(
+                gko::solver::Cg<value_type>::build()
+                    .with_criteria(
+                        gko::stop::Iteration::build().with_max_iters(4u).on(
+                            this->exec))
+                    .on(this->exec))
+            .with_max_levels(2u)
+            .with_min_coarse_rows(1u)
+            .with_criteria(
+                gko::stop::Iteration::build().with_max_iters(100u).on(
+                    this->exec),
+                gko::stop::ResidualNorm<value_type>::build()
+                    .with_reduction_factor(r<value_type>::value)
+                    .on(this->exec))
+            .on(this->exec)
+            ->generate(csr);
+    auto b = gko::initialize<Mtx>({-1.0, 3.0, 1.0}, this->exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0}, this->exec);
+
+    solver->apply(b.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, l({1.0, 3.0, 2.0}), r<value_type>::value * 1e1);
+}
+
+
+}  // namespace
@@ -406,6 +406,56 @@ TYPED_TEST(Gmres, KernelMultiAxpy)
 }
 
 
+TYPED_TEST(Gmres, KernelMultiDot)
+{
+    using T = typename TestFixture::value_type;
+    using Mtx = typename TestFixture::Mtx;
+    auto bases = gko::initialize<Mtx>(  // 2 x rows x #rhs
+        {I<T>{1, 2}, I<T>{0, 1}, I<T>{2, 0}, I<T>{1, 0}, I<T>{1, 1},
+         I<T>{0, 1}},
+        this->exec);
+    auto block = gko::initialize<Mtx>(  // 2 x rows x #rhs
+        {I<T>{2, 1}, I<T>{1, 0}, I<T>{0, 3}, I<T>{1, 1}, I<T>{1, 1},
+         I<T>{1, 1}},
+        this->exec);
+    auto result = Mtx::create(this->exec, gko::dim<2>{2, 4});
+    gko::array<char> tmp{this->exec};
+
+    gko::kernels::reference::gmres::multi_dot(this->exec, bases.get(),
+                                              block.get(), result.get(), tmp);
+
+    GKO_ASSERT_MTX_NEAR(result, l({{2., 2., 3., 3.}, {3., 3., 2., 2.}}), 0);
+}
+
+
+TYPED_TEST(Gmres, KernelMultiUpdate)
+{
+    using T = typename TestFixture::value_type;
+    using Mtx = typename TestFixture::Mtx;
+    auto bases = gko::initialize<Mtx>({I<T>{1, 2}, I<T>{0, 1}, I<T>{2, 0}},
+                                      this->exec);
+    auto coeffs = gko::initialize<Mtx>({I<T>{1, 0, 0, 2}}, this->exec);
+    auto triangular = gko::initialize<Mtx>(
+        {I<T>{2, 1, 1, 0}, I<T>{0, 0, 3, 1}}, this->exec);
+    auto block = gko::initialize<Mtx>(  // 2 x rows x #rhs
+        {I<T>{2, 1}, I<T>{1, 0}, I<T>{0, 3}, I<T>{1, 1}, I<T>{1, 1},
+         I<T>{1, 1}},
+        this->exec);
+
+    gko::kernels::reference::gmres::multi_update(
+        this->exec, bases.get(), coeffs.get(), triangular.get(), block.get());
+
+    GKO_ASSERT_MTX_NEAR(block,
+                        l({{3., 1.},
+                           {2., 0.},
+                           {-2., 3.},
+                           {5., -3.},
+                           {4., -1.},
+                           {3., 1.}}),
+                        0);
+}
+
+
 TYPED_TEST(Gmres, SolvesStencilSystem)
 {
     using Mtx = typename TestFixture::Mtx;
@@ -757,6 +807,263 @@ TYPED_TEST(Gmres, SolvesBigDenseSystem1WithRestart)
 }
 
 
+TYPED_TEST(Gmres, SolvesBigDenseSystem1WithSStep)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Solver = typename TestFixture::Solver;
+    using value_type = typename TestFixture::value_type;
+    auto gmres_factory_s_step =
+        Solver::build()
+            .with_s_step(3u)
+            .with_criteria(
+                gko::stop::Iteration::build().with_max_iters(100u).on(
+                    this->exec),
+                gko::stop::ResidualNorm<value_type>::build()
+                    .with_reduction_factor(r<value_type>::value)
+                    .on(this->exec))
+            .on(this->exec);
+    auto solver = gmres_factory_s_step->generate(this->mtx_big);
+    auto b = gko::initialize<Mtx>(
+        {72748.36, 297469.88, 347229.24, 36290.66, 82958.82, -80192.15},
+        this->exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0, 0.0, 0.0, 0.0}, this->exec);
+
+    solver->apply(b.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, l({52.7, 85.4, 134.2, -250.0, -16.8, 35.3}),
+                        r<value_type>::value * 1e3);
+}
+
+
+TYPED_TEST(Gmres, SolvesMultipleStencilSystemsWithSStep)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Solver = typename TestFixture::Solver;
+    using value_type = typename TestFixture::value_type;
+    using T = value_type;
+    auto gmres_factory_s_step =
+        Solver::build()
+            .with_s_step(2u)
+            .with_criteria(
+                gko::stop::Iteration::build().with_max_iters(100u).on(
+                    this->exec),
+                gko::stop::ResidualNorm<value_type>::build()
+                    .with_reduction_factor(r<value_type>::value)
+                    .on(this->exec))
+            .on(this->exec);
+    auto solver = gmres_factory_s_step->generate(this->mtx);
+    auto b = gko::initialize<Mtx>(
+        {I<T>{13.0, 6.0}, I<T>{7.0, 4.0}, I<T>{1.0, 1.0}}, this->exec);
+    auto x = gko::initialize<Mtx>(
+        {I<T>{0.0, 0.0}, I<T>{0.0, 0.0}, I<T>{0.0, 0.0}}, this->exec);
+
+    solver->apply(b.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, l({{1.0, 1.0}, {3.0, 1.0}, {2.0, 1.0}}),
+                        r<value_type>::value * 1e1);
+}
+
+
+TYPED_TEST(Gmres, SolvesBigDenseSystem1WithSStepAndRestart)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Solver = typename TestFixture::Solver;
+    using value_type = typename TestFixture::value_type;
+    auto half_tol = std::sqrt(r<value_type>::value);
+    auto gmres_factory_restart =
+        Solver::build()
+            .with_krylov_dim(4u)
+            .with_s_step(3u)
+            .with_criteria(
+                gko::stop::Iteration::build().with_max_iters(200u).on(
+                    this->exec),
+                gko::stop::ResidualNorm<value_type>::build()
+                    .with_reduction_factor(r<value_type>::value)
+                    .on(this->exec))
+            .on(this->exec);
+    auto solver = gmres_factory_restart->generate(this->mtx_medium);
+    auto b = gko::initialize<Mtx>(
+        {-13945.16, 11205.66, 16132.96, 24342.18, -10910.98}, this->exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0, 0.0, 0.0}, this->exec);
+
+    solver->apply(b.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, l({-140.20, -142.20, 48.80, -17.70, -19.60}),
+                        half_tol * 1e2);
+}
+
+
+TYPED_TEST(Gmres, SolvesBigDenseSystem1WithCgs)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Solver = typename TestFixture::Solver;
+    using value_type = typename TestFixture::value_type;
+    auto solver =
+        Solver::build()
+            .with_orthogonalization(gko::solver::gmres::ortho_method::cgs)
+            .with_criteria(
+                gko::stop::Iteration::build().with_max_iters(100u).on(
+                    this->exec),
+                gko::stop::ResidualNorm<value_type>::build()
+                    .with_reduction_factor(r<value_type>::value)
+                    .on(this->exec))
+            .on(this->exec)
+            ->generate(this->mtx_big);
+    auto b = gko::initialize<Mtx>(
+        {72748.36, 297469.88, 347229.24, 36290.66, 82958.82, -80192.15},
+        this->exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0, 0.0, 0.0, 0.0}, this->exec);
+
+    solver->apply(b.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, l({52.7, 85.4, 134.2, -250.0, -16.8, 35.3}),
+                        r<value_type>::value * 1e3);
+}
+
+
+TYPED_TEST(Gmres, SolvesBigDenseSystem1WithCgs2)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Solver = typename TestFixture::Solver;
+    using value_type = typename TestFixture::value_type;
+    auto solver =
+        Solver::build()
+            .with_orthogonalization(gko::solver::gmres::ortho_method::cgs2)
+            .with_criteria(
+                gko::stop::Iteration::build().with_max_iters(100u).on(
+                    this->exec),
+                gko::stop::ResidualNorm<value_type>::build()
+                    .with_reduction_factor(r<value_type>::value)
+                    .on(this->exec))
+            .on(this->exec)
+            ->generate(this->mtx_big);
+    auto b = gko::initialize<Mtx>(
+        {72748.36, 297469.88, 347229.24, 36290.66, 82958.82, -80192.15},
+        this->exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0, 0.0, 0.0, 0.0}, this->exec);
+
+    solver->apply(b.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, l({52.7, 85.4, 134.2, -250.0, -16.8, 35.3}),
+                        r<value_type>::value * 1e3);
+}
+
+
+TYPED_TEST(Gmres, SolvesBigDenseSystem1WithConditionalCgs)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Solver = typename TestFixture::Solver;
+    using value_type = typename TestFixture::value_type;
+    auto solver =
+        Solver::build()
+            .with_orthogonalization(
+                gko::solver::gmres::ortho_method::cgs_conditional)
+            .with_criteria(
+                gko::stop::Iteration::build().with_max_iters(100u).on(
+                    this->exec),
+                gko::stop::ResidualNorm<value_type>::build()
+                    .with_reduction_factor(r<value_type>::value)
+                    .on(this->exec))
+            .on(this->exec)
+            ->generate(this->mtx_big);
+    auto b = gko::initialize<Mtx>(
+        {72748.36, 297469.88, 347229.24, 36290.66, 82958.82, -80192.15},
+        this->exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0, 0.0, 0.0, 0.0}, this->exec);
+
+    solver->apply(b.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, l({52.7, 85.4, 134.2, -250.0, -16.8, 35.3}),
+                        r<value_type>::value * 1e3);
+}
+
+
+TYPED_TEST(Gmres, SolvesBigDenseSystem1WithDcgs2)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Solver = typename TestFixture::Solver;
+    using value_type = typename TestFixture::value_type;
+    auto solver =
+        Solver::build()
+            .with_orthogonalization(gko::solver::gmres::ortho_method::dcgs2)
+            .with_criteria(
+                gko::stop::Iteration::build().with_max_iters(100u).on(
+                    this->exec),
+                gko::stop::ResidualNorm<value_type>::build()
+                    .with_reduction_factor(r<value_type>::value)
+                    .on(this->exec))
+            .on(this->exec)
+            ->generate(this->mtx_big);
+    auto b = gko::initialize<Mtx>(
+        {72748.36, 297469.88, 347229.24, 36290.66, 82958.82, -80192.15},
+        this->exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0, 0.0, 0.0, 0.0}, this->exec);
+
+    solver->apply(b.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, l({52.7, 85.4, 134.2, -250.0, -16.8, 35.3}),
+                        r<value_type>::value * 1e3);
+}
+
+
+TYPED_TEST(Gmres, SolvesMultipleStencilSystemsWithDcgs2)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Solver = typename TestFixture::Solver;
+    using value_type = typename TestFixture::value_type;
+    using T = value_type;
+    auto solver =
+        Solver::build()
+            .with_orthogonalization(gko::solver::gmres::ortho_method::dcgs2)
+            .with_criteria(
+                gko::stop::Iteration::build().with_max_iters(100u).on(
+                    this->exec),
+                gko::stop::ResidualNorm<value_type>::build()
+                    .with_reduction_factor(r<value_type>::value)
+                    .on(this->exec))
+            .on(this->exec)
+            ->generate(this->mtx);
+    auto b = gko::initialize<Mtx>(
+        {I<T>{13.0, 6.0}, I<T>{7.0, 4.0}, I<T>{1.0, 1.0}}, this->exec);
+    auto x = gko::initialize<Mtx>(
+        {I<T>{0.0, 0.0}, I<T>{0.0, 0.0}, I<T>{0.0, 0.0}}, this->exec);
+
+    solver->apply(b.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, l({{1.0, 1.0}, {3.0, 1.0}, {2.0, 1.0}}),
+                        r<value_type>::value * 1e1);
+}
+
+
+TYPED_TEST(Gmres, SolvesBigDenseSystem1WithDcgs2AndRestart)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Solver = typename TestFixture::Solver;
+    using value_type = typename TestFixture::value_type;
+    auto half_tol = std::sqrt(r<value_type>::value);
+    auto solver =
+        Solver::build()
+            .with_krylov_dim(4u)
+            .with_orthogonalization(gko::solver::gmres::ortho_method::dcgs2)
+            .with_criteria(
+                gko::stop::Iteration::build().with_max_iters(200u).on(
+                    this->exec),
+                gko::stop::ResidualNorm<value_type>::build()
+                    .with_reduction_factor(r<value_type>::value)
+                    .on(this->exec))
+            .on(this->exec)
+            ->generate(this->mtx_medium);
+    auto b = gko::initialize<Mtx>(
+        {-13945.16, 11205.66, 16132.96, 24342.18, -10910.98}, this->exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0, 0.0, 0.0}, this->exec);
+
+    solver->apply(b.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, l({-140.20, -142.20, 48.80, -17.70, -19.60}),
+                        half_tol * 1e2);
+}
+
+
 TYPED_TEST(Gmres, SolvesWithPreconditioner)
 {
     using Mtx = typename TestFixture::Mtx;
@@ -36,11 +36,17 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <algorithm>
 #include <fstream>
 #include <memory>
+#include <vector>
 
 
 #include <gtest/gtest.h>
 
 
+#ifdef GKO_COMPILING_OMP
+#include <omp.h>
+#endif
+
+
 #include <ginkgo/core/base/array.hpp>
 #include <ginkgo/core/base/exception.hpp>
 #include <ginkgo/core/base/types.hpp>
@@ -119,6 +125,53 @@ protected:
         dmtx_lu_sparsity->copy_from(mtx_lu_sparsity.get());
     }
 
+    // independent chains coupled by a few trailing rows, so the factor has
+    // many rows per level and one level per chain row and coupling row
+    void initialize_multilevel_data()
+    {
+        const index_type num_chains = 8;
+        const index_type chain_length = 40;
+        const index_type num_coupling = 8;
+        const auto first_coupling = num_chains * chain_length;
+        const auto size = first_coupling + num_coupling;
+        gko::matrix_data<value_type, index_type> data{gko::dim<2>(size, size)};
+        std::vector<double> diag(size, 1.0);
+        const auto add_pair = [&](index_type row, index_type col) {
+            data.nonzeros.emplace_back(row, col, -1.0);
+            data.nonzeros.emplace_back(col, row, -0.5);
+            diag[row] += 1.0;
+            diag[col] += 0.5;
+        };
+        for (index_type chain = 0; chain < num_chains; chain++) {
+            for (index_type i = 0; i < chain_length; i++) {
+                const auto row = chain * chain_length + i;
+                for (index_type offset : {1, 2}) {
+                    if (i + offset < chain_length) {
+                        add_pair(row, row + offset);
+                    }
+                }
+                if (i % 5 == 0) {
+                    for (index_type c = 0; c < num_coupling; c++) {
+                        add_pair(row, first_coupling + c);
+                    }
+                }
+            }
+        }
+        for (index_type c = 0; c < num_coupling; c++) {
+            for (index_type c2 = c + 1; c2 < num_coupling; c2++) {
+                add_pair(first_coupling + c, first_coupling + c2);
+            }
+        }
+        for (index_type row = 0; row < size; row++) {
+            data.nonzeros.emplace_back(row, row, diag[row]);
+        }
+        data.ensure_row_major_order();
+        mtx = gko::share(matrix_type::create(ref));
+        mtx->read(data);
+        dmtx = gko::clone(exec, mtx);
+        num_rows = size;
+    }
+
     gko::size_type num_rows;
     std::shared_ptr<matrix_type> mtx;
     std::shared_ptr<matrix_type> mtx_lu;
@@ -320,6 +373,37 @@ TYPED_TEST(Lu, GenerateSymmWithUnknownSparsityAmdIsEquivalentToRef)
 }
 
 
+TYPED_TEST(Lu, GenerateMultiLevelIsEquivalentToRef)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    this->initialize_multilevel_data();
+    auto factory =
+        gko::experimental::factorization::Lu<value_type, index_type>::build()
+            .with_symmetric_sparsity(true)
+            .on(this->ref);
+    auto dfactory =
+        gko::experimental::factorization::Lu<value_type, index_type>::build()
+            .with_symmetric_sparsity(true)
+            .on(this->exec);
+#ifdef GKO_COMPILING_OMP
+    // the rows are only scheduled by levels with more than one thread
+    const auto num_threads = omp_get_max_threads();
+    omp_set_num_threads(4);
+#endif
+
+    auto lu = factory->generate(this->mtx);
+    auto dlu = dfactory->generate(this->dmtx);
+
+#ifdef GKO_COMPILING_OMP
+    omp_set_num_threads(num_threads);
+#endif
+    GKO_ASSERT_MTX_EQ_SPARSITY(lu->get_combined(), dlu->get_combined());
+    GKO_ASSERT_MTX_NEAR(lu->get_combined(), dlu->get_combined(),
+                        r<value_type>::value);
+}
+
+
 TYPED_TEST(Lu, GenerateWithKnownSparsityIsEquivalentToRef)
 {
     using value_type = typename TestFixture::value_type;
@@ -0,0 +1,163 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2022, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#include <ginkgo/core/matrix/batch_ell.hpp>
+
+
+#include <random>
+#include <vector>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+
+#include "core/test/utils.hpp"
+#include "test/utils/executor.hpp"
+
+
+class BatchEll : public CommonTestFixture {
+protected:
+    using Mtx = gko::matrix::BatchEll<value_type, index_type>;
+    using Vec = gko::matrix::Dense<value_type>;
+    using mat_data = gko::matrix_data<value_type, index_type>;
+
+    BatchEll() : rand_engine(42) {}
+
+    std::vector<mat_data> gen_batch_data(gko::size_type num_items,
+                                         gko::size_type num_rows,
+                                         gko::size_type num_cols)
+    {
+        // all items share the sparsity pattern of the first one
+        auto pattern =
+            gko::test::generate_random_matrix_data<value_type, index_type>(
+                num_rows, num_cols, std::uniform_int_distribution<>(0, 10),
+                std::normal_distribution<>(-1.0, 1.0), rand_engine);
+        std::normal_distribution<> value_dist(-1.0, 1.0);
+        std::vector<mat_data> data(num_items, pattern);
+        for (auto& item : data) {
+            for (auto& entry : item.nonzeros) {
+                entry.value = gko::test::detail::get_rand_value<value_type>(
+                    value_dist, rand_engine);
+            }
+        }
+        return data;
+    }
+
+    std::unique_ptr<Vec> gen_vec(gko::size_type num_rows,
+                                 gko::size_type num_cols)
+    {
+        return gko::test::generate_random_matrix<Vec>(
+            num_rows, num_cols,
+            std::uniform_int_distribution<>(num_cols, num_cols),
+            std::normal_distribution<>(-1.0, 1.0), rand_engine, ref);
+    }
+
+    void set_up_apply_data(gko::size_type num_rhs)
+    {
+        const gko::size_type num_items = 7;
+        const gko::size_type num_rows = 47;
+        const gko::size_type num_cols = 31;
+        mtx = Mtx::create(ref);
+        mtx->read(gen_batch_data(num_items, num_rows, num_cols));
+        b = gen_vec(num_items * num_cols, num_rhs);
+        x = gen_vec(num_items * num_rows, num_rhs);
+        alpha = gko::initialize<Vec>({2.0}, ref);
+        beta = gko::initialize<Vec>({-1.0}, ref);
+        dmtx = gko::clone(exec, mtx);
+        db = gko::clone(exec, b);
+        dx = gko::clone(exec, x);
+        dalpha = gko::clone(exec, alpha);
+        dbeta = gko::clone(exec, beta);
+    }
+
+    std::default_random_engine rand_engine;
+
+    std::unique_ptr<Mtx> mtx;
+    std::unique_ptr<Vec> b;
+    std::unique_ptr<Vec> x;
+    std::unique_ptr<Vec> alpha;
+    std::unique_ptr<Vec> beta;
+
+    std::unique_ptr<Mtx> dmtx;
+    std::unique_ptr<Vec> db;
+    std::unique_ptr<Vec> dx;
+    std::unique_ptr<Vec> dalpha;
+    std::unique_ptr<Vec> dbeta;
+};
+
+
+TEST_F(BatchEll, SimpleApplyIsEquivalentToRef)
+{
+    set_up_apply_data(1);
+
+    mtx->apply(b.get(), x.get());
+    dmtx->apply(db.get(), dx.get());
+
+    GKO_ASSERT_MTX_NEAR(dx, x, r<value_type>::value);
+}
+
+
+TEST_F(BatchEll, SimpleApplyToMultipleVectorsIsEquivalentToRef)
+{
+    set_up_apply_data(3);
+
+    mtx->apply(b.get(), x.get());
+    dmtx->apply(db.get(), dx.get());
+
+    GKO_ASSERT_MTX_NEAR(dx, x, r<value_type>::value);
+}
+
+
+TEST_F(BatchEll, AdvancedApplyIsEquivalentToRef)
+{
+    set_up_apply_data(1);
+
+    mtx->apply(alpha.get(), b.get(), beta.get(), x.get());
+    dmtx->apply(dalpha.get(), db.get(), dbeta.get(), dx.get());
+
+    GKO_ASSERT_MTX_NEAR(dx, x, r<value_type>::value);
+}
+
+
+TEST_F(BatchEll, AdvancedApplyToMultipleVectorsIsEquivalentToRef)
+{
+    set_up_apply_data(3);
+
+    mtx->apply(alpha.get(), b.get(), beta.get(), x.get());
+    dmtx->apply(dalpha.get(), db.get(), dbeta.get(), dx.get());
+
+    GKO_ASSERT_MTX_NEAR(dx, x, r<value_type>::value);
+}
@@ -43,6 +43,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ginkgo/core/base/exception.hpp>
 #include <ginkgo/core/base/executor.hpp>
 #include <ginkgo/core/matrix/coo.hpp>
+#include <ginkgo/core/matrix/csr_spgemm_plan.hpp>
 #include <ginkgo/core/matrix/dense.hpp>
 #include <ginkgo/core/matrix/diagonal.hpp>
 #include <ginkgo/core/matrix/ell.hpp>
@@ -105,11 +106,7 @@ protected:
     template <typename Mtx>
     void set_up_strategy(std::shared_ptr<typename Mtx::automatical>& strategy)
     {
-#ifdef GKO_COMPILING_OMP
-        throw std::runtime_error{"We shouldn't be testing this"};
-#else
         strategy = std::make_shared<typename Mtx::automatical>(exec);
-#endif
     }
 
     template <typename Mtx>
@@ -121,11 +118,7 @@ protected:
     template <typename Mtx>
     void set_up_strategy(std::shared_ptr<typename Mtx::load_balance>& strategy)
     {
-#ifdef GKO_COMPILING_OMP
-        throw std::runtime_error{"We shouldn't be testing this"};
-#else
         strategy = std::make_shared<typename Mtx::load_balance>(exec);
-#endif
     }
 
     template <typename Mtx>
@@ -185,6 +178,60 @@ protected:
         complex_dmtx->copy_from(complex_mtx.get());
     }
 
+    template <typename StrategyType>
+    void assert_apply_is_equivalent_to_ref(
+        const gko::matrix_data<value_type, index_type>& data)
+    {
+        std::shared_ptr<StrategyType> strategy;
+        set_up_strategy<Mtx>(strategy);
+        auto mtx = Mtx::create(ref, strategy);
+        mtx->read(data);
+        auto dmtx = Mtx::create(exec, strategy);
+        dmtx->copy_from(mtx.get());
+        auto alpha = gko::initialize<Vec>({2.0}, ref);
+        auto beta = gko::initialize<Vec>({-1.0}, ref);
+        auto dalpha = gko::clone(exec, alpha);
+        auto dbeta = gko::clone(exec, beta);
+        for (int num_vectors : {1, 3}) {
+            auto y = gen_mtx<Vec>(data.size[1], num_vectors, num_vectors);
+            auto dy = gko::clone(exec, y);
+            // the initial values make sure every row of the result is written
+            auto result =
+                Vec::create(ref, gko::dim<2>(data.size[0], num_vectors));
+            result->fill(42.0);
+            auto dresult = gko::clone(exec, result);
+            auto advanced_result = gko::clone(result);
+            auto advanced_dresult = gko::clone(exec, result);
+
+            mtx->apply(y.get(), result.get());
+            dmtx->apply(dy.get(), dresult.get());
+            mtx->apply(alpha.get(), y.get(), beta.get(),
+                       advanced_result.get());
+            dmtx->apply(dalpha.get(), dy.get(), dbeta.get(),
+                        advanced_dresult.get());
+
+            GKO_ASSERT_MTX_NEAR(dresult, result, r<value_type>::value);
+            GKO_ASSERT_MTX_NEAR(advanced_dresult, advanced_result,
+                                r<value_type>::value);
+        }
+    }
+
+    gko::matrix_data<value_type, index_type> gen_empty_rows_data(
+        index_type num_leading_empty, index_type num_trailing_empty)
+    {
+        const index_type size = 1000;
+        gko::matrix_data<value_type, index_type> data{gko::dim<2>(size, size)};
+        for (index_type row = num_leading_empty;
+             row < size - num_trailing_empty; row++) {
+            for (index_type k = 0; k <= row % 7; k++) {
+                data.nonzeros.emplace_back(row, (row + 31 * k) % size,
+                                           1.0 + k);
+            }
+        }
+        data.ensure_row_major_order();
+        return data;
+    }
+
     void unsort_mtx()
     {
         gko::test::unsort_matrix(mtx.get(), rand_engine);
@@ -281,8 +328,70 @@ TEST_F(Csr, AdvancedApplyToDenseMatrixIsEquivalentToRefWithClassical)
 }
 
 
-// OpenMP doesn't have strategies
-#ifndef GKO_COMPILING_OMP
+TEST_F(Csr, SimpleApplyToManyVectorsIsEquivalentToRefWithClassical)
+{
+    for (auto num_vectors : {4, 7, 33}) {
+        SCOPED_TRACE(num_vectors);
+        set_up_apply_data<Mtx::classical>(num_vectors);
+
+        mtx->apply(y.get(), expected.get());
+        dmtx->apply(dy.get(), dresult.get());
+
+        GKO_ASSERT_MTX_NEAR(dresult, expected, r<value_type>::value);
+    }
+}
+
+
+TEST_F(Csr, AdvancedApplyToManyVectorsIsEquivalentToRefWithClassical)
+{
+    for (auto num_vectors : {4, 7, 33}) {
+        SCOPED_TRACE(num_vectors);
+        set_up_apply_data<Mtx::classical>(num_vectors);
+
+        mtx->apply(alpha.get(), y.get(), beta.get(), expected.get());
+        dmtx->apply(dalpha.get(), dy.get(), dbeta.get(), dresult.get());
+
+        GKO_ASSERT_MTX_NEAR(dresult, expected, r<value_type>::value);
+    }
+}
+
+
+TEST_F(Csr, SimpleApplyInReducedPrecisionIsEquivalentToRef)
+{
+    using MixedMtx = gko::matrix::Csr<gko::next_precision<value_type>>;
+    for (auto num_vectors : {1, 3, 7, 33}) {
+        SCOPED_TRACE(num_vectors);
+        set_up_apply_data<Mtx::load_balance>(num_vectors);
+        auto mixed_mtx = MixedMtx::create(ref);
+        mtx->convert_to(mixed_mtx.get());
+        auto dmixed_mtx = gko::clone(exec, mixed_mtx);
+
+        mixed_mtx->apply(y.get(), expected.get());
+        dmixed_mtx->apply(dy.get(), dresult.get());
+
+        GKO_ASSERT_MTX_NEAR(dresult, expected,
+                            r<gko::next_precision<value_type>>::value);
+    }
+}
+
+
+TEST_F(Csr, AdvancedApplyInReducedPrecisionIsEquivalentToRef)
+{
+    using MixedMtx = gko::matrix::Csr<gko::next_precision<value_type>>;
+    for (auto num_vectors : {1, 3, 7, 33}) {
+        SCOPED_TRACE(num_vectors);
+        set_up_apply_data<Mtx::load_balance>(num_vectors);
+        auto mixed_mtx = MixedMtx::create(ref);
+        mtx->convert_to(mixed_mtx.get());
+        auto dmixed_mtx = gko::clone(exec, mixed_mtx);
+
+        mixed_mtx->apply(alpha.get(), y.get(), beta.get(), expected.get());
+        dmixed_mtx->apply(dalpha.get(), dy.get(), dbeta.get(), dresult.get());
+
+        GKO_ASSERT_MTX_NEAR(dresult, expected,
+                            r<gko::next_precision<value_type>>::value);
+    }
+}
 
 
 TEST_F(Csr, SimpleApplyIsEquivalentToRefWithLoadBalance)
@@ -462,6 +571,8 @@ TEST_F(Csr, OneAutomaticalWorksWithDifferentMatrices)
 #elif defined(GKO_COMPILING_HIP)
     auto row_len_limit = std::max(automatical->nvidia_row_len_limit,
                                   automatical->amd_row_len_limit);
+#elif defined(GKO_COMPILING_OMP)
+    auto row_len_limit = automatical->omp_row_len_limit;
 #else
     auto row_len_limit = automatical->intel_row_len_limit;
 #endif
@@ -481,7 +592,81 @@ TEST_F(Csr, OneAutomaticalWorksWithDifferentMatrices)
 }
 
 
-#endif
+#ifdef GKO_COMPILING_OMP
+
+
+TEST_F(Csr, AutomaticalUsesMergePathForImbalancedShortRows)
+{
+    auto automatical = std::make_shared<Mtx::automatical>(exec);
+    // many empty rows followed by a few dense ones
+    const auto num_rows = automatical->omp_nnz_limit;
+    auto data = gko::matrix_data<value_type, index_type>{
+        gko::dim<2>(num_rows, num_rows)};
+    for (index_type row = num_rows - 50; row < num_rows; row++) {
+        for (index_type col = 0; col <= automatical->omp_row_len_limit; col++) {
+            data.nonzeros.emplace_back(row, col, 1.0);
+        }
+    }
+    auto mtx = Mtx::create(ref);
+    mtx->read(data);
+    auto dmtx = gko::clone(exec, mtx);
+    auto y = gen_mtx<Vec>(num_rows, 2, 1);
+    auto dy = gko::clone(exec, y);
+    auto result = Vec::create(ref, gko::dim<2>(num_rows, 2));
+    auto dresult = Vec::create(exec, gko::dim<2>(num_rows, 2));
+
+    dmtx->set_strategy(automatical);
+    mtx->apply(y.get(), result.get());
+    dmtx->apply(dy.get(), dresult.get());
+
+    EXPECT_EQ("merge_path", dmtx->get_strategy()->get_name());
+    GKO_ASSERT_MTX_NEAR(dresult, result, r<value_type>::value);
+}
+
+
+#endif  // GKO_COMPILING_OMP
+
+
+TEST_F(Csr, ApplyWithLeadingEmptyRowsIsEquivalentToRefWithLoadBalance)
+{
+    assert_apply_is_equivalent_to_ref<Mtx::load_balance>(
+        gen_empty_rows_data(100, 0));
+}
+
+
+TEST_F(Csr, ApplyWithTrailingEmptyRowsIsEquivalentToRefWithLoadBalance)
+{
+    assert_apply_is_equivalent_to_ref<Mtx::load_balance>(
+        gen_empty_rows_data(0, 100));
+}
+
+
+TEST_F(Csr, ApplyWithoutNonzerosIsEquivalentToRefWithLoadBalance)
+{
+    assert_apply_is_equivalent_to_ref<Mtx::load_balance>(
+        gen_empty_rows_data(1000, 0));
+}
+
+
+TEST_F(Csr, ApplyWithLeadingEmptyRowsIsEquivalentToRefWithMergePath)
+{
+    assert_apply_is_equivalent_to_ref<Mtx::merge_path>(
+        gen_empty_rows_data(100, 0));
+}
+
+
+TEST_F(Csr, ApplyWithTrailingEmptyRowsIsEquivalentToRefWithMergePath)
+{
+    assert_apply_is_equivalent_to_ref<Mtx::merge_path>(
+        gen_empty_rows_data(0, 100));
+}
+
+
+TEST_F(Csr, ApplyWithoutNonzerosIsEquivalentToRefWithMergePath)
+{
+    assert_apply_is_equivalent_to_ref<Mtx::merge_path>(
+        gen_empty_rows_data(1000, 0));
+}
 
 
 TEST_F(Csr, AdvancedApplyToCsrMatrixIsEquivalentToRef)
@@ -514,6 +699,92 @@ TEST_F(Csr, SimpleApplyToCsrMatrixIsEquivalentToRef)
 }
 
 
+TEST_F(Csr, SimpleApplyToCsrMatrixWithMixedRowsIsEquivalentToRef)
+{
+    // even rows of A are short but produce long output rows, odd rows are
+    // long but produce short output rows
+    const index_type size = 200;
+    gko::matrix_data<value_type, index_type> a_data{gko::dim<2>(size, size)};
+    gko::matrix_data<value_type, index_type> b_data{gko::dim<2>(size, size)};
+    std::uniform_real_distribution<gko::remove_complex<value_type>> dist(-1.0,
+                                                                         1.0);
+    for (index_type row = 0; row < size; row++) {
+        if (row % 2 == 0) {
+            a_data.nonzeros.emplace_back(row, row / 2 * 2 + 1,
+                                         dist(rand_engine));
+        } else {
+            for (index_type col = 0; col < size; col += 2) {
+                a_data.nonzeros.emplace_back(row, col, dist(rand_engine));
+            }
+        }
+    }
+    for (index_type row = 0; row < size; row++) {
+        if (row % 2 == 0) {
+            b_data.nonzeros.emplace_back(row, row % 4, dist(rand_engine));
+        } else {
+            for (index_type col = 0; col < size; col += 3) {
+                b_data.nonzeros.emplace_back(row, col, dist(rand_engine));
+            }
+        }
+    }
+    auto a = Mtx::create(ref);
+    auto b = Mtx::create(ref);
+    a->read(a_data);
+    b->read(b_data);
+    auto da = gko::clone(exec, a);
+    auto db = gko::clone(exec, b);
+    auto product = Mtx::create(ref, gko::dim<2>(size, size));
+    auto dproduct = Mtx::create(exec, gko::dim<2>(size, size));
+
+    a->apply(b.get(), product.get());
+    da->apply(db.get(), dproduct.get());
+
+    GKO_ASSERT_MTX_NEAR(dproduct, product, r<value_type>::value);
+    GKO_ASSERT_MTX_EQ_SPARSITY(dproduct, product);
+    ASSERT_TRUE(dproduct->is_sorted_by_column_index());
+}
+
+
+TEST_F(Csr, SpgemmPlanIsEquivalentToRef)
+{
+    set_up_apply_data<Mtx::classical>();
+    auto trans = gko::as<Mtx>(mtx->transpose());
+    auto d_trans = gko::as<Mtx>(dmtx->transpose());
+    gko::matrix::CsrSpgemmPlan<value_type> plan{ref, mtx.get(), trans.get()};
+    gko::matrix::CsrSpgemmPlan<value_type> dplan{exec, dmtx.get(),
+                                                 d_trans.get()};
+    auto product = plan.create_product();
+    auto dproduct = dplan.create_product();
+
+    plan.compute(mtx.get(), trans.get(), product.get());
+    dplan.compute(dmtx.get(), d_trans.get(), dproduct.get());
+
+    GKO_ASSERT_MTX_EQ_SPARSITY(dproduct, product);
+    GKO_ASSERT_MTX_NEAR(dproduct, product, r<value_type>::value);
+}
+
+
+TEST_F(Csr, SpgemmSymbolicIsEquivalentToRef)
+{
+    set_up_apply_data<Mtx::classical>();
+    auto trans = gko::as<Mtx>(mtx->transpose());
+    auto d_trans = gko::as<Mtx>(dmtx->transpose());
+    const auto num_rows = mtx->get_size()[0];
+    gko::array<index_type> row_ptrs{ref, num_rows + 1};
+    gko::array<index_type> col_idxs{ref};
+    gko::array<index_type> drow_ptrs{exec, num_rows + 1};
+    gko::array<index_type> dcol_idxs{exec};
+
+    gko::kernels::reference::csr::spgemm_symbolic(
+        ref, mtx.get(), trans.get(), row_ptrs.get_data(), col_idxs);
+    gko::kernels::EXEC_NAMESPACE::csr::spgemm_symbolic(
+        exec, dmtx.get(), d_trans.get(), drow_ptrs.get_data(), dcol_idxs);
+
+    GKO_ASSERT_ARRAY_EQ(drow_ptrs, row_ptrs);
+    GKO_ASSERT_ARRAY_EQ(dcol_idxs, col_idxs);
+}
+
+
 TEST_F(Csr, SimpleApplyToSparseCsrMatrixIsEquivalentToRef)
 {
     set_up_apply_data<Mtx::classical>();
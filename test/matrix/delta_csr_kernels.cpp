@@ -0,0 +1,218 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2022, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#include <ginkgo/core/matrix/delta_csr.hpp>
+
+
+#include <algorithm>
+#include <random>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+
+#include "core/matrix/delta_csr_kernels.hpp"
+#include "core/test/utils.hpp"
+#include "core/test/utils/matrix_generator.hpp"
+#include "test/utils/executor.hpp"
+
+
+class DeltaCsr : public CommonTestFixture {
+protected:
+    using Csr = gko::matrix::Csr<value_type, index_type>;
+    using Mtx = gko::matrix::DeltaCsr<value_type, index_type>;
+    using Vec = gko::matrix::Dense<value_type>;
+
+    DeltaCsr() : rand_engine(42) {}
+
+    template <typename MtxType>
+    std::unique_ptr<MtxType> gen_mtx(int num_rows, int num_cols,
+                                     int min_nnz_row, int max_nnz_row)
+    {
+        return gko::test::generate_random_matrix<MtxType>(
+            num_rows, num_cols,
+            std::uniform_int_distribution<>(min_nnz_row, max_nnz_row),
+            std::normal_distribution<value_type>(-1.0, 1.0), rand_engine, ref);
+    }
+
+    void set_up_apply_data(int num_vectors = 1)
+    {
+        // the wide matrix makes sure that some deltas need to be escaped
+        csr = gen_mtx<Csr>(num_rows, num_cols, 0, 50);
+        mtx = Mtx::create(ref);
+        csr->convert_to(mtx.get());
+        dmtx = gko::clone(exec, mtx);
+        expected = gen_mtx<Vec>(num_rows, num_vectors, num_vectors,
+                                num_vectors);
+        y = gen_mtx<Vec>(num_cols, num_vectors, num_vectors, num_vectors);
+        alpha = gko::initialize<Vec>({2.0}, ref);
+        beta = gko::initialize<Vec>({-1.0}, ref);
+        dresult = gko::clone(exec, expected);
+        dy = gko::clone(exec, y);
+        dalpha = gko::clone(exec, alpha);
+        dbeta = gko::clone(exec, beta);
+    }
+
+    const int num_rows = 321;
+    const int num_cols = 200000;
+    std::default_random_engine rand_engine;
+
+    std::unique_ptr<Csr> csr;
+    std::unique_ptr<Mtx> mtx;
+    std::unique_ptr<Vec> expected;
+    std::unique_ptr<Vec> y;
+    std::unique_ptr<Vec> alpha;
+    std::unique_ptr<Vec> beta;
+
+    std::unique_ptr<Mtx> dmtx;
+    std::unique_ptr<Vec> dresult;
+    std::unique_ptr<Vec> dy;
+    std::unique_ptr<Vec> dalpha;
+    std::unique_ptr<Vec> dbeta;
+};
+
+
+TEST_F(DeltaCsr, ConvertFromCsrIsEquivalentToRef)
+{
+    set_up_apply_data();
+    auto dcsr = gko::clone(exec, csr);
+    auto result = Mtx::create(exec);
+
+    dcsr->convert_to(result.get());
+
+    ASSERT_GT(mtx->get_num_escapes(), 0);
+    GKO_ASSERT_ARRAY_EQ(
+        gko::array<index_type>::const_view(ref, num_rows + 1,
+                                           mtx->get_const_escape_ptrs()),
+        gko::array<index_type>::const_view(exec, num_rows + 1,
+                                           result->get_const_escape_ptrs()));
+    GKO_ASSERT_ARRAY_EQ(
+        gko::array<index_type>::const_view(ref, mtx->get_num_escapes(),
+                                           mtx->get_const_escape_col_idxs()),
+        gko::array<index_type>::const_view(
+            exec, result->get_num_escapes(),
+            result->get_const_escape_col_idxs()));
+    GKO_ASSERT_ARRAY_EQ(
+        gko::array<Mtx::delta_type>::const_view(
+            ref, mtx->get_num_stored_elements(), mtx->get_const_col_deltas()),
+        gko::array<Mtx::delta_type>::const_view(
+            exec, result->get_num_stored_elements(),
+            result->get_const_col_deltas()));
+}
+
+
+TEST_F(DeltaCsr, ConvertToCsrIsEquivalentToRef)
+{
+    set_up_apply_data();
+    auto result = Csr::create(exec);
+
+    dmtx->convert_to(result.get());
+
+    GKO_ASSERT_MTX_NEAR(result, csr, 0.0);
+}
+
+
+TEST_F(DeltaCsr, SimpleApplyIsEquivalentToRef)
+{
+    set_up_apply_data();
+
+    mtx->apply(y.get(), expected.get());
+    dmtx->apply(dy.get(), dresult.get());
+
+    GKO_ASSERT_MTX_NEAR(dresult, expected, r<value_type>::value);
+}
+
+
+TEST_F(DeltaCsr, AdvancedApplyIsEquivalentToRef)
+{
+    set_up_apply_data();
+
+    mtx->apply(alpha.get(), y.get(), beta.get(), expected.get());
+    dmtx->apply(dalpha.get(), dy.get(), dbeta.get(), dresult.get());
+
+    GKO_ASSERT_MTX_NEAR(dresult, expected, r<value_type>::value);
+}
+
+
+TEST_F(DeltaCsr, SimpleApplyToDenseMatrixIsEquivalentToRef)
+{
+    set_up_apply_data(3);
+
+    mtx->apply(y.get(), expected.get());
+    dmtx->apply(dy.get(), dresult.get());
+
+    GKO_ASSERT_MTX_NEAR(dresult, expected, r<value_type>::value);
+}
+
+
+TEST_F(DeltaCsr, AdvancedApplyToDenseMatrixIsEquivalentToRef)
+{
+    set_up_apply_data(3);
+
+    mtx->apply(alpha.get(), y.get(), beta.get(), expected.get());
+    dmtx->apply(dalpha.get(), dy.get(), dbeta.get(), dresult.get());
+
+    GKO_ASSERT_MTX_NEAR(dresult, expected, r<value_type>::value);
+}
+
+
+TEST_F(DeltaCsr, ApplyMatchesCsrOnBandedMatrix)
+{
+    // a banded matrix does not need any escapes
+    gko::matrix_data<value_type, index_type> data{gko::dim<2>(1000, 1000)};
+    for (int row = 0; row < 1000; ++row) {
+        for (int col = std::max(row - 3, 0); col < std::min(row + 4, 1000);
+             ++col) {
+            data.nonzeros.emplace_back(row, col, row + 0.5 * col);
+        }
+    }
+    auto band_csr = Csr::create(exec);
+    band_csr->read(data);
+    auto band_mtx = Mtx::create(exec);
+    band_csr->convert_to(band_mtx.get());
+    auto b = gen_mtx<Vec>(1000, 1, 1, 1);
+    auto db = gko::clone(exec, b);
+    auto x = Vec::create(exec, gko::dim<2>{1000, 1});
+    auto expected_x = Vec::create(exec, gko::dim<2>{1000, 1});
+
+    band_mtx->apply(db.get(), x.get());
+    band_csr->apply(db.get(), expected_x.get());
+
+    ASSERT_EQ(band_mtx->get_num_escapes(), 0);
+    GKO_ASSERT_MTX_NEAR(x, expected_x, r<value_type>::value);
+}
+
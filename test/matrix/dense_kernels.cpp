@@ -274,6 +274,56 @@ TEST_F(Dense, SimpleApplyIsEquivalentToRef)
 }
 
 
+TEST_F(Dense, SimpleApplyLargeIsEquivalentToRef)
+{
+    auto a = gen_mtx<Mtx>(131, 300);
+    auto b = gen_mtx<Mtx>(300, 21);
+    auto c = gen_mtx<Mtx>(131, 21);
+    auto da = gko::clone(exec, a);
+    auto db = gko::clone(exec, b);
+    auto dc = gko::clone(exec, c);
+
+    a->apply(b.get(), c.get());
+    da->apply(db.get(), dc.get());
+
+    GKO_ASSERT_MTX_NEAR(dc, c, 10 * r<value_type>::value);
+}
+
+
+TEST_F(Dense, SimpleApplyTallIsEquivalentToRef)
+{
+    // many row panels share each packed block of B
+    auto a = gen_mtx<Mtx>(1031, 300);
+    auto b = gen_mtx<Mtx>(300, 21);
+    auto c = gen_mtx<Mtx>(1031, 21);
+    auto da = gko::clone(exec, a);
+    auto db = gko::clone(exec, b);
+    auto dc = gko::clone(exec, c);
+
+    a->apply(b.get(), c.get());
+    da->apply(db.get(), dc.get());
+
+    GKO_ASSERT_MTX_NEAR(dc, c, 10 * r<value_type>::value);
+}
+
+
+TEST_F(Dense, AdvancedApplyLargeIsEquivalentToRef)
+{
+    set_up_apply_data();
+    auto a = gen_mtx<Mtx>(131, 300);
+    auto b = gen_mtx<Mtx>(300, 21);
+    auto c = gen_mtx<Mtx>(131, 21);
+    auto da = gko::clone(exec, a);
+    auto db = gko::clone(exec, b);
+    auto dc = gko::clone(exec, c);
+
+    a->apply(alpha.get(), b.get(), beta.get(), c.get());
+    da->apply(dalpha.get(), db.get(), dbeta.get(), dc.get());
+
+    GKO_ASSERT_MTX_NEAR(dc, c, 10 * r<value_type>::value);
+}
+
+
 TEST_F(Dense, SimpleApplyMixedIsEquivalentToRef)
 {
     set_up_apply_data();
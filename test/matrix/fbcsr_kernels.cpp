@@ -254,6 +254,45 @@ TYPED_TEST(Fbcsr, AdvancedSpmvMultiIsEquivalentToRefSorted)
 }
 
 
+TYPED_TEST(Fbcsr, AdvancedSpmvMultiIsEquivalentToRefForFixedBlockSizes)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Dense = typename TestFixture::Dense;
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename Mtx::index_type;
+    // 9 is not among the compiled block sizes, exercising the generic kernel
+    for (int block_size : {2, 5, 6, 8, 9}) {
+        SCOPED_TRACE(block_size);
+        auto rand = gko::test::generate_random_fbcsr<value_type, index_type>(
+            this->ref, 30, 20, block_size, false, false,
+            std::default_random_engine(43));
+        auto drand = gko::clone(this->exec, rand);
+        auto x = Dense::create(this->ref, gko::dim<2>(rand->get_size()[1], 3));
+        this->generate_sin(x.get());
+        auto dx = gko::clone(this->exec, x);
+        auto prod =
+            Dense::create(this->ref, gko::dim<2>(rand->get_size()[0], 3));
+        this->generate_sin(prod.get());
+        auto dprod = gko::clone(this->exec, prod);
+        auto alpha = gko::initialize<Dense>({2.5}, this->ref);
+        auto beta = gko::initialize<Dense>({-1.2}, this->ref);
+        auto dalpha = gko::clone(this->exec, alpha);
+        auto dbeta = gko::clone(this->exec, beta);
+        auto simple_prod = Dense::create(this->ref, prod->get_size());
+        auto dsimple_prod = Dense::create(this->exec, prod->get_size());
+
+        drand->apply(dalpha.get(), dx.get(), dbeta.get(), dprod.get());
+        rand->apply(alpha.get(), x.get(), beta.get(), prod.get());
+        drand->apply(dx.get(), dsimple_prod.get());
+        rand->apply(x.get(), simple_prod.get());
+
+        const double tol = r<value_type>::value;
+        GKO_ASSERT_MTX_NEAR(prod, dprod, 5 * tol);
+        GKO_ASSERT_MTX_NEAR(simple_prod, dsimple_prod, 5 * tol);
+    }
+}
+
+
 TYPED_TEST(Fbcsr, ConjTransposeIsEquivalentToRefSortedBS3)
 {
     using Mtx = typename TestFixture::Mtx;
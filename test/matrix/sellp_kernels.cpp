@@ -85,6 +85,17 @@ protected:
         dbeta = gko::clone(exec, beta);
     }
 
+    void sort_apply_matrix(int sorting_window)
+    {
+        gko::matrix_data<value_type> data;
+        mtx->write(data);
+        mtx = Mtx::create(ref, gko::dim<2>{}, gko::matrix::default_slice_size,
+                          gko::matrix::default_stride_factor, sorting_window,
+                          0);
+        mtx->read(data);
+        dmtx = gko::clone(exec, mtx);
+    }
+
     std::default_random_engine rand_engine;
 
     std::unique_ptr<Mtx> mtx;
@@ -147,6 +158,30 @@ TEST_F(Sellp, AdvancedApplyWithSliceSizeAndStrideFActorIsEquivalentToRef)
 }
 
 
+TEST_F(Sellp, SimpleApplyWithSortingWindowIsEquivalentToRef)
+{
+    set_up_apply_matrix();
+    sort_apply_matrix(256);
+
+    mtx->apply(y.get(), expected.get());
+    dmtx->apply(dy.get(), dresult.get());
+
+    GKO_ASSERT_MTX_NEAR(dresult, expected, r<value_type>::value);
+}
+
+
+TEST_F(Sellp, AdvancedApplyMultipleRHSWithSortingWindowIsEquivalentToRef)
+{
+    set_up_apply_matrix(6);
+    sort_apply_matrix(256);
+
+    mtx->apply(alpha.get(), y.get(), beta.get(), expected.get());
+    dmtx->apply(dalpha.get(), dy.get(), dbeta.get(), dresult.get());
+
+    GKO_ASSERT_MTX_NEAR(dresult, expected, r<value_type>::value);
+}
+
+
 TEST_F(Sellp, SimpleApplyMultipleRHSIsEquivalentToRef)
 {
     set_up_apply_matrix(3);
@@ -193,6 +228,40 @@ TEST_F(Sellp,
 }
 
 
+TEST_F(Sellp, SimpleApplyInReducedPrecisionIsEquivalentToRef)
+{
+    using MixedMtx = gko::matrix::Sellp<gko::next_precision<value_type>>;
+    set_up_apply_matrix();
+    auto mixed_mtx = MixedMtx::create(ref);
+    mtx->convert_to(mixed_mtx.get());
+    auto dmixed_mtx = gko::clone(exec, mixed_mtx);
+
+    mixed_mtx->apply(y.get(), expected.get());
+    dmixed_mtx->apply(dy.get(), dresult.get());
+
+    GKO_ASSERT_MTX_NEAR(dresult, expected,
+                        r<gko::next_precision<value_type>>::value);
+}
+
+
+TEST_F(Sellp,
+       AdvancedApplyInReducedPrecisionWithSortingWindowIsEquivalentToRef)
+{
+    using MixedMtx = gko::matrix::Sellp<gko::next_precision<value_type>>;
+    set_up_apply_matrix(6);
+    sort_apply_matrix(256);
+    auto mixed_mtx = MixedMtx::create(ref);
+    mtx->convert_to(mixed_mtx.get());
+    auto dmixed_mtx = gko::clone(exec, mixed_mtx);
+
+    mixed_mtx->apply(alpha.get(), y.get(), beta.get(), expected.get());
+    dmixed_mtx->apply(dalpha.get(), dy.get(), dbeta.get(), dresult.get());
+
+    GKO_ASSERT_MTX_NEAR(dresult, expected,
+                        r<gko::next_precision<value_type>>::value);
+}
+
+
 TEST_F(Sellp, ApplyToComplexIsEquivalentToRef)
 {
     set_up_apply_matrix(64);
@@ -52,6 +52,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ginkgo/core/solver/cgs.hpp>
 #include <ginkgo/core/solver/fcg.hpp>
 #include <ginkgo/core/solver/ir.hpp>
+#include <ginkgo/core/solver/pipe_bicgstab.hpp>
+#include <ginkgo/core/solver/pipe_cg.hpp>
 #include <ginkgo/core/stop/residual_norm.hpp>
 
 
@@ -151,6 +153,21 @@ struct Bicgstab : SimpleSolverTest<gko::solver::Bicgstab<solver_value_type>> {
 };
 
 
+struct PipeCg : SimpleSolverTest<gko::solver::PipeCg<solver_value_type>> {
+    static void preprocess(
+        gko::matrix_data<value_type, global_index_type>& data)
+    {
+        gko::utils::make_hpd(data, 1.5);
+    }
+};
+
+
+struct PipeBicgstab
+    : SimpleSolverTest<gko::solver::PipeBicgstab<solver_value_type>> {
+    static constexpr double tolerance() { return 300 * reduction_factor(); }
+};
+
+
 struct Ir : SimpleSolverTest<gko::solver::Ir<solver_value_type>> {
     static void preprocess(
         gko::matrix_data<value_type, global_index_type>& data)
@@ -484,7 +501,8 @@ protected:
     std::default_random_engine rand_engine;
 };
 
-using SolverTypes = ::testing::Types<Cg, Cgs, Fcg, Bicgstab, Ir>;
+using SolverTypes =
+    ::testing::Types<Cg, Cgs, Fcg, Bicgstab, PipeCg, PipeBicgstab, Ir>;
 
 TYPED_TEST_SUITE(Solver, SolverTypes, TypenameNameGenerator);
 
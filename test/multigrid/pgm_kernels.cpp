@@ -271,6 +271,31 @@ TEST_F(Pgm, AssignToExistAggUnderteminsticIsEquivalentToRef)
 }
 
 
+#ifdef GKO_COMPILING_OMP
+
+
+TEST_F(Pgm, ComputeCoarseCsrIsEquivalentToRef)
+{
+    initialize_data();
+    index_type num_agg;
+    gko::kernels::reference::pgm::renumber(ref, agg, &num_agg);
+    d_agg = agg;
+    auto coarse = Csr::create(ref, gko::dim<2>(num_agg));
+    auto d_coarse = Csr::create(exec, gko::dim<2>(num_agg));
+
+    gko::kernels::reference::pgm::compute_coarse_csr(ref, system_mtx.get(),
+                                                     agg, coarse.get());
+    gko::kernels::EXEC_NAMESPACE::pgm::compute_coarse_csr(
+        exec, d_system_mtx.get(), d_agg, d_coarse.get());
+
+    GKO_ASSERT_MTX_EQ_SPARSITY(d_coarse, coarse);
+    GKO_ASSERT_MTX_NEAR(d_coarse, coarse, r<value_type>::value);
+}
+
+
+#endif  // GKO_COMPILING_OMP
+
+
 TEST_F(Pgm, GenerateMgLevelIsEquivalentToRef)
 {
     initialize_data();
@@ -0,0 +1,172 @@
+/*******************************<GINKGO LICENSE>******************************
+Copyright (c) 2017-2022, the Ginkgo authors
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+contributors may be used to endorse or promote products derived from
+this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************<GINKGO LICENSE>*******************************/
+
+#include <ginkgo/core/solver/batch_cg.hpp>
+
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/log/batch_convergence.hpp>
+#include <ginkgo/core/matrix/batch_csr.hpp>
+#include <ginkgo/core/matrix/batch_dense.hpp>
+#include <ginkgo/core/matrix/batch_ell.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+
+#include "core/test/utils.hpp"
+#include "test/utils/executor.hpp"
+
+
+class BatchCg : public CommonTestFixture {
+protected:
+    using Csr = gko::matrix::BatchCsr<value_type, index_type>;
+    using Ell = gko::matrix::BatchEll<value_type, index_type>;
+    using BatchDense = gko::matrix::BatchDense<value_type>;
+    using Vec = gko::matrix::Dense<value_type>;
+    using Solver = gko::solver::BatchCg<value_type>;
+    using Logger = gko::log::BatchConvergence<value_type>;
+    using mat_data = gko::matrix_data<value_type, index_type>;
+
+    BatchCg() : rand_engine(15) {}
+
+    /**
+     * Generates diagonally dominant, symmetric positive definite band matrices
+     * with individual values for each system.
+     */
+    std::vector<mat_data> gen_batch_data(gko::size_type num_items,
+                                         index_type size)
+    {
+        const index_type bandwidth = 3;
+        std::uniform_real_distribution<> value_dist(-1.0, 0.0);
+        std::vector<mat_data> data;
+        for (gko::size_type item = 0; item < num_items; item++) {
+            // entry (i, j) and (j, i) share the value stored for min(i, j)
+            std::vector<double> off_diag(size * bandwidth);
+            for (auto& value : off_diag) {
+                value = value_dist(rand_engine);
+            }
+            mat_data item_data{gko::dim<2>(size, size)};
+            for (index_type row = 0; row < size; row++) {
+                for (auto col = std::max(row - bandwidth, index_type{});
+                     col < std::min(row + bandwidth + 1, size); col++) {
+                    const auto diag_dist = std::abs(row - col);
+                    item_data.nonzeros.emplace_back(
+                        row, col,
+                        row == col ? 2.0 * bandwidth + 1.0
+                                   : off_diag[std::min(row, col) * bandwidth +
+                                              diag_dist - 1]);
+                }
+            }
+            data.push_back(std::move(item_data));
+        }
+        return data;
+    }
+
+    void initialize_data()
+    {
+        const gko::size_type num_items = 9;
+        const index_type size = 33;
+        data = gen_batch_data(num_items, size);
+        b = gko::test::generate_random_matrix<Vec>(
+            num_items * size, 2, std::uniform_int_distribution<>(2, 2),
+            std::normal_distribution<>(-1.0, 1.0), rand_engine, ref);
+        db = gko::clone(exec, b);
+    }
+
+    template <typename MtxType>
+    void assert_solve_is_equivalent_to_ref()
+    {
+        initialize_data();
+        auto mtx = gko::share(MtxType::create(ref));
+        mtx->read(data);
+        auto dmtx = gko::share(gko::clone(exec, mtx));
+        auto x = Vec::create(ref, b->get_size());
+        x->fill(gko::zero<value_type>());
+        auto dx = gko::clone(exec, x);
+        auto logger = gko::share(Logger::create());
+        auto dlogger = gko::share(Logger::create());
+        auto solver = Solver::build()
+                          .with_max_iterations(100u)
+                          .with_tolerance(r<value_type>::value * 1e2)
+                          .on(ref)
+                          ->generate(mtx);
+        auto dsolver = Solver::build()
+                           .with_max_iterations(100u)
+                           .with_tolerance(r<value_type>::value * 1e2)
+                           .on(exec)
+                           ->generate(dmtx);
+        solver->add_logger(logger);
+        dsolver->add_logger(dlogger);
+
+        solver->apply(b.get(), x.get());
+        dsolver->apply(db.get(), dx.get());
+
+        GKO_ASSERT_MTX_NEAR(dx, x, r<value_type>::value * 1e2);
+        GKO_ASSERT_ARRAY_EQ(dlogger->get_num_iterations(),
+                            logger->get_num_iterations());
+        GKO_ASSERT_MTX_NEAR(dlogger->get_residual_norms(),
+                            logger->get_residual_norms(),
+                            r<value_type>::value * 1e2);
+    }
+
+    std::default_random_engine rand_engine;
+
+    std::vector<mat_data> data;
+    std::unique_ptr<Vec> b;
+    std::unique_ptr<Vec> db;
+};
+
+
+TEST_F(BatchCg, SolvesBatchCsrIsEquivalentToRef)
+{
+    assert_solve_is_equivalent_to_ref<Csr>();
+}
+
+
+TEST_F(BatchCg, SolvesBatchEllIsEquivalentToRef)
+{
+    assert_solve_is_equivalent_to_ref<Ell>();
+}
+
+
+TEST_F(BatchCg, SolvesBatchDenseIsEquivalentToRef)
+{
+    assert_solve_is_equivalent_to_ref<BatchDense>();
+}
@@ -156,7 +156,7 @@ protected:
         d_next_krylov_basis = gko::clone(exec, next_krylov_basis);
         d_hessenberg = gko::clone(exec, hessenberg);
         d_hessenberg_iter = gko::clone(exec, hessenberg_iter);
-        d_buffer_iter = Mtx::create(exec);
+        d_buffer_iter = gko::clone(exec, buffer_iter);
         d_residual = gko::clone(exec, residual);
         d_residual_norm = gko::clone(exec, residual_norm);
         d_residual_norm_collection = gko::clone(exec, residual_norm_collection);
@@ -282,14 +282,83 @@ TEST_F(CbGmres, CbGmresStep1IsEquivalentToRef)
         residual_norm.get(), residual_norm_collection.get(),
         range_helper.get_range(), hessenberg_iter.get(), buffer_iter.get(),
         arnoldi_norm.get(), iter, final_iter_nums.get(), stop_status.get(),
-        reorth_status.get(), num_reorth.get());
+        reorth_status.get(), num_reorth.get(),
+        gko::solver::gmres::ortho_method::cgs_conditional);
     gko::kernels::EXEC_NAMESPACE::cb_gmres::arnoldi(
         exec, d_next_krylov_basis.get(), d_givens_sin.get(), d_givens_cos.get(),
         d_residual_norm.get(), d_residual_norm_collection.get(),
         d_range_helper.get_range(), d_hessenberg_iter.get(),
         d_buffer_iter.get(), d_arnoldi_norm.get(), iter,
         d_final_iter_nums.get(), d_stop_status.get(), d_reorth_status.get(),
-        d_num_reorth.get());
+        d_num_reorth.get(), gko::solver::gmres::ortho_method::cgs_conditional);
+
+    GKO_ASSERT_MTX_NEAR(d_arnoldi_norm, arnoldi_norm, r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(d_next_krylov_basis, next_krylov_basis,
+                        r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(d_givens_sin, givens_sin, r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(d_givens_cos, givens_cos, r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(d_residual_norm, residual_norm, r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(d_residual_norm_collection, residual_norm_collection,
+                        r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(d_hessenberg_iter, hessenberg_iter,
+                        r<value_type>::value);
+    assert_krylov_bases_near();
+    GKO_ASSERT_ARRAY_EQ(*d_final_iter_nums, *final_iter_nums);
+}
+
+TEST_F(CbGmres, CbGmresStep1WithCgsIsEquivalentToRef)
+{
+    initialize_data();
+    int iter = 5;
+
+    gko::kernels::reference::cb_gmres::arnoldi(
+        ref, next_krylov_basis.get(), givens_sin.get(), givens_cos.get(),
+        residual_norm.get(), residual_norm_collection.get(),
+        range_helper.get_range(), hessenberg_iter.get(), buffer_iter.get(),
+        arnoldi_norm.get(), iter, final_iter_nums.get(), stop_status.get(),
+        reorth_status.get(), num_reorth.get(),
+        gko::solver::gmres::ortho_method::cgs);
+    gko::kernels::EXEC_NAMESPACE::cb_gmres::arnoldi(
+        exec, d_next_krylov_basis.get(), d_givens_sin.get(), d_givens_cos.get(),
+        d_residual_norm.get(), d_residual_norm_collection.get(),
+        d_range_helper.get_range(), d_hessenberg_iter.get(),
+        d_buffer_iter.get(), d_arnoldi_norm.get(), iter,
+        d_final_iter_nums.get(), d_stop_status.get(), d_reorth_status.get(),
+        d_num_reorth.get(), gko::solver::gmres::ortho_method::cgs);
+
+    GKO_ASSERT_MTX_NEAR(d_arnoldi_norm, arnoldi_norm, r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(d_next_krylov_basis, next_krylov_basis,
+                        r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(d_givens_sin, givens_sin, r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(d_givens_cos, givens_cos, r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(d_residual_norm, residual_norm, r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(d_residual_norm_collection, residual_norm_collection,
+                        r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(d_hessenberg_iter, hessenberg_iter,
+                        r<value_type>::value);
+    assert_krylov_bases_near();
+    GKO_ASSERT_ARRAY_EQ(*d_final_iter_nums, *final_iter_nums);
+}
+
+TEST_F(CbGmres, CbGmresStep1WithCgs2IsEquivalentToRef)
+{
+    initialize_data();
+    int iter = 5;
+
+    gko::kernels::reference::cb_gmres::arnoldi(
+        ref, next_krylov_basis.get(), givens_sin.get(), givens_cos.get(),
+        residual_norm.get(), residual_norm_collection.get(),
+        range_helper.get_range(), hessenberg_iter.get(), buffer_iter.get(),
+        arnoldi_norm.get(), iter, final_iter_nums.get(), stop_status.get(),
+        reorth_status.get(), num_reorth.get(),
+        gko::solver::gmres::ortho_method::cgs2);
+    gko::kernels::EXEC_NAMESPACE::cb_gmres::arnoldi(
+        exec, d_next_krylov_basis.get(), d_givens_sin.get(), d_givens_cos.get(),
+        d_residual_norm.get(), d_residual_norm_collection.get(),
+        d_range_helper.get_range(), d_hessenberg_iter.get(),
+        d_buffer_iter.get(), d_arnoldi_norm.get(), iter,
+        d_final_iter_nums.get(), d_stop_status.get(), d_reorth_status.get(),
+        d_num_reorth.get(), gko::solver::gmres::ortho_method::cgs2);
 
     GKO_ASSERT_MTX_NEAR(d_arnoldi_norm, arnoldi_norm, r<value_type>::value);
     GKO_ASSERT_MTX_NEAR(d_next_krylov_basis, next_krylov_basis,
@@ -41,6 +41,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <ginkgo/core/base/exception.hpp>
 #include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
 #include <ginkgo/core/matrix/dense.hpp>
 #include <ginkgo/core/solver/cg.hpp>
 #include <ginkgo/core/stop/combined.hpp>
@@ -188,6 +189,58 @@ TEST_F(Cg, CgStep2IsEquivalentToRef)
 }
 
 
+#ifdef GKO_COMPILING_OMP
+
+
+TEST_F(Cg, CgStep2NormIsEquivalentToRef)
+{
+    using NormVector = gko::matrix::Dense<gko::remove_complex<value_type>>;
+    initialize_data();
+    auto norm = NormVector::create(ref, gko::dim<2>{1, x->get_size()[1]});
+    auto d_norm = NormVector::create(exec, norm->get_size());
+    gko::array<char> tmp{ref};
+    gko::array<char> d_tmp{exec};
+
+    gko::kernels::reference::cg::step_2_norm(
+        ref, x.get(), r.get(), p.get(), q.get(), beta.get(), rho.get(),
+        prev_rho.get(), norm.get(), stop_status.get(), tmp);
+    gko::kernels::EXEC_NAMESPACE::cg::step_2_norm(
+        exec, d_x.get(), d_r.get(), d_p.get(), d_q.get(), d_beta.get(),
+        d_rho.get(), d_prev_rho.get(), d_norm.get(), d_stop_status.get(),
+        d_tmp);
+
+    GKO_ASSERT_MTX_NEAR(d_x, x, ::r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(d_r, r, ::r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(d_prev_rho, prev_rho, ::r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(d_norm, norm, ::r<value_type>::value);
+}
+
+
+TEST_F(Cg, CgSpmvConjDotIsEquivalentToRef)
+{
+    using Csr = gko::matrix::Csr<value_type, index_type>;
+    initialize_data();
+    auto mtx = gko::test::generate_random_matrix<Csr>(
+        p->get_size()[0], p->get_size()[0],
+        std::uniform_int_distribution<>(1, 20),
+        std::normal_distribution<value_type>(-1.0, 1.0), rand_engine, ref);
+    auto d_mtx = gko::clone(exec, mtx);
+    gko::array<char> tmp{ref};
+    gko::array<char> d_tmp{exec};
+
+    gko::kernels::reference::cg::spmv_conj_dot(ref, mtx.get(), p.get(),
+                                               q.get(), beta.get(), tmp);
+    gko::kernels::EXEC_NAMESPACE::cg::spmv_conj_dot(
+        exec, d_mtx.get(), d_p.get(), d_q.get(), d_beta.get(), d_tmp);
+
+    GKO_ASSERT_MTX_NEAR(d_q, q, ::r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(d_beta, beta, ::r<value_type>::value * 10);
+}
+
+
+#endif  // GKO_COMPILING_OMP
+
+
 TEST_F(Cg, ApplyIsEquivalentToRef)
 {
     auto data = gko::matrix_data<value_type, index_type>(
@@ -225,3 +278,43 @@ TEST_F(Cg, ApplyIsEquivalentToRef)
 
     GKO_ASSERT_MTX_NEAR(d_x, x, ::r<value_type>::value * 1000);
 }
+
+
+TEST_F(Cg, ApplyWithCsrIsEquivalentToRef)
+{
+    using Csr = gko::matrix::Csr<value_type, index_type>;
+    auto data = gko::matrix_data<value_type, index_type>(
+        gko::dim<2>{50, 50}, std::normal_distribution<value_type>(-1.0, 1.0),
+        rand_engine);
+    gko::utils::make_hpd(data);
+    auto mtx = gko::share(Csr::create(ref));
+    mtx->read(data);
+    auto x = gen_mtx(50, 3, 5);
+    auto b = gen_mtx(50, 3, 4);
+    auto d_mtx = gko::share(gko::clone(exec, mtx));
+    auto d_x = gko::clone(exec, x);
+    auto d_b = gko::clone(exec, b);
+    auto cg_factory =
+        gko::solver::Cg<value_type>::build()
+            .with_criteria(
+                gko::stop::Iteration::build().with_max_iters(50u).on(ref),
+                gko::stop::ResidualNorm<value_type>::build()
+                    .with_reduction_factor(::r<value_type>::value)
+                    .on(ref))
+            .on(ref);
+    auto d_cg_factory =
+        gko::solver::Cg<value_type>::build()
+            .with_criteria(
+                gko::stop::Iteration::build().with_max_iters(50u).on(exec),
+                gko::stop::ResidualNorm<value_type>::build()
+                    .with_reduction_factor(::r<value_type>::value)
+                    .on(exec))
+            .on(exec);
+    auto solver = cg_factory->generate(mtx);
+    auto d_solver = d_cg_factory->generate(d_mtx);
+
+    solver->apply(b.get(), x.get());
+    d_solver->apply(d_b.get(), d_x.get());
+
+    GKO_ASSERT_MTX_NEAR(d_x, x, ::r<value_type>::value * 1000);
+}
@@ -305,6 +305,70 @@ TEST_F(Gmres, GmresKernelMultiAxpyIsEquivalentToRef)
 }
 
 
+TEST_F(Gmres, GmresKernelMultiDotIsEquivalentToRef)
+{
+    initialize_data();
+    const auto m = x->get_size()[0];
+    const auto nrhs = x->get_size()[1];
+    const gko::size_type num_bases = 7;
+    const gko::size_type block_size = 3;
+    auto bases = krylov_bases->create_submatrix(gko::span{0, m * num_bases},
+                                                gko::span{0, nrhs});
+    auto block = krylov_bases->create_submatrix(
+        gko::span{m * (num_bases - block_size), m * num_bases},
+        gko::span{0, nrhs});
+    auto d_bases = d_krylov_bases->create_submatrix(
+        gko::span{0, m * num_bases}, gko::span{0, nrhs});
+    auto d_block = d_krylov_bases->create_submatrix(
+        gko::span{m * (num_bases - block_size), m * num_bases},
+        gko::span{0, nrhs});
+    auto result = Mtx::create(ref, gko::dim<2>{num_bases, block_size * nrhs});
+    auto d_result =
+        Mtx::create(exec, gko::dim<2>{num_bases, block_size * nrhs});
+    gko::array<char> tmp{ref};
+    gko::array<char> d_tmp{exec};
+
+    gko::kernels::reference::gmres::multi_dot(ref, bases.get(), block.get(),
+                                              result.get(), tmp);
+    gko::kernels::EXEC_NAMESPACE::gmres::multi_dot(
+        exec, d_bases.get(), d_block.get(), d_result.get(), d_tmp);
+
+    GKO_ASSERT_MTX_NEAR(d_result, result, r<value_type>::value * 1e2);
+}
+
+
+TEST_F(Gmres, GmresKernelMultiUpdateIsEquivalentToRef)
+{
+    initialize_data();
+    const auto m = x->get_size()[0];
+    const auto nrhs = x->get_size()[1];
+    const gko::size_type num_bases = 4;
+    const gko::size_type block_size = 3;
+    auto bases = krylov_bases->create_submatrix(gko::span{0, m * num_bases},
+                                                gko::span{0, nrhs});
+    auto block = krylov_bases->create_submatrix(
+        gko::span{m * num_bases, m * (num_bases + block_size)},
+        gko::span{0, nrhs});
+    auto d_bases = d_krylov_bases->create_submatrix(
+        gko::span{0, m * num_bases}, gko::span{0, nrhs});
+    auto d_block = d_krylov_bases->create_submatrix(
+        gko::span{m * num_bases, m * (num_bases + block_size)},
+        gko::span{0, nrhs});
+    auto coeffs = gen_mtx(num_bases, block_size * nrhs);
+    auto triangular = gen_mtx(block_size, block_size * nrhs);
+    auto d_coeffs = gko::clone(exec, coeffs);
+    auto d_triangular = gko::clone(exec, triangular);
+
+    gko::kernels::reference::gmres::multi_update(
+        ref, bases.get(), coeffs.get(), triangular.get(), block.get());
+    gko::kernels::EXEC_NAMESPACE::gmres::multi_update(
+        exec, d_bases.get(), d_coeffs.get(), d_triangular.get(),
+        d_block.get());
+
+    GKO_ASSERT_MTX_NEAR(d_krylov_bases, krylov_bases, r<value_type>::value);
+}
+
+
 TEST_F(Gmres, GmresApplyOneRHSIsEquivalentToRef)
 {
     int m = 123;
@@ -341,3 +405,90 @@ TEST_F(Gmres, GmresApplyMultipleRHSIsEquivalentToRef)
     GKO_ASSERT_MTX_NEAR(d_b, b, 0);
     GKO_ASSERT_MTX_NEAR(d_x, x, r<value_type>::value * 1e3);
 }
+
+
+TEST_F(Gmres, GmresApplyWithSStepIsEquivalentToRef)
+{
+    int m = 123;
+    int n = 5;
+    auto ref_solver = Solver::build()
+                          .with_s_step(3u)
+                          .with_criteria(ref_gmres_factory->get_parameters()
+                                             .criteria)
+                          .on(ref)
+                          ->generate(mtx);
+    auto exec_solver = Solver::build()
+                           .with_s_step(3u)
+                           .with_criteria(exec_gmres_factory->get_parameters()
+                                              .criteria)
+                           .on(exec)
+                           ->generate(d_mtx);
+    auto b = gen_mtx(m, n);
+    auto x = gen_mtx(m, n);
+    auto d_b = gko::clone(exec, b);
+    auto d_x = gko::clone(exec, x);
+
+    ref_solver->apply(b.get(), x.get());
+    exec_solver->apply(d_b.get(), d_x.get());
+
+    GKO_ASSERT_MTX_NEAR(d_b, b, 0);
+    GKO_ASSERT_MTX_NEAR(d_x, x, r<value_type>::value * 1e4);
+}
+
+
+TEST_F(Gmres, GmresApplyWithCgs2IsEquivalentToRef)
+{
+    int m = 123;
+    int n = 5;
+    auto ref_solver =
+        Solver::build()
+            .with_orthogonalization(gko::solver::gmres::ortho_method::cgs2)
+            .with_criteria(ref_gmres_factory->get_parameters().criteria)
+            .on(ref)
+            ->generate(mtx);
+    auto exec_solver =
+        Solver::build()
+            .with_orthogonalization(gko::solver::gmres::ortho_method::cgs2)
+            .with_criteria(exec_gmres_factory->get_parameters().criteria)
+            .on(exec)
+            ->generate(d_mtx);
+    auto b = gen_mtx(m, n);
+    auto x = gen_mtx(m, n);
+    auto d_b = gko::clone(exec, b);
+    auto d_x = gko::clone(exec, x);
+
+    ref_solver->apply(b.get(), x.get());
+    exec_solver->apply(d_b.get(), d_x.get());
+
+    GKO_ASSERT_MTX_NEAR(d_b, b, 0);
+    GKO_ASSERT_MTX_NEAR(d_x, x, r<value_type>::value * 1e3);
+}
+
+
+TEST_F(Gmres, GmresApplyWithDcgs2IsEquivalentToRef)
+{
+    int m = 123;
+    int n = 5;
+    auto ref_solver =
+        Solver::build()
+            .with_orthogonalization(gko::solver::gmres::ortho_method::dcgs2)
+            .with_criteria(ref_gmres_factory->get_parameters().criteria)
+            .on(ref)
+            ->generate(mtx);
+    auto exec_solver =
+        Solver::build()
+            .with_orthogonalization(gko::solver::gmres::ortho_method::dcgs2)
+            .with_criteria(exec_gmres_factory->get_parameters().criteria)
+            .on(exec)
+            ->generate(d_mtx);
+    auto b = gen_mtx(m, n);
+    auto x = gen_mtx(m, n);
+    auto d_b = gko::clone(exec, b);
+    auto d_x = gko::clone(exec, x);
+
+    ref_solver->apply(b.get(), x.get());
+    exec_solver->apply(d_b.get(), d_x.get());
+
+    GKO_ASSERT_MTX_NEAR(d_b, b, 0);
+    GKO_ASSERT_MTX_NEAR(d_x, x, r<value_type>::value * 1e3);
+}
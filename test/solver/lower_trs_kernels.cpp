@@ -365,6 +365,64 @@ TEST_F(LowerTrs, ApplyTriangularSparseMtxUnitDiagMultipleRhsIsEquivalentToRef)
 }
 
 
+TEST_F(LowerTrs, ApplyTriangularLargeSparseMtxIsEquivalentToRef)
+{
+    initialize_data(1000, 1, 5);
+    mtx_l = gko::test::generate_random_lower_triangular_matrix<mtx_type>(
+        1000, true, std::uniform_int_distribution<>(1, 5),
+        std::uniform_real_distribution<>(-0.2, 0.2), rand_engine, ref);
+    dmtx_l = gko::clone(exec, mtx_l);
+    auto lower_trs_factory = solver_type::build().on(ref);
+    auto d_lower_trs_factory = solver_type::build().on(exec);
+    auto solver = lower_trs_factory->generate(mtx_l);
+    auto d_solver = d_lower_trs_factory->generate(dmtx_l);
+
+    solver->apply(b.get(), x.get());
+    d_solver->apply(db.get(), dx.get());
+
+    GKO_ASSERT_MTX_NEAR(dx, x, 1e-14);
+}
+
+
+TEST_F(LowerTrs, SyncfreeApplyTriangularSparseMtxIsEquivalentToRef)
+{
+    initialize_data(50, 1, 5);
+    auto lower_trs_factory = solver_type::build().on(ref);
+    auto d_lower_trs_factory =
+        solver_type::build()
+            .with_algorithm(gko::solver::trisolve_algorithm::syncfree)
+            .on(exec);
+    auto solver = lower_trs_factory->generate(mtx_l);
+    auto d_solver = d_lower_trs_factory->generate(dmtx_l);
+
+    solver->apply(b.get(), x.get());
+    d_solver->apply(db.get(), dx.get());
+
+    GKO_ASSERT_MTX_NEAR(dx, x, 1e-14);
+}
+
+
+TEST_F(LowerTrs, SyncfreeApplyFullSparseMtxUnitDiagMultipleRhsIsEquivalentToRef)
+{
+    initialize_data(50, 7, 5);
+    auto lower_trs_factory =
+        solver_type::build().with_num_rhs(7u).with_unit_diagonal(true).on(ref);
+    auto d_lower_trs_factory =
+        solver_type::build()
+            .with_num_rhs(7u)
+            .with_unit_diagonal(true)
+            .with_algorithm(gko::solver::trisolve_algorithm::syncfree)
+            .on(exec);
+    auto solver = lower_trs_factory->generate(mtx);
+    auto d_solver = d_lower_trs_factory->generate(dmtx);
+
+    solver->apply(b.get(), x.get());
+    d_solver->apply(db.get(), dx.get());
+
+    GKO_ASSERT_MTX_NEAR(dx, x, 1e-14);
+}
+
+
 #ifdef GKO_COMPILING_CUDA
 
 
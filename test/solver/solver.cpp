@@ -50,10 +50,13 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ginkgo/core/solver/cb_gmres.hpp>
 #include <ginkgo/core/solver/cg.hpp>
 #include <ginkgo/core/solver/cgs.hpp>
+#include <ginkgo/core/solver/chebyshev.hpp>
 #include <ginkgo/core/solver/fcg.hpp>
 #include <ginkgo/core/solver/gmres.hpp>
 #include <ginkgo/core/solver/idr.hpp>
 #include <ginkgo/core/solver/ir.hpp>
+#include <ginkgo/core/solver/pipe_bicgstab.hpp>
+#include <ginkgo/core/solver/pipe_cg.hpp>
 #include <ginkgo/core/solver/triangular.hpp>
 
 
@@ -162,6 +165,23 @@ struct Bicgstab : SimpleSolverTest<gko::solver::Bicgstab<solver_value_type>> {
 };
 
 
+struct PipeCg : SimpleSolverTest<gko::solver::PipeCg<solver_value_type>> {
+    static double tolerance() { return 1e7 * r<value_type>::value; }
+};
+
+
+struct PipeBicgstab
+    : SimpleSolverTest<gko::solver::PipeBicgstab<solver_value_type>> {
+    static double tolerance() { return 1e12 * r<value_type>::value; }
+};
+
+
+struct Chebyshev
+    : SimpleSolverTest<gko::solver::Chebyshev<solver_value_type>> {
+    static double tolerance() { return 1e5 * r<value_type>::value; }
+};
+
+
 template <unsigned dimension>
 struct Idr : SimpleSolverTest<gko::solver::Idr<solver_value_type>> {
     static typename solver_type::parameters_type build(
@@ -852,11 +872,12 @@ protected:
 };
 
 using SolverTypes =
-    ::testing::Types<Cg, Cgs, Fcg, Bicg, Bicgstab,
+    ::testing::Types<Cg, Cgs, Fcg, Bicg, Bicgstab, PipeCg, PipeBicgstab,
                      /* "IDR uses different initialization approaches even when
                         deterministic", Idr<1>, Idr<4>,*/
-                     Ir, CbGmres<2>, CbGmres<10>, Gmres<2>, Gmres<10>, LowerTrs,
-                     UpperTrs, LowerTrsUnitdiag, UpperTrsUnitdiag
+                     Ir, Chebyshev, CbGmres<2>, CbGmres<10>, Gmres<2>,
+                     Gmres<10>, LowerTrs, UpperTrs, LowerTrsUnitdiag,
+                     UpperTrsUnitdiag
 #ifdef GKO_COMPILING_CUDA
                      ,
                      LowerTrsSyncfree, UpperTrsSyncfree,
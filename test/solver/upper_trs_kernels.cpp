@@ -365,6 +365,64 @@ TEST_F(UpperTrs, ApplyTriangularSparseMtxUnitDiagMultipleRhsIsEquivalentToRef)
 }
 
 
+TEST_F(UpperTrs, ApplyTriangularLargeSparseMtxIsEquivalentToRef)
+{
+    initialize_data(1000, 1, 5);
+    mtx_u = gko::test::generate_random_upper_triangular_matrix<mtx_type>(
+        1000, true, std::uniform_int_distribution<>(1, 5),
+        std::uniform_real_distribution<>(-0.2, 0.2), rand_engine, ref);
+    dmtx_u = gko::clone(exec, mtx_u);
+    auto upper_trs_factory = solver_type::build().on(ref);
+    auto d_upper_trs_factory = solver_type::build().on(exec);
+    auto solver = upper_trs_factory->generate(mtx_u);
+    auto d_solver = d_upper_trs_factory->generate(dmtx_u);
+
+    solver->apply(b.get(), x.get());
+    d_solver->apply(db.get(), dx.get());
+
+    GKO_ASSERT_MTX_NEAR(dx, x, 1e-14);
+}
+
+
+TEST_F(UpperTrs, SyncfreeApplyTriangularSparseMtxIsEquivalentToRef)
+{
+    initialize_data(50, 1, 5);
+    auto upper_trs_factory = solver_type::build().on(ref);
+    auto d_upper_trs_factory =
+        solver_type::build()
+            .with_algorithm(gko::solver::trisolve_algorithm::syncfree)
+            .on(exec);
+    auto solver = upper_trs_factory->generate(mtx_u);
+    auto d_solver = d_upper_trs_factory->generate(dmtx_u);
+
+    solver->apply(b.get(), x.get());
+    d_solver->apply(db.get(), dx.get());
+
+    GKO_ASSERT_MTX_NEAR(dx, x, 1e-14);
+}
+
+
+TEST_F(UpperTrs, SyncfreeApplyFullSparseMtxUnitDiagMultipleRhsIsEquivalentToRef)
+{
+    initialize_data(50, 7, 5);
+    auto upper_trs_factory =
+        solver_type::build().with_num_rhs(7u).with_unit_diagonal(true).on(ref);
+    auto d_upper_trs_factory =
+        solver_type::build()
+            .with_num_rhs(7u)
+            .with_unit_diagonal(true)
+            .with_algorithm(gko::solver::trisolve_algorithm::syncfree)
+            .on(exec);
+    auto solver = upper_trs_factory->generate(mtx);
+    auto d_solver = d_upper_trs_factory->generate(dmtx);
+
+    solver->apply(b.get(), x.get());
+    d_solver->apply(db.get(), dx.get());
+
+    GKO_ASSERT_MTX_NEAR(dx, x, 1e-14);
+}
+
+
 #ifdef GKO_COMPILING_CUDA
 
 